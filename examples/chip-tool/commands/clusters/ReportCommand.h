@@ -37,7 +37,7 @@ public:
         CHIP_ERROR error = status.ToChipError();
         if (CHIP_NO_ERROR != error)
         {
-            ReturnOnFailure(RemoteDataModelLogger::LogErrorAsJSON(path, status));
+            ReturnOnFailure(RemoteDataModelLogger::LogErrorAsJSON(this, path, status));
 
             ChipLogError(chipTool, "Response Failure: %s", chip::ErrorStr(error));
             mError = error;
@@ -51,7 +51,7 @@ public:
             return;
         }
 
-        ReturnOnFailure(RemoteDataModelLogger::LogAttributeAsJSON(path, data));
+        ReturnOnFailure(RemoteDataModelLogger::LogAttributeAsJSON(this, path, data));
 
         error = DataModelLogger::LogAttribute(path, data);
         if (CHIP_NO_ERROR != error)
@@ -70,7 +70,7 @@ public:
             CHIP_ERROR error = status->ToChipError();
             if (CHIP_NO_ERROR != error)
             {
-                ReturnOnFailure(RemoteDataModelLogger::LogErrorAsJSON(eventHeader, *status));
+                ReturnOnFailure(RemoteDataModelLogger::LogErrorAsJSON(this, eventHeader, *status));
 
                 ChipLogError(chipTool, "Response Failure: %s", chip::ErrorStr(error));
                 mError = error;
@@ -85,7 +85,7 @@ public:
             return;
         }
 
-        ReturnOnFailure(RemoteDataModelLogger::LogEventAsJSON(eventHeader, data));
+        ReturnOnFailure(RemoteDataModelLogger::LogEventAsJSON(this, eventHeader, data));
 
         CHIP_ERROR error = DataModelLogger::LogEvent(eventHeader, data);
         if (CHIP_NO_ERROR != error)
@@ -33,6 +33,7 @@
 
 std::map<CHIPCommand::CommissionerIdentity, std::unique_ptr<chip::Controller::DeviceCommissioner>> CHIPCommand::mCommissioners;
 std::set<CHIPCommand *> CHIPCommand::sDeferredCleanups;
+std::mutex CHIPCommand::sDeferredCleanupsMutex;
 
 using DeviceControllerFactory = chip::Controller::DeviceControllerFactory;
 
@@ -226,6 +227,7 @@ CHIP_ERROR CHIPCommand::Run()
 
     if (deferCleanup)
     {
+        std::lock_guard<std::mutex> lock(sDeferredCleanupsMutex);
         sDeferredCleanups.insert(this);
     }
     else
@@ -566,9 +568,23 @@ void CHIPCommand::StopWaiting()
 
 void CHIPCommand::ExecuteDeferredCleanups(intptr_t ignored)
 {
+    std::lock_guard<std::mutex> lock(sDeferredCleanupsMutex);
     for (auto * cmd : sDeferredCleanups)
     {
         cmd->Cleanup();
     }
     sDeferredCleanups.clear();
 }
+
+bool CHIPCommand::IsCleanupDeferred(const Command * command)
+{
+    std::lock_guard<std::mutex> lock(sDeferredCleanupsMutex);
+    for (auto * cmd : sDeferredCleanups)
+    {
+        if (cmd == command)
+        {
+            return true;
+        }
+    }
+    return false;
+}
@@ -142,6 +142,9 @@ protected:
     // Execute any deferred cleanups.  Used when exiting interactive mode.
     static void ExecuteDeferredCleanups(intptr_t ignored);
 
+    // Whether the cleanup of the given command has been deferred, i.e. the command object is still in use after its run.
+    static bool IsCleanupDeferred(const Command * command);
+
 #ifdef CONFIG_USE_LOCAL_STORAGE
     PersistentStorage mDefaultStorage;
     // TODO: It's pretty weird that we re-init mCommissionerStorage for every
@@ -200,6 +203,8 @@ private:
 
     static std::map<CommissionerIdentity, std::unique_ptr<ChipDeviceCommissioner>> mCommissioners;
     static std::set<CHIPCommand *> sDeferredCleanups;
+    // Commands run from several threads at once in concurrent interactive server mode.
+    static std::mutex sDeferredCleanupsMutex;
 
     chip::Optional<char *> mCommissionerName;
     chip::Optional<chip::NodeId> mCommissionerNodeId;
@@ -149,7 +149,17 @@ exit:
     return (err == CHIP_NO_ERROR) ? EXIT_SUCCESS : EXIT_FAILURE;
 }
 
-int Commands::RunInteractive(const char * command, const chip::Optional<char *> & storageDirectory)
+std::unique_ptr<Commands> Commands::CreateCopy() const
+{
+    VerifyOrReturnValue(mRegistrar, nullptr);
+
+    auto commands = std::make_unique<Commands>();
+    commands->SetRegistrar(mRegistrar);
+    mRegistrar(*commands);
+    return commands;
+}
+
+int Commands::RunInteractive(const char * command, const chip::Optional<char *> & storageDirectory, const RunObserver & observer)
 {
     std::vector<std::string> arguments;
     VerifyOrReturnValue(DecodeArgumentsFromInteractiveMode(command, arguments), EXIT_FAILURE);
@@ -174,7 +184,7 @@ int Commands::RunInteractive(const char * command, const chip::Optional<char *>
     }
 
     ChipLogProgress(chipTool, "Command: %s", commandStr.c_str());
-    auto err = RunCommand(argc, argv, true, storageDirectory);
+    auto err = RunCommand(argc, argv, true, storageDirectory, observer);
 
     // Do not delete arg[0]
     for (auto i = 1; i < argc; i++)
@@ -186,7 +196,7 @@ int Commands::RunInteractive(const char * command, const chip::Optional<char *>
 }
 
 CHIP_ERROR Commands::RunCommand(int argc, char ** argv, bool interactive,
-                                const chip::Optional<char *> & interactiveStorageDirectory)
+                                const chip::Optional<char *> & interactiveStorageDirectory, const RunObserver & observer)
 {
     Command * command = nullptr;
 
@@ -274,6 +284,10 @@ CHIP_ERROR Commands::RunCommand(int argc, char ** argv, bool interactive,
 
     if (interactive)
     {
+        if (observer)
+        {
+            observer(command);
+        }
         return command->RunAsInteractive(interactiveStorageDirectory);
     }
 
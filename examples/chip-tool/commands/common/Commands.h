@@ -23,22 +23,46 @@
 #endif // CONFIG_USE_LOCAL_STORAGE
 
 #include "Command.h"
+#include <functional>
 #include <map>
 
 class Commands
 {
 public:
     using CommandsVector = ::std::vector<std::unique_ptr<Command>>;
+    using Registrar      = std::function<void(Commands & commands)>;
+    using RunObserver    = std::function<void(Command * command)>;
 
     void Register(const char * clusterName, commands_list commandsList, const char * helpText = nullptr);
     int Run(int argc, char ** argv);
-    int RunInteractive(const char * command, const chip::Optional<char *> & storageDirectory = chip::NullOptional);
+
+    /**
+     * Run a command line in interactive mode. If observer is set, it is called with the command object that is about to run
+     * the command line, once its arguments have been parsed.
+     */
+    int RunInteractive(const char * command, const chip::Optional<char *> & storageDirectory = chip::NullOptional,
+                       const RunObserver & observer = nullptr);
+
+    /**
+     * Set the function that registers all the commands of this instance. It is used by CreateCopy().
+     */
+    void SetRegistrar(Registrar registrar) { mRegistrar = std::move(registrar); }
+
+    /**
+     * Create another instance with the same commands registered, using distinct command objects. A command object holds the
+     * arguments of its run in progress, so running the same command concurrently requires one command object per run.
+     *
+     * Returns nullptr if no registrar has been set.
+     */
+    std::unique_ptr<Commands> CreateCopy() const;
+    bool CanCreateCopy() const { return static_cast<bool>(mRegistrar); }
 
 private:
     using ClusterMap = std::map<std::string, std::pair<CommandsVector, const char *>>;
 
     CHIP_ERROR RunCommand(int argc, char ** argv, bool interactive = false,
-                          const chip::Optional<char *> & interactiveStorageDirectory = chip::NullOptional);
+                          const chip::Optional<char *> & interactiveStorageDirectory = chip::NullOptional,
+                          const RunObserver & observer                               = nullptr);
 
     ClusterMap::iterator GetCluster(std::string clusterName);
     Command * GetCommand(CommandsVector & commands, std::string commandName);
@@ -61,6 +85,7 @@ private:
     static void ShowHelpText(const char * helpText);
 
     ClusterMap mClusters;
+    Registrar mRegistrar;
 #ifdef CONFIG_USE_LOCAL_STORAGE
     PersistentStorage mStorage;
 #endif // CONFIG_USE_LOCAL_STORAGE
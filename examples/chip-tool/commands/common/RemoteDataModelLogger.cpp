@@ -38,7 +38,7 @@ constexpr const char * kIPKKey            = "IPK";
 namespace {
 RemoteDataModelLoggerDelegate * gDelegate;
 
-CHIP_ERROR LogError(Json::Value & value, const chip::app::StatusIB & status)
+CHIP_ERROR LogError(const Command * source, Json::Value & value, const chip::app::StatusIB & status)
 {
     if (status.mClusterStatus.HasValue())
     {
@@ -55,13 +55,14 @@ CHIP_ERROR LogError(Json::Value & value, const chip::app::StatusIB & status)
 #endif // CHIP_CONFIG_IM_STATUS_CODE_VERBOSE_FORMAT
 
     auto valueStr = chip::JsonToString(value);
-    return gDelegate->LogJSON(valueStr.c_str());
+    return gDelegate->LogJSON(source, valueStr.c_str());
 }
 
 } // namespace
 
 namespace RemoteDataModelLogger {
-CHIP_ERROR LogAttributeAsJSON(const chip::app::ConcreteDataAttributePath & path, chip::TLV::TLVReader * data)
+CHIP_ERROR LogAttributeAsJSON(const Command * source, const chip::app::ConcreteDataAttributePath & path,
+                              chip::TLV::TLVReader * data)
 {
     VerifyOrReturnError(gDelegate != nullptr, CHIP_NO_ERROR);
 
@@ -75,10 +76,11 @@ CHIP_ERROR LogAttributeAsJSON(const chip::app::ConcreteDataAttributePath & path,
     ReturnErrorOnFailure(chip::TlvToJson(reader, value));
 
     auto valueStr = chip::JsonToString(value);
-    return gDelegate->LogJSON(valueStr.c_str());
+    return gDelegate->LogJSON(source, valueStr.c_str());
 }
 
-CHIP_ERROR LogErrorAsJSON(const chip::app::ConcreteDataAttributePath & path, const chip::app::StatusIB & status)
+CHIP_ERROR LogErrorAsJSON(const Command * source, const chip::app::ConcreteDataAttributePath & path,
+                          const chip::app::StatusIB & status)
 {
     VerifyOrReturnError(gDelegate != nullptr, CHIP_NO_ERROR);
 
@@ -87,10 +89,10 @@ CHIP_ERROR LogErrorAsJSON(const chip::app::ConcreteDataAttributePath & path, con
     value[kEndpointIdKey]  = path.mEndpointId;
     value[kAttributeIdKey] = path.mAttributeId;
 
-    return LogError(value, status);
+    return LogError(source, value, status);
 }
 
-CHIP_ERROR LogCommandAsJSON(const chip::app::ConcreteCommandPath & path, chip::TLV::TLVReader * data)
+CHIP_ERROR LogCommandAsJSON(const Command * source, const chip::app::ConcreteCommandPath & path, chip::TLV::TLVReader * data)
 {
     VerifyOrReturnError(gDelegate != nullptr, CHIP_NO_ERROR);
 
@@ -104,10 +106,10 @@ CHIP_ERROR LogCommandAsJSON(const chip::app::ConcreteCommandPath & path, chip::T
     ReturnErrorOnFailure(chip::TlvToJson(reader, value));
 
     auto valueStr = chip::JsonToString(value);
-    return gDelegate->LogJSON(valueStr.c_str());
+    return gDelegate->LogJSON(source, valueStr.c_str());
 }
 
-CHIP_ERROR LogErrorAsJSON(const chip::app::ConcreteCommandPath & path, const chip::app::StatusIB & status)
+CHIP_ERROR LogErrorAsJSON(const Command * source, const chip::app::ConcreteCommandPath & path, const chip::app::StatusIB & status)
 {
     VerifyOrReturnError(gDelegate != nullptr, CHIP_NO_ERROR);
 
@@ -116,10 +118,10 @@ CHIP_ERROR LogErrorAsJSON(const chip::app::ConcreteCommandPath & path, const chi
     value[kEndpointIdKey] = path.mEndpointId;
     value[kCommandIdKey]  = path.mCommandId;
 
-    return LogError(value, status);
+    return LogError(source, value, status);
 }
 
-CHIP_ERROR LogEventAsJSON(const chip::app::EventHeader & header, chip::TLV::TLVReader * data)
+CHIP_ERROR LogEventAsJSON(const Command * source, const chip::app::EventHeader & header, chip::TLV::TLVReader * data)
 {
     VerifyOrReturnError(gDelegate != nullptr, CHIP_NO_ERROR);
 
@@ -133,10 +135,10 @@ CHIP_ERROR LogEventAsJSON(const chip::app::EventHeader & header, chip::TLV::TLVR
     ReturnErrorOnFailure(chip::TlvToJson(reader, value));
 
     auto valueStr = chip::JsonToString(value);
-    return gDelegate->LogJSON(valueStr.c_str());
+    return gDelegate->LogJSON(source, valueStr.c_str());
 }
 
-CHIP_ERROR LogErrorAsJSON(const chip::app::EventHeader & header, const chip::app::StatusIB & status)
+CHIP_ERROR LogErrorAsJSON(const Command * source, const chip::app::EventHeader & header, const chip::app::StatusIB & status)
 {
     VerifyOrReturnError(gDelegate != nullptr, CHIP_NO_ERROR);
 
@@ -145,20 +147,20 @@ CHIP_ERROR LogErrorAsJSON(const chip::app::EventHeader & header, const chip::app
     value[kEndpointIdKey] = header.mPath.mEndpointId;
     value[kEventIdKey]    = header.mPath.mEventId;
 
-    return LogError(value, status);
+    return LogError(source, value, status);
 }
 
-CHIP_ERROR LogErrorAsJSON(const CHIP_ERROR & error)
+CHIP_ERROR LogErrorAsJSON(const Command * source, const CHIP_ERROR & error)
 {
     VerifyOrReturnError(gDelegate != nullptr, CHIP_NO_ERROR);
 
     Json::Value value;
     chip::app::StatusIB status;
     status.InitFromChipError(error);
-    return LogError(value, status);
+    return LogError(source, value, status);
 }
 
-CHIP_ERROR LogGetCommissionerNodeId(chip::NodeId value)
+CHIP_ERROR LogGetCommissionerNodeId(const Command * source, chip::NodeId value)
 {
     VerifyOrReturnError(gDelegate != nullptr, CHIP_NO_ERROR);
 
@@ -167,10 +169,10 @@ CHIP_ERROR LogGetCommissionerNodeId(chip::NodeId value)
     rootValue[kValueKey][kNodeIdKey] = value;
 
     auto valueStr = chip::JsonToString(rootValue);
-    return gDelegate->LogJSON(valueStr.c_str());
+    return gDelegate->LogJSON(source, valueStr.c_str());
 }
 
-CHIP_ERROR LogGetCommissionerRootCertificate(const char * value)
+CHIP_ERROR LogGetCommissionerRootCertificate(const Command * source, const char * value)
 {
     VerifyOrReturnError(gDelegate != nullptr, CHIP_NO_ERROR);
 
@@ -179,10 +181,10 @@ CHIP_ERROR LogGetCommissionerRootCertificate(const char * value)
     rootValue[kValueKey][kRCACKey] = value;
 
     auto valueStr = chip::JsonToString(rootValue);
-    return gDelegate->LogJSON(valueStr.c_str());
+    return gDelegate->LogJSON(source, valueStr.c_str());
 }
 
-CHIP_ERROR LogIssueNOCChain(const char * noc, const char * icac, const char * rcac, const char * ipk)
+CHIP_ERROR LogIssueNOCChain(const Command * source, const char * noc, const char * icac, const char * rcac, const char * ipk)
 {
     VerifyOrReturnError(gDelegate != nullptr, CHIP_NO_ERROR);
 
@@ -194,10 +196,10 @@ CHIP_ERROR LogIssueNOCChain(const char * noc, const char * icac, const char * rc
     rootValue[kValueKey][kIPKKey]  = ipk;
 
     auto valueStr = chip::JsonToString(rootValue);
-    return gDelegate->LogJSON(valueStr.c_str());
+    return gDelegate->LogJSON(source, valueStr.c_str());
 }
 
-CHIP_ERROR LogDiscoveredNodeData(const chip::Dnssd::DiscoveredNodeData & nodeData)
+CHIP_ERROR LogDiscoveredNodeData(const Command * source, const chip::Dnssd::DiscoveredNodeData & nodeData)
 {
     VerifyOrReturnError(gDelegate != nullptr, CHIP_NO_ERROR);
 
@@ -252,7 +254,7 @@ CHIP_ERROR LogDiscoveredNodeData(const chip::Dnssd::DiscoveredNodeData & nodeDat
     rootValue[kValueKey] = value;
 
     auto valueStr = chip::JsonToString(rootValue);
-    return gDelegate->LogJSON(valueStr.c_str());
+    return gDelegate->LogJSON(source, valueStr.c_str());
 }
 
 void SetDelegate(RemoteDataModelLoggerDelegate * delegate)
@@ -25,24 +25,29 @@
 #include <crypto/CHIPCryptoPAL.h>
 #include <lib/dnssd/Resolver.h>
 
+class Command;
+
+// The source argument is the command that produced the value, so results can be attributed to the request that ran it.
 class RemoteDataModelLoggerDelegate
 {
 public:
-    CHIP_ERROR virtual LogJSON(const char *) = 0;
+    CHIP_ERROR virtual LogJSON(const Command * source, const char * json) = 0;
     virtual ~RemoteDataModelLoggerDelegate(){};
 };
 
 namespace RemoteDataModelLogger {
-CHIP_ERROR LogAttributeAsJSON(const chip::app::ConcreteDataAttributePath & path, chip::TLV::TLVReader * data);
-CHIP_ERROR LogErrorAsJSON(const chip::app::ConcreteDataAttributePath & path, const chip::app::StatusIB & status);
-CHIP_ERROR LogCommandAsJSON(const chip::app::ConcreteCommandPath & path, chip::TLV::TLVReader * data);
-CHIP_ERROR LogErrorAsJSON(const chip::app::ConcreteCommandPath & path, const chip::app::StatusIB & status);
-CHIP_ERROR LogEventAsJSON(const chip::app::EventHeader & header, chip::TLV::TLVReader * data);
-CHIP_ERROR LogErrorAsJSON(const chip::app::EventHeader & header, const chip::app::StatusIB & status);
-CHIP_ERROR LogErrorAsJSON(const CHIP_ERROR & error);
-CHIP_ERROR LogGetCommissionerNodeId(chip::NodeId value);
-CHIP_ERROR LogGetCommissionerRootCertificate(const char * value);
-CHIP_ERROR LogIssueNOCChain(const char * noc, const char * icac, const char * rcac, const char * ipk);
-CHIP_ERROR LogDiscoveredNodeData(const chip::Dnssd::DiscoveredNodeData & nodeData);
+CHIP_ERROR LogAttributeAsJSON(const Command * source, const chip::app::ConcreteDataAttributePath & path,
+                              chip::TLV::TLVReader * data);
+CHIP_ERROR LogErrorAsJSON(const Command * source, const chip::app::ConcreteDataAttributePath & path,
+                          const chip::app::StatusIB & status);
+CHIP_ERROR LogCommandAsJSON(const Command * source, const chip::app::ConcreteCommandPath & path, chip::TLV::TLVReader * data);
+CHIP_ERROR LogErrorAsJSON(const Command * source, const chip::app::ConcreteCommandPath & path, const chip::app::StatusIB & status);
+CHIP_ERROR LogEventAsJSON(const Command * source, const chip::app::EventHeader & header, chip::TLV::TLVReader * data);
+CHIP_ERROR LogErrorAsJSON(const Command * source, const chip::app::EventHeader & header, const chip::app::StatusIB & status);
+CHIP_ERROR LogErrorAsJSON(const Command * source, const CHIP_ERROR & error);
+CHIP_ERROR LogGetCommissionerNodeId(const Command * source, chip::NodeId value);
+CHIP_ERROR LogGetCommissionerRootCertificate(const Command * source, const char * value);
+CHIP_ERROR LogIssueNOCChain(const Command * source, const char * noc, const char * icac, const char * rcac, const char * ipk);
+CHIP_ERROR LogDiscoveredNodeData(const Command * source, const chip::Dnssd::DiscoveredNodeData & nodeData);
 void SetDelegate(RemoteDataModelLoggerDelegate * delegate);
 }; // namespace RemoteDataModelLogger
@@ -26,7 +26,7 @@ using namespace ::chip;
 void DiscoverCommissionablesCommandBase::OnDiscoveredDevice(const chip::Dnssd::DiscoveredNodeData & nodeData)
 {
     nodeData.LogDetail();
-    LogErrorOnFailure(RemoteDataModelLogger::LogDiscoveredNodeData(nodeData));
+    LogErrorOnFailure(RemoteDataModelLogger::LogDiscoveredNodeData(this, nodeData));
 
     if (mDiscoverOnce.ValueOr(true))
     {
@@ -22,12 +22,15 @@
 
 #include <editline.h>
 
+#include <algorithm>
+
 constexpr const char * kInteractiveModePrompt          = ">>> ";
 constexpr const char * kInteractiveModeHistoryFilePath = "/tmp/chip_tool_history";
 constexpr const char * kInteractiveModeStopCommand     = "quit()";
 constexpr const char * kCategoryError                  = "Error";
 constexpr const char * kCategoryProgress               = "Info";
 constexpr const char * kCategoryDetail                 = "Debug";
+constexpr size_t kMaxRequestIdLength                   = 64;
 
 namespace {
 
@@ -61,11 +64,15 @@ struct InteractiveServerResultLog
     std::string messageType;
 };
 
+} // namespace
+
 struct InteractiveServerResult
 {
     bool mEnabled       = false;
     bool mIsAsyncReport = false;
     int mStatus         = EXIT_SUCCESS;
+    // The request id in concurrent mode, empty otherwise.
+    std::string mId;
     std::vector<std::string> mResults;
     std::vector<InteractiveServerResultLog> mLogs;
 
@@ -141,12 +148,29 @@ struct InteractiveServerResult
         mLogs.push_back(InteractiveServerResultLog({ module, base64Message, messageType }));
     }
 
-    void MaybeAddResult(const char * result)
+    bool MaybeAddResult(const char * result)
     {
         auto lock = ScopedLock(mMutex);
-        VerifyOrReturn(mEnabled);
+        VerifyOrReturnValue(mEnabled, false);
 
         mResults.push_back(result);
+        return true;
+    }
+
+    // Stop collecting results and logs, and return the ones collected so far.
+    std::string Finish()
+    {
+        {
+            auto lock = ScopedLock(mMutex);
+            mEnabled  = false;
+        }
+
+        auto jsonLog = AsJsonString();
+
+        auto lock = ScopedLock(mMutex);
+        mResults.clear();
+        mLogs.clear();
+        return jsonLog;
     }
 
     std::string AsJsonString()
@@ -192,6 +216,10 @@ struct InteractiveServerResult
 
         std::string jsonLog;
         jsonLog = jsonLog + "{";
+        if (mId.size())
+        {
+            jsonLog = jsonLog + "  \"id\": \"" + mId + "\",";
+        }
         jsonLog = jsonLog + "  \"results\": [" + resultsStr + "],";
         jsonLog = jsonLog + "  \"logs\": [" + logsStr + "]";
         jsonLog = jsonLog + "}";
@@ -200,8 +228,25 @@ struct InteractiveServerResult
     }
 };
 
+namespace {
+
 InteractiveServerResult gInteractiveServerResult;
 
+// The result of the request run by the current thread, in concurrent mode.
+thread_local InteractiveServerResult * gWorkerResult = nullptr;
+
+// Request ids are echoed in the JSON responses, so they are restricted to characters that do not need escaping.
+bool IsValidRequestId(const char * id, size_t length)
+{
+    VerifyOrReturnValue(length > 0 && length <= kMaxRequestIdLength, false);
+
+    for (size_t i = 0; i < length; i++)
+    {
+        VerifyOrReturnValue(isalnum(id[i]) || id[i] == '-' || id[i] == '_' || id[i] == '.' || id[i] == ':', false);
+    }
+    return true;
+}
+
 void ENFORCE_FORMAT(3, 0) InteractiveServerLoggingCallback(const char * module, uint8_t category, const char * msg, va_list args)
 {
     va_list args_copy;
@@ -217,6 +262,10 @@ void ENFORCE_FORMAT(3, 0) InteractiveServerLoggingCallback(const char * module,
     chip::Base64Encode(chip::Uint8::from_char(message), static_cast<uint16_t>(strlen(message)), base64Message);
 
     gInteractiveServerResult.MaybeAddLog(module, category, base64Message);
+    if (gWorkerResult != nullptr)
+    {
+        gWorkerResult->MaybeAddLog(module, category, base64Message);
+    }
 }
 
 char * GetCommand(char * command)
@@ -247,7 +296,14 @@ CHIP_ERROR InteractiveServerCommand::RunCommand()
     chip::Logging::SetLogRedirectCallback(InteractiveServerLoggingCallback);
 
     RemoteDataModelLogger::SetDelegate(this);
-    ReturnErrorOnFailure(mWebSocketServer.Run(mPort, this));
+
+    CHIP_ERROR err = StartWorkers();
+    if (err == CHIP_NO_ERROR)
+    {
+        err = mWebSocketServer.Run(mPort, this);
+    }
+    StopWorkers();
+    ReturnErrorOnFailure(err);
 
     gInteractiveServerResult.Reset();
     SetCommandExitStatus(CHIP_NO_ERROR);
@@ -256,6 +312,11 @@ CHIP_ERROR InteractiveServerCommand::RunCommand()
 
 bool InteractiveServerCommand::OnWebSocketMessageReceived(char * msg)
 {
+    if (IsConcurrent())
+    {
+        return EnqueueRequest(msg);
+    }
+
     bool isAsyncReport = strlen(msg) == 0;
     gInteractiveServerResult.Setup(isAsyncReport);
     VerifyOrReturnValue(!isAsyncReport, true);
@@ -266,8 +327,35 @@ bool InteractiveServerCommand::OnWebSocketMessageReceived(char * msg)
     return shouldStop;
 }
 
-CHIP_ERROR InteractiveServerCommand::LogJSON(const char * json)
+CHIP_ERROR InteractiveServerCommand::LogJSON(const Command * source, const char * json)
 {
+    if (IsConcurrent())
+    {
+        // Hold the lock while sending, so a report that comes in after its request completed is never sent before the
+        // response to the request.
+        std::lock_guard<std::mutex> lock(mRequestsMutex);
+
+        // The command objects of a request are its own, so the request that ran the source is the one the value belongs to.
+        auto it = std::find_if(mActiveRequests.begin(), mActiveRequests.end(),
+                               [source](const auto & request) { return request.second.mCommand == source; });
+        if (it == mActiveRequests.end())
+        {
+            ChipLogError(chipTool, "Dropping a result that does not belong to any request.");
+            return CHIP_NO_ERROR;
+        }
+
+        auto & result = it->second.mResult;
+        if (!result->MaybeAddResult(json))
+        {
+            InteractiveServerResult report;
+            report.mId = it->first;
+            report.Setup(true /* isAsyncReport */);
+            report.MaybeAddResult(json);
+            mWebSocketServer.Send(report.AsJsonString().c_str());
+        }
+        return CHIP_NO_ERROR;
+    }
+
     gInteractiveServerResult.MaybeAddResult(json);
     if (gInteractiveServerResult.IsAsyncReport())
     {
@@ -277,6 +365,152 @@ CHIP_ERROR InteractiveServerCommand::LogJSON(const char * json)
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR InteractiveServerCommand::StartWorkers()
+{
+    VerifyOrReturnError(IsConcurrent(), CHIP_NO_ERROR);
+
+    {
+        std::lock_guard<std::mutex> lock(mRequestsMutex);
+        mStopping = false;
+    }
+
+    // Each request runs on a copy of the commands this command has been registered with.
+    VerifyOrReturnError(mHandler->CanCreateCopy(), CHIP_ERROR_NOT_IMPLEMENTED,
+                        ChipLogError(chipTool, "Concurrent mode is not supported by this tool."));
+
+    auto concurrency = mConcurrency.Value();
+    for (uint16_t i = 0; i < concurrency; i++)
+    {
+        mWorkers.emplace_back(&InteractiveServerCommand::RunWorker, this);
+    }
+
+    ChipLogProgress(chipTool, "Running up to %u commands concurrently.", concurrency);
+    return CHIP_NO_ERROR;
+}
+
+void InteractiveServerCommand::StopWorkers()
+{
+    {
+        std::lock_guard<std::mutex> lock(mRequestsMutex);
+        mStopping = true;
+    }
+    mRequestsCondition.notify_all();
+
+    // The workers run the pending requests before they stop.
+    for (auto & worker : mWorkers)
+    {
+        worker.join();
+    }
+    mWorkers.clear();
+
+    // The command objects of the requests whose cleanup is deferred are kept until this command goes away, since the deferred
+    // cleanup uses them.
+}
+
+void InteractiveServerCommand::RunWorker()
+{
+    while (true)
+    {
+        Request request;
+        {
+            std::unique_lock<std::mutex> lock(mRequestsMutex);
+            mRequestsCondition.wait(lock, [this] { return mStopping || !mPendingRequests.empty(); });
+            VerifyOrReturn(!mPendingRequests.empty());
+
+            request = std::move(mPendingRequests.front());
+            mPendingRequests.pop_front();
+        }
+
+        auto & result          = request.mResult;
+        const std::string & id = result->mId;
+
+        auto commands = mHandler->CreateCopy();
+        VerifyOrDie(commands != nullptr);
+        auto * requestCommands = commands.get();
+        {
+            std::lock_guard<std::mutex> lock(mRequestsMutex);
+            mActiveRequests[id].mCommands = std::move(commands);
+        }
+
+        auto observer = [this, &id](Command * command) {
+            std::lock_guard<std::mutex> lock(mRequestsMutex);
+            mActiveRequests[id].mCommand = command;
+        };
+
+        gWorkerResult = result.get();
+        auto status   = requestCommands->RunInteractive(request.mCommand.c_str(), GetStorageDirectory(), observer);
+        gWorkerResult = nullptr;
+
+        const Command * command = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(mRequestsMutex);
+            result->mStatus = status;
+            mWebSocketServer.Send(result->Finish().c_str());
+            command = mActiveRequests[id].mCommand;
+        }
+
+        // A command whose cleanup is deferred keeps producing values for its request, e.g. subscription reports. The deferred
+        // cleanups lock their own mutex and may log values, so this is checked without holding mRequestsMutex.
+        if (command != nullptr && CHIPCommand::IsCleanupDeferred(command))
+        {
+            continue;
+        }
+
+        // The command objects are released once the lock is released.
+        std::unique_ptr<Commands> completed;
+        {
+            std::lock_guard<std::mutex> lock(mRequestsMutex);
+            auto it   = mActiveRequests.find(id);
+            completed = std::move(it->second.mCommands);
+            mActiveRequests.erase(it);
+        }
+    }
+}
+
+bool InteractiveServerCommand::EnqueueRequest(char * msg)
+{
+    // Reports are sent as soon as they are received in concurrent mode, so there is nothing to wait for.
+    VerifyOrReturnValue(strlen(msg) != 0, true);
+
+    // The request id is everything up to the first space, and the command everything after it.
+    char * separator = strchr(msg, ' ');
+    char * command   = (separator != nullptr) ? separator + 1 : msg;
+
+    if (strcmp(command, kInteractiveModeStopCommand) == 0)
+    {
+        StopWorkers();
+        int status;
+        return ParseCommand(command, &status);
+    }
+
+    auto result = std::make_shared<InteractiveServerResult>();
+    if (separator == nullptr || !IsValidRequestId(msg, static_cast<size_t>(separator - msg)))
+    {
+        ChipLogError(chipTool, "Expected '<request id> <command>', where the request id is made of [A-Za-z0-9_.:-].");
+        result->mStatus = EXIT_FAILURE;
+        mWebSocketServer.Send(result->AsJsonString().c_str());
+        return true;
+    }
+    result->mId.assign(msg, static_cast<size_t>(separator - msg));
+
+    {
+        std::lock_guard<std::mutex> lock(mRequestsMutex);
+        if (mActiveRequests.find(result->mId) != mActiveRequests.end())
+        {
+            ChipLogError(chipTool, "Request id '%s' is already in use.", result->mId.c_str());
+            result->mStatus = EXIT_FAILURE;
+            mWebSocketServer.Send(result->AsJsonString().c_str());
+            return true;
+        }
+
+        result->Setup(false /* isAsyncReport */);
+        mActiveRequests[result->mId].mResult = result;
+        mPendingRequests.push_back({ command, std::move(result) });
+    }
+    mRequestsCondition.notify_one();
+    return true;
+}
+
 CHIP_ERROR InteractiveStartCommand::RunCommand()
 {
     read_history(kInteractiveModeHistoryFilePath);
@@ -24,6 +24,15 @@
 
 #include <websocket-server/WebSocketServer.h>
 
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
 class Commands;
 
 class InteractiveCommand : public CHIPCommand
@@ -42,8 +51,10 @@ public:
 
     bool ParseCommand(char * command, int * status);
 
-private:
+protected:
     Commands * mHandler = nullptr;
+
+private:
     chip::Optional<bool> mAdvertiseOperational;
 };
 
@@ -58,6 +69,19 @@ public:
     CHIP_ERROR RunCommand() override;
 };
 
+struct InteractiveServerResult;
+
+/**
+ * By default, the server runs the commands it receives one at a time: it blocks until a command completes before reading the
+ * next message, and answers with { "results": [...], "logs": [...] }.
+ *
+ * With --concurrency N (N > 1), each message is "<request id> <command>" and up to N commands run at the same time on the shared
+ * commissioners, each on a command object of its own. The server keeps reading messages while commands run, and answers each
+ * request with { "id": "<request id>", "results": [...], "logs": [...] } as soon as it completes, so responses may come out of
+ * order. Reports received after a request completed (e.g. subscription reports) are sent right away, tagged with the id of the
+ * request that ran the command; such a request keeps its id until interactive mode is left. Only the logs emitted by the thread
+ * running a request are returned with it.
+ */
 class InteractiveServerCommand : public InteractiveCommand, public WebSocketServerDelegate, public RemoteDataModelLoggerDelegate
 {
 public:
@@ -65,6 +89,9 @@ public:
         InteractiveCommand("server", commandsHandler, credsIssuerConfig)
     {
         AddArgument("port", 0, UINT16_MAX, &mPort, "Port the websocket will listen to. Defaults to 9002.");
+        AddArgument("concurrency", 1, kMaxConcurrency, &mConcurrency,
+                    "Number of commands that can run at the same time. When greater than 1, each message has to be prefixed with a "
+                    "request id, which is echoed in its response. Defaults to 1.");
     }
 
     /////////// CHIPCommand Interface /////////
@@ -74,9 +101,43 @@ public:
     bool OnWebSocketMessageReceived(char * msg) override;
 
     /////////// RemoteDataModelLoggerDelegate interface /////////
-    CHIP_ERROR LogJSON(const char * json) override;
+    CHIP_ERROR LogJSON(const Command * source, const char * json) override;
 
 private:
+    static constexpr uint16_t kMaxConcurrency = 64;
+
+    struct Request
+    {
+        std::string mCommand;
+        std::shared_ptr<InteractiveServerResult> mResult;
+    };
+
+    struct ActiveRequest
+    {
+        // Each request runs on command objects of its own, so that the same command can run concurrently and the values a
+        // command object logs belong to a single request.
+        std::unique_ptr<Commands> mCommands;
+        const Command * mCommand = nullptr;
+        std::shared_ptr<InteractiveServerResult> mResult;
+    };
+
+    bool IsConcurrent() const { return mConcurrency.ValueOr(1) > 1; }
+    CHIP_ERROR StartWorkers();
+    void StopWorkers();
+    void RunWorker();
+    bool EnqueueRequest(char * msg);
+
     WebSocketServer mWebSocketServer;
     chip::Optional<uint16_t> mPort;
+    chip::Optional<uint16_t> mConcurrency;
+
+    std::vector<std::thread> mWorkers;
+
+    std::mutex mRequestsMutex;
+    std::condition_variable mRequestsCondition;
+    std::deque<Request> mPendingRequests;
+    bool mStopping = false;
+    // Requests that are pending or running, and the completed ones whose command keeps producing values (e.g. subscriptions),
+    // by request id. The command objects of a request are released when it completes, unless its cleanup is deferred.
+    std::unordered_map<std::string, ActiveRequest> mActiveRequests;
 };
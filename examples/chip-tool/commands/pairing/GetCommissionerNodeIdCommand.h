@@ -34,7 +34,7 @@ public:
         ReturnErrorOnFailure(GetIdentityNodeId(GetIdentity(), &id));
         ChipLogProgress(chipTool, "Commissioner Node Id 0x:" ChipLogFormatX64, ChipLogValueX64(id));
 
-        ReturnErrorOnFailure(RemoteDataModelLogger::LogGetCommissionerNodeId(id));
+        ReturnErrorOnFailure(RemoteDataModelLogger::LogGetCommissionerNodeId(this, id));
         SetCommandExitStatus(CHIP_NO_ERROR);
         return CHIP_NO_ERROR;
     }
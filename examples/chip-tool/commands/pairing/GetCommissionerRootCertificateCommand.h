@@ -40,7 +40,7 @@ public:
         ReturnErrorOnFailure(ToTLVCert(span, rcac));
         ChipLogProgress(chipTool, "RCAC: %s", rcac.c_str());
 
-        ReturnErrorOnFailure(RemoteDataModelLogger::LogGetCommissionerRootCertificate(rcac.c_str()));
+        ReturnErrorOnFailure(RemoteDataModelLogger::LogGetCommissionerRootCertificate(this, rcac.c_str()));
 
         SetCommandExitStatus(CHIP_NO_ERROR);
         return CHIP_NO_ERROR;
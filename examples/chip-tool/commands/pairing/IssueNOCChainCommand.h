@@ -75,7 +75,7 @@ public:
         VerifyOrReturn(CHIP_NO_ERROR == err, command->SetCommandExitStatus(err));
         ChipLogProgress(chipTool, "IPK: %s", ipkStr.c_str());
 
-        err = RemoteDataModelLogger::LogIssueNOCChain(nocStr.c_str(), icacStr.c_str(), rcacStr.c_str(), ipkStr.c_str());
+        err = RemoteDataModelLogger::LogIssueNOCChain(command, nocStr.c_str(), icacStr.c_str(), rcacStr.c_str(), ipkStr.c_str());
         command->SetCommandExitStatus(err);
     }
 
@@ -35,21 +35,27 @@
 // ================================================================================
 // Main Code
 // ================================================================================
+void registerCommands(Commands & commands, CredentialIssuerCommands * credIssuerCommands)
+{
+    registerCommandsDelay(commands, credIssuerCommands);
+    registerCommandsDiscover(commands, credIssuerCommands);
+    registerCommandsInteractive(commands, credIssuerCommands);
+    registerCommandsPayload(commands);
+    registerCommandsPairing(commands, credIssuerCommands);
+    registerCommandsTests(commands, credIssuerCommands);
+    registerCommandsGroup(commands, credIssuerCommands);
+    registerClusters(commands, credIssuerCommands);
+    registerCommandsSubscriptions(commands, credIssuerCommands);
+    registerCommandsStorage(commands);
+    registerCommandsSessionManagement(commands, credIssuerCommands);
+}
+
 int main(int argc, char * argv[])
 {
     ExampleCredentialIssuerCommands credIssuerCommands;
     Commands commands;
-    registerCommandsDelay(commands, &credIssuerCommands);
-    registerCommandsDiscover(commands, &credIssuerCommands);
-    registerCommandsInteractive(commands, &credIssuerCommands);
-    registerCommandsPayload(commands);
-    registerCommandsPairing(commands, &credIssuerCommands);
-    registerCommandsTests(commands, &credIssuerCommands);
-    registerCommandsGroup(commands, &credIssuerCommands);
-    registerClusters(commands, &credIssuerCommands);
-    registerCommandsSubscriptions(commands, &credIssuerCommands);
-    registerCommandsStorage(commands);
-    registerCommandsSessionManagement(commands, &credIssuerCommands);
+    commands.SetRegistrar([&credIssuerCommands](Commands & registry) { registerCommands(registry, &credIssuerCommands); });
+    registerCommands(commands, &credIssuerCommands);
 
     return commands.Run(argc, argv);
 }
@@ -31,10 +31,13 @@ namespace {
 lws * gWebSocketInstance = nullptr;
 std::deque<std::string> gMessageQueue;
 
-// This mutex protect the global gMessageQueue instance such that messages
+// This mutex protect the global gMessageQueue and gWebSocketContext instances such that messages
 // can be added/removed from multiple threads.
 std::mutex gMutex;
 
+// Used to wake up the service loop when a message is queued from another thread.
+lws_context * gWebSocketContext = nullptr;
+
 void LogWebSocketCallbackReason(lws_callback_reasons reason)
 {
 #if CHIP_DETAIL_LOGGING
@@ -173,6 +176,11 @@ CHIP_ERROR WebSocketServer::Run(chip::Optional<uint16_t> port, WebSocketServerDe
     auto context = lws_create_context(&info);
     VerifyOrReturnError(nullptr != context, CHIP_ERROR_INTERNAL);
 
+    {
+        std::lock_guard<std::mutex> lock(gMutex);
+        gWebSocketContext = context;
+    }
+
     mRunning  = true;
     mDelegate = delegate;
 
@@ -186,6 +194,11 @@ CHIP_ERROR WebSocketServer::Run(chip::Optional<uint16_t> port, WebSocketServerDe
             lws_callback_on_writable(gWebSocketInstance);
         }
     }
+
+    {
+        std::lock_guard<std::mutex> lock(gMutex);
+        gWebSocketContext = nullptr;
+    }
     lws_context_destroy(context);
     return CHIP_NO_ERROR;
 }
@@ -204,4 +217,11 @@ void WebSocketServer::Send(const char * msg)
 {
     std::lock_guard<std::mutex> lock(gMutex);
     gMessageQueue.push_back(msg);
+
+    // lws_cancel_service is safe to call from any thread. It makes lws_service return so the message gets written even when
+    // it is queued while no other event is pending.
+    if (gWebSocketContext != nullptr)
+    {
+        lws_cancel_service(gWebSocketContext);
+    }
 }
@@ -98,8 +98,8 @@ chip::DeviceLayer::DeviceInfoProviderImpl gExampleDeviceInfoProvider;
 // Define a custom attribute persister which makes actual write of the CurrentLevel attribute value
 // to the non-volatile storage only when it has remained constant for 5 seconds. This is to reduce
 // the flash wearout when the attribute changes frequently as a result of MoveToLevel command.
-// DeferredAttribute object describes a deferred attribute, but also holds a buffer with a value to
-// be written, so it must live so long as the DeferredAttributePersistenceProvider object.
+// DeferredAttribute object describes a deferred attribute, so it must live so long as the
+// DeferredAttributePersistenceProvider object.
 DeferredAttribute gCurrentLevelPersister(ConcreteAttributePath(kLightEndpointId, Clusters::LevelControl::Id,
                                                                Clusters::LevelControl::Attributes::CurrentLevel::Id));
 DeferredAttributePersistenceProvider gDeferredAttributePersister(Server::GetInstance().GetDefaultAttributePersister(),
@@ -93,6 +93,10 @@ void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & ev
                 // After sending the StatusReport, exchange context gets closed so, set mExchangeCtx to null
                 mExchangeCtx = nullptr;
             }
+            else
+            {
+                ContinueAsyncTransfer();
+            }
         }
         else
         {
@@ -106,8 +110,14 @@ void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & ev
         // TransferSession will automatically reject a transfer if there are no
         // common supported control modes. It will also default to the smaller
         // block size.
+        // OTA must use receiver drive on transports that require MRP: Async mode keeps several Blocks in flight on the
+        // exchange, which MRP does not allow. Async mode is only used when the requestor offers it over a transport without MRP.
+        chip::BitFlags<TransferControlFlags> proposedModes(event.transferInitData.TransferCtlFlags);
+        bool useAsync = proposedModes.Has(TransferControlFlags::kAsync) && mExchangeCtx != nullptr &&
+            !mExchangeCtx->GetSessionHandle()->RequireMRP();
+
         TransferSession::TransferAcceptData acceptData;
-        acceptData.ControlMode  = TransferControlFlags::kReceiverDrive; // OTA must use receiver drive
+        acceptData.ControlMode  = useAsync ? TransferControlFlags::kAsync : TransferControlFlags::kReceiverDrive;
         acceptData.MaxBlockSize = mTransfer.GetTransferBlockSize();
         acceptData.StartOffset  = mTransfer.GetStartOffset();
         acceptData.Length       = mTransfer.GetTransferLength();
@@ -124,59 +134,11 @@ void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & ev
 
         break;
     }
-    case TransferSession::OutputEventType::kQueryReceived: {
-        TransferSession::BlockData blockData;
-        uint16_t blockSize   = mTransfer.GetTransferBlockSize();
-        uint16_t bytesToRead = blockSize;
-
-        // TODO: This should be a utility function in TransferSession
-        if (mTransfer.GetTransferLength() > 0 && mNumBytesSent + blockSize > mTransfer.GetTransferLength())
-        {
-            // cast should be safe because of condition above
-            bytesToRead = static_cast<uint16_t>(mTransfer.GetTransferLength() - mNumBytesSent);
-        }
-
-        chip::System::PacketBufferHandle blockBuf = chip::System::PacketBufferHandle::New(bytesToRead);
-        if (blockBuf.IsNull())
-        {
-            // TODO(#13981): AbortTransfer() needs to support GeneralStatusCode failures as well as BDX specific errors.
-            mTransfer.AbortTransfer(StatusCode::kUnknown);
-            return;
-        }
-
-        std::ifstream otaFile(mFileDesignator, std::ifstream::in);
-        if (!otaFile.good())
-        {
-            ChipLogError(BDX, "OTA file open failed");
-            mTransfer.AbortTransfer(StatusCode::kFileDesignatorUnknown);
-            return;
-        }
-
-        otaFile.seekg(mNumBytesSent);
-        otaFile.read(reinterpret_cast<char *>(blockBuf->Start()), bytesToRead);
-        if (!(otaFile.good() || otaFile.eof()))
-        {
-            ChipLogError(BDX, "OTA file read failed");
-            mTransfer.AbortTransfer(StatusCode::kFileDesignatorUnknown);
-            return;
-        }
-
-        blockData.Data   = blockBuf->Start();
-        blockData.Length = static_cast<size_t>(otaFile.gcount());
-        blockData.IsEof  = (blockData.Length < blockSize) ||
-            (mNumBytesSent + static_cast<uint64_t>(blockData.Length) == mTransfer.GetTransferLength() || (otaFile.peek() == EOF));
-        mNumBytesSent = static_cast<uint32_t>(mNumBytesSent + blockData.Length);
-        otaFile.close();
-
-        err = mTransfer.PrepareBlock(blockData);
-        if (err != CHIP_NO_ERROR)
-        {
-            ChipLogError(BDX, "PrepareBlock failed: %" CHIP_ERROR_FORMAT, err.Format());
-            mTransfer.AbortTransfer(StatusCode::kUnknown);
-        }
+    case TransferSession::OutputEventType::kQueryReceived:
+        PrepareNextBlock();
         break;
-    }
     case TransferSession::OutputEventType::kAckReceived:
+        ContinueAsyncTransfer();
         break;
     case TransferSession::OutputEventType::kAckEOFReceived:
         ChipLogDetail(BDX, "Transfer completed, got AckEOF");
@@ -203,6 +165,67 @@ void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & ev
     }
 }
 
+void BdxOtaSender::PrepareNextBlock()
+{
+    TransferSession::BlockData blockData;
+    uint16_t blockSize   = mTransfer.GetTransferBlockSize();
+    uint16_t bytesToRead = blockSize;
+
+    // TODO: This should be a utility function in TransferSession
+    if (mTransfer.GetTransferLength() > 0 && mNumBytesSent + blockSize > mTransfer.GetTransferLength())
+    {
+        // cast should be safe because of condition above
+        bytesToRead = static_cast<uint16_t>(mTransfer.GetTransferLength() - mNumBytesSent);
+    }
+
+    chip::System::PacketBufferHandle blockBuf = chip::System::PacketBufferHandle::New(bytesToRead);
+    if (blockBuf.IsNull())
+    {
+        // TODO(#13981): AbortTransfer() needs to support GeneralStatusCode failures as well as BDX specific errors.
+        mTransfer.AbortTransfer(StatusCode::kUnknown);
+        return;
+    }
+
+    std::ifstream otaFile(mFileDesignator, std::ifstream::in);
+    if (!otaFile.good())
+    {
+        ChipLogError(BDX, "OTA file open failed");
+        mTransfer.AbortTransfer(StatusCode::kFileDesignatorUnknown);
+        return;
+    }
+
+    otaFile.seekg(mNumBytesSent);
+    otaFile.read(reinterpret_cast<char *>(blockBuf->Start()), bytesToRead);
+    if (!(otaFile.good() || otaFile.eof()))
+    {
+        ChipLogError(BDX, "OTA file read failed");
+        mTransfer.AbortTransfer(StatusCode::kFileDesignatorUnknown);
+        return;
+    }
+
+    blockData.Data   = blockBuf->Start();
+    blockData.Length = static_cast<size_t>(otaFile.gcount());
+    blockData.IsEof  = (blockData.Length < blockSize) ||
+        (mNumBytesSent + static_cast<uint64_t>(blockData.Length) == mTransfer.GetTransferLength() || (otaFile.peek() == EOF));
+    mNumBytesSent = static_cast<uint32_t>(mNumBytesSent + blockData.Length);
+    otaFile.close();
+
+    CHIP_ERROR err = mTransfer.PrepareBlock(blockData);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(BDX, "PrepareBlock failed: %" CHIP_ERROR_FORMAT, err.Format());
+        mTransfer.AbortTransfer(StatusCode::kUnknown);
+    }
+}
+
+void BdxOtaSender::ContinueAsyncTransfer()
+{
+    // In Async mode, there is no BlockQuery: send the next Block as soon as the send window allows it.
+    VerifyOrReturn(mTransfer.CanPrepareBlock() && mTransfer.GetControlMode() == TransferControlFlags::kAsync);
+    PrepareNextBlock();
+    ScheduleImmediatePoll();
+}
+
 /* Reset() calls bdx::TransferSession::Reset() which sets the output event type to
  * TransferSession::OutputEventType::kNone. So, bdx::TransferFacilitator::PollForOutput()
  * will call HandleTransferSessionOutput() with event TransferSession::OutputEventType::kNone.
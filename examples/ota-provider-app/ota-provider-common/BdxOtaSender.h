@@ -32,6 +32,10 @@ private:
     // Inherited from bdx::TransferFacilitator
     void HandleTransferSessionOutput(chip::bdx::TransferSession::OutputEvent & event) override;
 
+    // Reads the next Block of the OTA file and prepares it to be sent.
+    void PrepareNextBlock();
+    void ContinueAsyncTransfer();
+
     void Reset();
 
     // Null-terminated string representing file designator
@@ -271,6 +271,12 @@ void OTAProviderExample::SendQueryImageResponse(app::CommandHandler * commandObj
         // Initialize the transfer session in prepartion for a BDX transfer
         BitFlags<TransferControlFlags> bdxFlags;
         bdxFlags.Set(TransferControlFlags::kReceiverDrive);
+        // Async mode keeps several messages in flight on the exchange, so only offer it over transports without MRP
+        Messaging::ExchangeContext * ec = commandObj->GetExchangeContext();
+        if (ec != nullptr && !ec->GetSessionHandle()->RequireMRP())
+        {
+            bdxFlags.Set(TransferControlFlags::kAsync);
+        }
         if (mBdxOtaSender.InitializeTransfer(commandObj->GetSubjectDescriptor().fabricIndex,
                                              commandObj->GetSubjectDescriptor().subject) == CHIP_NO_ERROR)
         {
@@ -0,0 +1,128 @@
+#!/usr/bin/env python3
+
+#
+#    Copyright (c) 2023 Project CHIP Authors
+#
+#    Licensed under the Apache License, Version 2.0 (the "License");
+#    you may not use this file except in compliance with the License.
+#    You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#    Unless required by applicable law or agreed to in writing, software
+#    distributed under the License is distributed on an "AS IS" BASIS,
+#    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#    See the License for the specific language governing permissions and
+#    limitations under the License.
+#
+
+#
+# Measures the command throughput of a chip-tool interactive server.
+#
+# Commands are sent round-robin from the --command options, in which {index}
+# is replaced by the index of the request. With --window greater than 1, the
+# server has to run with at least that concurrency.
+#
+# Example usage:
+#
+#   ./out/chip-tool interactive server --concurrency 8 &
+#   ./scripts/tools/chip_tool_interactive_benchmark.py --window 8 --count 1000 \
+#       --command 'onoff read on-off 0x12344321 1' \
+#       --command 'basicinformation read vendor-name 0x12344322 0'
+#
+#   ./out/chip-tool interactive server &
+#   ./scripts/tools/chip_tool_interactive_benchmark.py --window 1 --count 1000 \
+#       --command 'onoff read on-off 0x12344321 1'
+#
+
+import argparse
+import asyncio
+import json
+import statistics
+import sys
+import time
+
+import websockets
+
+
+def is_failure(response):
+    return any('error' in result for result in response.get('results', []))
+
+
+async def run_serial(connection, commands, count):
+    latencies = []
+    failures = 0
+    for index in range(count):
+        start = time.monotonic()
+        await connection.send(commands[index % len(commands)].format(index=index))
+        response = json.loads(await connection.recv())
+        latencies.append(time.monotonic() - start)
+        failures += is_failure(response)
+    return latencies, failures
+
+
+async def run_concurrent(connection, commands, count, window):
+    latencies = []
+    failures = 0
+    in_flight = {}
+    next_index = 0
+
+    while next_index < count or in_flight:
+        while next_index < count and len(in_flight) < window:
+            request_id = str(next_index)
+            in_flight[request_id] = time.monotonic()
+            await connection.send(f'{request_id} ' + commands[next_index % len(commands)].format(index=next_index))
+            next_index += 1
+
+        response = json.loads(await connection.recv())
+        start = in_flight.pop(response.get('id'), None)
+        if start is None:
+            # A report that came in after its request completed, e.g. for a subscription.
+            continue
+        latencies.append(time.monotonic() - start)
+        failures += is_failure(response)
+
+    return latencies, failures
+
+
+async def run(args):
+    async with websockets.connect(args.url, max_size=None) as connection:
+        start = time.monotonic()
+        if args.window > 1:
+            latencies, failures = await run_concurrent(connection, args.command, args.count, args.window)
+        else:
+            latencies, failures = await run_serial(connection, args.command, args.count)
+        elapsed = time.monotonic() - start
+
+    latencies.sort()
+    print(json.dumps({
+        'requests': len(latencies),
+        'failures': failures,
+        'window': args.window,
+        'seconds': round(elapsed, 3),
+        'requests_per_second': round(len(latencies) / elapsed, 1),
+        'latency_p50_ms': round(statistics.median(latencies) * 1000, 1),
+        'latency_p99_ms': round(latencies[min(len(latencies) - 1, int(len(latencies) * 0.99))] * 1000, 1),
+    }))
+    return failures == 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Measure the command throughput of a chip-tool interactive server.')
+    parser.add_argument('--url', default='ws://localhost:9002', help='URL of the interactive server')
+    parser.add_argument('--command', action='append', required=True,
+                        help='Command to run, in which {index} is replaced by the request index. Can be repeated.')
+    parser.add_argument('--count', type=int, default=100, help='Number of requests to send')
+    parser.add_argument('--window', type=int, default=1,
+                        help='Maximum number of requests in flight. Values greater than 1 need a server started with '
+                        '--concurrency.')
+    args = parser.parse_args()
+
+    if args.count < 1 or args.window < 1:
+        parser.error('--count and --window must be positive')
+
+    return 0 if asyncio.run(run(args)) else 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())
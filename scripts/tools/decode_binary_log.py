@@ -0,0 +1,159 @@
+#!/usr/bin/env python3
+
+#
+#    Copyright (c) 2023 Project CHIP Authors
+#
+#    Licensed under the Apache License, Version 2.0 (the "License");
+#    you may not use this file except in compliance with the License.
+#    You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#    Unless required by applicable law or agreed to in writing, software
+#    distributed under the License is distributed on an "AS IS" BASIS,
+#    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#    See the License for the specific language governing permissions and
+#    limitations under the License.
+#
+
+#
+# Converts a log file written by the Linux binary logging backend
+# (src/platform/Linux/BinaryLogging.cpp) to the text format of the default
+# Linux logging backend.
+#
+# Example usage:
+#
+#   ./scripts/tools/decode_binary_log.py /tmp/chip.blog
+#
+
+import argparse
+import re
+import struct
+import sys
+
+FILE_MAGIC = b'CHIPBLOG'
+FILE_VERSION = 1
+
+CONVERSION = re.compile(
+    rb'%(?P<flags>[-+ #0]*)(?P<width>\*|\d+)?(?:\.(?P<precision>\*|\d*))?(?P<length>hh|h|ll|l|j|z|t|L)?(?P<conversion>[%a-zA-Z])')
+
+
+class LogFormatError(Exception):
+    pass
+
+
+class Reader:
+    def __init__(self, data):
+        self.data = data
+        self.offset = 0
+
+    def done(self):
+        return self.offset >= len(self.data)
+
+    def read(self, fmt):
+        size = struct.calcsize(fmt)
+        if self.offset + size > len(self.data):
+            raise LogFormatError('truncated record at offset %d' % self.offset)
+        values = struct.unpack_from(fmt, self.data, self.offset)
+        self.offset += size
+        return values[0] if len(values) == 1 else values
+
+    def read_bytes(self, length):
+        if self.offset + length > len(self.data):
+            raise LogFormatError('truncated record at offset %d' % self.offset)
+        value = self.data[self.offset:self.offset + length]
+        self.offset += length
+        return value
+
+
+def read_argument(reader):
+    tag = reader.read('<c')
+    if tag == b'i':
+        return reader.read('<q')
+    if tag == b'u':
+        return reader.read('<Q')
+    if tag == b'f':
+        return struct.unpack('<d', struct.pack('<Q', reader.read('<Q')))[0]
+    if tag == b's':
+        return reader.read_bytes(reader.read('<H'))
+    raise LogFormatError('unknown argument tag %r' % tag)
+
+
+def format_message(fmt, reader):
+    def substitute(match):
+        conversion = match.group('conversion')
+        if conversion == b'%':
+            return '%'
+
+        spec = '%' + match.group('flags').decode()
+        width = match.group('width')
+        if width == b'*':
+            width = str(read_argument(reader)).encode()
+        if width is not None:
+            spec += width.decode()
+        precision = match.group('precision')
+        if precision == b'*':
+            precision = str(read_argument(reader)).encode()
+        if precision is not None:
+            spec += '.' + (precision.decode() or '0')
+
+        value = read_argument(reader)
+        if conversion == b's':
+            return (spec + 's') % value.decode('utf-8', errors='replace')
+        if conversion == b'c':
+            return (spec + 'c') % chr(value & 0xff)
+        if conversion == b'p':
+            return (spec + 's') % ('0x%x' % value if value else '(nil)')
+        if conversion == b'u':
+            return (spec + 'd') % value
+        return (spec + conversion.decode()) % value
+
+    return CONVERSION.sub(lambda m: substitute(m).encode('utf-8', errors='replace'), fmt).decode('utf-8', errors='replace')
+
+
+def decode(data, output):
+    reader = Reader(data)
+    if reader.read_bytes(len(FILE_MAGIC)) != FILE_MAGIC:
+        raise LogFormatError('not a binary log file')
+    version = reader.read('<B')
+    if version != FILE_VERSION:
+        raise LogFormatError('unsupported version %d' % version)
+    pid = reader.read('<I')
+
+    strings = {}
+    while not reader.done():
+        record_type = reader.read('<c')
+        if record_type == b'S':
+            address, length = reader.read('<QH')
+            strings[address] = reader.read_bytes(length)
+        elif record_type == b'M':
+            tid, length = reader.read('<IH')
+            message = Reader(reader.read_bytes(length))
+            timestamp, category, module, fmt = message.read('<QBQQ')
+            text = format_message(strings.get(fmt, b'<unknown format>'), message)
+            output.write('[%d.%06d][%d:%d] CHIP:%s: %s\n' % (timestamp // 1000000, timestamp % 1000000, pid, tid,
+                                                            strings.get(module, b'???').decode(errors='replace'), text))
+        else:
+            raise LogFormatError('unknown record type %r at offset %d' % (record_type, reader.offset - 1))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decode a CHIP binary log file to text.')
+    parser.add_argument('input', help='Binary log file, or - for stdin')
+    args = parser.parse_args()
+
+    if args.input == '-':
+        data = sys.stdin.buffer.read()
+    else:
+        with open(args.input, 'rb') as f:
+            data = f.read()
+
+    try:
+        decode(data, sys.stdout)
+    except LogFormatError as e:
+        sys.stderr.write('%s: %s\n' % (args.input, e))
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+
+#
+#    Copyright (c) 2023 Project CHIP Authors
+#
+#    Licensed under the Apache License, Version 2.0 (the "License");
+#    you may not use this file except in compliance with the License.
+#    You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#    Unless required by applicable law or agreed to in writing, software
+#    distributed under the License is distributed on an "AS IS" BASIS,
+#    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#    See the License for the specific language governing permissions and
+#    limitations under the License.
+#
+
+#
+# Unit tests for decode_binary_log.py.
+#
+# Example usage:
+#
+#   ./scripts/tools/test_decode_binary_log.py
+#
+
+import io
+import os
+import struct
+import sys
+import unittest
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+
+from decode_binary_log import LogFormatError, decode  # noqa: E402
+
+PID = 1234
+TID = 5678
+MODULE_ADDRESS = 0x1000
+TIMESTAMP = 1700000000123456
+
+
+def header(magic=b'CHIPBLOG', version=1):
+    return magic + struct.pack('<BI', version, PID)
+
+
+def string_record(address, value):
+    return b'S' + struct.pack('<QH', address, len(value)) + value
+
+
+def signed(value):
+    return b'i' + struct.pack('<q', value)
+
+
+def unsigned(value):
+    return b'u' + struct.pack('<Q', value)
+
+
+def double(value):
+    return b'f' + struct.pack('<d', value)
+
+
+def string(value):
+    return b's' + struct.pack('<H', len(value)) + value
+
+
+def message_record(format_address, arguments=b'', category=2):
+    message = struct.pack('<QBQQ', TIMESTAMP, category, MODULE_ADDRESS, format_address) + arguments
+    return b'M' + struct.pack('<IH', TID, len(message)) + message
+
+
+def decode_to_text(data):
+    output = io.StringIO()
+    decode(data, output)
+    return output.getvalue().splitlines()
+
+
+class TestDecodeBinaryLog(unittest.TestCase):
+    def check_message(self, fmt, arguments, expected):
+        data = header() + string_record(MODULE_ADDRESS, b'TST') + string_record(0x2000, fmt) + message_record(0x2000, arguments)
+        self.assertEqual(decode_to_text(data), ['[1700000000.123456][%d:%d] CHIP:TST: %s' % (PID, TID, expected)])
+
+    def test_integers(self):
+        self.check_message(b'%d %hhd %lld', signed(-1) + signed(-2) + signed(-3), '-1 -2 -3')
+        self.check_message(b'%u %02x %X %lu', unsigned(1) + unsigned(0xa) + unsigned(0xab) + unsigned(2**64 - 1),
+                           '1 0a AB 18446744073709551615')
+        self.check_message(b'%c', signed(ord('c')), 'c')
+        self.check_message(b'%p %p', unsigned(0x1234) + unsigned(0), '0x1234 (nil)')
+
+    def test_strings(self):
+        self.check_message(b'%s, %.3s!', string(b'hello') + string(b'wor'), 'hello, wor!')
+        self.check_message(b'[%-*.*s]', signed(6) + signed(2) + string(b'ab'), '[ab    ]')
+        self.check_message(b'100%%', b'', '100%')
+
+    def test_doubles(self):
+        self.check_message(b'%.2f %g', double(1.5) + double(0.25), '1.50 0.25')
+
+    def test_strings_are_recorded_once(self):
+        data = header() + string_record(MODULE_ADDRESS, b'TST') + string_record(0x2000, b'Value %u')
+        data += message_record(0x2000, unsigned(1)) + message_record(0x2000, unsigned(2))
+        lines = decode_to_text(data)
+        self.assertEqual(len(lines), 2)
+        self.assertTrue(lines[0].endswith('CHIP:TST: Value 1'))
+        self.assertTrue(lines[1].endswith('CHIP:TST: Value 2'))
+
+    def test_unknown_strings(self):
+        lines = decode_to_text(header() + message_record(0x2000))
+        self.assertEqual(lines, ['[1700000000.123456][%d:%d] CHIP:???: <unknown format>' % (PID, TID)])
+
+    def test_invalid_files(self):
+        with self.assertRaises(LogFormatError):
+            decode_to_text(header(magic=b'NOTABLOG'))
+        with self.assertRaises(LogFormatError):
+            decode_to_text(header(version=2))
+        with self.assertRaises(LogFormatError):
+            decode_to_text(header() + b'X')
+
+        # Truncated records, and records without the arguments their format string needs.
+        record = string_record(0x2000, b'Value %u')
+        with self.assertRaises(LogFormatError):
+            decode_to_text(header() + record[:-1])
+        with self.assertRaises(LogFormatError):
+            decode_to_text(header() + record + message_record(0x2000))
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -25,8 +25,11 @@
 #include <app/GlobalAttributes.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/core/TLVDebug.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/DLLUtil.h>
+#include <lib/support/SafeInt.h>
+#include <lib/support/ScopedBuffer.h>
 #include <lib/support/logging/CHIPLogging.h>
 
 using namespace chip;
@@ -48,9 +51,303 @@ extern Optional<AttributeId> emberAfGetServerAttributeIdByIndex(chip::EndpointId
                                                                 uint16_t attributeIndex);
 extern uint8_t emberAfClusterIndex(EndpointId endpoint, ClusterId clusterId, EmberAfClusterMask mask);
 extern bool emberAfEndpointIndexIsEnabled(uint16_t index);
+extern uint32_t emberAfMetadataStructureGeneration();
 
 namespace chip {
 namespace app {
+namespace {
+
+constexpr uint16_t kGlobalAttributesNotInMetadataCount = static_cast<uint16_t>(ArraySize(GlobalAttributesNotInMetadata));
+
+/**
+ * Flat table of the server clusters of the enabled endpoints and of their attributes, in the order the iterator emits them.
+ *
+ * Endpoints are indexed like ember endpoints, disabled ones having no clusters. The clusters of an endpoint (attributes of a
+ * cluster) end where those of the next one start, so mEndpoints and mClusters have one more entry than there are endpoints
+ * and clusters.
+ */
+struct ExpansionTable
+{
+    struct Endpoint
+    {
+        EndpointId mEndpointId;
+        bool mEnabled;
+        uint32_t mFirstCluster;
+    };
+
+    struct Cluster
+    {
+        ClusterId mClusterId;
+        uint32_t mFirstAttribute;
+    };
+
+    CHIP_ERROR Build();
+
+    uint32_t mGeneration    = 0;
+    uint16_t mEndpointCount = 0;
+    Platform::ScopedMemoryBuffer<Endpoint> mEndpoints;
+    Platform::ScopedMemoryBuffer<Cluster> mClusters;
+    Platform::ScopedMemoryBuffer<AttributeId> mAttributes;
+};
+
+CHIP_ERROR ExpansionTable::Build()
+{
+    mGeneration    = emberAfMetadataStructureGeneration();
+    mEndpointCount = emberAfEndpointCount();
+
+    // Count the clusters and attributes first, so that each array is a single allocation.
+    size_t clusterCount   = 0;
+    size_t attributeCount = 0;
+    for (uint16_t endpointIndex = 0; endpointIndex < mEndpointCount; endpointIndex++)
+    {
+        if (!emberAfEndpointIndexIsEnabled(endpointIndex))
+        {
+            continue;
+        }
+
+        EndpointId endpointId        = emberAfEndpointFromIndex(endpointIndex);
+        uint8_t endpointClusterCount = emberAfClusterCount(endpointId, true /* server */);
+        clusterCount += endpointClusterCount;
+        for (uint8_t clusterIndex = 0; clusterIndex < endpointClusterCount; clusterIndex++)
+        {
+            ClusterId clusterId = emberAfGetNthClusterId(endpointId, clusterIndex, true /* server */).Value();
+            uint16_t count      = emberAfGetServerAttributeCount(endpointId, clusterId);
+            // The iterator uses UINT16_MAX as an invalid attribute index.
+            VerifyOrReturnError(count < UINT16_MAX - kGlobalAttributesNotInMetadataCount, CHIP_ERROR_INTERNAL);
+            attributeCount += count + kGlobalAttributesNotInMetadataCount;
+        }
+    }
+    VerifyOrReturnError(CanCastTo<uint32_t>(attributeCount), CHIP_ERROR_NO_MEMORY);
+
+    VerifyOrReturnError(mEndpoints.Alloc(mEndpointCount + 1u), CHIP_ERROR_NO_MEMORY);
+    VerifyOrReturnError(mClusters.Alloc(clusterCount + 1), CHIP_ERROR_NO_MEMORY);
+    VerifyOrReturnError(attributeCount == 0 || mAttributes.Alloc(attributeCount), CHIP_ERROR_NO_MEMORY);
+
+    uint32_t cluster   = 0;
+    uint32_t attribute = 0;
+    for (uint16_t endpointIndex = 0; endpointIndex < mEndpointCount; endpointIndex++)
+    {
+        Endpoint & endpoint    = mEndpoints[endpointIndex];
+        endpoint.mEnabled      = emberAfEndpointIndexIsEnabled(endpointIndex);
+        endpoint.mEndpointId   = endpoint.mEnabled ? emberAfEndpointFromIndex(endpointIndex) : kInvalidEndpointId;
+        endpoint.mFirstCluster = cluster;
+        if (!endpoint.mEnabled)
+        {
+            continue;
+        }
+
+        uint8_t endpointClusterCount = emberAfClusterCount(endpoint.mEndpointId, true /* server */);
+        for (uint8_t clusterIndex = 0; clusterIndex < endpointClusterCount; clusterIndex++)
+        {
+            ClusterId clusterId  = emberAfGetNthClusterId(endpoint.mEndpointId, clusterIndex, true /* server */).Value();
+            mClusters[cluster++] = { clusterId, attribute };
+
+            uint16_t count = emberAfGetServerAttributeCount(endpoint.mEndpointId, clusterId);
+            for (uint16_t attributeIndex = 0; attributeIndex < count; attributeIndex++)
+            {
+                mAttributes[attribute++] =
+                    emberAfGetServerAttributeIdByIndex(endpoint.mEndpointId, clusterId, attributeIndex).Value();
+            }
+            for (AttributeId attributeId : GlobalAttributesNotInMetadata)
+            {
+                mAttributes[attribute++] = attributeId;
+            }
+        }
+    }
+    mEndpoints[mEndpointCount] = { kInvalidEndpointId, false, cluster };
+    mClusters[cluster]         = { kInvalidClusterId, attribute };
+
+    return CHIP_NO_ERROR;
+}
+
+// The expansion table for the current metadata generation, or nullptr if it could not be built, in which case the ember
+// metadata is walked instead.
+ExpansionTable * gExpansionTable = nullptr;
+bool gExpansionTableBuildFailed  = false;
+uint32_t gExpansionTableFailedGeneration;
+
+void UpdateExpansionTable()
+{
+    uint32_t generation = emberAfMetadataStructureGeneration();
+    if (gExpansionTable != nullptr && gExpansionTable->mGeneration == generation)
+    {
+        return;
+    }
+
+    // Do not retry a failed build until the metadata changes.
+    if (gExpansionTableBuildFailed && gExpansionTableFailedGeneration == generation)
+    {
+        return;
+    }
+
+    AttributePathExpandIterator::ReleaseExpansionTable();
+
+    gExpansionTable = Platform::New<ExpansionTable>();
+    CHIP_ERROR err  = (gExpansionTable != nullptr) ? gExpansionTable->Build() : CHIP_ERROR_NO_MEMORY;
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DataManagement, "Failed to build the attribute path expansion table: %" CHIP_ERROR_FORMAT, err.Format());
+        AttributePathExpandIterator::ReleaseExpansionTable();
+        gExpansionTableBuildFailed      = true;
+        gExpansionTableFailedGeneration = generation;
+    }
+}
+
+// The functions below take both the indices and the ids of the endpoint and cluster: the table is looked up by index, while the
+// ember metadata is looked up by id. Indices are checked against the current table since an iterator may have been advanced
+// using an older one.
+
+const ExpansionTable::Cluster * FindTableCluster(uint16_t endpointIndex, uint8_t clusterIndex)
+{
+    VerifyOrReturnValue(endpointIndex < gExpansionTable->mEndpointCount, nullptr);
+    uint32_t cluster = gExpansionTable->mEndpoints[endpointIndex].mFirstCluster + clusterIndex;
+    VerifyOrReturnValue(cluster < gExpansionTable->mEndpoints[endpointIndex + 1].mFirstCluster, nullptr);
+    return &gExpansionTable->mClusters[cluster];
+}
+
+uint16_t EndpointCount()
+{
+    return (gExpansionTable != nullptr) ? gExpansionTable->mEndpointCount : emberAfEndpointCount();
+}
+
+bool EndpointIndexIsEnabled(uint16_t endpointIndex)
+{
+    if (gExpansionTable != nullptr)
+    {
+        return endpointIndex < gExpansionTable->mEndpointCount && gExpansionTable->mEndpoints[endpointIndex].mEnabled;
+    }
+    return emberAfEndpointIndexIsEnabled(endpointIndex);
+}
+
+// Must only be called for an enabled endpoint.
+EndpointId EndpointFromIndex(uint16_t endpointIndex)
+{
+    return (gExpansionTable != nullptr) ? gExpansionTable->mEndpoints[endpointIndex].mEndpointId
+                                        : emberAfEndpointFromIndex(endpointIndex);
+}
+
+uint16_t IndexFromEndpoint(EndpointId endpointId)
+{
+    if (gExpansionTable != nullptr)
+    {
+        for (uint16_t endpointIndex = 0; endpointIndex < gExpansionTable->mEndpointCount; endpointIndex++)
+        {
+            const ExpansionTable::Endpoint & endpoint = gExpansionTable->mEndpoints[endpointIndex];
+            if (endpoint.mEnabled && endpoint.mEndpointId == endpointId)
+            {
+                return endpointIndex;
+            }
+        }
+        return UINT16_MAX;
+    }
+    return emberAfIndexFromEndpoint(endpointId);
+}
+
+uint8_t ClusterCount(uint16_t endpointIndex, EndpointId endpointId)
+{
+    if (gExpansionTable != nullptr)
+    {
+        VerifyOrReturnValue(endpointIndex < gExpansionTable->mEndpointCount, 0);
+        return static_cast<uint8_t>(gExpansionTable->mEndpoints[endpointIndex + 1].mFirstCluster -
+                                    gExpansionTable->mEndpoints[endpointIndex].mFirstCluster);
+    }
+    return emberAfClusterCount(endpointId, true /* server */);
+}
+
+Optional<ClusterId> NthClusterId(uint16_t endpointIndex, EndpointId endpointId, uint8_t clusterIndex)
+{
+    if (gExpansionTable != nullptr)
+    {
+        const ExpansionTable::Cluster * cluster = FindTableCluster(endpointIndex, clusterIndex);
+        VerifyOrReturnValue(cluster != nullptr, NullOptional);
+        return MakeOptional(cluster->mClusterId);
+    }
+    return emberAfGetNthClusterId(endpointId, clusterIndex, true /* server */);
+}
+
+uint8_t IndexFromClusterId(uint16_t endpointIndex, EndpointId endpointId, ClusterId clusterId)
+{
+    if (gExpansionTable != nullptr)
+    {
+        uint8_t count = ClusterCount(endpointIndex, endpointId);
+        for (uint8_t clusterIndex = 0; clusterIndex < count; clusterIndex++)
+        {
+            if (FindTableCluster(endpointIndex, clusterIndex)->mClusterId == clusterId)
+            {
+                return clusterIndex;
+            }
+        }
+        return UINT8_MAX;
+    }
+    return emberAfClusterIndex(endpointId, clusterId, CLUSTER_MASK_SERVER);
+}
+
+uint16_t AttributeCount(uint16_t endpointIndex, uint8_t clusterIndex, EndpointId endpointId, ClusterId clusterId)
+{
+    if (gExpansionTable != nullptr)
+    {
+        const ExpansionTable::Cluster * cluster = FindTableCluster(endpointIndex, clusterIndex);
+        VerifyOrReturnValue(cluster != nullptr, 0);
+        return static_cast<uint16_t>(cluster[1].mFirstAttribute - cluster[0].mFirstAttribute);
+    }
+    return static_cast<uint16_t>(emberAfGetServerAttributeCount(endpointId, clusterId) + kGlobalAttributesNotInMetadataCount);
+}
+
+Optional<AttributeId> NthAttributeId(uint16_t endpointIndex, uint8_t clusterIndex, EndpointId endpointId, ClusterId clusterId,
+                                     uint16_t attributeIndex)
+{
+    if (gExpansionTable != nullptr)
+    {
+        const ExpansionTable::Cluster * cluster = FindTableCluster(endpointIndex, clusterIndex);
+        VerifyOrReturnValue(cluster != nullptr, NullOptional);
+        uint32_t attribute = cluster->mFirstAttribute + attributeIndex;
+        VerifyOrReturnValue(attribute < cluster[1].mFirstAttribute, NullOptional);
+        return MakeOptional(gExpansionTable->mAttributes[attribute]);
+    }
+
+    uint16_t metadataCount = emberAfGetServerAttributeCount(endpointId, clusterId);
+    if (attributeIndex < metadataCount)
+    {
+        return emberAfGetServerAttributeIdByIndex(endpointId, clusterId, attributeIndex);
+    }
+    VerifyOrReturnValue(attributeIndex - metadataCount < kGlobalAttributesNotInMetadataCount, NullOptional);
+    return MakeOptional(GlobalAttributesNotInMetadata[attributeIndex - metadataCount]);
+}
+
+uint16_t IndexFromAttributeId(uint16_t endpointIndex, uint8_t clusterIndex, EndpointId endpointId, ClusterId clusterId,
+                              AttributeId attributeId)
+{
+    if (gExpansionTable != nullptr)
+    {
+        uint16_t count = AttributeCount(endpointIndex, clusterIndex, endpointId, clusterId);
+        for (uint16_t attributeIndex = 0; attributeIndex < count; attributeIndex++)
+        {
+            if (NthAttributeId(endpointIndex, clusterIndex, endpointId, clusterId, attributeIndex).Value() == attributeId)
+            {
+                return attributeIndex;
+            }
+        }
+        return UINT16_MAX;
+    }
+
+    uint16_t attributeIndex = emberAfGetServerAttributeIndexByAttributeId(endpointId, clusterId, attributeId);
+    if (attributeIndex != UINT16_MAX)
+    {
+        return attributeIndex;
+    }
+
+    // Check whether this is a non-metadata global attribute.
+    for (uint16_t idx = 0; idx < kGlobalAttributesNotInMetadataCount; ++idx)
+    {
+        if (GlobalAttributesNotInMetadata[idx] == attributeId)
+        {
+            return static_cast<uint16_t>(emberAfGetServerAttributeCount(endpointId, clusterId) + idx);
+        }
+    }
+    return UINT16_MAX;
+}
+
+} // namespace
 
 AttributePathExpandIterator::AttributePathExpandIterator(ObjectList<AttributePathParams> * aAttributePath)
 {
@@ -61,26 +358,30 @@ AttributePathExpandIterator::AttributePathExpandIterator(ObjectList<AttributePat
     mClusterIndex   = UINT8_MAX;
     mAttributeIndex = UINT16_MAX;
 
-    static_assert(std::numeric_limits<decltype(mGlobalAttributeIndex)>::max() >= ArraySize(GlobalAttributesNotInMetadata),
-                  "Our index won't be able to hold the value we need to hold.");
-    static_assert(std::is_same<decltype(mGlobalAttributeIndex), uint8_t>::value,
-                  "If this changes audit all uses where we set to UINT8_MAX");
-    mGlobalAttributeIndex = UINT8_MAX;
-
     // Make the iterator ready to emit the first valid path in the list.
     Next();
 }
 
+void AttributePathExpandIterator::ReleaseExpansionTable()
+{
+    if (gExpansionTable != nullptr)
+    {
+        Platform::Delete(gExpansionTable);
+        gExpansionTable = nullptr;
+    }
+    gExpansionTableBuildFailed = false;
+}
+
 void AttributePathExpandIterator::PrepareEndpointIndexRange(const AttributePathParams & aAttributePath)
 {
     if (aAttributePath.HasWildcardEndpointId())
     {
         mEndpointIndex    = 0;
-        mEndEndpointIndex = emberAfEndpointCount();
+        mEndEndpointIndex = EndpointCount();
     }
     else
     {
-        mEndpointIndex = emberAfIndexFromEndpoint(aAttributePath.mEndpointId);
+        mEndpointIndex = IndexFromEndpoint(aAttributePath.mEndpointId);
         // If the given cluster id does not exist on the given endpoint, it will return uint16(0xFFFF), then endEndpointIndex
         // will be 0, means we should iterate a null endpoint set (skip it).
         mEndEndpointIndex = static_cast<uint16_t>(mEndpointIndex + 1);
@@ -92,11 +393,11 @@ void AttributePathExpandIterator::PrepareClusterIndexRange(const AttributePathPa
     if (aAttributePath.HasWildcardClusterId())
     {
         mClusterIndex    = 0;
-        mEndClusterIndex = emberAfClusterCount(aEndpointId, true /* server */);
+        mEndClusterIndex = ClusterCount(mEndpointIndex, aEndpointId);
     }
     else
     {
-        mClusterIndex = emberAfClusterIndex(aEndpointId, aAttributePath.mClusterId, CLUSTER_MASK_SERVER);
+        mClusterIndex = IndexFromClusterId(mEndpointIndex, aEndpointId, aAttributePath.mClusterId);
         // If the given cluster id does not exist on the given endpoint, it will return uint8(0xFF), then endClusterIndex
         // will be 0, means we should iterate a null cluster set (skip it).
         mEndClusterIndex = static_cast<uint8_t>(mClusterIndex + 1);
@@ -108,39 +409,16 @@ void AttributePathExpandIterator::PrepareAttributeIndexRange(const AttributePath
 {
     if (aAttributePath.HasWildcardAttributeId())
     {
-        mAttributeIndex          = 0;
-        mEndAttributeIndex       = emberAfGetServerAttributeCount(aEndpointId, aClusterId);
-        mGlobalAttributeIndex    = 0;
-        mGlobalAttributeEndIndex = ArraySize(GlobalAttributesNotInMetadata);
+        mAttributeIndex    = 0;
+        mEndAttributeIndex = AttributeCount(mEndpointIndex, mClusterIndex, aEndpointId, aClusterId);
     }
     else
     {
-        mAttributeIndex = emberAfGetServerAttributeIndexByAttributeId(aEndpointId, aClusterId, aAttributePath.mAttributeId);
+        mAttributeIndex =
+            IndexFromAttributeId(mEndpointIndex, mClusterIndex, aEndpointId, aClusterId, aAttributePath.mAttributeId);
         // If the given attribute id does not exist on the given endpoint, it will return uint16(0xFFFF), then endAttributeIndex
         // will be 0, means we should iterate a null attribute set (skip it).
         mEndAttributeIndex = static_cast<uint16_t>(mAttributeIndex + 1);
-        if (mAttributeIndex == UINT16_MAX)
-        {
-            // Check whether this is a non-metadata global attribute.
-            //
-            // Default to the max value, which will correspond (after we add 1
-            // and overflow to 0 for the max index) to us not going through
-            // non-metadata global attributes for this attribute.
-            mGlobalAttributeIndex = UINT8_MAX;
-
-            static_assert(ArraySize(GlobalAttributesNotInMetadata) <= UINT8_MAX, "Iterating over at most 256 array entries");
-
-            const uint8_t arraySize = static_cast<uint8_t>(ArraySize(GlobalAttributesNotInMetadata));
-            for (uint8_t idx = 0; idx < arraySize; ++idx)
-            {
-                if (GlobalAttributesNotInMetadata[idx] == aAttributePath.mAttributeId)
-                {
-                    mGlobalAttributeIndex = idx;
-                    break;
-                }
-            }
-            mGlobalAttributeEndIndex = static_cast<uint8_t>(mGlobalAttributeIndex + 1);
-        }
     }
 }
 
@@ -160,13 +438,14 @@ void AttributePathExpandIterator::ResetCurrentCluster()
     // - We have exhausted all paths
     // Only the second case will happen here since the above check will fail for 1 and 3, so the following Next() call must result
     // in a valid path, which is the first attribute id we will emit for the current cluster.
-    mAttributeIndex       = UINT16_MAX;
-    mGlobalAttributeIndex = UINT8_MAX;
+    mAttributeIndex = UINT16_MAX;
     Next();
 }
 
 bool AttributePathExpandIterator::Next()
 {
+    UpdateExpansionTable();
+
     for (; mpAttributePath != nullptr; (mpAttributePath = mpAttributePath->mpNext, mEndpointIndex = UINT16_MAX))
     {
         mOutputPath.mExpanded = mpAttributePath->mValue.IsWildcardPath();
@@ -189,55 +468,50 @@ bool AttributePathExpandIterator::Next()
             mClusterIndex = UINT8_MAX;
         }
 
-        for (; mEndpointIndex < mEndEndpointIndex;
-             (mEndpointIndex++, mClusterIndex = UINT8_MAX, mAttributeIndex = UINT16_MAX, mGlobalAttributeIndex = UINT8_MAX))
+        for (; mEndpointIndex < mEndEndpointIndex; (mEndpointIndex++, mClusterIndex = UINT8_MAX, mAttributeIndex = UINT16_MAX))
         {
-            if (!emberAfEndpointIndexIsEnabled(mEndpointIndex))
+            if (!EndpointIndexIsEnabled(mEndpointIndex))
             {
                 // Not an enabled endpoint; skip it.
                 continue;
             }
 
-            EndpointId endpointId = emberAfEndpointFromIndex(mEndpointIndex);
+            EndpointId endpointId = EndpointFromIndex(mEndpointIndex);
 
             if (mClusterIndex == UINT8_MAX)
             {
                 PrepareClusterIndexRange(mpAttributePath->mValue, endpointId);
-                mAttributeIndex       = UINT16_MAX;
-                mGlobalAttributeIndex = UINT8_MAX;
+                mAttributeIndex = UINT16_MAX;
             }
 
-            for (; mClusterIndex < mEndClusterIndex;
-                 (mClusterIndex++, mAttributeIndex = UINT16_MAX, mGlobalAttributeIndex = UINT8_MAX))
+            for (; mClusterIndex < mEndClusterIndex; (mClusterIndex++, mAttributeIndex = UINT16_MAX))
             {
-                // emberAfGetNthClusterId must return a valid cluster id here since we have verified the mClusterIndex does
-                // not exceed the mEndClusterIndex.
-                ClusterId clusterId = emberAfGetNthClusterId(endpointId, mClusterIndex, true /* server */).Value();
-                if (mAttributeIndex == UINT16_MAX && mGlobalAttributeIndex == UINT8_MAX)
+                // The cluster can only be missing if the metadata changed while we were expanding this endpoint.
+                Optional<ClusterId> clusterId = NthClusterId(mEndpointIndex, endpointId, mClusterIndex);
+                if (!clusterId.HasValue())
                 {
-                    PrepareAttributeIndexRange(mpAttributePath->mValue, endpointId, clusterId);
+                    break;
                 }
 
-                if (mAttributeIndex < mEndAttributeIndex)
+                if (mAttributeIndex == UINT16_MAX)
                 {
-                    // GetServerAttributeIdByIdex must return a valid attribute here since we have verified the mAttributeIndex does
-                    // not exceed the mEndAttributeIndex.
-                    mOutputPath.mAttributeId = emberAfGetServerAttributeIdByIndex(endpointId, clusterId, mAttributeIndex).Value();
-                    mOutputPath.mClusterId   = clusterId;
-                    mOutputPath.mEndpointId  = endpointId;
-                    mAttributeIndex++;
-                    // We found a valid attribute path, now return and increase the attribute index for next iteration.
-                    // Return true will skip the increment of mClusterIndex, mEndpointIndex and mpAttributePath.
-                    return true;
+                    PrepareAttributeIndexRange(mpAttributePath->mValue, endpointId, clusterId.Value());
                 }
-                if (mGlobalAttributeIndex < mGlobalAttributeEndIndex)
+
+                if (mAttributeIndex < mEndAttributeIndex)
                 {
-                    // Return a path pointing to the next global attribute.
-                    mOutputPath.mAttributeId = GlobalAttributesNotInMetadata[mGlobalAttributeIndex];
-                    mOutputPath.mClusterId   = clusterId;
-                    mOutputPath.mEndpointId  = endpointId;
-                    mGlobalAttributeIndex++;
-                    return true;
+                    Optional<AttributeId> attributeId =
+                        NthAttributeId(mEndpointIndex, mClusterIndex, endpointId, clusterId.Value(), mAttributeIndex);
+                    if (attributeId.HasValue())
+                    {
+                        mOutputPath.mAttributeId = attributeId.Value();
+                        mOutputPath.mClusterId   = clusterId.Value();
+                        mOutputPath.mEndpointId  = endpointId;
+                        mAttributeIndex++;
+                        // We found a valid attribute path, now return and increase the attribute index for next iteration.
+                        // Return true will skip the increment of mClusterIndex, mEndpointIndex and mpAttributePath.
+                        return true;
+                    }
                 }
                 // We have exhausted all attributes of this cluster, continue iterating over attributes of next cluster.
             }
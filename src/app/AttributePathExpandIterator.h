@@ -56,6 +56,11 @@ namespace app {
  * The iterator does not copy the given AttributePathParams, The given AttributePathParams must be valid when using the iterator.
  * If the set of endpoints, clusters, or attributes that are supported changes, AttributePathExpandIterator must be reinitialized.
  *
+ * Wildcards are expanded using a flat table of the enabled endpoints, their server clusters and their attributes (including
+ * the global attributes that are not part of the attribute metadata), which is shared by all iterators. The table is built on
+ * first use and rebuilt whenever emberAfMetadataStructureGeneration() changes, i.e. when an endpoint is enabled or disabled.
+ * If it cannot be allocated, the iterator walks the ember metadata instead.
+ *
  * A initialized iterator will return the first valid path, no need to call Next() before calling Get() for the first time.
  *
  * Note: The Next() and Get() are two separate operations by design since a possible call of this iterator might be:
@@ -104,19 +109,22 @@ public:
      */
     inline bool Valid() const { return mpAttributePath != nullptr; }
 
+    /**
+     * Free the expansion table shared by all iterators. It will be rebuilt the next time a wildcard path is expanded.
+     */
+    static void ReleaseExpansionTable();
+
 private:
     ObjectList<AttributePathParams> * mpAttributePath;
 
     ConcreteAttributePath mOutputPath;
 
     uint16_t mEndpointIndex, mEndEndpointIndex;
+    // Attribute indices cover the attributes in the metadata of the cluster first, then GlobalAttributesNotInMetadata.
     uint16_t mAttributeIndex, mEndAttributeIndex;
 
     // Note: should use decltype(EmberAfEndpointType::clusterCount) here, but af-types is including app specific generated files.
     uint8_t mClusterIndex, mEndClusterIndex;
-    // For dealing with global attributes that are not part of the attribute
-    // metadata.
-    uint8_t mGlobalAttributeIndex, mGlobalAttributeEndIndex;
 
     /**
      * Prepare*IndexRange will update mBegin*Index and mEnd*Index variables.
@@ -125,7 +133,7 @@ private:
      *
      * If the Endpoint/Cluster/Attribute does not exist, mBegin*Index will be UINT*_MAX, and mEnd*Inde will be 0.
      *
-     * The index can be used with emberAfEndpointFromIndex, emberAfGetNthClusterId and emberAfGetServerAttributeIdByIndex.
+     * The endpoint index is the ember endpoint index, the cluster index is the index of the server cluster on the endpoint.
      */
     void PrepareEndpointIndexRange(const AttributePathParams & aAttributePath);
     void PrepareClusterIndexRange(const AttributePathParams & aAttributePath, EndpointId aEndpointId);
@@ -25,10 +25,25 @@
 #include <app/BufferedReadCallback.h>
 #include <app/InteractionModelEngine.h>
 #include <lib/support/ScopedBuffer.h>
+#include <lib/support/TypeTraits.h>
+
+#include <algorithm>
+#include <string.h>
 
 namespace chip {
 namespace app {
 
+namespace {
+
+//
+// Control octets framing the buffered list elements as an anonymous array.
+//
+constexpr uint8_t kListStartControlOctet =
+    static_cast<uint8_t>(to_underlying(TLV::TLVTagControl::Anonymous) | to_underlying(TLV::TLVElementType::Array));
+constexpr uint8_t kListEndControlOctet = static_cast<uint8_t>(TLV::TLVElementType::EndOfContainer);
+
+} // namespace
+
 void BufferedReadCallback::OnReportBegin()
 {
     mCallback.OnReportBegin();
@@ -45,91 +60,91 @@ void BufferedReadCallback::OnReportEnd()
     mCallback.OnReportEnd();
 }
 
-CHIP_ERROR BufferedReadCallback::GenerateListTLV(TLV::ScopedBufferTLVReader & aReader)
+CHIP_ERROR BufferedReadCallback::GenerateListTLV(TLV::TLVReader & aReader)
 {
-    TLV::TLVType outerType;
-    Platform::ScopedMemoryBuffer<uint8_t> backingBuffer;
-
-    //
-    // To generate the final reconstituted list, we need to allocate a contiguous
-    // buffer than can hold the entirety of its contents. To do so, we need to figure out
-    // how big a buffer to allocate. This requires walking the buffered list items and computing their TLV sizes,
-    // summing them all up and adding a bit of slop to account for the TLV array the list elements will go into.
     //
-    // The alternative was to use a PacketBufferTLVWriter backed by chained packet buffers to
-    // write out the list - this would have removed the need for this first pass. However,
-    // we cannot actually back a TLVReader with a chained buffer since that violates the ability
-    // for us to create readers off-of readers. Each reader would assume exclusive ownership of the chained
-    // buffer and mutate the state within TLVPacketBufferBackingStore, preventing shared use.
+    // The list buffer already holds the start of the array and its elements (see BufferListItem), so the array
+    // only needs to be closed before being read in place.
     //
-    // To avoid that, a single contiguous buffer is the best likely approach for now.
+    // It is a single contiguous buffer rather than a chain of packet buffers: a TLVReader cannot be backed by a
+    // chained buffer since that violates the ability for us to create readers off-of readers. Each reader would
+    // assume exclusive ownership of the chained buffer and mutate the state within TLVPacketBufferBackingStore,
+    // preventing shared use.
     //
-    uint32_t totalBufSize = 0;
-    for (const auto & packetBuffer : mBufferedList)
+    if (mListBufferLength == 0)
     {
-        totalBufSize += packetBuffer->TotalLength();
+        //
+        // No element was buffered (e.g. an empty ReplaceAll), start an empty array.
+        //
+        ReturnErrorOnFailure(ReserveListBuffer(2));
+        mListBuffer[mListBufferLength++] = kListStartControlOctet;
     }
 
-    //
-    // Size of the start container and end container are just 1 byte each, but, let's just be safe.
-    //
-    totalBufSize += 4;
+    ReturnErrorOnFailure(ReserveListBuffer(1));
+    mListBuffer[mListBufferLength++] = kListEndControlOctet;
 
-    backingBuffer.Calloc(totalBufSize);
-    VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+    aReader.Init(mListBuffer.Get(), mListBufferLength);
 
-    TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), totalBufSize);
-    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Array, outerType));
+    return CHIP_NO_ERROR;
+}
 
-    for (auto & bufHandle : mBufferedList)
-    {
-        System::PacketBufferTLVReader reader;
+CHIP_ERROR BufferedReadCallback::ReserveListBuffer(size_t aLength)
+{
+    VerifyOrReturnError(mListBufferLength + aLength > mListBufferSize, CHIP_NO_ERROR);
 
-        reader.Init(std::move(bufHandle));
+    size_t newSize = std::max(mListBufferSize * 2, mListBufferLength + aLength);
+    Platform::ScopedMemoryBuffer<uint8_t> newBuffer;
+    VerifyOrReturnError(newBuffer.Alloc(newSize), CHIP_ERROR_NO_MEMORY);
 
-        ReturnErrorOnFailure(reader.Next());
-        ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), reader));
+    if (mListBufferLength > 0)
+    {
+        memcpy(newBuffer.Get(), mListBuffer.Get(), mListBufferLength);
     }
 
-    ReturnErrorOnFailure(writer.EndContainer(outerType));
-
-    writer.Finalize(backingBuffer);
-
-    aReader.Init(std::move(backingBuffer), totalBufSize);
-
+    mListBuffer     = std::move(newBuffer);
+    mListBufferSize = newSize;
     return CHIP_NO_ERROR;
 }
 
+void BufferedReadCallback::ClearBufferedList()
+{
+    mListBuffer.Free();
+    mListBufferSize   = 0;
+    mListBufferLength = 0;
+}
+
 CHIP_ERROR BufferedReadCallback::BufferListItem(TLV::TLVReader & reader)
 {
-    System::PacketBufferTLVWriter writer;
-    System::PacketBufferHandle handle;
+    TLV::TLVReader elementStart;
+    TLV::TLVWriter writer;
 
     //
-    // We conservatively allocate a packet buffer as big as an IPv6 MTU (since we're buffering
-    // data received over the wire, which should always fit within that).
+    // Any list element we buffer was received over the wire, so it fits within an IPv6 MTU. We reserve that much
+    // before the first element, and afterwards attempt the copy in whatever space is left, growing the buffer
+    // and copying again only if the element did not fit.
     //
-    // We could have snapshotted the reader at its current position, advanced it past the current element
-    // and computed the delta in its read point to figure out the size of the element before allocating
-    // our target buffer. However, the reader's current position is already set past the control octet
-    // and the tag. Consequently, the computed size is always going to omit the sizes of these two parts of the
-    // TLV element. Since the tag can vary in size, for now, let's just do the safe thing. In the future, if this is a problem,
-    // we can improve this.
-    //
-    handle = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
-    VerifyOrReturnError(!handle.IsNull(), CHIP_ERROR_NO_MEMORY);
+    if (mListBufferLength == 0)
+    {
+        ReturnErrorOnFailure(ReserveListBuffer(1 + chip::app::kMaxSecureSduLengthBytes));
+        mListBuffer[mListBufferLength++] = kListStartControlOctet;
+    }
 
-    writer.Init(std::move(handle), false);
+    elementStart.Init(reader);
 
-    ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), reader));
-    ReturnErrorOnFailure(writer.Finalize(&handle));
+    writer.Init(mListBuffer.Get() + mListBufferLength, mListBufferSize - mListBufferLength);
+    CHIP_ERROR err = writer.CopyElement(TLV::AnonymousTag(), reader);
+    if (err == CHIP_ERROR_BUFFER_TOO_SMALL)
+    {
+        ReturnErrorOnFailure(ReserveListBuffer(chip::app::kMaxSecureSduLengthBytes));
+        reader.Init(elementStart);
 
-    // Compact the buffer down to a more reasonably sized packet buffer
-    // if we can.
-    //
-    handle.RightSize();
+        writer.Init(mListBuffer.Get() + mListBufferLength, mListBufferSize - mListBufferLength);
+        err = writer.CopyElement(TLV::AnonymousTag(), reader);
+    }
+    ReturnErrorOnFailure(err);
+    ReturnErrorOnFailure(writer.Finalize());
 
-    mBufferedList.push_back(std::move(handle));
+    mListBufferLength += writer.GetLengthWritten();
 
     return CHIP_NO_ERROR;
 }
@@ -142,7 +157,7 @@ CHIP_ERROR BufferedReadCallback::BufferData(const ConcreteDataAttributePath & aP
         TLV::TLVType outerContainer;
 
         VerifyOrReturnError(apData->GetType() == TLV::kTLVType_Array, CHIP_ERROR_INVALID_TLV_ELEMENT);
-        mBufferedList.clear();
+        ClearBufferedList();
 
         ReturnErrorOnFailure(apData->EnterContainer(outerContainer));
 
@@ -201,7 +216,7 @@ CHIP_ERROR BufferedReadCallback::DispatchBufferedData(const ConcreteAttributePat
     }
 
     StatusIB statusIB;
-    TLV::ScopedBufferTLVReader reader;
+    TLV::TLVReader reader;
 
     ReturnErrorOnFailure(GenerateListTLV(reader));
 
@@ -221,7 +236,7 @@ CHIP_ERROR BufferedReadCallback::DispatchBufferedData(const ConcreteAttributePat
     //
     // Clear out our buffered contents to free up allocated buffers, and reset the buffered path.
     //
-    mBufferedList.clear();
+    ClearBufferedList();
     mBufferedPath = ConcreteDataAttributePath();
     return CHIP_NO_ERROR;
 }
@@ -23,7 +23,7 @@
 #include "system/TLVPacketBufferBackingStore.h"
 #include <app/AttributePathParams.h>
 #include <app/ReadClient.h>
-#include <vector>
+#include <lib/support/ScopedBuffer.h>
 
 namespace chip {
 namespace app {
@@ -42,9 +42,17 @@ public:
 
 private:
     /*
-     * Generates the reconsistuted TLV array from the stored individual list elements
+     * Terminates the TLV array of buffered list elements and points the reader at it. The reader reads the list buffer
+     * in place, so it is only valid until the buffered list is cleared.
      */
-    CHIP_ERROR GenerateListTLV(TLV::ScopedBufferTLVReader & reader);
+    CHIP_ERROR GenerateListTLV(TLV::TLVReader & reader);
+
+    /*
+     * Grows the list buffer, if needed, so that it can hold aLength more bytes.
+     */
+    CHIP_ERROR ReserveListBuffer(size_t aLength);
+
+    void ClearBufferedList();
 
     /*
      * Dispatch any buffered list data if we need to. Buffered data will only be dispatched if:
@@ -71,7 +79,7 @@ private:
     void OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus) override;
     void OnError(CHIP_ERROR aError) override
     {
-        mBufferedList.clear();
+        ClearBufferedList();
         return mCallback.OnError(aError);
     }
 
@@ -97,7 +105,7 @@ private:
     }
 
     virtual CHIP_ERROR OnUpdateDataVersionFilterList(DataVersionFilterIBs::Builder & aDataVersionFilterIBsBuilder,
-                                                     const Span<AttributePathParams> & aAttributePaths,
+                                                     const Span<const AttributePathParams> & aAttributePaths,
                                                      bool & aEncodedDataVersionList) override
     {
         return mCallback.OnUpdateDataVersionFilterList(aDataVersionFilterIBsBuilder, aAttributePaths, aEncodedDataVersionList);
@@ -114,15 +122,24 @@ private:
     }
 
     /*
-     * Given a reader positioned at a list element, allocate a packet buffer, copy the list item where
-     * the reader is positioned into that buffer and add it to our buffered list for tracking.
+     * Given a reader positioned at a list element, append the list item where the reader is positioned
+     * to the list buffer, growing it if needed.
      *
      * This should be called in list index order starting from the lowest index that needs to be buffered.
      *
      */
     CHIP_ERROR BufferListItem(TLV::TLVReader & reader);
     ConcreteDataAttributePath mBufferedPath;
-    std::vector<System::PacketBufferHandle> mBufferedList;
+
+    //
+    // The buffered list is kept as the TLV of an anonymous array under construction: the array's control
+    // octet followed by each element, appended in place. The buffer grows geometrically, so buffering a list
+    // costs a handful of allocations rather than one packet buffer per element, and it is dispatched without
+    // being copied again.
+    //
+    Platform::ScopedMemoryBuffer<uint8_t> mListBuffer;
+    size_t mListBufferSize   = 0;
+    size_t mListBufferLength = 0;
     Callback & mCallback;
 };
 
@@ -0,0 +1,197 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/core/Optional.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * An index of per-cluster interfaces (CommandHandlerInterface, AttributeAccessInterface) keyed by (endpoint, cluster).
+ *
+ * Interfaces are chained through their own SetNext()/GetNext() links into one of kBucketCount buckets, so the registry
+ * does not allocate.  Interfaces registered for all endpoints of a cluster are hashed with kInvalidEndpointId in place
+ * of the endpoint, which means a lookup probes at most two buckets instead of walking every registered interface.
+ *
+ * T must provide GetNext(), SetNext(), GetEndpointId() (an Optional<EndpointId>), GetClusterId(),
+ * Matches(EndpointId, ClusterId), Matches(const T &) and MatchesEndpoint(EndpointId).
+ */
+template <typename T, size_t kBucketCount = CHIP_CONFIG_CLUSTER_INTERFACE_REGISTRY_BUCKETS>
+class ClusterInterfaceRegistry
+{
+public:
+    static_assert(kBucketCount > 0, "ClusterInterfaceRegistry needs at least one bucket");
+
+    /**
+     * Add aInterface to the registry.  Returns false if an interface handling an overlapping set of paths is already
+     * registered, in which case the registry is unchanged.
+     */
+    bool Register(T * aInterface)
+    {
+        const Optional<EndpointId> endpointId = aInterface->GetEndpointId();
+        const ClusterId clusterId             = aInterface->GetClusterId();
+
+        if (endpointId.HasValue())
+        {
+            if (FindInBucket(endpointId.Value(), clusterId) != nullptr || FindInBucket(kInvalidEndpointId, clusterId) != nullptr)
+            {
+                return false;
+            }
+        }
+        else
+        {
+            // A wildcard registration overlaps every endpoint-specific one for the same cluster, wherever it is hashed.
+            // These are rare and usually happen once at startup, so a full scan is fine here.
+            for (T * head : mBuckets)
+            {
+                for (T * cur = head; cur != nullptr; cur = cur->GetNext())
+                {
+                    if (cur->Matches(*aInterface))
+                    {
+                        return false;
+                    }
+                }
+            }
+        }
+
+        T *& head = mBuckets[BucketIndex(endpointId.ValueOr(kInvalidEndpointId), clusterId)];
+        aInterface->SetNext(head);
+        head = aInterface;
+        return true;
+    }
+
+    /**
+     * Remove the registered interface that handles the same set of paths as aInterface.  Returns false if there is none.
+     */
+    bool Unregister(T * aInterface)
+    {
+        T *& head = mBuckets[BucketIndex(aInterface->GetEndpointId().ValueOr(kInvalidEndpointId), aInterface->GetClusterId())];
+        T * prev  = nullptr;
+
+        for (T * cur = head; cur != nullptr; cur = cur->GetNext())
+        {
+            if (cur->Matches(*aInterface))
+            {
+                Unlink(head, prev, cur);
+                return true;
+            }
+            prev = cur;
+        }
+
+        return false;
+    }
+
+    /**
+     * Remove every interface registered for the given specific endpoint.  Wildcard registrations are kept.
+     */
+    void UnregisterAllForEndpoint(EndpointId aEndpointId)
+    {
+        for (T *& head : mBuckets)
+        {
+            T * prev = nullptr;
+            T * cur  = head;
+            while (cur != nullptr)
+            {
+                T * next = cur->GetNext();
+                if (cur->MatchesEndpoint(aEndpointId))
+                {
+                    // Do not change prev in this case.
+                    Unlink(head, prev, cur);
+                }
+                else
+                {
+                    prev = cur;
+                }
+                cur = next;
+            }
+        }
+    }
+
+    /**
+     * Remove every interface, resetting their links.
+     */
+    void Clear()
+    {
+        for (T *& head : mBuckets)
+        {
+            while (head != nullptr)
+            {
+                T * next = head->GetNext();
+                head->SetNext(nullptr);
+                head = next;
+            }
+        }
+    }
+
+    /**
+     * Find the interface that handles the given concrete cluster, if any.  An endpoint-specific registration is looked up
+     * first; since registration rejects overlaps, at most one of the two probes can match.
+     */
+    T * Find(EndpointId aEndpointId, ClusterId aClusterId) const
+    {
+        T * found = FindInBucket(aEndpointId, aClusterId);
+        return (found != nullptr) ? found : FindInBucket(kInvalidEndpointId, aClusterId);
+    }
+
+private:
+    static size_t BucketIndex(EndpointId aEndpointId, ClusterId aClusterId)
+    {
+        // Standard cluster ids only use the low 16 bits, vendor-specific ones carry the vendor prefix in the high bits.
+        uint32_t hash = aClusterId ^ (aClusterId >> 16);
+        hash          = hash * 31 + aEndpointId;
+        return hash % kBucketCount;
+    }
+
+    T * FindInBucket(EndpointId aEndpointId, ClusterId aClusterId) const
+    {
+        for (T * cur = mBuckets[BucketIndex(aEndpointId, aClusterId)]; cur != nullptr; cur = cur->GetNext())
+        {
+            const Optional<EndpointId> endpointId = cur->GetEndpointId();
+            if (cur->GetClusterId() == aClusterId && endpointId.ValueOr(kInvalidEndpointId) == aEndpointId)
+            {
+                return cur;
+            }
+        }
+        return nullptr;
+    }
+
+    static void Unlink(T *& aHead, T * aPrev, T * aInterface)
+    {
+        if (aPrev == nullptr)
+        {
+            aHead = aInterface->GetNext();
+        }
+        else
+        {
+            aPrev->SetNext(aInterface->GetNext());
+        }
+        aInterface->SetNext(nullptr);
+    }
+
+    T * mBuckets[kBucketCount] = {};
+};
+
+} // namespace app
+} // namespace chip
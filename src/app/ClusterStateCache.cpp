@@ -19,6 +19,9 @@
 #include "system/SystemPacketBuffer.h"
 #include <app/ClusterStateCache.h>
 #include <app/InteractionModelEngine.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/support/TypeTraits.h>
+#include <string.h>
 #include <tuple>
 
 namespace chip {
@@ -47,8 +50,76 @@ size_t SizeOfStatusIB(const StatusIB & aStatus)
     return size;
 }
 
+constexpr uint8_t kSnapshotFormatVersion = 1;
+
+// Upper bounds of the TLV overhead of a snapshot, of each cluster in it and of each attribute in a cluster.
+constexpr size_t kSnapshotOverhead          = 64;
+constexpr size_t kSnapshotClusterOverhead   = 32;
+constexpr size_t kSnapshotAttributeOverhead = 24;
+
+enum class SnapshotTag : uint8_t
+{
+    kFormatVersion      = 1,
+    kDigest             = 2,
+    kHighestEventNumber = 3,
+    kClusters           = 4,
+};
+
+enum class ClusterSnapshotTag : uint8_t
+{
+    kEndpointId  = 1,
+    kClusterId   = 2,
+    kDataVersion = 3,
+    kAttributes  = 4,
+};
+
+enum class AttributeSnapshotTag : uint8_t
+{
+    kAttributeId   = 1,
+    kData          = 2,
+    kStatus        = 3,
+    kClusterStatus = 4,
+};
+
 } // anonymous namespace
 
+size_t ClusterStateCache::SizeOfAttributeState(const AttributeState & aState)
+{
+    if (aState.Is<StatusIB>())
+    {
+        return SizeOfStatusIB(aState.Get<StatusIB>());
+    }
+
+    if (aState.Is<size_t>())
+    {
+        return aState.Get<size_t>();
+    }
+
+    // The buffer is allocated to the exact size of the TLV element it holds.
+    VerifyOrDie(aState.Is<AttributeData>());
+    return aState.Get<AttributeData>().AllocatedSize();
+}
+
+bool ClusterStateCache::IsSameAttributeState(const AttributeState & aOld, const AttributeState & aNew)
+{
+    if (aOld.Is<StatusIB>() && aNew.Is<StatusIB>())
+    {
+        const StatusIB & oldStatus = aOld.Get<StatusIB>();
+        const StatusIB & newStatus = aNew.Get<StatusIB>();
+        return oldStatus.mStatus == newStatus.mStatus && oldStatus.mClusterStatus == newStatus.mClusterStatus;
+    }
+
+    if (aOld.Is<AttributeData>() && aNew.Is<AttributeData>())
+    {
+        const AttributeData & oldData = aOld.Get<AttributeData>();
+        const AttributeData & newData = aNew.Get<AttributeData>();
+        return oldData.AllocatedSize() == newData.AllocatedSize() &&
+            memcmp(oldData.Get(), newData.Get(), oldData.AllocatedSize()) == 0;
+    }
+
+    return false;
+}
+
 CHIP_ERROR ClusterStateCache::GetElementTLVSize(TLV::TLVReader * apData, size_t & aSize)
 {
     Platform::ScopedMemoryBufferWithSize<uint8_t> backingBuffer;
@@ -151,7 +222,27 @@ CHIP_ERROR ClusterStateCache::UpdateCache(const ConcreteDataAttributePath & aPat
         mAddedEndpoints.push_back(aPath.mEndpointId);
     }
 
-    mCache[aPath.mEndpointId][aPath.mClusterId].mAttributes[aPath.mAttributeId] = std::move(state);
+    auto & clusterState = mCache[aPath.mEndpointId][aPath.mClusterId];
+    auto attributeIter  = clusterState.mAttributes.find(aPath.mAttributeId);
+    if (attributeIter != clusterState.mAttributes.end())
+    {
+        //
+        // Clusters whose data version could not be filtered are sent in their entirety, even if only a few of their
+        // attributes changed.  If asked to, keep the cached copy of the others, and do not report them as changed.
+        //
+        if (mCacheData && mSkipUnchangedAttributes && IsSameAttributeState(attributeIter->second, state))
+        {
+            return CHIP_NO_ERROR;
+        }
+
+        clusterState.mAttributesSize -= SizeOfAttributeState(attributeIter->second);
+        attributeIter->second = std::move(state);
+    }
+    else
+    {
+        attributeIter = clusterState.mAttributes.emplace(aPath.mAttributeId, std::move(state)).first;
+    }
+    clusterState.mAttributesSize += SizeOfAttributeState(attributeIter->second);
 
     if (mCacheData)
     {
@@ -446,7 +537,8 @@ CHIP_ERROR ClusterStateCache::GetStatus(const ConcreteEventPath & path, StatusIB
     return CHIP_NO_ERROR;
 }
 
-void ClusterStateCache::GetSortedFilters(std::vector<std::pair<DataVersionFilter, size_t>> & aVector) const
+void ClusterStateCache::GetSortedFilters(const Span<const AttributePathParams> & aAttributePaths,
+                                         std::vector<std::pair<DataVersionFilter, size_t>> & aVector) const
 {
     for (auto const & endpointIter : mCache)
     {
@@ -457,45 +549,32 @@ void ClusterStateCache::GetSortedFilters(std::vector<std::pair<DataVersionFilter
             {
                 continue;
             }
-            DataVersion dataVersion = clusterIter.second.mCommittedDataVersion.Value();
-            size_t clusterSize      = 0;
-            ClusterId clusterId     = clusterIter.first;
 
-            for (auto const & attributeIter : clusterIter.second.mAttributes)
+            if (clusterIter.second.mAttributesSize == 0)
             {
-                if (attributeIter.second.Is<StatusIB>())
-                {
-                    clusterSize += SizeOfStatusIB(attributeIter.second.Get<StatusIB>());
-                }
-                else if (attributeIter.second.Is<size_t>())
-                {
-                    clusterSize += attributeIter.second.Get<size_t>();
-                }
-                else
+                // No data in this cluster, so no point in sending a dataVersion
+                // along at all.
+                continue;
+            }
+
+            DataVersionFilter filter(endpointId, clusterIter.first, clusterIter.second.mCommittedDataVersion.Value());
+
+            // if the particular cached cluster does not intersect with user provided attribute paths, skip the cached one
+            bool intersected = false;
+            for (const auto & attributePath : aAttributePaths)
+            {
+                if (attributePath.IncludesAttributesInCluster(filter))
                 {
-                    VerifyOrDie(attributeIter.second.Is<AttributeData>());
-                    TLV::TLVReader bufReader;
-                    bufReader.Init(attributeIter.second.Get<AttributeData>().Get(),
-                                   attributeIter.second.Get<AttributeData>().AllocatedSize());
-                    ReturnOnFailure(bufReader.Next());
-                    // Skip to the end of the element.
-                    ReturnOnFailure(bufReader.Skip());
-
-                    // Compute the amount of value data
-                    clusterSize += bufReader.GetLengthRead();
+                    intersected = true;
+                    break;
                 }
             }
-
-            if (clusterSize == 0)
+            if (!intersected)
             {
-                // No data in this cluster, so no point in sending a dataVersion
-                // along at all.
                 continue;
             }
 
-            DataVersionFilter filter(endpointId, clusterId, dataVersion);
-
-            aVector.push_back(std::make_pair(filter, clusterSize));
+            aVector.push_back(std::make_pair(filter, clusterIter.second.mAttributesSize));
         }
     }
 
@@ -506,7 +585,7 @@ void ClusterStateCache::GetSortedFilters(std::vector<std::pair<DataVersionFilter
 }
 
 CHIP_ERROR ClusterStateCache::OnUpdateDataVersionFilterList(DataVersionFilterIBs::Builder & aDataVersionFilterIBsBuilder,
-                                                            const Span<AttributePathParams> & aAttributePaths,
+                                                            const Span<const AttributePathParams> & aAttributePaths,
                                                             bool & aEncodedDataVersionList)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -543,28 +622,15 @@ CHIP_ERROR ClusterStateCache::OnUpdateDataVersionFilterList(DataVersionFilterIBs
     }
 
     std::vector<std::pair<DataVersionFilter, size_t>> filterVector;
-    GetSortedFilters(filterVector);
+    GetSortedFilters(aAttributePaths, filterVector);
+
+    const uint32_t startLength = aDataVersionFilterIBsBuilder.GetWriter()->GetLengthWritten();
 
     aEncodedDataVersionList = false;
     for (auto & filter : filterVector)
     {
-        bool intersected = false;
         aDataVersionFilterIBsBuilder.Checkpoint(backup);
 
-        // if the particular cached cluster does not intersect with user provided attribute paths, skip the cached one
-        for (const auto & attributePath : aAttributePaths)
-        {
-            if (attributePath.IncludesAttributesInCluster(filter.first))
-            {
-                intersected = true;
-                break;
-            }
-        }
-        if (!intersected)
-        {
-            continue;
-        }
-
         DataVersionFilterIB::Builder & filterIB = aDataVersionFilterIBsBuilder.CreateDataVersionFilter();
         SuccessOrExit(err = aDataVersionFilterIBsBuilder.GetError());
         ClusterPathIB::Builder & filterPath = filterIB.CreatePath();
@@ -572,6 +638,12 @@ CHIP_ERROR ClusterStateCache::OnUpdateDataVersionFilterList(DataVersionFilterIBs
         SuccessOrExit(
             err = filterPath.Endpoint(filter.first.mEndpointId).Cluster(filter.first.mClusterId).EndOfClusterPathIB().GetError());
         SuccessOrExit(err = filterIB.DataVersion(filter.first.mDataVersion.Value()).EndOfDataVersionFilterIB().GetError());
+        if (aDataVersionFilterIBsBuilder.GetWriter()->GetLengthWritten() - startLength > mDataVersionFilterBudget)
+        {
+            ChipLogProgress(DataManagement, "OnUpdateDataVersionFilterList over budget; rolling back");
+            aDataVersionFilterIBsBuilder.Rollback(backup);
+            break;
+        }
         ChipLogProgress(DataManagement, "Update DataVersionFilter: Endpoint=%u Cluster=" ChipLogFormatMEI " Version=%" PRIu32,
                         filter.first.mEndpointId, ChipLogValueMEI(filter.first.mClusterId), filter.first.mDataVersion.Value());
 
@@ -588,6 +660,289 @@ exit:
     return err;
 }
 
+size_t ClusterStateCache::GetSnapshotSizeUpperBound() const
+{
+    size_t size = kSnapshotOverhead;
+    for (auto const & endpointIter : mCache)
+    {
+        for (auto const & clusterIter : endpointIter.second)
+        {
+            size += kSnapshotClusterOverhead + clusterIter.second.mAttributesSize +
+                clusterIter.second.mAttributes.size() * kSnapshotAttributeOverhead;
+        }
+    }
+    return size;
+}
+
+CHIP_ERROR ClusterStateCache::SaveSnapshot(MutableByteSpan & aBuffer) const
+{
+    VerifyOrReturnError(mCacheData, CHIP_ERROR_INCORRECT_STATE);
+
+    TLV::TLVWriter writer;
+    TLV::TLVType outerType;
+    TLV::TLVType clustersType;
+    uint8_t emptyDigest[Crypto::kSHA256_Hash_Length] = { 0 };
+
+    writer.Init(aBuffer);
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outerType));
+    ReturnErrorOnFailure(writer.Put(TLV::ContextTag(SnapshotTag::kFormatVersion), kSnapshotFormatVersion));
+
+    // The digest covers everything after it, so it is filled in once the rest of the snapshot is written.
+    ReturnErrorOnFailure(writer.Put(TLV::ContextTag(SnapshotTag::kDigest), ByteSpan(emptyDigest)));
+    const size_t digestedStart = writer.GetLengthWritten();
+
+    if (mHighestReceivedEventNumber.HasValue())
+    {
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(SnapshotTag::kHighestEventNumber), mHighestReceivedEventNumber.Value()));
+    }
+
+    ReturnErrorOnFailure(writer.StartContainer(TLV::ContextTag(SnapshotTag::kClusters), TLV::kTLVType_Array, clustersType));
+    for (auto const & endpointIter : mCache)
+    {
+        for (auto const & clusterIter : endpointIter.second)
+        {
+            ReturnErrorOnFailure(SaveClusterSnapshot(writer, endpointIter.first, clusterIter.first, clusterIter.second));
+        }
+    }
+    ReturnErrorOnFailure(writer.EndContainer(clustersType));
+    ReturnErrorOnFailure(writer.EndContainer(outerType));
+    ReturnErrorOnFailure(writer.Finalize());
+
+    const size_t length = writer.GetLengthWritten();
+    ReturnErrorOnFailure(Crypto::Hash_SHA256(aBuffer.data() + digestedStart, length - digestedStart,
+                                             aBuffer.data() + digestedStart - Crypto::kSHA256_Hash_Length));
+    aBuffer.reduce_size(length);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ClusterStateCache::SaveClusterSnapshot(TLV::TLVWriter & aWriter, EndpointId aEndpointId, ClusterId aClusterId,
+                                                  const ClusterState & aClusterState)
+{
+    TLV::TLVType clusterType;
+    TLV::TLVType attributesType;
+
+    ReturnErrorOnFailure(aWriter.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, clusterType));
+    ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(ClusterSnapshotTag::kEndpointId), aEndpointId));
+    ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(ClusterSnapshotTag::kClusterId), aClusterId));
+    if (aClusterState.mCommittedDataVersion.HasValue())
+    {
+        ReturnErrorOnFailure(
+            aWriter.Put(TLV::ContextTag(ClusterSnapshotTag::kDataVersion), aClusterState.mCommittedDataVersion.Value()));
+    }
+
+    ReturnErrorOnFailure(
+        aWriter.StartContainer(TLV::ContextTag(ClusterSnapshotTag::kAttributes), TLV::kTLVType_Array, attributesType));
+    for (auto const & attributeIter : aClusterState.mAttributes)
+    {
+        TLV::TLVType attributeType;
+        ReturnErrorOnFailure(aWriter.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, attributeType));
+        ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(AttributeSnapshotTag::kAttributeId), attributeIter.first));
+        if (attributeIter.second.Is<StatusIB>())
+        {
+            const StatusIB & status = attributeIter.second.Get<StatusIB>();
+            ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(AttributeSnapshotTag::kStatus), to_underlying(status.mStatus)));
+            if (status.mClusterStatus.HasValue())
+            {
+                ReturnErrorOnFailure(
+                    aWriter.Put(TLV::ContextTag(AttributeSnapshotTag::kClusterStatus), status.mClusterStatus.Value()));
+            }
+        }
+        else
+        {
+            VerifyOrDie(attributeIter.second.Is<AttributeData>());
+            const AttributeData & data = attributeIter.second.Get<AttributeData>();
+            ReturnErrorOnFailure(
+                aWriter.Put(TLV::ContextTag(AttributeSnapshotTag::kData), ByteSpan(data.Get(), data.AllocatedSize())));
+        }
+        ReturnErrorOnFailure(aWriter.EndContainer(attributeType));
+    }
+    ReturnErrorOnFailure(aWriter.EndContainer(attributesType));
+
+    return aWriter.EndContainer(clusterType);
+}
+
+CHIP_ERROR ClusterStateCache::LoadSnapshot(const ByteSpan & aSnapshot)
+{
+    TLV::TLVReader reader;
+    TLV::TLVType outerType;
+    uint8_t formatVersion;
+    ByteSpan digest;
+    uint8_t computedDigest[Crypto::kSHA256_Hash_Length];
+    NodeState nodeState;
+    Optional<EventNumber> highestReceivedEventNumber;
+    CHIP_ERROR err;
+
+    VerifyOrReturnError(mCacheData, CHIP_ERROR_INCORRECT_STATE);
+
+    reader.Init(aSnapshot);
+    ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag()));
+    ReturnErrorOnFailure(reader.EnterContainer(outerType));
+    ReturnErrorOnFailure(reader.Next(TLV::ContextTag(SnapshotTag::kFormatVersion)));
+    ReturnErrorOnFailure(reader.Get(formatVersion));
+    VerifyOrReturnError(formatVersion == kSnapshotFormatVersion, CHIP_ERROR_VERSION_MISMATCH);
+
+    // Check the digest before parsing anything it covers.
+    ReturnErrorOnFailure(reader.Next(TLV::ContextTag(SnapshotTag::kDigest)));
+    ReturnErrorOnFailure(reader.Get(digest));
+    VerifyOrReturnError(digest.size() == sizeof(computedDigest), CHIP_ERROR_INVALID_TLV_ELEMENT);
+    const uint8_t * digestedStart = digest.data() + digest.size();
+    ReturnErrorOnFailure(Crypto::Hash_SHA256(
+        digestedStart, static_cast<size_t>(aSnapshot.data() + aSnapshot.size() - digestedStart), computedDigest));
+    VerifyOrReturnError(digest.data_equal(ByteSpan(computedDigest)), CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        if (reader.GetTag() == TLV::ContextTag(SnapshotTag::kHighestEventNumber))
+        {
+            EventNumber eventNumber;
+            ReturnErrorOnFailure(reader.Get(eventNumber));
+            highestReceivedEventNumber.SetValue(eventNumber);
+        }
+        else if (reader.GetTag() == TLV::ContextTag(SnapshotTag::kClusters))
+        {
+            TLV::TLVType clustersType;
+            ReturnErrorOnFailure(reader.EnterContainer(clustersType));
+            while ((err = reader.Next()) == CHIP_NO_ERROR)
+            {
+                ReturnErrorOnFailure(LoadClusterSnapshot(reader, nodeState));
+            }
+            VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+            ReturnErrorOnFailure(reader.ExitContainer(clustersType));
+        }
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    ReturnErrorOnFailure(reader.ExitContainer(outerType));
+
+    mCache = std::move(nodeState);
+    if (highestReceivedEventNumber.HasValue())
+    {
+        mHighestReceivedEventNumber = highestReceivedEventNumber;
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ClusterStateCache::LoadClusterSnapshot(TLV::TLVReader & aReader, NodeState & aNodeState)
+{
+    TLV::TLVType clusterType;
+    EndpointId endpointId = kInvalidEndpointId;
+    ClusterId clusterId   = kInvalidClusterId;
+    ClusterState clusterState;
+    CHIP_ERROR err;
+
+    VerifyOrReturnError(aReader.GetType() == TLV::kTLVType_Structure, CHIP_ERROR_WRONG_TLV_TYPE);
+    ReturnErrorOnFailure(aReader.EnterContainer(clusterType));
+    while ((err = aReader.Next()) == CHIP_NO_ERROR)
+    {
+        if (!TLV::IsContextTag(aReader.GetTag()))
+        {
+            continue;
+        }
+
+        switch (TLV::TagNumFromTag(aReader.GetTag()))
+        {
+        case to_underlying(ClusterSnapshotTag::kEndpointId):
+            ReturnErrorOnFailure(aReader.Get(endpointId));
+            break;
+        case to_underlying(ClusterSnapshotTag::kClusterId):
+            ReturnErrorOnFailure(aReader.Get(clusterId));
+            break;
+        case to_underlying(ClusterSnapshotTag::kDataVersion): {
+            DataVersion dataVersion;
+            ReturnErrorOnFailure(aReader.Get(dataVersion));
+            clusterState.mCommittedDataVersion.SetValue(dataVersion);
+            break;
+        }
+        case to_underlying(ClusterSnapshotTag::kAttributes): {
+            TLV::TLVType attributesType;
+            ReturnErrorOnFailure(aReader.EnterContainer(attributesType));
+            while ((err = aReader.Next()) == CHIP_NO_ERROR)
+            {
+                ReturnErrorOnFailure(LoadAttributeSnapshot(aReader, clusterState));
+            }
+            VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+            ReturnErrorOnFailure(aReader.ExitContainer(attributesType));
+            break;
+        }
+        default:
+            break;
+        }
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    ReturnErrorOnFailure(aReader.ExitContainer(clusterType));
+
+    VerifyOrReturnError(endpointId != kInvalidEndpointId && clusterId != kInvalidClusterId, CHIP_ERROR_INVALID_TLV_ELEMENT);
+    // A snapshot written by SaveSnapshot() holds each cluster once.
+    auto inserted = aNodeState[endpointId].emplace(clusterId, std::move(clusterState));
+    VerifyOrReturnError(inserted.second, CHIP_ERROR_INVALID_TLV_ELEMENT);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ClusterStateCache::LoadAttributeSnapshot(TLV::TLVReader & aReader, ClusterState & aClusterState)
+{
+    TLV::TLVType attributeType;
+    AttributeId attributeId = kInvalidAttributeId;
+    AttributeState state;
+    StatusIB status;
+    bool hasStatus = false;
+    CHIP_ERROR err;
+
+    VerifyOrReturnError(aReader.GetType() == TLV::kTLVType_Structure, CHIP_ERROR_WRONG_TLV_TYPE);
+    ReturnErrorOnFailure(aReader.EnterContainer(attributeType));
+    while ((err = aReader.Next()) == CHIP_NO_ERROR)
+    {
+        if (!TLV::IsContextTag(aReader.GetTag()))
+        {
+            continue;
+        }
+
+        switch (TLV::TagNumFromTag(aReader.GetTag()))
+        {
+        case to_underlying(AttributeSnapshotTag::kAttributeId):
+            ReturnErrorOnFailure(aReader.Get(attributeId));
+            break;
+        case to_underlying(AttributeSnapshotTag::kData): {
+            ByteSpan data;
+            AttributeData buffer;
+            ReturnErrorOnFailure(aReader.Get(data));
+            VerifyOrReturnError(!data.empty(), CHIP_ERROR_INVALID_TLV_ELEMENT);
+            buffer.Calloc(data.size());
+            VerifyOrReturnError(buffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+            memcpy(buffer.Get(), data.data(), data.size());
+            state.Set<AttributeData>(std::move(buffer));
+            break;
+        }
+        case to_underlying(AttributeSnapshotTag::kStatus): {
+            std::underlying_type_t<Protocols::InteractionModel::Status> statusCode;
+            ReturnErrorOnFailure(aReader.Get(statusCode));
+            status.mStatus = static_cast<Protocols::InteractionModel::Status>(statusCode);
+            hasStatus      = true;
+            break;
+        }
+        case to_underlying(AttributeSnapshotTag::kClusterStatus): {
+            ClusterStatus clusterStatus;
+            ReturnErrorOnFailure(aReader.Get(clusterStatus));
+            status.mClusterStatus.SetValue(clusterStatus);
+            break;
+        }
+        default:
+            break;
+        }
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    ReturnErrorOnFailure(aReader.ExitContainer(attributeType));
+
+    if (hasStatus)
+    {
+        state.Set<StatusIB>(status);
+    }
+    VerifyOrReturnError(attributeId != kInvalidAttributeId && state.Valid(), CHIP_ERROR_INVALID_TLV_ELEMENT);
+
+    const size_t size = SizeOfAttributeState(state);
+    VerifyOrReturnError(aClusterState.mAttributes.emplace(attributeId, std::move(state)).second, CHIP_ERROR_INVALID_TLV_ELEMENT);
+    aClusterState.mAttributesSize += size;
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR ClusterStateCache::GetLastReportDataPath(ConcreteClusterPath & aPath)
 {
     if (mLastReportDataPath.IsValidConcreteClusterPath())
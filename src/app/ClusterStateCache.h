@@ -31,6 +31,7 @@
 #include <map>
 #include <queue>
 #include <set>
+#include <stdint.h>
 #include <vector>
 
 namespace chip {
@@ -107,6 +108,21 @@ public:
         mHighestReceivedEventNumber.SetValue(highestReceivedEventNumber);
     }
 
+    /*
+     * Limit how many bytes of the read / subscribe request the data version filters for the cached clusters may use.
+     * Filters are added starting with the clusters holding the most data, so a small budget still avoids the largest
+     * re-downloads while leaving room in the request.  By default, filters fill up whatever space is left in the request.
+     */
+    void SetDataVersionFilterBudget(size_t aMaxBytes) { mDataVersionFilterBudget = aMaxBytes; }
+
+    /*
+     * When enabled, an attribute reported with the value already in the cache (as happens for every attribute of a cluster
+     * whose data version could not be filtered on resubscribe) keeps the cached buffer and is not reported through
+     * OnAttributeChanged / OnClusterChanged.  By default every reported attribute is reported as changed.  Only applies to
+     * caches that store attribute data.
+     */
+    void SetSkipUnchangedAttributes(bool aSkip) { mSkipUnchangedAttributes = aSkip; }
+
     /*
      * When registering as a callback to the ReadClient, the ClusterStateCache cannot not be passed as a callback
      * directly. Instead, utilize this method below to correctly set up the callback chain such that
@@ -499,6 +515,44 @@ public:
      */
     CHIP_ERROR GetLastReportDataPath(ConcreteClusterPath & aPath);
 
+    /*
+     * Serialize the cached attribute data and statuses, the committed cluster data versions and the highest received
+     * event number into aBuffer, and shrink aBuffer to the size of the snapshot. Cached events are not included.
+     *
+     * The snapshot is a single TLV structure whose contents are covered by a SHA-256 digest, so that it can be kept as is
+     * (e.g. one storage entry or file per node) and validated and parsed in place when the node is needed again.
+     *
+     * Notable return values:
+     *      - CHIP_ERROR_BUFFER_TOO_SMALL if aBuffer cannot hold the snapshot. GetSnapshotSizeUpperBound() returns a size
+     *        that is always large enough.
+     *
+     *      - CHIP_ERROR_INCORRECT_STATE if this cache only tracks the size of attributes (cacheData is false).
+     *
+     */
+    CHIP_ERROR SaveSnapshot(MutableByteSpan & aBuffer) const;
+
+    size_t GetSnapshotSizeUpperBound() const;
+
+    /*
+     * Replace the cached attributes and data versions, as well as the highest received event number if the snapshot has
+     * one, with the contents of a snapshot produced by SaveSnapshot(). The cache is left unchanged if the snapshot cannot
+     * be loaded.
+     *
+     * No callbacks are called for the loaded data. Since the data versions are restored, a subscription made through this
+     * cache afterwards only needs to receive the clusters that changed since the snapshot was taken.
+     *
+     * Notable return values:
+     *      - CHIP_ERROR_INTEGRITY_CHECK_FAILED if the snapshot does not match its digest.
+     *
+     *      - CHIP_ERROR_VERSION_MISMATCH if the snapshot was written in a format this version does not understand.
+     *
+     *      - CHIP_ERROR_INVALID_TLV_ELEMENT if the snapshot is malformed, e.g. lists the same cluster twice.
+     *
+     *      - CHIP_ERROR_INCORRECT_STATE if this cache only tracks the size of attributes (cacheData is false).
+     *
+     */
+    CHIP_ERROR LoadSnapshot(const ByteSpan & aSnapshot);
+
 private:
     // An attribute state can be one of three things:
     // * If we got a path-specific error for the attribute, the corresponding
@@ -515,11 +569,15 @@ private:
     // mCurrentDataVersion represents a known data version for a cluster.  In order for this to have a
     // value the cluster must be included in a path in mRequestPathSet that has a wildcard attribute
     // and we must not be in the middle of receiving reports for that cluster.
+    //
+    // mAttributesSize is the sum of the TLV sizes of mAttributes, kept up to date as attributes are updated so that
+    // data version filters can be prioritized without walking the cached data.
     struct ClusterState
     {
         std::map<AttributeId, AttributeState> mAttributes;
         Optional<DataVersion> mPendingDataVersion;
         Optional<DataVersion> mCommittedDataVersion;
+        size_t mAttributesSize = 0;
     };
     using EndpointState = std::map<ClusterId, ClusterState>;
     using NodeState     = std::map<EndpointId, EndpointState>;
@@ -612,7 +670,7 @@ private:
     }
 
     virtual CHIP_ERROR OnUpdateDataVersionFilterList(DataVersionFilterIBs::Builder & aDataVersionFilterIBsBuilder,
-                                                     const Span<AttributePathParams> & aAttributePaths,
+                                                     const Span<const AttributePathParams> & aAttributePaths,
                                                      bool & aEncodedDataVersionList) override;
 
     void OnUnsolicitedMessageFromPublisher(ReadClient * apReadClient) override
@@ -623,13 +681,25 @@ private:
     // Commit the pending cluster data version, if there is one.
     void CommitPendingDataVersion();
 
-    // Get our list of data version filters, sorted from larges to smallest by the total size of the TLV
-    // payload for the filter's cluster.  Applying filters in this order should maximize space savings
-    // on the wire if not all filters can be applied.
-    void GetSortedFilters(std::vector<std::pair<DataVersionFilter, size_t>> & aVector) const;
+    // Get our list of data version filters for the clusters included in aAttributePaths, sorted from largest to
+    // smallest by the total size of the TLV payload for the filter's cluster.  Applying filters in this order should
+    // maximize space savings on the wire if not all filters can be applied.
+    void GetSortedFilters(const Span<const AttributePathParams> & aAttributePaths,
+                          std::vector<std::pair<DataVersionFilter, size_t>> & aVector) const;
 
     CHIP_ERROR GetElementTLVSize(TLV::TLVReader * apData, size_t & aSize);
 
+    // Size of the TLV payload an attribute state stands for.
+    static size_t SizeOfAttributeState(const AttributeState & aState);
+
+    // Whether storing aNew over aOld would leave the cached value unchanged.
+    static bool IsSameAttributeState(const AttributeState & aOld, const AttributeState & aNew);
+
+    static CHIP_ERROR SaveClusterSnapshot(TLV::TLVWriter & aWriter, EndpointId aEndpointId, ClusterId aClusterId,
+                                          const ClusterState & aClusterState);
+    static CHIP_ERROR LoadClusterSnapshot(TLV::TLVReader & aReader, NodeState & aNodeState);
+    static CHIP_ERROR LoadAttributeSnapshot(TLV::TLVReader & aReader, ClusterState & aClusterState);
+
     Callback & mCallback;
     NodeState mCache;
     std::set<ConcreteAttributePath> mChangedAttributeSet;
@@ -641,6 +711,8 @@ private:
     std::map<ConcreteEventPath, StatusIB> mEventStatusCache;
     BufferedReadCallback mBufferedReader;
     ConcreteClusterPath mLastReportDataPath = ConcreteClusterPath(kInvalidEndpointId, kInvalidClusterId);
+    size_t mDataVersionFilterBudget         = SIZE_MAX;
+    bool mSkipUnchangedAttributes           = false;
     const bool mCacheData                   = true;
 };
 
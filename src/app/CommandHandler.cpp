@@ -53,7 +53,19 @@ CHIP_ERROR CommandHandler::AllocateBuffer()
         System::PacketBufferHandle commandPacket = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
         VerifyOrReturnError(!commandPacket.IsNull(), CHIP_ERROR_NO_MEMORY);
 
+        // Always limit the size of the packet to fit within kMaxSecureSduLengthBytes regardless of the available buffer capacity,
+        // so that a response chunk filled up to the limit can still be sent.
+        uint16_t reservedSize = 0;
+        if (commandPacket->AvailableDataLength() > kMaxSecureSduLengthBytes)
+        {
+            reservedSize = static_cast<uint16_t>(commandPacket->AvailableDataLength() - kMaxSecureSduLengthBytes);
+        }
+
+        // ... and we need to reserve some extra space for the MIC field.
+        reservedSize = static_cast<uint16_t>(reservedSize + Crypto::CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES);
+
         mCommandMessageWriter.Init(std::move(commandPacket));
+        ReturnErrorOnFailure(mCommandMessageWriter.ReserveBuffer(reservedSize));
         ReturnErrorOnFailure(mInvokeResponseBuilder.Init(&mCommandMessageWriter));
 
         mInvokeResponseBuilder.SuppressResponse(mSuppressResponse);
@@ -61,6 +73,8 @@ CHIP_ERROR CommandHandler::AllocateBuffer()
 
         mInvokeResponseBuilder.CreateInvokeResponses();
         ReturnErrorOnFailure(mInvokeResponseBuilder.GetError());
+
+        ReturnErrorOnFailure(mCommandMessageWriter.ReserveBuffer(kReservedSizeForTLVEncodingOverhead));
         mBufferAllocated = true;
     }
 
@@ -117,11 +131,14 @@ Status CommandHandler::ProcessInvokeRequest(System::PacketBufferHandle && payloa
     invokeRequests.GetReader(&invokeRequestsReader);
 
     {
-        // We don't support handling multiple commands but the protocol is ready to support it in the future, reject all of them and
-        // IM Engine will send a status response.
         size_t commandCount = 0;
         TLV::Utilities::Count(invokeRequestsReader, commandCount, false /* recurse */);
-        VerifyOrReturnError(commandCount == 1, Status::InvalidAction);
+        VerifyOrReturnError(commandCount > 0, Status::InvalidAction);
+        if (commandCount > 1 && !mExchangeCtx->IsGroupExchangeContext())
+        {
+            Status status = ValidateCommandPathsAreUnique(invokeRequestsReader);
+            VerifyOrReturnError(status == Status::Success, status);
+        }
     }
 
     while (CHIP_NO_ERROR == (err = invokeRequestsReader.Next()))
@@ -154,17 +171,101 @@ Status CommandHandler::ProcessInvokeRequest(System::PacketBufferHandle && payloa
     return Status::Success;
 }
 
+namespace {
+CHIP_ERROR DecodeConcreteCommandPath(const TLV::TLVReader & aReader, ConcreteCommandPath & aPath)
+{
+    CommandDataIB::Parser commandData;
+    CommandPathIB::Parser commandPath;
+    ReturnErrorOnFailure(commandData.Init(aReader));
+    ReturnErrorOnFailure(commandData.GetPath(&commandPath));
+    ReturnErrorOnFailure(commandPath.GetEndpointId(&aPath.mEndpointId));
+    ReturnErrorOnFailure(commandPath.GetClusterId(&aPath.mClusterId));
+    return commandPath.GetCommandId(&aPath.mCommandId);
+}
+} // anonymous namespace
+
+Status CommandHandler::ValidateCommandPathsAreUnique(const TLV::TLVReader & aInvokeRequestsReader)
+{
+    // The number of commands in a single request is bounded by the message size, so a quadratic scan over copies of the
+    // reader is cheaper than keeping a table of the paths seen so far. Malformed entries are skipped here, they are rejected
+    // when the request is processed.
+    TLV::TLVReader outerReader(aInvokeRequestsReader);
+
+    while (outerReader.Next() == CHIP_NO_ERROR)
+    {
+        ConcreteCommandPath path(0, 0, 0);
+        if (DecodeConcreteCommandPath(outerReader, path) != CHIP_NO_ERROR)
+        {
+            continue;
+        }
+
+        TLV::TLVReader innerReader(outerReader);
+        while (innerReader.Next() == CHIP_NO_ERROR)
+        {
+            ConcreteCommandPath otherPath(0, 0, 0);
+            if (DecodeConcreteCommandPath(innerReader, otherPath) == CHIP_NO_ERROR && path == otherPath)
+            {
+                ChipLogError(DataManagement,
+                             "Invoke request repeats Endpoint=%u Cluster=" ChipLogFormatMEI " Command=" ChipLogFormatMEI,
+                             path.mEndpointId, ChipLogValueMEI(path.mClusterId), ChipLogValueMEI(path.mCommandId));
+                return Status::InvalidAction;
+            }
+        }
+    }
+
+    return Status::Success;
+}
+
 CHIP_ERROR CommandHandler::OnMessageReceived(Messaging::ExchangeContext * apExchangeContext, const PayloadHeader & aPayloadHeader,
                                              System::PacketBufferHandle && aPayload)
 {
-    ChipLogDetail(DataManagement, "CommandHandler: Unexpected message type %d", aPayloadHeader.GetMessageType());
-    StatusResponse::Send(Status::InvalidAction, mExchangeCtx.Get(), false /*aExpectResponse*/);
-    return CHIP_ERROR_INVALID_MESSAGE_TYPE;
+    CHIP_ERROR err          = CHIP_ERROR_INVALID_MESSAGE_TYPE;
+    bool sendStatusResponse = true;
+    // Only the StatusResponse acknowledging a chunk of the response is expected.
+    const bool awaitingChunkAck = mState == State::CommandSent && !mChunks.IsNull();
+
+    if (awaitingChunkAck && aPayloadHeader.HasMessageType(Protocols::InteractionModel::MsgType::StatusResponse))
+    {
+        CHIP_ERROR statusError = CHIP_NO_ERROR;
+        err                    = StatusResponse::ProcessStatusResponse(std::move(aPayload), statusError);
+        if (err == CHIP_NO_ERROR)
+        {
+            sendStatusResponse = false;
+            err                = statusError;
+        }
+        if (err == CHIP_NO_ERROR)
+        {
+            err = SendNextChunk();
+        }
+    }
+    else
+    {
+        ChipLogDetail(DataManagement, "CommandHandler: Unexpected message type %d", aPayloadHeader.GetMessageType());
+    }
+
+    if (sendStatusResponse)
+    {
+        StatusResponse::Send(Status::InvalidAction, mExchangeCtx.Get(), false /*aExpectResponse*/);
+    }
+
+    if (awaitingChunkAck && (err != CHIP_NO_ERROR || mChunks.IsNull()))
+    {
+        Close();
+    }
+    return err;
+}
+
+void CommandHandler::OnResponseTimeout(Messaging::ExchangeContext * ec)
+{
+    ChipLogError(DataManagement, "Time out! failed to receive status response from Exchange: " ChipLogFormatExchange,
+                 ChipLogValueExchange(ec));
+    Close();
 }
 
 void CommandHandler::Close()
 {
     mSuppressResponse = false;
+    mChunks           = nullptr;
     MoveToState(State::AwaitingDestruction);
 
     // We must finish all async work before we can shut down a CommandHandler. The actual CommandHandler MUST finish their work
@@ -207,6 +308,11 @@ void CommandHandler::DecrementHoldOff()
             {
                 ChipLogError(DataManagement, "Failed to send command response: %" CHIP_ERROR_FORMAT, err.Format());
             }
+            else if (!mChunks.IsNull())
+            {
+                // The remaining chunks are sent as the requester acknowledges each of them, see OnMessageReceived.
+                return;
+            }
         }
     }
 
@@ -218,20 +324,60 @@ CHIP_ERROR CommandHandler::SendCommandResponse()
     System::PacketBufferHandle commandPacket;
 
     VerifyOrReturnError(mPendingWork == 0, CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnError(mState == State::AddedCommand, CHIP_ERROR_INCORRECT_STATE);
+    // The last chunk of a response sent in several chunks may be empty, if the response that overflowed the previous chunk
+    // could not be added to it either.
+    VerifyOrReturnError(mState == State::AddedCommand || (mState == State::Idle && !mChunks.IsNull()), CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mExchangeCtx, CHIP_ERROR_INCORRECT_STATE);
 
+    ReturnErrorOnFailure(AllocateBuffer());
     ReturnErrorOnFailure(Finalize(commandPacket));
-    ReturnErrorOnFailure(
-        mExchangeCtx->SendMessage(Protocols::InteractionModel::MsgType::InvokeCommandResponse, std::move(commandPacket)));
-    // The ExchangeContext is automatically freed here, and it makes mpExchangeCtx be temporarily dangling, but in
-    // all cases, we are going to call Close immediately after this function, which nulls out mpExchangeCtx.
+    mChunks.AddToEnd(std::move(commandPacket));
+    return SendNextChunk();
+}
+
+CHIP_ERROR CommandHandler::SendNextChunk()
+{
+    using namespace Messaging;
+
+    VerifyOrReturnError(!mChunks.IsNull(), CHIP_ERROR_INCORRECT_STATE);
+    System::PacketBufferHandle commandPacket = mChunks.PopHead();
+    const bool moreChunks                    = !mChunks.IsNull();
+
+    if (moreChunks)
+    {
+        mExchangeCtx->UseSuggestedResponseTimeout(app::kExpectedIMProcessingTime);
+    }
+    ReturnErrorOnFailure(mExchangeCtx->SendMessage(Protocols::InteractionModel::MsgType::InvokeCommandResponse,
+                                                   std::move(commandPacket),
+                                                   moreChunks ? SendMessageFlags::kExpectResponse : SendMessageFlags::kNone));
+    // Once the last chunk is sent, the ExchangeContext is automatically freed here, and it makes mpExchangeCtx be temporarily
+    // dangling, but in all cases, we are going to call Close immediately after this function, which nulls out mpExchangeCtx.
 
     MoveToState(State::CommandSent);
 
     return CHIP_NO_ERROR;
 }
 
+bool CommandHandler::StartNewChunkOnOverflow(CHIP_ERROR aError)
+{
+    // A response that does not fit in an InvokeResponseMessage of its own will not fit in a new one either.
+    VerifyOrReturnValue(aError == CHIP_ERROR_NO_MEMORY || aError == CHIP_ERROR_BUFFER_TOO_SMALL, false);
+    VerifyOrReturnValue(mState == State::AddedCommand, false);
+    VerifyOrReturnValue(mExchangeCtx && !mExchangeCtx->IsGroupExchangeContext(), false);
+
+    System::PacketBufferHandle commandPacket;
+    CHIP_ERROR err = Finalize(commandPacket, /* aMoreChunkedMessages = */ true);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DataManagement, "Failed to finalize command response chunk: %" CHIP_ERROR_FORMAT, err.Format());
+        return false;
+    }
+    mChunks.AddToEnd(std::move(commandPacket));
+    mBufferAllocated = false;
+    MoveToState(State::Idle);
+    return AllocateBuffer() == CHIP_NO_ERROR;
+}
+
 namespace {
 // We use this when the sender did not actually provide a CommandFields struct,
 // to avoid downstream consumers having to worry about cases when there is or is
@@ -455,6 +601,24 @@ Status CommandHandler::ProcessGroupCommandDataIB(CommandDataIB::Parser & aComman
 }
 
 CHIP_ERROR CommandHandler::AddStatusInternal(const ConcreteCommandPath & aCommandPath, const StatusIB & aStatus)
+{
+    CHIP_ERROR err = TryAddStatusInternal(aCommandPath, aStatus);
+    if (err != CHIP_NO_ERROR)
+    {
+        RollbackResponse();
+        if (StartNewChunkOnOverflow(err))
+        {
+            err = TryAddStatusInternal(aCommandPath, aStatus);
+            if (err != CHIP_NO_ERROR)
+            {
+                RollbackResponse();
+            }
+        }
+    }
+    return err;
+}
+
+CHIP_ERROR CommandHandler::TryAddStatusInternal(const ConcreteCommandPath & aCommandPath, const StatusIB & aStatus)
 {
     ReturnErrorOnFailure(PrepareStatus(aCommandPath));
     CommandStatusIB::Builder & commandStatus = mInvokeResponseBuilder.GetInvokeResponses().GetInvokeResponse().GetStatus();
@@ -484,11 +648,13 @@ CHIP_ERROR CommandHandler::PrepareCommand(const ConcreteCommandPath & aCommandPa
 {
     ReturnErrorOnFailure(AllocateBuffer());
 
-    mInvokeResponseBuilder.Checkpoint(mBackupWriter);
     //
-    // We must not be in the middle of preparing a command, or having prepared or sent one.
+    // We must not be in the middle of preparing a command, or having sent the response.  Responses to earlier commands in the
+    // same request may already have been added.
     //
-    VerifyOrReturnError(mState == State::Idle, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mState == State::Idle || mState == State::AddedCommand, CHIP_ERROR_INCORRECT_STATE);
+    mInvokeResponseBuilder.Checkpoint(mBackupWriter);
+    mBackupState = mState;
     MoveToState(State::Preparing);
     InvokeResponseIBs::Builder & invokeResponses = mInvokeResponseBuilder.GetInvokeResponses();
     InvokeResponseIB::Builder & invokeResponse   = invokeResponses.CreateInvokeResponse();
@@ -518,8 +684,6 @@ CHIP_ERROR CommandHandler::FinishCommand(bool aStartDataStruct)
     }
     ReturnErrorOnFailure(commandData.EndOfCommandDataIB().GetError());
     ReturnErrorOnFailure(mInvokeResponseBuilder.GetInvokeResponses().GetInvokeResponse().EndOfInvokeResponseIB().GetError());
-    ReturnErrorOnFailure(mInvokeResponseBuilder.GetInvokeResponses().EndOfInvokeResponses().GetError());
-    ReturnErrorOnFailure(mInvokeResponseBuilder.EndOfInvokeResponseMessage().GetError());
     MoveToState(State::AddedCommand);
     return CHIP_NO_ERROR;
 }
@@ -528,9 +692,12 @@ CHIP_ERROR CommandHandler::PrepareStatus(const ConcreteCommandPath & aCommandPat
 {
     ReturnErrorOnFailure(AllocateBuffer());
     //
-    // We must not be in the middle of preparing a command, or having prepared or sent one.
+    // We must not be in the middle of preparing a command, or having sent the response.  Responses to earlier commands in the
+    // same request may already have been added.
     //
-    VerifyOrReturnError(mState == State::Idle, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mState == State::Idle || mState == State::AddedCommand, CHIP_ERROR_INCORRECT_STATE);
+    mInvokeResponseBuilder.Checkpoint(mBackupWriter);
+    mBackupState = mState;
     MoveToState(State::Preparing);
     InvokeResponseIBs::Builder & invokeResponses = mInvokeResponseBuilder.GetInvokeResponses();
     InvokeResponseIB::Builder & invokeResponse   = invokeResponses.CreateInvokeResponse();
@@ -550,8 +717,6 @@ CHIP_ERROR CommandHandler::FinishStatus()
     ReturnErrorOnFailure(
         mInvokeResponseBuilder.GetInvokeResponses().GetInvokeResponse().GetStatus().EndOfCommandStatusIB().GetError());
     ReturnErrorOnFailure(mInvokeResponseBuilder.GetInvokeResponses().GetInvokeResponse().EndOfInvokeResponseIB().GetError());
-    ReturnErrorOnFailure(mInvokeResponseBuilder.GetInvokeResponses().EndOfInvokeResponses().GetError());
-    ReturnErrorOnFailure(mInvokeResponseBuilder.EndOfInvokeResponseMessage().GetError());
     MoveToState(State::AddedCommand);
     return CHIP_NO_ERROR;
 }
@@ -561,9 +726,10 @@ CHIP_ERROR CommandHandler::RollbackResponse()
     VerifyOrReturnError(mState == State::Preparing || mState == State::AddingCommand, CHIP_ERROR_INCORRECT_STATE);
     mInvokeResponseBuilder.Rollback(mBackupWriter);
     mInvokeResponseBuilder.ResetError();
-    // Note: We only support one command per request, so we reset the state to Idle here, need to review the states when adding
-    // supports of having multiple requests in the same transaction.
-    MoveToState(State::Idle);
+    // A response that overflowed the message may have failed to open its InvokeResponseIB, which sticks to the list.
+    mInvokeResponseBuilder.GetInvokeResponses().ResetError();
+    // Responses already added for other commands in the same request are kept, so we go back to AddedCommand if there were any.
+    MoveToState(mBackupState);
     return CHIP_NO_ERROR;
 }
 
@@ -614,9 +780,16 @@ CommandHandler::Handle::Handle(CommandHandler * handle)
     }
 }
 
-CHIP_ERROR CommandHandler::Finalize(System::PacketBufferHandle & commandPacket)
+CHIP_ERROR CommandHandler::Finalize(System::PacketBufferHandle & commandPacket, bool aMoreChunkedMessages)
 {
-    VerifyOrReturnError(mState == State::AddedCommand, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mState == State::AddedCommand || (mState == State::Idle && mBufferAllocated), CHIP_ERROR_INCORRECT_STATE);
+    ReturnErrorOnFailure(mCommandMessageWriter.UnreserveBuffer(kReservedSizeForTLVEncodingOverhead));
+    ReturnErrorOnFailure(mInvokeResponseBuilder.GetInvokeResponses().EndOfInvokeResponses().GetError());
+    if (aMoreChunkedMessages)
+    {
+        ReturnErrorOnFailure(mInvokeResponseBuilder.MoreChunkedMessages(true).GetError());
+    }
+    ReturnErrorOnFailure(mInvokeResponseBuilder.EndOfInvokeResponseMessage().GetError());
     return mCommandMessageWriter.Finalize(&commandPacket);
 }
 
@@ -197,6 +197,12 @@ public:
      * object that can be encoded using the DataModel::Encode machinery and
      * exposes the right command id will work.
      *
+     * A response that does not fit in the InvokeResponseMessage after the
+     * responses already added for other commands of the request is added to a
+     * new InvokeResponseMessage, and the response is sent in several chunks.
+     * The same holds for AddStatus and its variants, but not for responses
+     * encoded directly with PrepareCommand / FinishCommand.
+     *
      * @param [in] aRequestCommandPath the concrete path of the command we are
      *             responding to.
      * @param [in] aData the data for the response.
@@ -211,6 +217,14 @@ public:
             // The state guarantees that either we can rollback or we don't have to rollback the buffer, so we don't care about the
             // return value of RollbackResponse.
             RollbackResponse();
+            if (StartNewChunkOnOverflow(err))
+            {
+                err = TryAddResponseData(aRequestCommandPath, aData);
+                if (err != CHIP_NO_ERROR)
+                {
+                    RollbackResponse();
+                }
+            }
         }
         return err;
     }
@@ -298,20 +312,15 @@ private:
     CHIP_ERROR OnMessageReceived(Messaging::ExchangeContext * ec, const PayloadHeader & payloadHeader,
                                  System::PacketBufferHandle && payload) override;
 
-    void OnResponseTimeout(Messaging::ExchangeContext * ec) override
-    {
-        //
-        // We're not expecting responses to any messages we send out on this EC.
-        //
-        VerifyOrDie(false);
-    }
+    // We only expect a response to the chunks of a response sent in several InvokeResponseMessages.
+    void OnResponseTimeout(Messaging::ExchangeContext * ec) override;
 
     enum class State
     {
         Idle,                ///< Default state that the object starts out in, where no work has commenced
         Preparing,           ///< We are prepaing the command or status header.
         AddingCommand,       ///< In the process of adding a command.
-        AddedCommand,        ///< A command has been completely encoded and is awaiting transmission.
+        AddedCommand,        ///< One or more responses have been completely encoded and are awaiting transmission.
         CommandSent,         ///< The command has been sent successfully.
         AwaitingDestruction, ///< The object has completed its work and is awaiting destruction by the application.
     };
@@ -324,6 +333,12 @@ private:
      */
     CHIP_ERROR RollbackResponse();
 
+    /**
+     * Validate that no two CommandDataIBs in a unicast InvokeRequests list target the same concrete path. Responses are only
+     * tagged with the command path, so a request containing duplicate paths could not be answered unambiguously.
+     */
+    Protocols::InteractionModel::Status ValidateCommandPathsAreUnique(const TLV::TLVReader & aInvokeRequestsReader);
+
     /*
      * This forcibly closes the exchange context if a valid one is pointed to. Such a situation does
      * not arise during normal message processing flows that all normally call Close() above. This can only
@@ -354,7 +369,22 @@ private:
      */
     CHIP_ERROR AllocateBuffer();
 
-    CHIP_ERROR Finalize(System::PacketBufferHandle & commandPacket);
+    CHIP_ERROR Finalize(System::PacketBufferHandle & commandPacket, bool aMoreChunkedMessages = false);
+
+    /**
+     * Called when adding a response failed with aError.  If the response failed because it did not fit after the responses
+     * already added to the InvokeResponseMessage, queue that message as a chunk of the response and start a new one, so that the
+     * response can be added again.
+     *
+     * @return true if a new InvokeResponseMessage was started.
+     */
+    bool StartNewChunkOnOverflow(CHIP_ERROR aError);
+
+    /**
+     * Send the first of the queued InvokeResponseMessages.  If more are queued, the requester acknowledges this one with a
+     * StatusResponse before the next one is sent.
+     */
+    CHIP_ERROR SendNextChunk();
 
     /**
      * Called internally to signal the completion of all work on this object, gracefully close the
@@ -376,6 +406,7 @@ private:
     Protocols::InteractionModel::Status ProcessGroupCommandDataIB(CommandDataIB::Parser & aCommandElement);
     CHIP_ERROR SendCommandResponse();
     CHIP_ERROR AddStatusInternal(const ConcreteCommandPath & aCommandPath, const StatusIB & aStatus);
+    CHIP_ERROR TryAddStatusInternal(const ConcreteCommandPath & aCommandPath, const StatusIB & aStatus);
 
     /**
      * If this function fails, it may leave our TLV buffer in an inconsistent state.  Callers should snapshot as needed before
@@ -397,6 +428,25 @@ private:
         return FinishCommand(/* aEndDataStruct = */ false);
     }
 
+    /**
+     * The InvokeResponses list and the InvokeResponseMessage are only closed in Finalize(), once every command in the request
+     * has added its response or the message is full, so the bytes needed to close them are reserved when the buffer is allocated.
+     *
+     *  InvokeResponseMessage =
+     *  {
+     *      suppressResponse = false,
+     *      invokeResponses = [
+     *          (...)
+     *      ],                           <-- 1 byte  "end of InvokeResponseIBs" (end of container)
+     *      moreChunkedMessages = true,  <-- 2 bytes "MessageBuilder::kReservedSizeForMoreChunksFlag"
+     *      InteractionModelRevision = 1,<-- 3 bytes "MessageBuilder::kReservedSizeForIMRevision"
+     *  }                                <-- 1 byte  "end of InvokeResponseMessage" (end of container)
+     *
+     * moreChunkedMessages is only encoded in the chunks that are followed by another one.
+     */
+    static constexpr uint16_t kReservedSizeForTLVEncodingOverhead =
+        MessageBuilder::kReservedSizeForEndOfListAndMessage + MessageBuilder::kReservedSizeForMoreChunksFlag;
+
     Messaging::ExchangeHolder mExchangeCtx;
     Callback * mpCallback = nullptr;
     InvokeResponseMessage::Builder mInvokeResponseBuilder;
@@ -408,9 +458,13 @@ private:
     bool mSentStatusResponse = false;
 
     State mState = State::Idle;
+    // The state to restore when RollbackResponse() discards a response: Idle for the first response, AddedCommand afterwards.
+    State mBackupState = State::Idle;
     chip::System::PacketBufferTLVWriter mCommandMessageWriter;
     TLV::TLVWriter mBackupWriter;
     bool mBufferAllocated = false;
+    // The finalized InvokeResponseMessages that have not been sent yet, when the response is sent in several chunks.
+    System::PacketBufferHandle mChunks;
     // If mGoneAsync is true, we have finished out initial processing of the
     // incoming invoke.  After this point, our session could go away at any
     // time.
@@ -157,6 +157,9 @@ public:
     void SetNext(CommandHandlerInterface * aNext) { mNext = aNext; }
     CommandHandlerInterface * GetNext() const { return mNext; }
 
+    Optional<EndpointId> GetEndpointId() const { return mEndpointId; }
+    ClusterId GetClusterId() const { return mClusterId; }
+
     /**
      * Check whether a this CommandHandlerInterface is relevant for a
      * particular endpoint+cluster.  An CommandHandlerInterface will be used
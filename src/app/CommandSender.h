@@ -97,6 +97,23 @@ public:
          */
         virtual void OnError(const CommandSender * apCommandSender, CHIP_ERROR aError) {}
 
+        /**
+         * OnErrorResponse will be called when the server returns a failure status for one of the commands in the invoke
+         * request.  The default implementation forwards the status to OnError, which does not identify the command; applications
+         * that add several commands to the same CommandSender should override this to learn which of them failed.
+         *
+         * The CommandSender object MUST continue to exist after this call is completed. The application shall wait until it
+         * receives an OnDone call to destroy and free the object.
+         *
+         * @param[in] apCommandSender The command sender object that initiated the command transaction.
+         * @param[in] aPath           The command path field in invoke command response.
+         * @param[in] aStatusIB       The failure status returned by the server for aPath.
+         */
+        virtual void OnErrorResponse(CommandSender * apCommandSender, const ConcreteCommandPath & aPath, const StatusIB & aStatusIB)
+        {
+            OnError(apCommandSender, aStatusIB.ToChipError());
+        }
+
         /**
          * OnDone will be called when CommandSender has finished all work and is safe to destroy and free the
          * allocated CommandSender object.
@@ -120,6 +137,10 @@ public:
      * The callback passed in has to outlive this CommandSender object.
      * If used in a groups setting, callbacks do not need to be passed.
      * If callbacks are passed the only one that will be called in a group sesttings is the onDone
+     *
+     * Several commands can be added before the request is sent by calling PrepareCommand / FinishCommand (or AddRequestData)
+     * once per command; they are all carried in the same InvokeRequestMessage and each response is delivered through the
+     * callback tagged with its command path.  The paths of the commands added to one request must be distinct.
      */
     CommandSender(Callback * apCallback, Messaging::ExchangeManager * apExchangeMgr, bool aIsTimedRequest = false);
     CHIP_ERROR PrepareCommand(const CommandPathParams & aCommandPathParams, bool aStartDataStruct = true);
@@ -216,7 +237,7 @@ private:
     {
         Idle,                ///< Default state that the object starts out in, where no work has commenced
         AddingCommand,       ///< In the process of adding a command.
-        AddedCommand,        ///< A command has been completely encoded and is awaiting transmission.
+        AddedCommand,        ///< One or more commands have been completely encoded and are awaiting transmission.
         AwaitingTimedStatus, ///< Sent a Timed Request and waiting for response.
         CommandSent,         ///< The command has been sent successfully.
         ResponseReceived,    ///< Received a response to our invoke and request and processing the response.
@@ -256,7 +277,11 @@ private:
      */
     void Abort();
 
-    CHIP_ERROR ProcessInvokeResponse(System::PacketBufferHandle && payload);
+    /**
+     * Process one InvokeResponseMessage.  moreChunkedMessages is set to whether the server sends the rest of the response in
+     * further InvokeResponseMessages.
+     */
+    CHIP_ERROR ProcessInvokeResponse(System::PacketBufferHandle && payload, bool & moreChunkedMessages);
     CHIP_ERROR ProcessInvokeResponseIB(InvokeResponseIB::Parser & aInvokeResponse);
 
     // Send our queued-up Invoke Request message.  Assumes the exchange is ready
@@ -265,6 +290,22 @@ private:
 
     CHIP_ERROR Finalize(System::PacketBufferHandle & commandPacket);
 
+    /**
+     * The InvokeRequests list and the InvokeRequestMessage are only closed in Finalize(), so that more commands can be added
+     * after FinishCommand, and the bytes needed to close them are reserved when the buffer is allocated.
+     *
+     *  InvokeRequestMessage =
+     *  {
+     *      suppressResponse = false,
+     *      timedRequest = false,
+     *      invokeRequests = [
+     *          (...)
+     *      ],                           <-- 1 byte  "end of InvokeRequests" (end of container)
+     *      InteractionModelRevision = 1,<-- 3 bytes "MessageBuilder::kReservedSizeForIMRevision"
+     *  }                                <-- 1 byte  "end of InvokeRequestMessage" (end of container)
+     */
+    static constexpr uint16_t kReservedSizeForTLVEncodingOverhead = MessageBuilder::kReservedSizeForEndOfListAndMessage;
+
     Messaging::ExchangeHolder mExchangeCtx;
     Callback * mpCallback                      = nullptr;
     Messaging::ExchangeManager * mpExchangeMgr = nullptr;
@@ -26,9 +26,9 @@ CHIP_ERROR DefaultAttributePersistenceProvider::WriteValue(const ConcreteAttribu
 {
     VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
 
-    // TODO: we may want to have a small cache for values that change a lot, so
-    // we only write them once a bunch of changes happen or on timer or
-    // shutdown.
+    // Values that change a lot can be committed on a timer or on shutdown
+    // instead, by initializing this provider with a WriteBehindStorageDelegate
+    // (see CHIP_CONFIG_WRITE_BEHIND_ATTRIBUTE_STORAGE).
     if (!CanCastTo<uint16_t>(aValue.size()))
     {
         return CHIP_ERROR_BUFFER_TOO_SMALL;
@@ -16,41 +16,46 @@
 
 #include <app/DeferredAttributePersistenceProvider.h>
 
+#include <lib/support/SafeInt.h>
 #include <platform/CHIPDeviceLayer.h>
 
+#include <stdio.h>
+#include <stdlib.h>
+
 namespace chip {
 namespace app {
 
-CHIP_ERROR DeferredAttribute::PrepareWrite(System::Clock::Timestamp flushTime, const ByteSpan & value)
-{
-    mFlushTime = flushTime;
-
-    if (mValue.AllocatedSize() != value.size())
-    {
-        mValue.Alloc(value.size());
-        ReturnErrorCodeIf(!mValue, CHIP_ERROR_NO_MEMORY);
-    }
-
-    memcpy(mValue.Get(), value.data(), value.size());
-    return CHIP_NO_ERROR;
-}
+namespace {
+// Large enough for the decimal index of a deferred attribute.
+constexpr size_t kDeferredAttributeKeyLength = 11;
+} // namespace
 
-void DeferredAttribute::Flush(AttributePersistenceProvider & persister)
+CHIP_ERROR DeferredAttributePersistenceProvider::DeferredAttributeStorage::SyncSetKeyValue(const char * key, const void * value,
+                                                                                           uint16_t size)
 {
-    VerifyOrReturn(IsArmed());
-    persister.WriteValue(mPath, ByteSpan(mValue.Get(), mValue.AllocatedSize()));
-    mValue.Release();
+    const unsigned long index = strtoul(key, nullptr, 10);
+    VerifyOrReturnError(index < mDeferredAttributes.size(), CHIP_ERROR_INVALID_ARGUMENT);
+    return mPersister.WriteValue(mDeferredAttributes[index].GetPath(), ByteSpan(static_cast<const uint8_t *>(value), size));
 }
 
+DeferredAttributePersistenceProvider::DeferredAttributePersistenceProvider(AttributePersistenceProvider & persister,
+                                                                           const Span<DeferredAttribute> & deferredAttributes,
+                                                                           System::Clock::Milliseconds32 writeDelay) :
+    mPersister(persister),
+    mDeferredAttributes(deferredAttributes), mStorage(persister, deferredAttributes),
+    mWriteBehind(mStorage, DeviceLayer::SystemLayer(), writeDelay, WriteBehindStorageDelegate::FlushDelayStart::kLastOperation)
+{}
+
 CHIP_ERROR DeferredAttributePersistenceProvider::WriteValue(const ConcreteAttributePath & path, const ByteSpan & value)
 {
-    for (DeferredAttribute & da : mDeferredAttributes)
+    for (size_t i = 0; i < mDeferredAttributes.size(); i++)
     {
-        if (da.Matches(path))
+        if (mDeferredAttributes[i].Matches(path))
         {
-            ReturnErrorOnFailure(da.PrepareWrite(System::SystemClock().GetMonotonicTimestamp() + mWriteDelay, value));
-            FlushAndScheduleNext();
-            return CHIP_NO_ERROR;
+            VerifyOrReturnError(CanCastTo<uint16_t>(value.size()), CHIP_ERROR_BUFFER_TOO_SMALL);
+            char key[kDeferredAttributeKeyLength];
+            snprintf(key, sizeof(key), "%u", static_cast<unsigned>(i));
+            return mWriteBehind.SyncSetKeyValue(key, value.data(), static_cast<uint16_t>(value.size()));
         }
     }
 
@@ -63,36 +68,5 @@ CHIP_ERROR DeferredAttributePersistenceProvider::ReadValue(const ConcreteAttribu
     return mPersister.ReadValue(path, metadata, value);
 }
 
-void DeferredAttributePersistenceProvider::FlushAndScheduleNext()
-{
-    const System::Clock::Timestamp now     = System::SystemClock().GetMonotonicTimestamp();
-    System::Clock::Timestamp nextFlushTime = System::Clock::Timestamp::max();
-
-    for (DeferredAttribute & da : mDeferredAttributes)
-    {
-        if (!da.IsArmed())
-        {
-            continue;
-        }
-
-        if (da.GetFlushTime() <= now)
-        {
-            da.Flush(mPersister);
-        }
-        else
-        {
-            nextFlushTime = chip::min(nextFlushTime, da.GetFlushTime());
-        }
-    }
-
-    if (nextFlushTime != System::Clock::Timestamp::max())
-    {
-        DeviceLayer::SystemLayer().StartTimer(
-            nextFlushTime - now,
-            [](System::Layer *, void * me) { static_cast<DeferredAttributePersistenceProvider *>(me)->FlushAndScheduleNext(); },
-            this);
-    }
-}
-
 } // namespace app
 } // namespace chip
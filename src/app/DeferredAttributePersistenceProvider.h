@@ -16,7 +16,7 @@
 #pragma once
 
 #include <app/AttributePersistenceProvider.h>
-#include <lib/support/ScopedBuffer.h>
+#include <app/WriteBehindStorageDelegate.h>
 #include <lib/support/Span.h>
 
 namespace chip {
@@ -28,16 +28,10 @@ public:
     explicit DeferredAttribute(const ConcreteAttributePath & path) : mPath(path) {}
 
     bool Matches(const ConcreteAttributePath & path) const { return mPath == path; }
-    bool IsArmed() const { return static_cast<bool>(mValue); }
-    System::Clock::Timestamp GetFlushTime() const { return mFlushTime; }
-
-    CHIP_ERROR PrepareWrite(System::Clock::Timestamp flushTime, const ByteSpan & value);
-    void Flush(AttributePersistenceProvider & persister);
+    const ConcreteAttributePath & GetPath() const { return mPath; }
 
 private:
     const ConcreteAttributePath mPath;
-    System::Clock::Timestamp mFlushTime;
-    Platform::ScopedMemoryBufferWithSize<uint8_t> mValue;
 };
 
 /**
@@ -47,16 +41,17 @@ private:
  * This class is useful to increase the flash lifetime by reducing the number
  * of writes of fast-changing attributes, such as CurrentLevel attribute of the
  * LevelControl cluster.
+ *
+ * The writes of the deferred attributes are queued in a WriteBehindStorageDelegate,
+ * which passes them to the decorated persister once none of them has changed for
+ * the write delay.
  */
 class DeferredAttributePersistenceProvider : public AttributePersistenceProvider
 {
 public:
     DeferredAttributePersistenceProvider(AttributePersistenceProvider & persister,
                                          const Span<DeferredAttribute> & deferredAttributes,
-                                         System::Clock::Milliseconds32 writeDelay) :
-        mPersister(persister),
-        mDeferredAttributes(deferredAttributes), mWriteDelay(writeDelay)
-    {}
+                                         System::Clock::Milliseconds32 writeDelay);
 
     /*
      * If the written attribute is one of the deferred attributes specified in the constructor,
@@ -71,11 +66,34 @@ public:
                          MutableByteSpan & value) override;
 
 private:
-    void FlushAndScheduleNext();
+    /*
+     * Storage of the deferred attributes as seen by the write-behind queue: the key of an attribute
+     * is its index in the deferred attributes, and its value is written to the decorated persister.
+     */
+    class DeferredAttributeStorage : public PersistentStorageDelegate
+    {
+    public:
+        DeferredAttributeStorage(AttributePersistenceProvider & persister, const Span<DeferredAttribute> & deferredAttributes) :
+            mPersister(persister), mDeferredAttributes(deferredAttributes)
+        {}
+
+        // Values are only read through the decorated persister.
+        CHIP_ERROR SyncGetKeyValue(const char * key, void * buffer, uint16_t & size) override
+        {
+            return CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND;
+        }
+        CHIP_ERROR SyncSetKeyValue(const char * key, const void * value, uint16_t size) override;
+        CHIP_ERROR SyncDeleteKeyValue(const char * key) override { return CHIP_ERROR_NOT_IMPLEMENTED; }
+
+    private:
+        AttributePersistenceProvider & mPersister;
+        const Span<DeferredAttribute> mDeferredAttributes;
+    };
 
     AttributePersistenceProvider & mPersister;
     const Span<DeferredAttribute> mDeferredAttributes;
-    const System::Clock::Milliseconds32 mWriteDelay;
+    DeferredAttributeStorage mStorage;
+    WriteBehindStorageDelegate mWriteBehind;
 };
 
 } // namespace app
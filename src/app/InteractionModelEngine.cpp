@@ -76,20 +76,8 @@ void InteractionModelEngine::Shutdown()
 {
     mpExchangeMgr->GetSessionManager()->SystemLayer()->CancelTimer(ResumeSubscriptionsTimerCallback, this);
 
-    CommandHandlerInterface * handlerIter = mCommandHandlerList;
-
-    //
-    // Walk our list of command handlers and de-register them, before finally
-    // nulling out the list entirely.
-    //
-    while (handlerIter)
-    {
-        CommandHandlerInterface * nextHandler = handlerIter->GetNext();
-        handlerIter->SetNext(nullptr);
-        handlerIter = nextHandler;
-    }
-
-    mCommandHandlerList = nullptr;
+    // De-register all our command handlers.
+    mCommandHandlers.Clear();
 
     // Increase magic number to invalidate all Handle-s.
     mMagic++;
@@ -144,6 +132,7 @@ void InteractionModelEngine::Shutdown()
     mAttributePathPool.ReleaseAll();
     mEventPathPool.ReleaseAll();
     mDataVersionFilterPool.ReleaseAll();
+    AttributePathExpandIterator::ReleaseExpansionTable();
     mpExchangeMgr->UnregisterUnsolicitedMessageHandlerForProtocol(Protocols::InteractionModel::Id);
 
     mpCASESessionMgr = nullptr;
@@ -330,6 +319,14 @@ Status InteractionModelEngine::OnInvokeCommandRequest(Messaging::ExchangeContext
                                                       const PayloadHeader & aPayloadHeader, System::PacketBufferHandle && aPayload,
                                                       bool aIsTimedInvoke)
 {
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    if (mElasticPoolLimits.HasValue() && mCommandHandlerObjs.Allocated() >= mElasticPoolLimits.Value().mMaxCommandHandlers)
+    {
+        ChipLogProgress(InteractionModel, "no resource for Invoke interaction");
+        return Status::Busy;
+    }
+#endif
+
     CommandHandler * commandHandler = mCommandHandlerObjs.CreateObject(this);
     if (commandHandler == nullptr)
     {
@@ -375,9 +372,7 @@ CHIP_ERROR InteractionModelEngine::ParseAttributePaths(const Access::SubjectDesc
             // AttributePathExpandIterator. So we just need to check the ACL bits.
             for (; pathIterator.Get(readPath); pathIterator.Next())
             {
-                Access::RequestPath requestPath{ .cluster = readPath.mClusterId, .endpoint = readPath.mEndpointId };
-                err = Access::GetAccessControl().Check(aSubjectDescriptor, requestPath,
-                                                       RequiredPrivilege::ForReadAttribute(readPath));
+                err = CheckReadAttributeAccess(aSubjectDescriptor, readPath);
                 if (err == CHIP_NO_ERROR)
                 {
                     aHasValidAttributePath = true;
@@ -391,10 +386,7 @@ CHIP_ERROR InteractionModelEngine::ParseAttributePaths(const Access::SubjectDesc
                                                paramsList.mValue.mAttributeId);
             if (ConcreteAttributePathExists(concretePath))
             {
-                Access::RequestPath requestPath{ .cluster = concretePath.mClusterId, .endpoint = concretePath.mEndpointId };
-
-                err = Access::GetAccessControl().Check(aSubjectDescriptor, requestPath,
-                                                       RequiredPrivilege::ForReadAttribute(concretePath));
+                err = CheckReadAttributeAccess(aSubjectDescriptor, concretePath);
                 if (err == CHIP_NO_ERROR)
                 {
                     aHasValidAttributePath = true;
@@ -766,6 +758,23 @@ void InteractionModelEngine::AddReadClient(ReadClient * apReadClient)
     mpActiveReadClientList = apReadClient;
 }
 
+bool InteractionModelEngine::IsHandlerQuotaEnforced() const
+{
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP && !CHIP_CONFIG_IM_FORCE_FABRIC_QUOTA_CHECK
+#if CONFIG_BUILD_FOR_HOST_UNIT_TEST
+    if (mForceHandlerQuota)
+    {
+        return true;
+    }
+#endif // CONFIG_BUILD_FOR_HOST_UNIT_TEST
+    // If the resources are allocated on the heap, we should be able to handle as many Read / Subscribe requests as possible,
+    // unless the application asked for the pools to stay within elastic limits.
+    return mElasticPoolLimits.HasValue();
+#else  // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP && !CHIP_CONFIG_IM_FORCE_FABRIC_QUOTA_CHECK
+    return true;
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP && !CHIP_CONFIG_IM_FORCE_FABRIC_QUOTA_CHECK
+}
+
 bool InteractionModelEngine::TrimFabricForSubscriptions(FabricIndex aFabricIndex, bool aForceEvict)
 {
     const size_t pathPoolCapacity        = GetPathPoolCapacityForSubscriptions();
@@ -845,16 +854,7 @@ bool InteractionModelEngine::TrimFabricForSubscriptions(FabricIndex aFabricIndex
 bool InteractionModelEngine::EnsureResourceForSubscription(FabricIndex aFabricIndex, size_t aRequestedAttributePathCount,
                                                            size_t aRequestedEventPathCount)
 {
-#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP && !CHIP_CONFIG_IM_FORCE_FABRIC_QUOTA_CHECK
-#if CONFIG_BUILD_FOR_HOST_UNIT_TEST
-    const bool allowUnlimited = !mForceHandlerQuota;
-#else  // CONFIG_BUILD_FOR_HOST_UNIT_TEST
-       // If the resources are allocated on the heap, we should be able to handle as many Read / Subscribe requests as possible.
-    const bool allowUnlimited = true;
-#endif // CONFIG_BUILD_FOR_HOST_UNIT_TEST
-#else  // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP && !CHIP_CONFIG_IM_FORCE_FABRIC_QUOTA_CHECK
-    const bool allowUnlimited = false;
-#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP && !CHIP_CONFIG_IM_FORCE_FABRIC_QUOTA_CHECK
+    const bool allowUnlimited = !IsHandlerQuotaEnforced();
 
     // Don't couple with read requests, always reserve enough resource for read requests.
 
@@ -1029,16 +1029,7 @@ Protocols::InteractionModel::Status InteractionModelEngine::EnsureResourceForRea
                                                                                   size_t aRequestedAttributePathCount,
                                                                                   size_t aRequestedEventPathCount)
 {
-#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP && !CHIP_CONFIG_IM_FORCE_FABRIC_QUOTA_CHECK
-#if CONFIG_BUILD_FOR_HOST_UNIT_TEST
-    const bool allowUnlimited = !mForceHandlerQuota;
-#else  // CONFIG_BUILD_FOR_HOST_UNIT_TEST
-       // If the resources are allocated on the heap, we should be able to handle as many Read / Subscribe requests as possible.
-    const bool allowUnlimited = true;
-#endif // CONFIG_BUILD_FOR_HOST_UNIT_TEST
-#else  // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP && !CHIP_CONFIG_IM_FORCE_FABRIC_QUOTA_CHECK
-    const bool allowUnlimited = false;
-#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP && !CHIP_CONFIG_IM_FORCE_FABRIC_QUOTA_CHECK
+    const bool allowUnlimited = !IsHandlerQuotaEnforced();
 
     // If we return early here, the compiler will complain about the unreachable code, so we add a always-true check.
     const size_t attributePathCap = allowUnlimited ? SIZE_MAX : GetPathPoolCapacityForReads();
@@ -1402,87 +1393,30 @@ CHIP_ERROR InteractionModelEngine::RegisterCommandHandler(CommandHandlerInterfac
 {
     VerifyOrReturnError(handler != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
 
-    for (auto * cur = mCommandHandlerList; cur; cur = cur->GetNext())
+    if (!mCommandHandlers.Register(handler))
     {
-        if (cur->Matches(*handler))
-        {
-            ChipLogError(InteractionModel, "Duplicate command handler registration failed");
-            return CHIP_ERROR_INCORRECT_STATE;
-        }
+        ChipLogError(InteractionModel, "Duplicate command handler registration failed");
+        return CHIP_ERROR_INCORRECT_STATE;
     }
 
-    handler->SetNext(mCommandHandlerList);
-    mCommandHandlerList = handler;
-
     return CHIP_NO_ERROR;
 }
 
 void InteractionModelEngine::UnregisterCommandHandlers(EndpointId endpointId)
 {
-    CommandHandlerInterface * prev = nullptr;
-
-    for (auto * cur = mCommandHandlerList; cur; cur = cur->GetNext())
-    {
-        if (cur->MatchesEndpoint(endpointId))
-        {
-            if (prev == nullptr)
-            {
-                mCommandHandlerList = cur->GetNext();
-            }
-            else
-            {
-                prev->SetNext(cur->GetNext());
-            }
-
-            cur->SetNext(nullptr);
-        }
-        else
-        {
-            prev = cur;
-        }
-    }
+    mCommandHandlers.UnregisterAllForEndpoint(endpointId);
 }
 
 CHIP_ERROR InteractionModelEngine::UnregisterCommandHandler(CommandHandlerInterface * handler)
 {
     VerifyOrReturnError(handler != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
-    CommandHandlerInterface * prev = nullptr;
-
-    for (auto * cur = mCommandHandlerList; cur; cur = cur->GetNext())
-    {
-        if (cur->Matches(*handler))
-        {
-            if (prev == nullptr)
-            {
-                mCommandHandlerList = cur->GetNext();
-            }
-            else
-            {
-                prev->SetNext(cur->GetNext());
-            }
-
-            cur->SetNext(nullptr);
-
-            return CHIP_NO_ERROR;
-        }
-
-        prev = cur;
-    }
-
-    return CHIP_ERROR_KEY_NOT_FOUND;
+    VerifyOrReturnError(mCommandHandlers.Unregister(handler), CHIP_ERROR_KEY_NOT_FOUND);
+    return CHIP_NO_ERROR;
 }
 
 CommandHandlerInterface * InteractionModelEngine::FindCommandHandler(EndpointId endpointId, ClusterId clusterId)
 {
-    for (auto * cur = mCommandHandlerList; cur; cur = cur->GetNext())
-    {
-        if (cur->Matches(endpointId, clusterId))
-        {
-            return cur;
-        }
-    }
-
-    return nullptr;
+    return mCommandHandlers.Find(endpointId, clusterId);
 }
 
 void InteractionModelEngine::OnTimedInteractionFailed(TimedHandler * apTimedHandler)
@@ -1545,13 +1479,88 @@ bool InteractionModelEngine::HasActiveRead()
 uint16_t InteractionModelEngine::GetMinGuaranteedSubscriptionsPerFabric() const
 {
 #if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
-    return UINT16_MAX;
-#else
+    if (!mElasticPoolLimits.HasValue())
+    {
+        return UINT16_MAX;
+    }
+#endif
     return static_cast<uint16_t>(
         min(GetReadHandlerPoolCapacityForSubscriptions() / GetConfigMaxFabrics(), static_cast<size_t>(UINT16_MAX)));
-#endif
 }
 
+InteractionModelEngine::PoolOccupancy InteractionModelEngine::GetPoolOccupancy() const
+{
+    PoolOccupancy occupancy;
+
+    occupancy.mReadHandlers             = mReadHandlers.Allocated();
+    occupancy.mReadHandlersHighWater    = mReadHandlers.HighWaterMark();
+    occupancy.mSubscriptions            = GetNumActiveReadHandlers(ReadHandler::InteractionType::Subscribe);
+    occupancy.mAttributePaths           = mAttributePathPool.Allocated();
+    occupancy.mAttributePathsHighWater  = mAttributePathPool.HighWaterMark();
+    occupancy.mEventPaths               = mEventPathPool.Allocated();
+    occupancy.mEventPathsHighWater      = mEventPathPool.HighWaterMark();
+    occupancy.mDataVersionFilters       = mDataVersionFilterPool.Allocated();
+    occupancy.mCommandHandlers          = mCommandHandlerObjs.Allocated();
+    occupancy.mCommandHandlersHighWater = mCommandHandlerObjs.HighWaterMark();
+    occupancy.mWriteHandlers            = GetNumActiveWriteHandlers();
+
+    return occupancy;
+}
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+CHIP_ERROR InteractionModelEngine::SetElasticPoolLimits(const ElasticPoolLimits & aLimits)
+{
+    const size_t maxFabrics = GetConfigMaxFabrics();
+
+    // Same requirements as the static_asserts on the compile time pool sizes, see spec 8.5.1.
+    VerifyOrReturnError(aLimits.mMaxSubscriptions >= maxFabrics * kMinSupportedSubscriptionsPerFabric, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(aLimits.mMaxPathsForSubscriptions >=
+                            maxFabrics * kMinSupportedSubscriptionsPerFabric * kMinSupportedPathsPerSubscription,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(aLimits.mMaxReads >= maxFabrics * kMinSupportedReadRequestsPerFabric, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(aLimits.mMaxPathsForReads >=
+                            maxFabrics * kMinSupportedReadRequestsPerFabric * kMinSupportedPathsPerReadRequest,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(aLimits.mMaxCommandHandlers > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mElasticPoolLimits.SetValue(aLimits);
+    ChipLogProgress(InteractionModel, "Elastic pool limits: %u reads, %u subscriptions, %u/%u paths, %u command handlers",
+                    static_cast<unsigned>(aLimits.mMaxReads), static_cast<unsigned>(aLimits.mMaxSubscriptions),
+                    static_cast<unsigned>(aLimits.mMaxPathsForReads), static_cast<unsigned>(aLimits.mMaxPathsForSubscriptions),
+                    static_cast<unsigned>(aLimits.mMaxCommandHandlers));
+    return CHIP_NO_ERROR;
+}
+
+InteractionModelEngine::ElasticPoolLimits InteractionModelEngine::ComputeElasticPoolLimits(size_t aMemoryBudget)
+{
+    ElasticPoolLimits limits;
+
+    // Every path group may come with an attribute path, an event path and a data version filter.
+    constexpr size_t kPathGroupSize =
+        sizeof(ObjectList<AttributePathParams>) + sizeof(ObjectList<EventPathParams>) + sizeof(ObjectList<DataVersionFilter>);
+    constexpr size_t kSubscriptionSize = sizeof(ReadHandler) + kMinSupportedPathsPerSubscription * kPathGroupSize;
+
+    const size_t fixedSize = limits.mMaxReads * sizeof(ReadHandler) + limits.mMaxPathsForReads * kPathGroupSize +
+        limits.mMaxCommandHandlers * sizeof(CommandHandler);
+    if (aMemoryBudget <= fixedSize)
+    {
+        return limits;
+    }
+
+    const size_t subscriptions = (aMemoryBudget - fixedSize) / kSubscriptionSize;
+    if (subscriptions > limits.mMaxSubscriptions)
+    {
+        limits.mMaxSubscriptions = subscriptions;
+    }
+    if (subscriptions * kMinSupportedPathsPerSubscription > limits.mMaxPathsForSubscriptions)
+    {
+        limits.mMaxPathsForSubscriptions = subscriptions * kMinSupportedPathsPerSubscription;
+    }
+
+    return limits;
+}
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
 size_t InteractionModelEngine::GetNumDirtySubscriptions() const
 {
     size_t numDirtySubscriptions = 0;
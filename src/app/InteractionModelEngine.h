@@ -41,6 +41,7 @@
 #include <system/SystemPacketBuffer.h>
 
 #include <app/AttributePathParams.h>
+#include <app/ClusterInterfaceRegistry.h>
 #include <app/CommandHandler.h>
 #include <app/CommandHandlerInterface.h>
 #include <app/CommandSender.h>
@@ -160,6 +161,70 @@ public:
 
     uint32_t GetNumActiveWriteHandlers() const;
 
+    /**
+     * A snapshot of how many objects the interaction model engine currently holds in each of its server-side pools, and the
+     * most it has ever held at once.
+     */
+    struct PoolOccupancy
+    {
+        size_t mReadHandlers             = 0;
+        size_t mReadHandlersHighWater    = 0;
+        size_t mSubscriptions            = 0;
+        size_t mAttributePaths           = 0;
+        size_t mAttributePathsHighWater  = 0;
+        size_t mEventPaths               = 0;
+        size_t mEventPathsHighWater      = 0;
+        size_t mDataVersionFilters       = 0;
+        size_t mCommandHandlers          = 0;
+        size_t mCommandHandlersHighWater = 0;
+        size_t mWriteHandlers            = 0;
+    };
+
+    PoolOccupancy GetPoolOccupancy() const;
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    /**
+     * Limits for the heap-backed read handler, path and command handler pools.
+     *
+     * Heap-backed pools are unbounded by default, and the per-fabric resource quotas of spec 8.5.1 are not enforced.  Once
+     * limits are set ("elastic mode"), the pools still only allocate on demand, but reads and subscriptions are admitted
+     * against these limits using the same per-fabric fairness and eviction rules as statically sized pools, so that one
+     * busy fabric cannot take all the resources from the others.  Invokes beyond mMaxCommandHandlers are answered with Busy.
+     *
+     * Write handlers are not covered: they live in a fixed array of CHIP_IM_MAX_NUM_WRITE_HANDLER entries that are reused in
+     * place, and a write only holds one for a single (possibly chunked) request, so deployments that need more parallel
+     * writes raise CHIP_IM_MAX_NUM_WRITE_HANDLER instead.
+     */
+    struct ElasticPoolLimits
+    {
+        size_t mMaxReads                 = CHIP_IM_MAX_NUM_READS;
+        size_t mMaxSubscriptions         = CHIP_IM_MAX_NUM_SUBSCRIPTIONS;
+        size_t mMaxPathsForReads         = CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_READS;
+        size_t mMaxPathsForSubscriptions = CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS;
+        size_t mMaxCommandHandlers       = CHIP_IM_MAX_NUM_COMMAND_HANDLER;
+    };
+
+    /**
+     * Enable elastic mode with the given limits.  Existing handlers are not evicted by this call; the limits are applied to
+     * new interactions.
+     *
+     * @retval CHIP_ERROR_INVALID_ARGUMENT if the limits do not leave every fabric the resources guaranteed by spec 8.5.1.
+     */
+    CHIP_ERROR SetElasticPoolLimits(const ElasticPoolLimits & aLimits);
+
+    /**
+     * Go back to unbounded heap-backed pools.
+     */
+    void ClearElasticPoolLimits() { mElasticPoolLimits.ClearValue(); }
+
+    /**
+     * Compute limits that fit the pools into roughly aMemoryBudget bytes of heap.  Reads and command handlers keep their
+     * configured sizes, the rest of the budget goes to subscriptions and their paths.  The result never goes below the
+     * configured sizes, so a budget that is too small yields the same limits as a statically sized build.
+     */
+    static ElasticPoolLimits ComputeElasticPoolLimits(size_t aMemoryBudget);
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
     /**
      * Returns the handler at a particular index within the active handler list.
      */
@@ -284,7 +349,7 @@ public:
 
     /**
      * Returns the minimal value of guaranteed subscriptions per fabic. UINT16_MAX will be returned if current app is configured to
-     * use heap for the object pools used by interaction model engine.
+     * use heap for the object pools used by interaction model engine, unless elastic pool limits are set.
      *
      * @retval the minimal value of guaranteed subscriptions per fabic.
      */
@@ -365,6 +430,7 @@ public:
 private:
     friend class reporting::Engine;
     friend class TestCommandInteraction;
+    friend class TestInteractionModelEngine;
     using Status = Protocols::InteractionModel::Status;
 
     void OnDone(CommandHandler & apCommandObj) override;
@@ -439,44 +505,77 @@ private:
     inline size_t GetPathPoolCapacityForReads() const
     {
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
-        return (mPathPoolCapacityForReadsOverride == -1) ? CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_READS
-                                                         : static_cast<size_t>(mPathPoolCapacityForReadsOverride);
-#else
-        return CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_READS;
+        if (mPathPoolCapacityForReadsOverride != -1)
+        {
+            return static_cast<size_t>(mPathPoolCapacityForReadsOverride);
+        }
+#endif
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+        if (mElasticPoolLimits.HasValue())
+        {
+            return mElasticPoolLimits.Value().mMaxPathsForReads;
+        }
 #endif
+        return CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_READS;
     }
 
     inline size_t GetReadHandlerPoolCapacityForReads() const
     {
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
-        return (mReadHandlerCapacityForReadsOverride == -1) ? CHIP_IM_MAX_NUM_READS
-                                                            : static_cast<size_t>(mReadHandlerCapacityForReadsOverride);
-#else
-        return CHIP_IM_MAX_NUM_READS;
+        if (mReadHandlerCapacityForReadsOverride != -1)
+        {
+            return static_cast<size_t>(mReadHandlerCapacityForReadsOverride);
+        }
 #endif
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+        if (mElasticPoolLimits.HasValue())
+        {
+            return mElasticPoolLimits.Value().mMaxReads;
+        }
+#endif
+        return CHIP_IM_MAX_NUM_READS;
     }
 
     inline size_t GetPathPoolCapacityForSubscriptions() const
     {
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
-        return (mPathPoolCapacityForSubscriptionsOverride == -1) ? CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS
-                                                                 : static_cast<size_t>(mPathPoolCapacityForSubscriptionsOverride);
-#else
-        return CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS;
+        if (mPathPoolCapacityForSubscriptionsOverride != -1)
+        {
+            return static_cast<size_t>(mPathPoolCapacityForSubscriptionsOverride);
+        }
 #endif
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+        if (mElasticPoolLimits.HasValue())
+        {
+            return mElasticPoolLimits.Value().mMaxPathsForSubscriptions;
+        }
+#endif
+        return CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS;
     }
 
     inline size_t GetReadHandlerPoolCapacityForSubscriptions() const
     {
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
-        return (mReadHandlerCapacityForSubscriptionsOverride == -1)
-            ? CHIP_IM_MAX_NUM_SUBSCRIPTIONS
-            : static_cast<size_t>(mReadHandlerCapacityForSubscriptionsOverride);
-#else
-        return CHIP_IM_MAX_NUM_SUBSCRIPTIONS;
+        if (mReadHandlerCapacityForSubscriptionsOverride != -1)
+        {
+            return static_cast<size_t>(mReadHandlerCapacityForSubscriptionsOverride);
+        }
+#endif
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+        if (mElasticPoolLimits.HasValue())
+        {
+            return mElasticPoolLimits.Value().mMaxSubscriptions;
+        }
 #endif
+        return CHIP_IM_MAX_NUM_SUBSCRIPTIONS;
     }
 
+    /**
+     * Whether reads and subscriptions have to be admitted against the pool capacities and per-fabric quotas.  This is always
+     * the case for statically sized pools; heap-backed pools are only bounded in elastic mode (or when forced for testing).
+     */
+    bool IsHandlerQuotaEnforced() const;
+
     inline uint8_t GetConfigMaxFabrics() const
     {
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
@@ -545,10 +644,11 @@ private:
 
     Messaging::ExchangeManager * mpExchangeMgr = nullptr;
 
-    CommandHandlerInterface * mCommandHandlerList = nullptr;
+    ClusterInterfaceRegistry<CommandHandlerInterface> mCommandHandlers;
 
     ObjectPool<CommandHandler, CHIP_IM_MAX_NUM_COMMAND_HANDLER> mCommandHandlerObjs;
     ObjectPool<TimedHandler, CHIP_IM_MAX_NUM_TIMED_HANDLER> mTimedHandlers;
+    // Not bounded by the elastic pool limits, see ElasticPoolLimits.
     WriteHandler mWriteHandlers[CHIP_IM_MAX_NUM_WRITE_HANDLER];
     reporting::Engine mReportingEngine;
 
@@ -584,6 +684,10 @@ private:
 
     ReadHandler::ApplicationCallback * mpReadHandlerApplicationCallback = nullptr;
 
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    Optional<ElasticPoolLimits> mElasticPoolLimits;
+#endif
+
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
     int mReadHandlerCapacityForSubscriptionsOverride = -1;
     int mPathPoolCapacityForSubscriptionsOverride    = -1;
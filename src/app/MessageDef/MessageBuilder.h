@@ -27,6 +27,19 @@ class MessageBuilder : public StructBuilder
 {
 public:
     CHIP_ERROR EncodeInteractionModelRevision();
+
+    // End Of Container (0x18) uses one byte.
+    static constexpr uint16_t kReservedSizeForEndOfContainer = 1;
+    // Reserved size for the uint8_t InteractionModelRevision flag, which takes up 1 byte for the control tag and 1 byte for the
+    // context tag, 1 byte for value
+    static constexpr uint16_t kReservedSizeForIMRevision = 1 + 1 + 1;
+    // Reserved size for the MoreChunkedMessages boolean flag, which takes up 1 byte for the control tag and 1 byte for the context
+    // tag.
+    static constexpr uint16_t kReservedSizeForMoreChunksFlag = 1 + 1;
+    // Reserved size for closing a message whose last element is a list, when the list and the message are only closed once all
+    // of the list elements have been encoded: the end of the list, the InteractionModelRevision and the end of the message.
+    static constexpr uint16_t kReservedSizeForEndOfListAndMessage =
+        kReservedSizeForEndOfContainer + kReservedSizeForIMRevision + kReservedSizeForEndOfContainer;
 };
 } // namespace app
 } // namespace chip
@@ -87,6 +87,8 @@ void ReadClient::StopResubscription()
         mReadPrepareParams.mpDataVersionFilterList      = nullptr;
         mReadPrepareParams.mDataVersionFilterListSize   = 0;
     }
+    // The template is not owned by the application through the params, it only has to outlive the subscription.
+    mReadPrepareParams.mpRequestTemplate = nullptr;
 }
 
 ReadClient::~ReadClient()
@@ -177,12 +179,13 @@ void ReadClient::Close(CHIP_ERROR aError, bool allowResubscription)
         if (aError != CHIP_NO_ERROR)
         {
             //
-            // We infer that re-subscription was requested by virtue of having a non-zero list of event OR attribute paths present
-            // in mReadPrepareParams. This would only be the case if an application called SendAutoResubscribeRequest which
-            // populates mReadPrepareParams with the values provided by the application.
+            // We infer that re-subscription was requested by virtue of having a non-zero list of event OR attribute paths, or a
+            // request template, present in mReadPrepareParams. This would only be the case if an application called
+            // SendAutoResubscribeRequest which populates mReadPrepareParams with the values provided by the application.
             //
             if (allowResubscription &&
-                (mReadPrepareParams.mEventPathParamsListSize != 0 || mReadPrepareParams.mAttributePathParamsListSize != 0))
+                (mReadPrepareParams.mEventPathParamsListSize != 0 || mReadPrepareParams.mAttributePathParamsListSize != 0 ||
+                 mReadPrepareParams.mpRequestTemplate != nullptr))
             {
                 aError = mpCallback.OnResubscriptionNeeded(this, aError);
                 if (aError == CHIP_NO_ERROR)
@@ -254,11 +257,20 @@ CHIP_ERROR ReadClient::SendReadRequest(ReadPrepareParams & aReadPrepareParams)
 
     VerifyOrReturnError(ClientState::Idle == mState, err = CHIP_ERROR_INCORRECT_STATE);
 
-    Span<AttributePathParams> attributePaths(aReadPrepareParams.mpAttributePathParamsList,
-                                             aReadPrepareParams.mAttributePathParamsListSize);
-    Span<EventPathParams> eventPaths(aReadPrepareParams.mpEventPathParamsList, aReadPrepareParams.mEventPathParamsListSize);
+    Span<const AttributePathParams> attributePaths(aReadPrepareParams.mpAttributePathParamsList,
+                                                   aReadPrepareParams.mAttributePathParamsListSize);
+    Span<const EventPathParams> eventPaths(aReadPrepareParams.mpEventPathParamsList,
+                                           aReadPrepareParams.mEventPathParamsListSize);
     Span<DataVersionFilter> dataVersionFilters(aReadPrepareParams.mpDataVersionFilterList,
                                                aReadPrepareParams.mDataVersionFilterListSize);
+    ReadRequestTemplate * requestTemplate = aReadPrepareParams.mpRequestTemplate;
+    if (requestTemplate != nullptr)
+    {
+        VerifyOrReturnError(requestTemplate->IsInitialized() && attributePaths.empty() && eventPaths.empty(),
+                            CHIP_ERROR_INVALID_ARGUMENT);
+        attributePaths = requestTemplate->GetAttributePaths();
+        eventPaths     = requestTemplate->GetEventPaths();
+    }
 
     System::PacketBufferHandle msgBuf;
     ReadRequestMessage::Builder request;
@@ -267,7 +279,12 @@ CHIP_ERROR ReadClient::SendReadRequest(ReadPrepareParams & aReadPrepareParams)
     InitWriterWithSpaceReserved(writer, kReservedSizeForTLVEncodingOverhead);
     ReturnErrorOnFailure(request.Init(&writer));
 
-    if (!attributePaths.empty())
+    if (requestTemplate != nullptr && !attributePaths.empty())
+    {
+        ReturnErrorOnFailure(requestTemplate->EncodeAttributePaths(
+            *request.GetWriter(), TLV::ContextTag(to_underlying(ReadRequestMessage::Tag::kAttributeRequests))));
+    }
+    else if (!attributePaths.empty())
     {
         AttributePathIBs::Builder & attributePathListBuilder = request.CreateAttributeRequests();
         ReturnErrorOnFailure(err = request.GetError());
@@ -276,10 +293,18 @@ CHIP_ERROR ReadClient::SendReadRequest(ReadPrepareParams & aReadPrepareParams)
 
     if (!eventPaths.empty())
     {
-        EventPathIBs::Builder & eventPathListBuilder = request.CreateEventRequests();
-        ReturnErrorOnFailure(err = request.GetError());
+        if (requestTemplate != nullptr)
+        {
+            ReturnErrorOnFailure(requestTemplate->EncodeEventPaths(
+                *request.GetWriter(), TLV::ContextTag(to_underlying(ReadRequestMessage::Tag::kEventRequests))));
+        }
+        else
+        {
+            EventPathIBs::Builder & eventPathListBuilder = request.CreateEventRequests();
+            ReturnErrorOnFailure(err = request.GetError());
 
-        ReturnErrorOnFailure(GenerateEventPaths(eventPathListBuilder, eventPaths));
+            ReturnErrorOnFailure(GenerateEventPaths(eventPathListBuilder, eventPaths));
+        }
 
         Optional<EventNumber> eventMin;
         ReturnErrorOnFailure(GetMinEventNumber(aReadPrepareParams, eventMin));
@@ -341,7 +366,8 @@ CHIP_ERROR ReadClient::SendReadRequest(ReadPrepareParams & aReadPrepareParams)
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR ReadClient::GenerateEventPaths(EventPathIBs::Builder & aEventPathsBuilder, const Span<EventPathParams> & aEventPaths)
+CHIP_ERROR ReadClient::GenerateEventPaths(EventPathIBs::Builder & aEventPathsBuilder,
+                                          const Span<const EventPathParams> & aEventPaths)
 {
     for (auto & event : aEventPaths)
     {
@@ -356,7 +382,7 @@ CHIP_ERROR ReadClient::GenerateEventPaths(EventPathIBs::Builder & aEventPathsBui
 }
 
 CHIP_ERROR ReadClient::GenerateAttributePaths(AttributePathIBs::Builder & aAttributePathIBsBuilder,
-                                              const Span<AttributePathParams> & aAttributePaths)
+                                              const Span<const AttributePathParams> & aAttributePaths)
 {
     for (auto & attribute : aAttributePaths)
     {
@@ -371,7 +397,7 @@ CHIP_ERROR ReadClient::GenerateAttributePaths(AttributePathIBs::Builder & aAttri
 }
 
 CHIP_ERROR ReadClient::BuildDataVersionFilterList(DataVersionFilterIBs::Builder & aDataVersionFilterIBsBuilder,
-                                                  const Span<AttributePathParams> & aAttributePaths,
+                                                  const Span<const AttributePathParams> & aAttributePaths,
                                                   const Span<DataVersionFilter> & aDataVersionFilters,
                                                   bool & aEncodedDataVersionList)
 {
@@ -408,7 +434,7 @@ CHIP_ERROR ReadClient::BuildDataVersionFilterList(DataVersionFilterIBs::Builder
 }
 
 CHIP_ERROR ReadClient::GenerateDataVersionFilterList(DataVersionFilterIBs::Builder & aDataVersionFilterIBsBuilder,
-                                                     const Span<AttributePathParams> & aAttributePaths,
+                                                     const Span<const AttributePathParams> & aAttributePaths,
                                                      const Span<DataVersionFilter> & aDataVersionFilters,
                                                      bool & aEncodedDataVersionList)
 {
@@ -959,11 +985,20 @@ CHIP_ERROR ReadClient::SendSubscribeRequestImpl(const ReadPrepareParams & aReadP
     mMinIntervalFloorSeconds = aReadPrepareParams.mMinIntervalFloorSeconds;
 
     // Todo: Remove the below, Update span in ReadPrepareParams
-    Span<AttributePathParams> attributePaths(aReadPrepareParams.mpAttributePathParamsList,
-                                             aReadPrepareParams.mAttributePathParamsListSize);
-    Span<EventPathParams> eventPaths(aReadPrepareParams.mpEventPathParamsList, aReadPrepareParams.mEventPathParamsListSize);
+    Span<const AttributePathParams> attributePaths(aReadPrepareParams.mpAttributePathParamsList,
+                                                   aReadPrepareParams.mAttributePathParamsListSize);
+    Span<const EventPathParams> eventPaths(aReadPrepareParams.mpEventPathParamsList,
+                                           aReadPrepareParams.mEventPathParamsListSize);
     Span<DataVersionFilter> dataVersionFilters(aReadPrepareParams.mpDataVersionFilterList,
                                                aReadPrepareParams.mDataVersionFilterListSize);
+    ReadRequestTemplate * requestTemplate = aReadPrepareParams.mpRequestTemplate;
+    if (requestTemplate != nullptr)
+    {
+        VerifyOrReturnError(requestTemplate->IsInitialized() && attributePaths.empty() && eventPaths.empty(),
+                            CHIP_ERROR_INVALID_ARGUMENT);
+        attributePaths = requestTemplate->GetAttributePaths();
+        eventPaths     = requestTemplate->GetEventPaths();
+    }
 
     System::PacketBufferHandle msgBuf;
     System::PacketBufferTLVWriter writer;
@@ -976,7 +1011,13 @@ CHIP_ERROR ReadClient::SendSubscribeRequestImpl(const ReadPrepareParams & aReadP
         .MinIntervalFloorSeconds(aReadPrepareParams.mMinIntervalFloorSeconds)
         .MaxIntervalCeilingSeconds(aReadPrepareParams.mMaxIntervalCeilingSeconds);
 
-    if (!attributePaths.empty())
+    if (requestTemplate != nullptr && !attributePaths.empty())
+    {
+        ReturnErrorOnFailure(request.GetError());
+        ReturnErrorOnFailure(requestTemplate->EncodeAttributePaths(
+            *request.GetWriter(), TLV::ContextTag(to_underlying(SubscribeRequestMessage::Tag::kAttributeRequests))));
+    }
+    else if (!attributePaths.empty())
     {
         AttributePathIBs::Builder & attributePathListBuilder = request.CreateAttributeRequests();
         ReturnErrorOnFailure(attributePathListBuilder.GetError());
@@ -985,9 +1026,18 @@ CHIP_ERROR ReadClient::SendSubscribeRequestImpl(const ReadPrepareParams & aReadP
 
     if (!eventPaths.empty())
     {
-        EventPathIBs::Builder & eventPathListBuilder = request.CreateEventRequests();
-        ReturnErrorOnFailure(eventPathListBuilder.GetError());
-        ReturnErrorOnFailure(GenerateEventPaths(eventPathListBuilder, eventPaths));
+        if (requestTemplate != nullptr)
+        {
+            ReturnErrorOnFailure(request.GetError());
+            ReturnErrorOnFailure(requestTemplate->EncodeEventPaths(
+                *request.GetWriter(), TLV::ContextTag(to_underlying(SubscribeRequestMessage::Tag::kEventRequests))));
+        }
+        else
+        {
+            EventPathIBs::Builder & eventPathListBuilder = request.CreateEventRequests();
+            ReturnErrorOnFailure(eventPathListBuilder.GetError());
+            ReturnErrorOnFailure(GenerateEventPaths(eventPathListBuilder, eventPaths));
+        }
 
         Optional<EventNumber> eventMin;
         ReturnErrorOnFailure(GetMinEventNumber(aReadPrepareParams, eventMin));
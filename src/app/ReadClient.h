@@ -217,7 +217,7 @@ public:
          * Otherwise aEncodedDataVersionList will be set to false.
          */
         virtual CHIP_ERROR OnUpdateDataVersionFilterList(DataVersionFilterIBs::Builder & aDataVersionFilterIBsBuilder,
-                                                         const Span<AttributePathParams> & aAttributePaths,
+                                                         const Span<const AttributePathParams> & aAttributePaths,
                                                          bool & aEncodedDataVersionList)
         {
             aEncodedDataVersionList = false;
@@ -353,7 +353,8 @@ public:
      *  has mKeepSubscriptions = false, OR, multiple subs with re-sub enabled with mKeepSubscriptions = true. You shall not
      *  have a mix of both simultaneously. If SendAutoResubscribeRequest is called at all, it guarantees that it will call
      *  OnDeallocatePaths when OnDone is called. SendAutoResubscribeRequest is the only case that calls OnDeallocatePaths, since
-     *  that's the only case when the consumer moved a ReadParams into the client.
+     *  that's the only case when the consumer moved a ReadParams into the client. A ReadRequestTemplate set in
+     *  mpRequestTemplate is not deallocated that way: it only has to outlive the ReadClient.
      *
      */
     CHIP_ERROR SendAutoResubscribeRequest(ReadPrepareParams && aReadPrepareParams);
@@ -465,15 +466,15 @@ private:
     bool IsAwaitingInitialReport() const { return mState == ClientState::AwaitingInitialReport; }
     bool IsAwaitingSubscribeResponse() const { return mState == ClientState::AwaitingSubscribeResponse; }
 
-    CHIP_ERROR GenerateEventPaths(EventPathIBs::Builder & aEventPathsBuilder, const Span<EventPathParams> & aEventPaths);
+    CHIP_ERROR GenerateEventPaths(EventPathIBs::Builder & aEventPathsBuilder, const Span<const EventPathParams> & aEventPaths);
     CHIP_ERROR GenerateAttributePaths(AttributePathIBs::Builder & aAttributePathIBsBuilder,
-                                      const Span<AttributePathParams> & aAttributePaths);
+                                      const Span<const AttributePathParams> & aAttributePaths);
 
     CHIP_ERROR GenerateDataVersionFilterList(DataVersionFilterIBs::Builder & aDataVersionFilterIBsBuilder,
-                                             const Span<AttributePathParams> & aAttributePaths,
+                                             const Span<const AttributePathParams> & aAttributePaths,
                                              const Span<DataVersionFilter> & aDataVersionFilters, bool & aEncodedDataVersionList);
     CHIP_ERROR BuildDataVersionFilterList(DataVersionFilterIBs::Builder & aDataVersionFilterIBsBuilder,
-                                          const Span<AttributePathParams> & aAttributePaths,
+                                          const Span<const AttributePathParams> & aAttributePaths,
                                           const Span<DataVersionFilter> & aDataVersionFilters, bool & aEncodedDataVersionList);
     CHIP_ERROR ProcessAttributeReportIBs(TLV::TLVReader & aAttributeDataIBsReader);
     CHIP_ERROR ProcessEventReportIBs(TLV::TLVReader & aEventReportIBsReader);
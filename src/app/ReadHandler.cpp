@@ -123,11 +123,7 @@ ReadHandler::~ReadHandler()
 
     if (IsType(InteractionType::Subscribe))
     {
-        InteractionModelEngine::GetInstance()->GetExchangeManager()->GetSessionManager()->SystemLayer()->CancelTimer(
-            OnUnblockHoldReportCallback, this);
-
-        InteractionModelEngine::GetInstance()->GetExchangeManager()->GetSessionManager()->SystemLayer()->CancelTimer(
-            OnRefreshSubscribeTimerSyncCallback, this);
+        InteractionModelEngine::GetInstance()->GetReportingEngine().GetReportScheduler().UnscheduleHandler(*this);
     }
 
     if (IsAwaitingReportResponse())
@@ -754,32 +750,10 @@ void ReadHandler::PersistSubscription()
     }
 }
 
-void ReadHandler::OnUnblockHoldReportCallback(System::Layer * apSystemLayer, void * apAppState)
-{
-    VerifyOrReturn(apAppState != nullptr);
-    ReadHandler * readHandler = static_cast<ReadHandler *>(apAppState);
-    ChipLogDetail(DataManagement, "Unblock report hold after min %d seconds", readHandler->mMinIntervalFloorSeconds);
-    readHandler->ClearStateFlag(ReadHandlerFlags::HoldReport);
-    InteractionModelEngine::GetInstance()->GetExchangeManager()->GetSessionManager()->SystemLayer()->StartTimer(
-        System::Clock::Seconds16(readHandler->mMaxInterval - readHandler->mMinIntervalFloorSeconds),
-        OnRefreshSubscribeTimerSyncCallback, readHandler);
-}
-
-void ReadHandler::OnRefreshSubscribeTimerSyncCallback(System::Layer * apSystemLayer, void * apAppState)
-{
-    VerifyOrReturn(apAppState != nullptr);
-    ReadHandler * readHandler = static_cast<ReadHandler *>(apAppState);
-    readHandler->ClearStateFlag(ReadHandlerFlags::HoldSync);
-    ChipLogProgress(DataManagement, "Refresh subscribe timer sync after %d seconds",
-                    readHandler->mMaxInterval - readHandler->mMinIntervalFloorSeconds);
-}
-
 CHIP_ERROR ReadHandler::RefreshSubscribeSyncTimer()
 {
-    InteractionModelEngine::GetInstance()->GetExchangeManager()->GetSessionManager()->SystemLayer()->CancelTimer(
-        OnUnblockHoldReportCallback, this);
-    InteractionModelEngine::GetInstance()->GetExchangeManager()->GetSessionManager()->SystemLayer()->CancelTimer(
-        OnRefreshSubscribeTimerSyncCallback, this);
+    reporting::ReportScheduler & scheduler = InteractionModelEngine::GetInstance()->GetReportingEngine().GetReportScheduler();
+    scheduler.UnscheduleHandler(*this);
 
     if (!IsChunkedReport())
     {
@@ -787,9 +761,8 @@ CHIP_ERROR ReadHandler::RefreshSubscribeSyncTimer()
                         mMinIntervalFloorSeconds, mMaxInterval);
         SetStateFlag(ReadHandlerFlags::HoldReport);
         SetStateFlag(ReadHandlerFlags::HoldSync);
-        ReturnErrorOnFailure(
-            InteractionModelEngine::GetInstance()->GetExchangeManager()->GetSessionManager()->SystemLayer()->StartTimer(
-                System::Clock::Seconds16(mMinIntervalFloorSeconds), OnUnblockHoldReportCallback, this));
+        ReturnErrorOnFailure(scheduler.ScheduleHandler(*this, System::Clock::Seconds16(mMinIntervalFloorSeconds),
+                                                       System::Clock::Seconds16(mMaxInterval)));
     }
 
     return CHIP_NO_ERROR;
@@ -44,6 +44,7 @@
 #include <lib/core/TLVDebug.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/DLLUtil.h>
+#include <lib/support/IntrusiveList.h>
 #include <lib/support/logging/CHIPLogging.h>
 #include <messaging/ExchangeHolder.h>
 #include <messaging/ExchangeMgr.h>
@@ -63,6 +64,7 @@ namespace app {
 //
 namespace reporting {
 class Engine;
+class ReportScheduler;
 class TestReportingEngine;
 } // namespace reporting
 
@@ -75,7 +77,7 @@ class InteractionModelEngine;
  *         for the relevant data, and sending a reply.
  *
  */
-class ReadHandler : public Messaging::ExchangeDelegate
+class ReadHandler : public Messaging::ExchangeDelegate, public IntrusiveListNodeBase<>
 {
 public:
     using SubjectDescriptor = Access::SubjectDescriptor;
@@ -373,6 +375,9 @@ private:
     friend class chip::app::reporting::Engine;
     friend class chip::app::InteractionModelEngine;
 
+    // The report scheduler releases HoldReport and HoldSync when the min / max intervals elapse.
+    friend class chip::app::reporting::ReportScheduler;
+
     enum class HandlerState : uint8_t
     {
         Idle,                   ///< The handler has been initialized and is ready
@@ -396,8 +401,6 @@ private:
      */
     void Close(CloseOptions options = CloseOptions::kDropPersistedSubscription);
 
-    static void OnUnblockHoldReportCallback(System::Layer * apSystemLayer, void * apAppState);
-    static void OnRefreshSubscribeTimerSyncCallback(System::Layer * apSystemLayer, void * apAppState);
     CHIP_ERROR RefreshSubscribeSyncTimer();
     CHIP_ERROR SendSubscribeResponse();
     CHIP_ERROR ProcessSubscribeRequest(System::PacketBufferHandle && aPayload);
@@ -471,6 +474,10 @@ private:
     uint16_t mMinIntervalFloorSeconds = 0;
     uint16_t mMaxInterval             = 0;
 
+    // When HoldReport and HoldSync are due to be released, as set up by the report scheduler.
+    System::Clock::Timestamp mMinReportTimestamp = System::Clock::kZero;
+    System::Clock::Timestamp mMaxReportTimestamp = System::Clock::kZero;
+
     EventNumber mEventMin = 0;
 
     // The last schedule event number snapshoted in the beginning when preparing to fill new events to reports
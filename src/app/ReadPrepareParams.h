@@ -22,6 +22,7 @@
 #include <app/DataVersionFilter.h>
 #include <app/EventPathParams.h>
 #include <app/InteractionModelTimeout.h>
+#include <app/ReadRequestTemplate.h>
 #include <app/util/basic-types.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/core/TLV.h>
@@ -39,6 +40,9 @@ struct ReadPrepareParams
     size_t mAttributePathParamsListSize             = 0;
     DataVersionFilter * mpDataVersionFilterList     = nullptr;
     size_t mDataVersionFilterListSize               = 0;
+    // Pre-encoded paths to use instead of mpEventPathParamsList and mpAttributePathParamsList, which must then be empty. Not
+    // owned, see ReadRequestTemplate.
+    ReadRequestTemplate * mpRequestTemplate = nullptr;
     Optional<EventNumber> mEventNumber;
     // The timeout for waiting for the response or System::Clock::kZero to let the interaction model decide the timeout based on the
     // MRP timeouts of the session.
@@ -59,6 +63,7 @@ struct ReadPrepareParams
         mAttributePathParamsListSize       = other.mAttributePathParamsListSize;
         mpDataVersionFilterList            = other.mpDataVersionFilterList;
         mDataVersionFilterListSize         = other.mDataVersionFilterListSize;
+        mpRequestTemplate                  = other.mpRequestTemplate;
         mEventNumber                       = other.mEventNumber;
         mMinIntervalFloorSeconds           = other.mMinIntervalFloorSeconds;
         mMaxIntervalCeilingSeconds         = other.mMaxIntervalCeilingSeconds;
@@ -83,6 +88,7 @@ struct ReadPrepareParams
         mAttributePathParamsListSize       = other.mAttributePathParamsListSize;
         mpDataVersionFilterList            = other.mpDataVersionFilterList;
         mDataVersionFilterListSize         = other.mDataVersionFilterListSize;
+        mpRequestTemplate                  = other.mpRequestTemplate;
         mEventNumber                       = other.mEventNumber;
         mMinIntervalFloorSeconds           = other.mMinIntervalFloorSeconds;
         mMaxIntervalCeilingSeconds         = other.mMaxIntervalCeilingSeconds;
@@ -0,0 +1,125 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/MessageDef/AttributePathIBs.h>
+#include <app/MessageDef/EventPathIBs.h>
+#include <app/ReadRequestTemplate.h>
+#include <lib/core/TLVReader.h>
+#include <lib/support/CodeUtils.h>
+
+#include <algorithm>
+#include <string.h>
+
+namespace chip {
+namespace app {
+
+namespace {
+
+// Upper bound of the size of an encoded AttributePathIB or EventPathIB, with every optional field present.
+constexpr size_t kMaxEncodedPathSize = 40;
+
+// Space for the head and the end of the array.
+constexpr size_t kEncodedArrayOverhead = 2;
+
+/**
+ * Encode an anonymous array with aEncodeArray, and keep what follows the head of the array in aMembers, so that the array can
+ * be written again with any tag.
+ */
+template <typename EncodeArrayFunction>
+CHIP_ERROR EncodeArrayMembers(size_t aPathCount, EncodeArrayFunction aEncodeArray,
+                              Platform::ScopedMemoryBufferWithSize<uint8_t> & aMembers)
+{
+    size_t maxSize = kEncodedArrayOverhead + aPathCount * kMaxEncodedPathSize;
+    Platform::ScopedMemoryBuffer<uint8_t> buffer;
+    VerifyOrReturnError(buffer.Alloc(maxSize), CHIP_ERROR_NO_MEMORY);
+
+    TLV::TLVWriter writer;
+    writer.Init(buffer.Get(), maxSize);
+    ReturnErrorOnFailure(aEncodeArray(writer));
+    ReturnErrorOnFailure(writer.Finalize());
+
+    TLV::TLVReader reader;
+    TLV::TLVType outerContainerType;
+    reader.Init(buffer.Get(), writer.GetLengthWritten());
+    ReturnErrorOnFailure(reader.Next());
+    ReturnErrorOnFailure(reader.EnterContainer(outerContainerType));
+
+    size_t headSize = static_cast<size_t>(reader.GetReadPoint() - buffer.Get());
+    size_t size     = writer.GetLengthWritten() - headSize;
+    VerifyOrReturnError(aMembers.Alloc(size), CHIP_ERROR_NO_MEMORY);
+    memcpy(aMembers.Get(), buffer.Get() + headSize, size);
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+CHIP_ERROR ReadRequestTemplate::Init(const Span<const AttributePathParams> & aAttributePaths,
+                                     const Span<const EventPathParams> & aEventPaths)
+{
+    VerifyOrReturnError(!mInitialized, CHIP_ERROR_INCORRECT_STATE);
+
+    if (!aAttributePaths.empty())
+    {
+        ReturnErrorOnFailure(EncodeArrayMembers(
+            aAttributePaths.size(),
+            [&](TLV::TLVWriter & writer) -> CHIP_ERROR {
+                AttributePathIBs::Builder builder;
+                ReturnErrorOnFailure(builder.Init(&writer));
+                for (auto & attribute : aAttributePaths)
+                {
+                    VerifyOrReturnError(attribute.IsValidAttributePath(), CHIP_ERROR_IM_MALFORMED_ATTRIBUTE_PATH_IB);
+                    AttributePathIB::Builder & path = builder.CreatePath();
+                    ReturnErrorOnFailure(builder.GetError());
+                    ReturnErrorOnFailure(path.Encode(attribute));
+                }
+                return builder.EndOfAttributePathIBs().GetError();
+            },
+            mEncodedAttributePaths));
+
+        VerifyOrReturnError(mAttributePaths.Alloc(aAttributePaths.size()), CHIP_ERROR_NO_MEMORY);
+        std::copy(aAttributePaths.begin(), aAttributePaths.end(), mAttributePaths.Get());
+    }
+
+    if (!aEventPaths.empty())
+    {
+        ReturnErrorOnFailure(EncodeArrayMembers(
+            aEventPaths.size(),
+            [&](TLV::TLVWriter & writer) -> CHIP_ERROR {
+                EventPathIBs::Builder builder;
+                ReturnErrorOnFailure(builder.Init(&writer));
+                for (auto & event : aEventPaths)
+                {
+                    VerifyOrReturnError(event.IsValidEventPath(), CHIP_ERROR_IM_MALFORMED_EVENT_PATH_IB);
+                    EventPathIB::Builder & path = builder.CreatePath();
+                    ReturnErrorOnFailure(builder.GetError());
+                    ReturnErrorOnFailure(path.Encode(event));
+                }
+                return builder.EndOfEventPaths().GetError();
+            },
+            mEncodedEventPaths));
+
+        VerifyOrReturnError(mEventPaths.Alloc(aEventPaths.size()), CHIP_ERROR_NO_MEMORY);
+        std::copy(aEventPaths.begin(), aEventPaths.end(), mEventPaths.Get());
+    }
+
+    mInitialized = true;
+    return CHIP_NO_ERROR;
+}
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,96 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/AttributePathParams.h>
+#include <app/EventPathParams.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/TLVTags.h>
+#include <lib/core/TLVWriter.h>
+#include <lib/support/ScopedBuffer.h>
+#include <lib/support/Span.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * The attribute and event paths of read or subscribe requests, encoded once so that they can be sent to many nodes.
+ *
+ * A controller that reads or subscribes to the same paths on many nodes, or resubscribes to all of them, can set
+ * ReadPrepareParams::mpRequestTemplate instead of the path lists. ReadClient then copies the pre-encoded AttributeRequests
+ * and EventRequests into each request, and only encodes what differs from node to node: the event filters, the data version
+ * filters, and the parameters of the subscription.
+ *
+ * Once initialized, a template does not change. It must outlive the ReadClients that use it, including their resubscriptions.
+ */
+class ReadRequestTemplate
+{
+public:
+    ReadRequestTemplate() = default;
+
+    ReadRequestTemplate(const ReadRequestTemplate &) = delete;
+    ReadRequestTemplate & operator=(const ReadRequestTemplate &) = delete;
+
+    /**
+     * Copy and encode the given paths. The template must not be initialized yet.
+     *
+     * @retval CHIP_ERROR_IM_MALFORMED_ATTRIBUTE_PATH_IB or CHIP_ERROR_IM_MALFORMED_EVENT_PATH_IB if a path is not valid.
+     */
+    CHIP_ERROR Init(const Span<const AttributePathParams> & aAttributePaths, const Span<const EventPathParams> & aEventPaths);
+
+    bool IsInitialized() const { return mInitialized; }
+
+    Span<const AttributePathParams> GetAttributePaths() const
+    {
+        return Span<const AttributePathParams>(mAttributePaths.Get(), mAttributePaths.AllocatedSize());
+    }
+    Span<const EventPathParams> GetEventPaths() const
+    {
+        return Span<const EventPathParams>(mEventPaths.Get(), mEventPaths.AllocatedSize());
+    }
+
+    /**
+     * Write the AttributePathIBs of the paths with the given tag, e.g. the AttributeRequests of a ReadRequestMessage.
+     */
+    CHIP_ERROR EncodeAttributePaths(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
+    {
+        return aWriter.PutPreEncodedContainer(aTag, TLV::kTLVType_Array, mEncodedAttributePaths.Get(),
+                                              static_cast<uint32_t>(mEncodedAttributePaths.AllocatedSize()));
+    }
+
+    /**
+     * Write the EventPathIBs of the paths with the given tag, e.g. the EventRequests of a ReadRequestMessage.
+     */
+    CHIP_ERROR EncodeEventPaths(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
+    {
+        return aWriter.PutPreEncodedContainer(aTag, TLV::kTLVType_Array, mEncodedEventPaths.Get(),
+                                              static_cast<uint32_t>(mEncodedEventPaths.AllocatedSize()));
+    }
+
+private:
+    Platform::ScopedMemoryBufferWithSize<AttributePathParams> mAttributePaths;
+    Platform::ScopedMemoryBufferWithSize<EventPathParams> mEventPaths;
+    // The members of the AttributePathIBs and EventPathIBs arrays, followed by the end of the array.
+    Platform::ScopedMemoryBufferWithSize<uint8_t> mEncodedAttributePaths;
+    Platform::ScopedMemoryBufferWithSize<uint8_t> mEncodedEventPaths;
+    bool mInitialized = false;
+};
+
+} // namespace app
+} // namespace chip
@@ -24,6 +24,7 @@
 
 #include <app/util/privilege-storage.h>
 
+#include <access/AccessControl.h>
 #include <access/Privilege.h>
 
 #include <lib/core/CHIPCore.h>
@@ -75,5 +76,16 @@ public:
     }
 };
 
+/**
+ * Checks that the subject has the privilege required to read the attribute at the given path.
+ *
+ * @return CHIP_ERROR_ACCESS_DENIED if it does not, or another error if access control could not be checked.
+ */
+inline CHIP_ERROR CheckReadAttributeAccess(const Access::SubjectDescriptor & subjectDescriptor, const ConcreteAttributePath & path)
+{
+    Access::RequestPath requestPath{ .cluster = path.mClusterId, .endpoint = path.mEndpointId };
+    return Access::GetAccessControl().Check(subjectDescriptor, requestPath, RequiredPrivilege::ForReadAttribute(path));
+}
+
 } // namespace app
 } // namespace chip
@@ -0,0 +1,208 @@
+/*
+ *    Copyright (c) 2023 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/WriteBehindStorageDelegate.h>
+
+#include <lib/support/CHIPMemString.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <string.h>
+
+namespace chip {
+namespace app {
+
+WriteBehindStorageDelegate::~WriteBehindStorageDelegate()
+{
+    SyncFlush();
+}
+
+CHIP_ERROR WriteBehindStorageDelegate::SyncGetKeyValue(const char * key, void * buffer, uint16_t & size)
+{
+    PendingWrite * pendingWrite = FindLastPending(key);
+    if (pendingWrite == nullptr)
+    {
+        return mStorage.SyncGetKeyValue(key, buffer, size);
+    }
+
+    ReturnErrorCodeIf(pendingWrite->mIsDelete, CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+
+    // Values are at most UINT16_MAX bytes long, as they were set through this API.
+    const uint16_t valueSize = static_cast<uint16_t>(pendingWrite->mValue.AllocatedSize());
+    const uint16_t copySize  = chip::min(size, valueSize);
+    if (copySize > 0)
+    {
+        VerifyOrReturnError(buffer != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+        memcpy(buffer, pendingWrite->mValue.Get(), copySize);
+    }
+    ReturnErrorCodeIf(valueSize > size, CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    size = valueSize;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR WriteBehindStorageDelegate::SyncSetKeyValue(const char * key, const void * value, uint16_t size)
+{
+    VerifyOrReturnError(value != nullptr || size == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    return Enqueue(key, value, size, false /* isDelete */);
+}
+
+CHIP_ERROR WriteBehindStorageDelegate::SyncDeleteKeyValue(const char * key)
+{
+    // Deleting a key that does not exist has to fail now, it cannot be reported once the delete is applied.
+    PendingWrite * pendingWrite = FindLastPending(key);
+    if (pendingWrite != nullptr)
+    {
+        ReturnErrorCodeIf(pendingWrite->mIsDelete, CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+    }
+    else
+    {
+        ReturnErrorCodeIf(!mStorage.SyncDoesKeyExist(key), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+    }
+
+    return Enqueue(key, nullptr, 0, true /* isDelete */);
+}
+
+CHIP_ERROR WriteBehindStorageDelegate::SyncFlush()
+{
+    CHIP_ERROR firstError = CHIP_NO_ERROR;
+
+    mSystemLayer.CancelTimer(OnFlushTimer, this);
+    while (!mPending.Empty())
+    {
+        CHIP_ERROR err = Apply(*mPending.begin());
+        if (firstError == CHIP_NO_ERROR)
+        {
+            firstError = err;
+        }
+    }
+
+    return firstError;
+}
+
+void WriteBehindStorageDelegate::OnFlushTimer(System::Layer * systemLayer, void * context)
+{
+    static_cast<WriteBehindStorageDelegate *>(context)->SyncFlush();
+}
+
+WriteBehindStorageDelegate::PendingWrite * WriteBehindStorageDelegate::FindLastPending(const char * key)
+{
+    // The list is in the order operations were queued, so the last match is the current value of the key.
+    PendingWrite * found = nullptr;
+    for (PendingWrite & pendingWrite : mPending)
+    {
+        if (strcmp(pendingWrite.mKey, key) == 0)
+        {
+            found = &pendingWrite;
+        }
+    }
+    return found;
+}
+
+CHIP_ERROR WriteBehindStorageDelegate::Enqueue(const char * key, const void * value, uint16_t size, bool isDelete)
+{
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    if (strlen(key) > kKeyLengthMax)
+    {
+        // Keys longer than what every storage has to support are rare; keep the order by writing them through.
+        ReturnErrorOnFailure(SyncFlush());
+        return isDelete ? mStorage.SyncDeleteKeyValue(key) : mStorage.SyncSetKeyValue(key, value, size);
+    }
+
+    // Copy the value first, so that a failed write leaves the queue as it was.
+    Platform::ScopedMemoryBufferWithSize<uint8_t> valueCopy;
+    if (size > 0)
+    {
+        valueCopy.Alloc(size);
+        VerifyOrReturnError(valueCopy, CHIP_ERROR_NO_MEMORY);
+        memcpy(valueCopy.Get(), value, size);
+    }
+
+    bool startTimer             = false;
+    PendingWrite * pendingWrite = FindLastPending(key);
+    if (pendingWrite == nullptr || pendingWrite->mEpoch != mEpoch)
+    {
+        if (mPendingCount >= CHIP_CONFIG_WRITE_BEHIND_STORAGE_MAX_PENDING_WRITES)
+        {
+            ChipLogDetail(AppServer, "Write-behind storage queue is full, flushing");
+            // The writer cannot do anything about errors of the operations queued earlier.
+            SyncFlush();
+        }
+
+        pendingWrite = mPendingPool.CreateObject();
+        VerifyOrReturnError(pendingWrite != nullptr, CHIP_ERROR_NO_MEMORY);
+        Platform::CopyString(pendingWrite->mKey, key);
+        pendingWrite->mEpoch = mEpoch;
+        mPending.PushBack(pendingWrite);
+        mPendingCount++;
+        startTimer = (mPendingCount == 1);
+    }
+    else
+    {
+        // The new value is the latest operation, so it has to be applied after the operations queued since the one it replaces.
+        mPending.Remove(pendingWrite);
+        mPending.PushBack(pendingWrite);
+    }
+
+    pendingWrite->mIsDelete = isDelete;
+    pendingWrite->mValue    = std::move(valueCopy);
+
+    // Starting the timer again replaces the running one.
+    startTimer = startTimer || mFlushDelayStart == FlushDelayStart::kLastOperation;
+
+    if (startTimer && mSystemLayer.StartTimer(mFlushDelay, OnFlushTimer, this) != CHIP_NO_ERROR)
+    {
+        // Nothing would flush the queue later, write through instead.
+        return SyncFlush();
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR WriteBehindStorageDelegate::Apply(PendingWrite & pendingWrite)
+{
+    CHIP_ERROR err;
+    if (pendingWrite.mIsDelete)
+    {
+        err = mStorage.SyncDeleteKeyValue(pendingWrite.mKey);
+        // The key may have been written and deleted before ever reaching the storage.
+        if (err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+        {
+            err = CHIP_NO_ERROR;
+        }
+    }
+    else
+    {
+        err = mStorage.SyncSetKeyValue(pendingWrite.mKey, pendingWrite.mValue.Get(),
+                                       static_cast<uint16_t>(pendingWrite.mValue.AllocatedSize()));
+    }
+
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(AppServer, "Failed to apply write-behind storage operation on key %s: %" CHIP_ERROR_FORMAT, pendingWrite.mKey,
+                     err.Format());
+        mFlushErrorCount++;
+    }
+
+    mPending.Remove(&pendingWrite);
+    mPendingPool.ReleaseObject(&pendingWrite);
+    mPendingCount--;
+    return err;
+}
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,119 @@
+/*
+ *    Copyright (c) 2023 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPPersistentStorageDelegate.h>
+#include <lib/support/IntrusiveList.h>
+#include <lib/support/Pool.h>
+#include <lib/support/ScopedBuffer.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * Decorator class for a PersistentStorageDelegate implementation that queues
+ * writes and deletes and applies them to the decorated storage from a timer.
+ *
+ * This class is useful when the decorated storage commits every write (e.g.
+ * rewriting a whole file), so that bursts of writes, such as many subscriptions
+ * being persisted at once, do not stall the event loop on each of them.
+ *
+ * - Reads return the value of the last queued write or delete of the key.
+ * - Queued operations are applied in the order they were made. Writing a key
+ *   that already has a queued write replaces the queued value and moves it
+ *   after the operations queued since, so a key that changes often is committed
+ *   once per flush, and never ahead of an operation made before its last write.
+ * - Barrier() orders the operations queued before it ahead of the ones queued
+ *   after it, even when the latter write the same keys.
+ * - SyncFlush() applies every queued operation before returning.
+ *
+ * Queued operations are applied after the flush delay following the first of
+ * them (or the last of them, see FlushDelayStart), or synchronously when
+ * CHIP_CONFIG_WRITE_BEHIND_STORAGE_MAX_PENDING_WRITES operations are already
+ * queued. Errors from the decorated storage while flushing from the timer cannot
+ * be reported to the writer; they are logged and counted.
+ */
+class WriteBehindStorageDelegate : public PersistentStorageDelegate
+{
+public:
+    enum class FlushDelayStart : uint8_t
+    {
+        // Bound how long an operation stays queued.
+        kFirstPendingOperation,
+        // Only flush once the queue has not changed for the flush delay, e.g. to write a value changing in steps once it
+        // settles.
+        kLastOperation,
+    };
+
+    WriteBehindStorageDelegate(PersistentStorageDelegate & storage, System::Layer & systemLayer,
+                               System::Clock::Milliseconds32 flushDelay,
+                               FlushDelayStart flushDelayStart = FlushDelayStart::kFirstPendingOperation) :
+        mStorage(storage),
+        mSystemLayer(systemLayer), mFlushDelay(flushDelay), mFlushDelayStart(flushDelayStart)
+    {}
+    ~WriteBehindStorageDelegate() override;
+
+    CHIP_ERROR SyncGetKeyValue(const char * key, void * buffer, uint16_t & size) override;
+    CHIP_ERROR SyncSetKeyValue(const char * key, const void * value, uint16_t size) override;
+    CHIP_ERROR SyncDeleteKeyValue(const char * key) override;
+
+    /*
+     * Make sure that the operations queued so far are applied to the decorated
+     * storage before any operation queued afterwards.
+     */
+    void Barrier() { mEpoch++; }
+
+    /*
+     * Apply every queued operation to the decorated storage. Returns the first
+     * error reported by the decorated storage, if any.
+     */
+    CHIP_ERROR SyncFlush();
+
+    size_t GetPendingCount() const { return mPendingCount; }
+    uint32_t GetFlushErrorCount() const { return mFlushErrorCount; }
+
+private:
+    struct PendingWrite : public IntrusiveListNodeBase<>
+    {
+        char mKey[kKeyLengthMax + 1];
+        Platform::ScopedMemoryBufferWithSize<uint8_t> mValue;
+        bool mIsDelete  = false;
+        uint32_t mEpoch = 0;
+    };
+
+    static void OnFlushTimer(System::Layer * systemLayer, void * context);
+
+    PendingWrite * FindLastPending(const char * key);
+    CHIP_ERROR Enqueue(const char * key, const void * value, uint16_t size, bool isDelete);
+    CHIP_ERROR Apply(PendingWrite & pendingWrite);
+
+    PersistentStorageDelegate & mStorage;
+    System::Layer & mSystemLayer;
+    const System::Clock::Milliseconds32 mFlushDelay;
+    const FlushDelayStart mFlushDelayStart;
+
+    IntrusiveList<PendingWrite> mPending;
+    ObjectPool<PendingWrite, CHIP_CONFIG_WRITE_BEHIND_STORAGE_MAX_PENDING_WRITES> mPendingPool;
+    size_t mPendingCount      = 0;
+    uint32_t mEpoch           = 0;
+    uint32_t mFlushErrorCount = 0;
+};
+
+} // namespace app
+} // namespace chip
@@ -62,6 +62,14 @@ void BDXDownloader::Reset()
 {
     mPrevBlockCounter = 0;
     DeviceLayer::SystemLayer().CancelTimer(TransferTimeoutCheckHandler, this);
+
+    for (; mNumQueuedMessages > 0; mNumQueuedMessages--)
+    {
+        mQueuedMessages[mFirstQueuedMessage].msg = nullptr;
+        mFirstQueuedMessage                      = (mFirstQueuedMessage + 1) % ArraySize(mQueuedMessages);
+    }
+    mFirstQueuedMessage = 0;
+    mIsProcessingBlock  = false;
 }
 
 bool BDXDownloader::HasTransferTimedOut()
@@ -81,6 +89,30 @@ bool BDXDownloader::HasTransferTimedOut()
 void BDXDownloader::OnMessageReceived(const chip::PayloadHeader & payloadHeader, chip::System::PacketBufferHandle msg)
 {
     VerifyOrReturn(mState == State::kInProgress, ChipLogError(BDX, "Can't accept messages, no transfer in progress"));
+
+    if (mIsProcessingBlock || mNumQueuedMessages > 0)
+    {
+        if (mNumQueuedMessages == ArraySize(mQueuedMessages))
+        {
+            ChipLogError(BDX, "Too many BDX messages in flight");
+            mBdxTransfer.AbortTransfer(bdx::StatusCode::kTransferFailedUnknownError);
+            PollTransferSession();
+            CleanupOnError(OTAChangeReasonEnum::kFailure);
+            return;
+        }
+
+        QueuedMessage & queued = mQueuedMessages[(mFirstQueuedMessage + mNumQueuedMessages) % ArraySize(mQueuedMessages)];
+        queued.payloadHeader   = payloadHeader;
+        queued.msg             = std::move(msg);
+        mNumQueuedMessages++;
+        return;
+    }
+
+    HandleMessage(payloadHeader, std::move(msg));
+}
+
+void BDXDownloader::HandleMessage(const chip::PayloadHeader & payloadHeader, chip::System::PacketBufferHandle msg)
+{
     CHIP_ERROR err =
         mBdxTransfer.HandleMessageReceived(payloadHeader, std::move(msg), /* TODO:(#12520) */ chip::System::Clock::Seconds16(0));
     if (err != CHIP_NO_ERROR)
@@ -93,6 +125,20 @@ void BDXDownloader::OnMessageReceived(const chip::PayloadHeader & payloadHeader,
     PollTransferSession();
 }
 
+void BDXDownloader::HandleQueuedMessages()
+{
+    while (mState == State::kInProgress && !mIsProcessingBlock && mNumQueuedMessages > 0)
+    {
+        QueuedMessage & queued = mQueuedMessages[mFirstQueuedMessage];
+        PayloadHeader payloadHeader(queued.payloadHeader);
+        System::PacketBufferHandle msg = std::move(queued.msg);
+        mFirstQueuedMessage            = (mFirstQueuedMessage + 1) % ArraySize(mQueuedMessages);
+        mNumQueuedMessages--;
+
+        HandleMessage(payloadHeader, std::move(msg));
+    }
+}
+
 CHIP_ERROR BDXDownloader::SetBDXParams(const chip::bdx::TransferSession::TransferInitData & bdxInitData,
                                        System::Clock::Timeout timeout)
 {
@@ -153,6 +199,18 @@ CHIP_ERROR BDXDownloader::OnPreparedForDownload(CHIP_ERROR status)
 CHIP_ERROR BDXDownloader::FetchNextData()
 {
     VerifyOrReturnError(mState == State::kInProgress, CHIP_ERROR_INCORRECT_STATE);
+
+    if (mBdxTransfer.GetControlMode() == bdx::TransferControlFlags::kAsync)
+    {
+        // The Sender does not wait for a query. Acknowledge the processed Block, which makes room in its send window, and
+        // move on to the Blocks that arrived in the meantime.
+        mIsProcessingBlock = false;
+        ReturnErrorOnFailure(mBdxTransfer.PrepareBlockAck());
+        PollTransferSession();
+        HandleQueuedMessages();
+        return CHIP_NO_ERROR;
+    }
+
     ReturnErrorOnFailure(mBdxTransfer.PrepareBlockQuery());
     PollTransferSession();
 
@@ -208,6 +266,12 @@ void BDXDownloader::EndDownload(CHIP_ERROR reason)
         // Now that we've sent our report, we're idle.
         SetState(State::kIdle, OTAChangeReasonEnum::kSuccess);
     }
+    else if (mState == State::kComplete && reason == CHIP_ERROR_INTEGRITY_CHECK_FAILED)
+    {
+        // The image is verified once the transfer has ended, so there is no transfer left to abort.
+        ChipLogError(BDX, "Downloaded image failed verification");
+        SetState(State::kIdle, OTAChangeReasonEnum::kFailure);
+    }
     else
     {
         ChipLogError(BDX, "No download in progress");
@@ -248,7 +312,11 @@ CHIP_ERROR BDXDownloader::HandleBdxEvent(const chip::bdx::TransferSession::Outpu
     case TransferSession::OutputEventType::kNone:
         break;
     case TransferSession::OutputEventType::kAcceptReceived:
-        ReturnErrorOnFailure(mBdxTransfer.PrepareBlockQuery());
+        // In Async mode, the Sender starts sending Blocks without a query.
+        if (mBdxTransfer.GetControlMode() != bdx::TransferControlFlags::kAsync)
+        {
+            ReturnErrorOnFailure(mBdxTransfer.PrepareBlockQuery());
+        }
         // TODO: need to check ReceiveAccept parameters
         break;
     case TransferSession::OutputEventType::kMsgToSend: {
@@ -265,6 +333,7 @@ CHIP_ERROR BDXDownloader::HandleBdxEvent(const chip::bdx::TransferSession::Outpu
     }
     case TransferSession::OutputEventType::kBlockReceived: {
         chip::ByteSpan blockData(outEvent.blockdata.Data, outEvent.blockdata.Length);
+        mIsProcessingBlock = (mBdxTransfer.GetControlMode() == bdx::TransferControlFlags::kAsync) && !outEvent.blockdata.IsEof;
         ReturnErrorOnFailure(mImageProcessor->ProcessBlock(blockData));
         mStateDelegate->OnUpdateProgressChanged(mImageProcessor->GetPercentComplete());
 
@@ -20,8 +20,6 @@
  * It should not execute any logic that is application specific.
  */
 
-// TODO: unit tests
-
 #pragma once
 
 #include "OTADownloader.h"
@@ -81,6 +79,16 @@ public:
     bool HasTransferTimedOut();
 
 private:
+    // In Async mode, messages that arrive while a Block is being processed are queued until FetchNextData() is called. The
+    // Sender has at most CHIP_CONFIG_BDX_ASYNC_MAX_BLOCKS_IN_FLIGHT Blocks in flight, including the one being processed.
+    struct QueuedMessage
+    {
+        PayloadHeader payloadHeader;
+        System::PacketBufferHandle msg;
+    };
+
+    void HandleMessage(const chip::PayloadHeader & payloadHeader, chip::System::PacketBufferHandle msg);
+    void HandleQueuedMessages();
     void PollTransferSession();
     void CleanupOnError(app::Clusters::OtaSoftwareUpdateRequestor::OTAChangeReasonEnum reason);
     CHIP_ERROR HandleBdxEvent(const chip::bdx::TransferSession::OutputEvent & outEvent);
@@ -94,6 +102,11 @@ private:
     System::Clock::Timeout mTimeout = System::Clock::kZero;
     // Tracks the last block counter used during the transfer session as of the previous check.
     uint32_t mPrevBlockCounter = 0;
+
+    QueuedMessage mQueuedMessages[CHIP_CONFIG_BDX_ASYNC_MAX_BLOCKS_IN_FLIGHT];
+    size_t mFirstQueuedMessage = 0;
+    size_t mNumQueuedMessages  = 0;
+    bool mIsProcessingBlock    = false;
 };
 
 } // namespace chip
@@ -802,8 +802,15 @@ CHIP_ERROR DefaultOTARequestor::StartDownload(Messaging::ExchangeManager & excha
 
     // TODO: allow caller to provide their own OTADownloader instance and set BDX parameters
 
+    // Async mode keeps several Blocks in flight on the exchange, which MRP does not allow, so only offer it over other transports
+    BitFlags<bdx::TransferControlFlags> controlModes(bdx::TransferControlFlags::kReceiverDrive);
+    if (!sessionHandle->RequireMRP())
+    {
+        controlModes.Set(bdx::TransferControlFlags::kAsync);
+    }
+
     TransferSession::TransferInitData initOptions;
-    initOptions.TransferCtlFlags = bdx::TransferControlFlags::kReceiverDrive;
+    initOptions.TransferCtlFlags = static_cast<bdx::TransferControlFlags>(controlModes.Raw());
     initOptions.MaxBlockSize     = mOtaRequestorDriver->GetMaxDownloadBlockSize();
     initOptions.FileDesLength    = static_cast<uint16_t>(mFileDesignator.size());
     initOptions.FileDesignator   = reinterpret_cast<const uint8_t *>(mFileDesignator.data());
@@ -58,6 +58,7 @@ public:
 
     // Not all download protocols will be able to close gracefully from the receiver side.
     // The reason parameter should be used to indicate if this is a graceful end or a forceful abort.
+    // Once the download is complete, a reason of CHIP_ERROR_INTEGRITY_CHECK_FAILED reports that the downloaded image was rejected.
     void virtual EndDownload(CHIP_ERROR reason = CHIP_NO_ERROR) = 0;
 
     // Fetch the next set of data. May be a no-op for asynchronous protocols.
@@ -0,0 +1,111 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/OTAImageHeader.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/Span.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <string.h>
+
+namespace chip {
+
+/**
+ * Computes the digest of an OTA image payload while it is being downloaded, so that the image does not need to be read
+ * back, and checks it against the payload size and digest in the image header. Only SHA-256 digests are verified.
+ */
+class OTAImageDigestVerifier
+{
+public:
+    /**
+     * Prepares the verifier for a new image.
+     */
+    CHIP_ERROR Begin()
+    {
+        mPayloadSize     = 0;
+        mNumPayloadBytes = 0;
+        mDigestType      = OTAImageDigestType::kSha256;
+        mDigestKnown     = false;
+        return mDigestStream.Begin();
+    }
+
+    /**
+     * Records the payload size and digest advertised in the decoded image header. The header may be released afterwards.
+     */
+    void SetHeader(const OTAImageHeader & header)
+    {
+        mPayloadSize = header.mPayloadSize;
+        mDigestType  = header.mImageDigestType;
+        mDigestKnown = (header.mImageDigestType == OTAImageDigestType::kSha256) && (header.mImageDigest.size() == sizeof(mDigest));
+        if (mDigestKnown)
+        {
+            memcpy(mDigest, header.mImageDigest.data(), sizeof(mDigest));
+        }
+    }
+
+    /**
+     * Adds the next chunk of the payload, which follows the image header, to the digest.
+     */
+    CHIP_ERROR AddPayload(const ByteSpan & payload)
+    {
+        ReturnErrorOnFailure(mDigestStream.AddData(payload));
+        mNumPayloadBytes += payload.size();
+        return CHIP_NO_ERROR;
+    }
+
+    /**
+     * Completes the digest once the whole payload has been added.
+     *
+     * @return CHIP_ERROR_INTEGRITY_CHECK_FAILED if the payload size or digest does not match the image header.
+     */
+    CHIP_ERROR Finish()
+    {
+        if (mPayloadSize != 0 && mNumPayloadBytes != mPayloadSize)
+        {
+            ChipLogError(SoftwareUpdate, "Downloaded %" PRIu64 " payload bytes, expected %" PRIu64, mNumPayloadBytes, mPayloadSize);
+            return CHIP_ERROR_INTEGRITY_CHECK_FAILED;
+        }
+
+        uint8_t digestBuffer[Crypto::kSHA256_Hash_Length];
+        MutableByteSpan digest(digestBuffer);
+        ReturnErrorOnFailure(mDigestStream.Finish(digest));
+
+        if (!mDigestKnown)
+        {
+            ChipLogProgress(SoftwareUpdate, "Image digest type %u is not verified on download", to_underlying(mDigestType));
+            return CHIP_NO_ERROR;
+        }
+
+        VerifyOrReturnError(digest.data_equal(ByteSpan(mDigest)), CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+        return CHIP_NO_ERROR;
+    }
+
+private:
+    Crypto::Hash_SHA256_stream mDigestStream;
+    uint64_t mPayloadSize                = 0;
+    uint64_t mNumPayloadBytes            = 0;
+    OTAImageDigestType mDigestType       = OTAImageDigestType::kSha256;
+    uint8_t mDigest[Crypto::kSHA256_Hash_Length];
+    bool mDigestKnown = false;
+};
+
+} // namespace chip
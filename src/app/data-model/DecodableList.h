@@ -22,6 +22,7 @@
 #include <app/data-model/Encode.h>
 #include <app/data-model/FabricScoped.h>
 #include <lib/core/TLV.h>
+#include <lib/support/Span.h>
 
 namespace chip {
 namespace app {
@@ -45,6 +46,17 @@ namespace DataModel {
  *    // If err is failure, decoding failed somewhere along the way.  Some valid
  *    // entries may have been processed already.
  *
+ * Lists that are read more than once, or out of order, can be indexed first:
+ *
+ *    uint32_t offsets[kMaxEntries + 1];
+ *    ReturnErrorOnFailure(list.BuildIndex(Span<uint32_t>(offsets)));
+ *    size_t count;
+ *    list.ComputeSize(&count); // No longer reads the TLV.
+ *    for (size_t i = first; i < count && i < first + pageSize; i++) {
+ *        ReturnErrorOnFailure(list.Get(i, entry));
+ *        // Do whatever with entry
+ *    }
+ *
  */
 template <typename T>
 class DecodableList
@@ -62,14 +74,22 @@ public:
      * Specifically, the passed-in reader should be pointing into the list just after
      * having called `OpenContainer` on the list element.
      */
-    void SetReader(const TLV::TLVReader & reader) { mReader = reader; }
+    void SetReader(const TLV::TLVReader & reader)
+    {
+        mReader = reader;
+        mOffsets = Span<uint32_t>();
+    }
 
     /*
      * @brief
      *
      * This call clears the TLV reader managed by this class, so it can be reused.
      */
-    void ClearReader() { mReader.Init(nullptr, 0); }
+    void ClearReader()
+    {
+        mReader.Init(nullptr, 0);
+        mOffsets = Span<uint32_t>();
+    }
 
     template <typename T0 = T, std::enable_if_t<DataModel::IsFabricScoped<T0>::value, bool> = true>
     void SetFabricIndex(FabricIndex fabricIndex)
@@ -199,6 +219,12 @@ public:
      */
     CHIP_ERROR ComputeSize(size_t * size) const
     {
+        if (IsIndexed())
+        {
+            *size = mOffsets.size() - 1;
+            return CHIP_NO_ERROR;
+        }
+
         if (mReader.GetContainerType() == TLV::kTLVType_NotSpecified)
         {
             *size = 0;
@@ -208,6 +234,82 @@ public:
         return mReader.CountRemainingInContainer(size);
     }
 
+    /*
+     * @brief
+     *
+     * Read the list once to store the offsets of its items in the given storage, so that ComputeSize()
+     * no longer reads the TLV and Get() decodes any item directly. The storage must hold one more
+     * offset than there are items, and must outlive the index, which is cleared by SetReader(),
+     * ClearReader() and Decode(). Copies of the list share the index.
+     *
+     * @retval CHIP_ERROR_BUFFER_TOO_SMALL if the storage cannot hold the offsets of all the items.
+     * @retval CHIP_ERROR_NOT_IMPLEMENTED if the list is not in a single buffer, e.g. it spans several
+     *         packet buffers of a chained reader.
+     */
+    CHIP_ERROR BuildIndex(const Span<uint32_t> & offsets)
+    {
+        mOffsets = Span<uint32_t>();
+        VerifyOrReturnError(!offsets.empty(), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+        if (mReader.GetContainerType() == TLV::kTLVType_NotSpecified)
+        {
+            offsets[0] = 0;
+            mOffsets   = offsets.SubSpan(0, 1);
+            return CHIP_NO_ERROR;
+        }
+
+        TLV::TLVReader reader;
+        reader.Init(mReader);
+        const uint8_t * start = reader.GetReadPoint();
+        uint32_t startLength  = reader.GetLengthRead();
+
+        size_t count = 0;
+        CHIP_ERROR err;
+        while ((err = reader.Next()) == CHIP_NO_ERROR)
+        {
+            ReturnErrorOnFailure(reader.Skip());
+            VerifyOrReturnError(count + 1 < offsets.size(), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+            // The item ends where the reader is after skipping it, at the same distance from the start of
+            // the list in the buffer as in the TLV, unless the reader moved to another buffer.
+            uint32_t end = reader.GetLengthRead() - startLength;
+            VerifyOrReturnError(reader.GetReadPoint() == start + end, CHIP_ERROR_NOT_IMPLEMENTED);
+            offsets[++count] = end;
+        }
+        VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+
+        offsets[0] = 0;
+        mOffsets   = offsets.SubSpan(0, count + 1);
+        return CHIP_NO_ERROR;
+    }
+
+    bool IsIndexed() const { return !mOffsets.empty(); }
+
+    /*
+     * @brief
+     *
+     * Decode the item at the given position of an indexed list, see BuildIndex().
+     *
+     * @retval CHIP_ERROR_INCORRECT_STATE if the list is not indexed.
+     * @retval CHIP_ERROR_NOT_FOUND if there is no such item.
+     */
+    CHIP_ERROR Get(size_t index, T & value) const
+    {
+        VerifyOrReturnError(IsIndexed(), CHIP_ERROR_INCORRECT_STATE);
+        VerifyOrReturnError(index + 1 < mOffsets.size(), CHIP_ERROR_NOT_FOUND);
+
+        // The item is an anonymous element, which can be read on its own.
+        TLV::TLVReader reader;
+        reader.Init(mReader.GetReadPoint() + mOffsets[index], mOffsets[index + 1] - mOffsets[index]);
+        ReturnErrorOnFailure(reader.Next());
+
+        // As in Iterator::Next(), start from the cluster object defaults.
+        value = T();
+        ReturnErrorOnFailure(DataModel::Decode(reader, value));
+        SetValueFabricIndex(value);
+        return CHIP_NO_ERROR;
+    }
+
     CHIP_ERROR Decode(TLV::TLVReader & reader)
     {
         VerifyOrReturnError(reader.GetType() == TLV::kTLVType_Array, CHIP_ERROR_SCHEMA_MISMATCH);
@@ -219,8 +321,23 @@ public:
     }
 
 private:
+    template <typename T0 = T, std::enable_if_t<!DataModel::IsFabricScoped<T0>::value, bool> = true>
+    void SetValueFabricIndex(T & value) const
+    {}
+
+    template <typename T0 = T, std::enable_if_t<DataModel::IsFabricScoped<T0>::value, bool> = true>
+    void SetValueFabricIndex(T & value) const
+    {
+        if (mFabricIndex.HasValue())
+        {
+            value.SetFabricIndex(mFabricIndex.Value());
+        }
+    }
+
     TLV::TLVReader mReader;
     chip::Optional<FabricIndex> mFabricIndex;
+    // When the list is indexed, the offsets from the start of the list of its items, followed by the end of the last item.
+    Span<uint32_t> mOffsets;
 };
 
 } // namespace DataModel
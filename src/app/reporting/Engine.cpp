@@ -49,6 +49,10 @@ void Engine::Shutdown()
     mNumReportsInFlight = 0;
     mCurReadHandlerIdx  = 0;
     mGlobalDirtySet.ReleaseAll();
+    mReportScheduler.Shutdown();
+#if CHIP_CONFIG_IM_REPORT_ENCODING_CACHE_SIZE > 0
+    mEncodingCache.Clear();
+#endif
 }
 
 bool Engine::IsClusterDataVersionMatch(const ObjectList<DataVersionFilter> * aDataVersionFilterList,
@@ -84,6 +88,29 @@ Engine::RetrieveClusterData(const SubjectDescriptor & aSubjectDescriptor, bool a
     return CHIP_NO_ERROR;
 }
 
+#if CHIP_CONFIG_IM_REPORT_ENCODING_CACHE_SIZE > 0
+CHIP_ERROR Engine::RetrieveSharedClusterData(ReadHandler * apReadHandler, AttributeReportIBs::Builder & aAttributeReportIBs,
+                                             const ConcreteReadAttributePath & aPath)
+{
+    const SubjectDescriptor subjectDescriptor = apReadHandler->GetSubjectDescriptor();
+
+    // Subjects that cannot read the attribute get their own status (or nothing, for expanded paths) from RetrieveClusterData.
+    VerifyOrReturnError(CheckReadAttributeAccess(subjectDescriptor, aPath) == CHIP_NO_ERROR, CHIP_ERROR_NOT_FOUND);
+
+    ReportEncodingCache::Key key;
+    key.mPath           = aPath;
+    key.mGeneration     = mDirtyGeneration;
+    key.mFabricIndex    = subjectDescriptor.fabricIndex;
+    key.mFabricFiltered = apReadHandler->IsFabricFiltered();
+    key.mExpanded       = aPath.mExpanded;
+
+    return mEncodingCache.CopyOrEncode(key, *aAttributeReportIBs.GetWriter(), [&](AttributeReportIBs::Builder & aBuilder) {
+        AttributeValueEncoder::AttributeEncodeState encodeState;
+        return RetrieveClusterData(subjectDescriptor, key.mFabricFiltered, aBuilder, aPath, &encodeState);
+    });
+}
+#endif // CHIP_CONFIG_IM_REPORT_ENCODING_CACHE_SIZE > 0
+
 CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Builder & aReportDataBuilder,
                                                            ReadHandler * apReadHandler, bool * apHasMoreChunks,
                                                            bool * apHasEncodedData)
@@ -126,6 +153,14 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
         uint32_t attributesRead = 0;
 #endif
 
+#if CHIP_CONFIG_IM_REPORT_ENCODING_CACHE_SIZE > 0
+        // Dirty attributes are usually reported to every subscription covering them within the same dirty set generation, so
+        // share their encoding between subscriptions.  Reads and priming reports are not driven by the dirty set, and may see
+        // attributes that change without being marked dirty, so they always read the current value.
+        const bool shareEncoding = !apReadHandler->IsPriming() &&
+            InteractionModelEngine::GetInstance()->GetNumActiveReadHandlers(ReadHandler::InteractionType::Subscribe) > 1;
+#endif
+
         // For each path included in the interested path of the read handler...
         for (; apReadHandler->GetAttributePathExpandIterator()->Get(readPath);
              apReadHandler->GetAttributePathExpandIterator()->Next())
@@ -177,8 +212,24 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
             ConcreteReadAttributePath pathForRetrieval(readPath);
             // Load the saved state from previous encoding session for chunking of one single attribute (list chunking).
             AttributeValueEncoder::AttributeEncodeState encodeState = apReadHandler->GetAttributeEncodeState();
-            err = RetrieveClusterData(apReadHandler->GetSubjectDescriptor(), apReadHandler->IsFabricFiltered(), attributeReportIBs,
-                                      pathForRetrieval, &encodeState);
+            bool encodedFromSharedData                              = false;
+#if CHIP_CONFIG_IM_REPORT_ENCODING_CACHE_SIZE > 0
+            // A list that is being chunked for this handler has to be continued where it stopped.
+            if (shareEncoding && !encodeState.AllowPartialData())
+            {
+                encodedFromSharedData =
+                    (RetrieveSharedClusterData(apReadHandler, attributeReportIBs, pathForRetrieval) == CHIP_NO_ERROR);
+                if (!encodedFromSharedData)
+                {
+                    // Retrieve the attribute for this handler alone; that also chunks lists that do not fit in this report.
+                    attributeReportIBs.Rollback(attributeBackup);
+                }
+            }
+#endif
+            err = encodedFromSharedData ? CHIP_NO_ERROR
+                                        : RetrieveClusterData(apReadHandler->GetSubjectDescriptor(),
+                                                              apReadHandler->IsFabricFiltered(), attributeReportIBs,
+                                                              pathForRetrieval, &encodeState);
             if (err != CHIP_NO_ERROR)
             {
                 ChipLogError(DataManagement,
@@ -618,6 +669,28 @@ void Engine::Run()
     // We may be deallocating read handlers as we go.  Track how many we had
     // initially, so we make sure to go through all of them.
     size_t initialAllocated = imEngine->mReadHandlers.Allocated();
+
+    // Keep-alive reports go first, in the order the max intervals of their handlers elapsed.  Handlers left over when the
+    // reports in flight run out stay due until OnReportConfirm runs the engine again.
+    while (mNumReportsInFlight < CHIP_IM_MAX_REPORTS_IN_FLIGHT)
+    {
+        ReadHandler * readHandler = mReportScheduler.PopDueHandler();
+        if (readHandler == nullptr)
+        {
+            break;
+        }
+        if (readHandler->IsReportable())
+        {
+            mRunningReadHandler = readHandler;
+            CHIP_ERROR err      = BuildAndSendSingleReportData(readHandler);
+            mRunningReadHandler = nullptr;
+            if (err != CHIP_NO_ERROR)
+            {
+                return;
+            }
+        }
+    }
+
     while ((mNumReportsInFlight < CHIP_IM_MAX_REPORTS_IN_FLIGHT) && (numReadHandled < initialAllocated))
     {
         ReadHandler * readHandler = imEngine->ActiveHandlerAt(mCurReadHandlerIdx % (uint32_t) imEngine->mReadHandlers.Allocated());
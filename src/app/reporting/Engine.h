@@ -27,6 +27,8 @@
 #include <access/AccessControl.h>
 #include <app/MessageDef/ReportDataMessage.h>
 #include <app/ReadHandler.h>
+#include <app/reporting/ReportEncodingCache.h>
+#include <app/reporting/ReportScheduler.h>
 #include <app/util/basic-types.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/support/CodeUtils.h>
@@ -122,6 +124,11 @@ public:
 
     uint64_t GetDirtySetGeneration() const { return mDirtyGeneration; }
 
+    /**
+     * The scheduler of the min / max intervals of all subscriptions, and its wakeup and latency metrics.
+     */
+    ReportScheduler & GetReportScheduler() { return mReportScheduler; }
+
     /**
      * Schedule event delivery to happen immediately and run reporting to get
      * those reports into messages and on the wire.  This can be done either for
@@ -132,6 +139,9 @@ public:
 
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
     size_t GetGlobalDirtySetSize() { return mGlobalDirtySet.Allocated(); }
+#if CHIP_CONFIG_IM_REPORT_ENCODING_CACHE_SIZE > 0
+    size_t GetSharedEncodingHitCount() const { return mEncodingCache.GetHitCount(); }
+#endif
 #endif
 
 private:
@@ -166,6 +176,17 @@ private:
                                    AttributeReportIBs::Builder & aAttributeReportIBs,
                                    const ConcreteReadAttributePath & aClusterInfo,
                                    AttributeValueEncoder::AttributeEncodeState * apEncoderState);
+#if CHIP_CONFIG_IM_REPORT_ENCODING_CACHE_SIZE > 0
+    /**
+     * Encode the attribute at aPath for apReadHandler by copying the encoding shared with the other ReadHandlers reporting it,
+     * reading and encoding it first if needed.
+     *
+     * @retval CHIP_ERROR_NOT_FOUND if the attribute cannot use a shared encoding for this ReadHandler, and has to be retrieved
+     *                              with RetrieveClusterData instead.
+     */
+    CHIP_ERROR RetrieveSharedClusterData(ReadHandler * apReadHandler, AttributeReportIBs::Builder & aAttributeReportIBs,
+                                         const ConcreteReadAttributePath & aPath);
+#endif
     CHIP_ERROR CheckAccessDeniedEventPaths(TLV::TLVWriter & aWriter, bool & aHasEncodedData, ReadHandler * apReadHandler);
 
     // If version match, it means don't send, if version mismatch, it means send.
@@ -275,6 +296,15 @@ private:
      */
     uint64_t mDirtyGeneration = 1;
 
+    ReportScheduler mReportScheduler;
+
+#if CHIP_CONFIG_IM_REPORT_ENCODING_CACHE_SIZE > 0
+    /**
+     * Encoded values of dirty attributes, shared by the subscriptions reporting them in the current dirty set generation.
+     */
+    ReportEncodingCache mEncodingCache;
+#endif
+
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
     uint32_t mReservedSize          = 0;
     uint32_t mMaxAttributesPerChunk = UINT32_MAX;
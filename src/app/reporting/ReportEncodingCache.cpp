@@ -0,0 +1,145 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/ReportEncodingCache.h>
+
+#if CHIP_CONFIG_IM_REPORT_ENCODING_CACHE_SIZE > 0
+
+#include <app/InteractionModelEngine.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+void ReportEncodingCache::Clear()
+{
+    for (auto & entry : mEntries)
+    {
+        entry.mState = EntryState::kFree;
+    }
+    mNextVictim = 0;
+}
+
+ReportEncodingCache::Entry * ReportEncodingCache::Find(const Key & aKey)
+{
+    for (auto & entry : mEntries)
+    {
+        if (entry.mState == EntryState::kFree || !(entry.mKey == aKey))
+        {
+            continue;
+        }
+
+        // The cluster may have changed without the attribute being marked dirty yet.
+        if (entry.mDataVersion.HasValue() &&
+            !IsClusterDataVersionEqual(ConcreteClusterPath(aKey.mPath.mEndpointId, aKey.mPath.mClusterId),
+                                       entry.mDataVersion.Value()))
+        {
+            entry.mState = EntryState::kFree;
+            return nullptr;
+        }
+        return &entry;
+    }
+    return nullptr;
+}
+
+ReportEncodingCache::Entry & ReportEncodingCache::Claim(const Key & aKey)
+{
+    Entry * victim = nullptr;
+    for (auto & entry : mEntries)
+    {
+        // Entries from an older dirty set generation will never be hit again.
+        if (entry.mState == EntryState::kFree || entry.mKey.mGeneration != aKey.mGeneration)
+        {
+            victim = &entry;
+            break;
+        }
+    }
+
+    if (victim == nullptr)
+    {
+        victim      = &mEntries[mNextVictim];
+        mNextVictim = (mNextVictim + 1) % CHIP_CONFIG_IM_REPORT_ENCODING_CACHE_SIZE;
+    }
+
+    victim->mKey = aKey;
+    victim->mDataVersion.ClearValue();
+    victim->mLength = 0;
+    victim->mState  = EntryState::kUncacheable;
+    return *victim;
+}
+
+void ReportEncodingCache::FinishEncoding(Entry & aEntry, TLV::TLVWriter & aWriter, AttributeReportIBs::Builder & aBuilder,
+                                         CHIP_ERROR aError)
+{
+    if (aError == CHIP_NO_ERROR)
+    {
+        aBuilder.EndOfAttributeReportIBs();
+        aError = aBuilder.GetError();
+    }
+    SuccessOrExit(aError);
+    SuccessOrExit(aError = aWriter.Finalize());
+
+    aEntry.mLength = aWriter.GetLengthWritten();
+    aEntry.mState  = EntryState::kEncoded;
+
+    {
+        // Remember the data version of the first report, unless it is a status, so that the entry can be dropped as soon as the
+        // cluster changes.
+        TLV::TLVReader reader;
+        TLV::TLVType containerType;
+        AttributeReportIB::Parser report;
+        AttributeDataIB::Parser data;
+        DataVersion version;
+
+        reader.Init(aEntry.mBuffer, aEntry.mLength);
+        SuccessOrExit(reader.Next());
+        SuccessOrExit(reader.EnterContainer(containerType));
+        SuccessOrExit(reader.Next());
+        SuccessOrExit(report.Init(reader));
+        SuccessOrExit(report.GetAttributeData(&data));
+        SuccessOrExit(data.GetDataVersion(&version));
+        aEntry.mDataVersion.SetValue(version);
+    }
+
+exit:
+    return;
+}
+
+CHIP_ERROR ReportEncodingCache::Copy(const Entry & aEntry, TLV::TLVWriter & aWriter)
+{
+    VerifyOrReturnError(aEntry.mState == EntryState::kEncoded, CHIP_ERROR_NOT_FOUND);
+
+    TLV::TLVReader reader;
+    TLV::TLVType containerType;
+    reader.Init(aEntry.mBuffer, aEntry.mLength);
+    ReturnErrorOnFailure(reader.Next());
+    ReturnErrorOnFailure(reader.EnterContainer(containerType));
+
+    CHIP_ERROR err;
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        ReturnErrorOnFailure(aWriter.CopyElement(TLV::AnonymousTag(), reader));
+    }
+    return (err == CHIP_END_OF_TLV) ? CHIP_NO_ERROR : err;
+}
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
+
+#endif // CHIP_CONFIG_IM_REPORT_ENCODING_CACHE_SIZE > 0
@@ -0,0 +1,155 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a cache of encoded attribute reports shared between the ReadHandlers of the reporting engine.
+ *
+ */
+
+#pragma once
+
+#include <app/ConcreteAttributePath.h>
+#include <app/MessageDef/AttributeReportIBs.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/core/Optional.h>
+#include <lib/core/TLV.h>
+#include <lib/support/CodeUtils.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if CHIP_CONFIG_IM_REPORT_ENCODING_CACHE_SIZE > 0
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+/**
+ * A small cache of encoded AttributeReportIBs, so that ReadHandlers reporting the same dirty attribute can copy one encoding
+ * instead of reading and encoding the attribute once each.
+ *
+ * An entry is keyed by everything besides the path that can change how the attribute is encoded: the accessing fabric and
+ * whether the interaction is fabric filtered (fabric-scoped lists and fabric-sensitive fields depend on both), and whether
+ * the path was expanded from a wildcard.  It is only valid for the dirty set generation, and the cluster data version, it was
+ * encoded at.
+ *
+ * Access control is not part of the key: callers must check that the subject may read the attribute before filling or
+ * using an entry.
+ */
+class ReportEncodingCache
+{
+public:
+    struct Key
+    {
+        ConcreteAttributePath mPath;
+        uint64_t mGeneration     = 0;
+        FabricIndex mFabricIndex = kUndefinedFabricIndex;
+        bool mFabricFiltered     = false;
+        bool mExpanded           = false;
+
+        bool operator==(const Key & aOther) const
+        {
+            return mPath == aOther.mPath && mGeneration == aOther.mGeneration && mFabricIndex == aOther.mFabricIndex &&
+                mFabricFiltered == aOther.mFabricFiltered && mExpanded == aOther.mExpanded;
+        }
+    };
+
+    /**
+     * Copy the AttributeReportIBs cached for aKey into aWriter, which must be positioned inside an AttributeReportIBs array.
+     * On failure, aWriter may hold part of the copy and the caller has to roll it back.
+     *
+     * If there is no entry for aKey, aEncode is called with a builder for an AttributeReportIBs array to fill one first.
+     * aEncode must behave like ReadSingleClusterData.
+     *
+     * @retval CHIP_ERROR_NOT_FOUND if the encoding cannot be shared (it does not fit in an entry, or aEncode failed); the
+     *                              caller should encode the attribute itself.
+     * @retval CHIP_ERROR_BUFFER_TOO_SMALL / CHIP_ERROR_NO_MEMORY if aWriter runs out of space.
+     */
+    template <typename EncodeFunction>
+    CHIP_ERROR CopyOrEncode(const Key & aKey, TLV::TLVWriter & aWriter, EncodeFunction && aEncode)
+    {
+        Entry * entry = Find(aKey);
+        if (entry != nullptr)
+        {
+            ReturnErrorOnFailure(Copy(*entry, aWriter));
+            mHitCount++;
+            return CHIP_NO_ERROR;
+        }
+
+        entry = &Claim(aKey);
+
+        TLV::TLVWriter writer;
+        AttributeReportIBs::Builder builder;
+        writer.Init(entry->mBuffer);
+        CHIP_ERROR err = builder.Init(&writer);
+        if (err == CHIP_NO_ERROR)
+        {
+            err = aEncode(builder);
+        }
+        FinishEncoding(*entry, writer, builder, err);
+
+        return Copy(*entry, aWriter);
+    }
+
+    /**
+     * Drop every entry.
+     */
+    void Clear();
+
+    /**
+     * Number of times an entry was copied instead of encoding the attribute again.
+     */
+    size_t GetHitCount() const { return mHitCount; }
+
+private:
+    enum class EntryState : uint8_t
+    {
+        kFree,
+        kEncoded,
+        // The encoding for the key could not be cached; do not try again until the entry is reused.
+        kUncacheable,
+    };
+
+    struct Entry
+    {
+        Key mKey;
+        Optional<DataVersion> mDataVersion;
+        uint32_t mLength  = 0;
+        EntryState mState = EntryState::kFree;
+        uint8_t mBuffer[CHIP_CONFIG_IM_REPORT_ENCODING_CACHE_ENTRY_SIZE];
+    };
+
+    Entry * Find(const Key & aKey);
+    Entry & Claim(const Key & aKey);
+    static void FinishEncoding(Entry & aEntry, TLV::TLVWriter & aWriter, AttributeReportIBs::Builder & aBuilder,
+                               CHIP_ERROR aError);
+    static CHIP_ERROR Copy(const Entry & aEntry, TLV::TLVWriter & aWriter);
+
+    Entry mEntries[CHIP_CONFIG_IM_REPORT_ENCODING_CACHE_SIZE];
+    size_t mNextVictim = 0;
+    size_t mHitCount   = 0;
+};
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
+
+#endif // CHIP_CONFIG_IM_REPORT_ENCODING_CACHE_SIZE > 0
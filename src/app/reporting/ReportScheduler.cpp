@@ -0,0 +1,223 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/ReportScheduler.h>
+
+#include <app/InteractionModelEngine.h>
+
+#include <algorithm>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+using namespace System::Clock;
+using System::SystemClock;
+// Not the event Timestamp of chip::app.
+using System::Clock::Timestamp;
+
+namespace {
+constexpr Milliseconds64 kAlignment{ CHIP_CONFIG_IM_REPORT_SCHEDULER_ALIGNMENT_MS };
+} // namespace
+
+void ReportScheduler::ComputeDeadlines(Timestamp aNow, Seconds16 aMinInterval, Seconds16 aMaxInterval, Timestamp & aMinTimestamp,
+                                       Timestamp & aMaxTimestamp)
+{
+    aMinTimestamp = aNow + aMinInterval;
+    aMaxTimestamp = aNow + aMaxInterval;
+
+#if CHIP_CONFIG_IM_REPORT_SCHEDULER_ALIGNMENT_MS > 0
+    // A min interval of 0 means the subscriber wants changes as soon as they happen, do not delay those.
+    if (aMinInterval > kZero)
+    {
+        Timestamp alignedMin((aMinTimestamp.count() + kAlignment.count() - 1) / kAlignment.count() * kAlignment.count());
+        if (alignedMin <= aMaxTimestamp)
+        {
+            aMinTimestamp = alignedMin;
+        }
+    }
+
+    Timestamp alignedMax(aMaxTimestamp.count() / kAlignment.count() * kAlignment.count());
+    if (alignedMax >= aMinTimestamp)
+    {
+        aMaxTimestamp = alignedMax;
+    }
+#endif // CHIP_CONFIG_IM_REPORT_SCHEDULER_ALIGNMENT_MS > 0
+}
+
+CHIP_ERROR ReportScheduler::ScheduleHandler(ReadHandler & aHandler, Seconds16 aMinInterval, Seconds16 aMaxInterval)
+{
+    Messaging::ExchangeManager * exchangeManager = InteractionModelEngine::GetInstance()->GetExchangeManager();
+    VerifyOrReturnError(exchangeManager != nullptr && exchangeManager->GetSessionManager() != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    mpSystemLayer = exchangeManager->GetSessionManager()->SystemLayer();
+    VerifyOrReturnError(mpSystemLayer != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    if (IsScheduled(aHandler))
+    {
+        mQueue.Remove(&aHandler);
+    }
+
+    ComputeDeadlines(SystemClock().GetMonotonicTimestamp(), aMinInterval, aMaxInterval, aHandler.mMinReportTimestamp,
+                     aHandler.mMaxReportTimestamp);
+    Insert(aHandler);
+    RearmTimer();
+    return CHIP_NO_ERROR;
+}
+
+void ReportScheduler::UnscheduleHandler(ReadHandler & aHandler)
+{
+    VerifyOrReturn(IsScheduled(aHandler));
+
+    const bool wasFirst = !mQueue.Empty() && (&*mQueue.begin() == &aHandler);
+    // The handler may be waiting in mQueue or in mDue; removing it does not depend on the list.
+    mQueue.Remove(&aHandler);
+    if (wasFirst)
+    {
+        RearmTimer();
+    }
+}
+
+void ReportScheduler::Shutdown()
+{
+    if (mpSystemLayer != nullptr)
+    {
+        mpSystemLayer->CancelTimer(OnTimerExpired, this);
+    }
+
+    while (!mQueue.Empty())
+    {
+        mQueue.Remove(&*mQueue.begin());
+    }
+    while (!mDue.Empty())
+    {
+        mDue.Remove(&*mDue.begin());
+    }
+    mpSystemLayer = nullptr;
+}
+
+ReadHandler * ReportScheduler::PopDueHandler()
+{
+    VerifyOrReturnValue(!mDue.Empty(), nullptr);
+    ReadHandler * const handler = &*mDue.begin();
+    mDue.Remove(handler);
+    return handler;
+}
+
+Timestamp ReportScheduler::NextDeadline(const ReadHandler & aHandler)
+{
+    return aHandler.mFlags.Has(ReadHandler::ReadHandlerFlags::HoldReport) ? aHandler.mMinReportTimestamp
+                                                                          : aHandler.mMaxReportTimestamp;
+}
+
+void ReportScheduler::Insert(ReadHandler & aHandler)
+{
+    const Timestamp deadline = NextDeadline(aHandler);
+
+    // New deadlines are usually the latest ones, so look for the insertion point from the back.
+    auto it = mQueue.end();
+    while (it != mQueue.begin())
+    {
+        --it;
+        if (NextDeadline(*it) <= deadline)
+        {
+            mQueue.InsertAfter(it, &aHandler);
+            return;
+        }
+    }
+    mQueue.PushFront(&aHandler);
+}
+
+void ReportScheduler::RearmTimer()
+{
+    VerifyOrReturn(mpSystemLayer != nullptr);
+    mpSystemLayer->CancelTimer(OnTimerExpired, this);
+    VerifyOrReturn(!mQueue.Empty());
+
+    const Timestamp now      = SystemClock().GetMonotonicTimestamp();
+    const Timestamp deadline = NextDeadline(*mQueue.begin());
+    const Milliseconds32 delay(deadline > now ? static_cast<uint32_t>((deadline - now).count()) : 0);
+
+    CHIP_ERROR err = mpSystemLayer->StartTimer(delay, OnTimerExpired, this);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DataManagement, "Failed to start report scheduler timer: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+}
+
+void ReportScheduler::OnTimerExpired(System::Layer * apSystemLayer, void * apAppState)
+{
+    ReportScheduler * const scheduler = static_cast<ReportScheduler *>(apAppState);
+    scheduler->HandleDeadlines();
+    scheduler->RearmTimer();
+}
+
+void ReportScheduler::CountDeadline(Timestamp aDeadline, Timestamp aNow)
+{
+    if (aNow > aDeadline)
+    {
+        const Milliseconds32 latency(static_cast<uint32_t>(std::min<uint64_t>((aNow - aDeadline).count(), UINT32_MAX)));
+        mMetrics.mMaxLatency = std::max(mMetrics.mMaxLatency, latency);
+        mMetrics.mTotalLatency += latency;
+    }
+    mMetrics.mDeadlinesHandled++;
+}
+
+void ReportScheduler::HandleDeadline(ReadHandler & aHandler, Timestamp aNow)
+{
+    CountDeadline(NextDeadline(aHandler), aNow);
+
+    mQueue.Remove(&aHandler);
+    if (aHandler.mFlags.Has(ReadHandler::ReadHandlerFlags::HoldReport))
+    {
+        // The min interval floor elapsed; the handler now waits for its max interval, unless it elapsed as well.
+        aHandler.ClearStateFlag(ReadHandler::ReadHandlerFlags::HoldReport);
+        if (aHandler.mMaxReportTimestamp > aNow)
+        {
+            Insert(aHandler);
+            return;
+        }
+        CountDeadline(aHandler.mMaxReportTimestamp, aNow);
+    }
+
+    mDue.PushBack(&aHandler);
+    aHandler.ClearStateFlag(ReadHandler::ReadHandlerFlags::HoldSync);
+}
+
+void ReportScheduler::HandleDeadlines()
+{
+    const Timestamp now          = SystemClock().GetMonotonicTimestamp();
+    const uint32_t handledBefore = mMetrics.mDeadlinesHandled;
+
+    mMetrics.mWakeups++;
+
+    // A handler that goes on waiting for its max interval is inserted after every handler that is due, so one pass over the
+    // due handlers at the front of the queue handles all of them.
+    auto it = mQueue.begin();
+    while (it != mQueue.end() && NextDeadline(*it) <= now)
+    {
+        ReadHandler & handler = *it;
+        ++it;
+        HandleDeadline(handler, now);
+    }
+
+    mMetrics.mMaxDeadlinesPerWakeup = std::max(mMetrics.mMaxDeadlinesPerWakeup, mMetrics.mDeadlinesHandled - handledBefore);
+}
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
@@ -0,0 +1,129 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the scheduler of the min/max interval deadlines of subscriptions.
+ *
+ */
+
+#pragma once
+
+#include <app/ReadHandler.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/support/IntrusiveList.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+class TestReportingEngine;
+
+/**
+ * Tracks when each subscription's ReadHandler may report again (its min interval floor elapsed) and when it has to report
+ * (its max interval elapsed), using a single timer for all of them.
+ *
+ * Handlers wait in a queue ordered by their next deadline, and the timer is armed for the earliest one.  To let one wakeup
+ * serve several handlers, deadlines are aligned to a grid of CHIP_CONFIG_IM_REPORT_SCHEDULER_ALIGNMENT_MS when that keeps
+ * them within the handler's [min, max] window: the end of the min interval is moved later (not for a min interval of 0, which
+ * asks for reports as soon as data changes), and the max interval deadline earlier.  Deadlines are never handled before they
+ * are due.
+ *
+ * The scheduler only releases the HoldReport / HoldSync flags of the handlers; the reporting engine still generates the
+ * reports, within its limit of reports in flight.  Handlers whose max interval elapsed wait in a second queue, in the order
+ * they were due, for the engine to send their keep-alive reports (see PopDueHandler).
+ */
+class ReportScheduler
+{
+public:
+    struct Metrics
+    {
+        // Number of times the timer fired.
+        uint32_t mWakeups = 0;
+        // Number of min or max interval deadlines handled by those wakeups.
+        uint32_t mDeadlinesHandled = 0;
+        // Most deadlines handled by a single wakeup.
+        uint32_t mMaxDeadlinesPerWakeup = 0;
+        // How late deadlines were handled compared to when they were due.
+        System::Clock::Milliseconds32 mMaxLatency   = System::Clock::kZero;
+        System::Clock::Milliseconds64 mTotalLatency = System::Clock::kZero;
+    };
+
+    /**
+     * Start the min / max intervals of aHandler from now, replacing any deadlines it had.
+     */
+    CHIP_ERROR ScheduleHandler(ReadHandler & aHandler, System::Clock::Seconds16 aMinInterval,
+                               System::Clock::Seconds16 aMaxInterval);
+
+    /**
+     * Forget about aHandler.  Must be called before a scheduled handler is destroyed.
+     */
+    void UnscheduleHandler(ReadHandler & aHandler);
+
+    /**
+     * Unschedule every handler and stop the timer.
+     */
+    void Shutdown();
+
+    static bool IsScheduled(const ReadHandler & aHandler) { return aHandler.IsInList(); }
+
+    /**
+     * Take the handler whose max interval elapsed first among those that have not been handed to the reporting engine yet,
+     * or nullptr if there is none.
+     */
+    ReadHandler * PopDueHandler();
+
+    const Metrics & GetMetrics() const { return mMetrics; }
+    void ResetMetrics() { mMetrics = Metrics(); }
+
+    /**
+     * Compute the aligned [aMinTimestamp, aMaxTimestamp] deadlines for min / max intervals that start at aNow.
+     */
+    static void ComputeDeadlines(System::Clock::Timestamp aNow, System::Clock::Seconds16 aMinInterval,
+                                 System::Clock::Seconds16 aMaxInterval, System::Clock::Timestamp & aMinTimestamp,
+                                 System::Clock::Timestamp & aMaxTimestamp);
+
+private:
+    friend class TestReportingEngine;
+
+    static void OnTimerExpired(System::Layer * apSystemLayer, void * apAppState);
+
+    static System::Clock::Timestamp NextDeadline(const ReadHandler & aHandler);
+
+    void Insert(ReadHandler & aHandler);
+    void CountDeadline(System::Clock::Timestamp aDeadline, System::Clock::Timestamp aNow);
+    void HandleDeadline(ReadHandler & aHandler, System::Clock::Timestamp aNow);
+    void HandleDeadlines();
+    void RearmTimer();
+
+    // Handlers waiting for a deadline, ordered by that deadline.
+    IntrusiveList<ReadHandler> mQueue;
+    // Handlers whose max interval elapsed, in the order it did.
+    IntrusiveList<ReadHandler> mDue;
+    System::Layer * mpSystemLayer = nullptr;
+    Metrics mMetrics;
+};
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
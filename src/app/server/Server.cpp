@@ -140,7 +140,13 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
 
     // Set up attribute persistence before we try to bring up the data model
     // handler.
+#if CHIP_CONFIG_WRITE_BEHIND_ATTRIBUTE_STORAGE
+    SuccessOrExit(err = mAttributePersister.Init(&mAttributeStorage.Emplace(
+                      *mDeviceStorage, DeviceLayer::SystemLayer(),
+                      System::Clock::Milliseconds32(CHIP_CONFIG_WRITE_BEHIND_ATTRIBUTE_STORAGE_FLUSH_DELAY_MS))));
+#else
     SuccessOrExit(mAttributePersister.Init(mDeviceStorage));
+#endif
     SetAttributePersistenceProvider(&mAttributePersister);
 
     {
@@ -478,6 +484,14 @@ void Server::Shutdown()
     Access::ResetAccessControlToDefault();
     Credentials::SetGroupDataProvider(nullptr);
     mAttributePersister.Shutdown();
+#if CHIP_CONFIG_WRITE_BEHIND_ATTRIBUTE_STORAGE
+    // Commit the attribute values that are still queued.
+    if (mAttributeStorage.HasValue())
+    {
+        LogErrorOnFailure(mAttributeStorage.Value().SyncFlush());
+        mAttributeStorage.ClearValue();
+    }
+#endif
     // TODO(16969): Remove chip::Platform::MemoryInit() call from Server class, it belongs to outer code
     chip::Platform::MemoryShutdown();
 }
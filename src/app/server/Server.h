@@ -28,6 +28,9 @@
 #include <app/OperationalSessionSetupPool.h>
 #include <app/SimpleSubscriptionResumptionStorage.h>
 #include <app/TestEventTriggerDelegate.h>
+#if CHIP_CONFIG_WRITE_BEHIND_ATTRIBUTE_STORAGE
+#include <app/WriteBehindStorageDelegate.h>
+#endif
 #include <app/server/AclStorage.h>
 #include <app/server/AppDelegate.h>
 #include <app/server/CommissioningWindowManager.h>
@@ -578,6 +581,9 @@ private:
     app::SubscriptionResumptionStorage * mSubscriptionResumptionStorage;
     Credentials::GroupDataProvider * mGroupsProvider;
     Crypto::SessionKeystore * mSessionKeystore;
+#if CHIP_CONFIG_WRITE_BEHIND_ATTRIBUTE_STORAGE
+    Optional<app::WriteBehindStorageDelegate> mAttributeStorage;
+#endif
     app::DefaultAttributePersistenceProvider mAttributePersister;
     GroupDataProviderListener mListener;
     ServerFabricDelegate mFabricDelegate;
@@ -22,8 +22,10 @@
 #include <app/EventManagement.h>
 #include <app/ObjectList.h>
 #include <app/util/mock/Constants.h>
+#include <app/util/mock/Functions.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/core/TLVDebug.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/DLLUtil.h>
 #include <lib/support/UnitTestRegistration.h>
@@ -417,8 +419,35 @@ void TestMultipleClusInfo(nlTestSuite * apSuite, void * apContext)
     NL_TEST_ASSERT(apSuite, index == ArraySize(paths));
 }
 
+void TestMetadataGenerationChange(nlTestSuite * apSuite, void * apContext)
+{
+    app::ObjectList<app::AttributePathParams> clusInfo;
+
+    // Changing the metadata generation in the middle of an expansion rebuilds the expansion table; since the mock endpoints did
+    // not actually change, the iterator must go on with the same paths.
+    app::ConcreteAttributePath expected;
+    app::ConcreteAttributePath path;
+    app::AttributePathExpandIterator reference(&clusInfo);
+    app::AttributePathExpandIterator iter(&clusInfo);
+    size_t count = 0;
+    while (reference.Get(expected))
+    {
+        if (count % 7 == 0)
+        {
+            Test::BumpMetadataStructureGeneration();
+        }
+        NL_TEST_ASSERT(apSuite, iter.Get(path) && path == expected);
+        reference.Next();
+        iter.Next();
+        count++;
+    }
+    NL_TEST_ASSERT(apSuite, !iter.Get(path));
+    NL_TEST_ASSERT(apSuite, count > 0);
+}
+
 static int TestSetup(void * inContext)
 {
+    VerifyOrReturnError(Platform::MemoryInit() == CHIP_NO_ERROR, FAILURE);
     return SUCCESS;
 }
 
@@ -427,6 +456,8 @@ static int TestSetup(void * inContext)
  */
 static int TestTeardown(void * inContext)
 {
+    app::AttributePathExpandIterator::ReleaseExpansionTable();
+    Platform::MemoryShutdown();
     return SUCCESS;
 }
 
@@ -445,6 +476,7 @@ const nlTest sTests[] =
         NL_TEST_DEF("TestWildcardAttribute", TestWildcardAttribute),
         NL_TEST_DEF("TestNoWildcard", TestNoWildcard),
         NL_TEST_DEF("TestMultipleClusInfo", TestMultipleClusInfo),
+        NL_TEST_DEF("TestMetadataGenerationChange", TestMetadataGenerationChange),
         NL_TEST_SENTINEL()
 };
 // clang-format on
@@ -0,0 +1,349 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/clusters/ota-requestor/BDXDownloader.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <platform/CHIPDeviceLayer.h>
+#include <protocols/bdx/BdxTransferSession.h>
+#include <system/SystemLayerImpl.h>
+#include <transport/raw/MessageHeader.h>
+
+#include <nlunit-test.h>
+
+using namespace chip;
+using namespace chip::bdx;
+using chip::app::Clusters::OtaSoftwareUpdateRequestor::OTAChangeReasonEnum;
+
+namespace {
+
+constexpr size_t kImageSize                    = 1000;
+constexpr uint16_t kBlockSize                  = 64;
+constexpr System::Clock::Timeout kTimeout      = System::Clock::Seconds16(30);
+constexpr System::Clock::Timestamp kNoAdvance  = System::Clock::kZero;
+constexpr int kMaxTransferSteps                = 1000;
+constexpr char kFileDesignator[]               = "test.bin";
+
+System::LayerImpl gSystemLayer;
+uint8_t gImage[kImageSize];
+
+// Stores the image, and only asks for the next Block when the test lets it finish processing the previous one.
+class TestImageProcessor : public OTAImageProcessorInterface
+{
+public:
+    CHIP_ERROR PrepareDownload() override { return CHIP_NO_ERROR; }
+    CHIP_ERROR Finalize() override
+    {
+        mFinalized = true;
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR Apply() override { return CHIP_NO_ERROR; }
+    CHIP_ERROR Abort() override
+    {
+        mAborted = true;
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR ProcessBlock(ByteSpan & block) override
+    {
+        VerifyOrReturnError(!mBlockPending, CHIP_ERROR_INCORRECT_STATE);
+        VerifyOrReturnError(mNumBytes + block.size() <= sizeof(mImage), CHIP_ERROR_BUFFER_TOO_SMALL);
+        memcpy(&mImage[mNumBytes], block.data(), block.size());
+        mNumBytes += block.size();
+        mBlockPending = true;
+        return CHIP_NO_ERROR;
+    }
+    bool IsFirstImageRun() override { return false; }
+    CHIP_ERROR ConfirmCurrentImage() override { return CHIP_NO_ERROR; }
+
+    uint8_t mImage[kImageSize];
+    size_t mNumBytes   = 0;
+    bool mBlockPending = false;
+    bool mFinalized    = false;
+    bool mAborted      = false;
+};
+
+// Queues the messages of the downloader until the Sender is ready for them, as the exchange to an OTA Provider would.
+class TestMessenger : public BDXDownloader::MessagingDelegate
+{
+public:
+    CHIP_ERROR SendMessage(const TransferSession::OutputEvent & msgEvent) override
+    {
+        VerifyOrReturnError(mNumMessages < ArraySize(mMessages), CHIP_ERROR_NO_MEMORY);
+        mMessages[mNumMessages].payloadHeader.SetMessageType(msgEvent.msgTypeData.ProtocolId, msgEvent.msgTypeData.MessageType);
+        mMessages[mNumMessages].msg = msgEvent.MsgData.Retain();
+        mNumMessages++;
+        return CHIP_NO_ERROR;
+    }
+
+    // Delivers the oldest queued message to the Sender, if any.
+    bool DeliverMessage(nlTestSuite * inSuite, TransferSession & sender)
+    {
+        VerifyOrReturnValue(mNumMessages > 0, false);
+        NL_TEST_ASSERT(inSuite,
+                       sender.HandleMessageReceived(mMessages[0].payloadHeader, std::move(mMessages[0].msg), kNoAdvance) ==
+                           CHIP_NO_ERROR);
+        for (size_t i = 1; i < mNumMessages; i++)
+        {
+            mMessages[i - 1].payloadHeader = mMessages[i].payloadHeader;
+            mMessages[i - 1].msg           = std::move(mMessages[i].msg);
+        }
+        mNumMessages--;
+        return true;
+    }
+
+private:
+    struct Message
+    {
+        PayloadHeader payloadHeader;
+        System::PacketBufferHandle msg;
+    };
+
+    Message mMessages[4];
+    size_t mNumMessages = 0;
+};
+
+class TestStateDelegate : public BDXDownloader::StateDelegate
+{
+public:
+    void OnDownloadStateChanged(OTADownloader::State state, OTAChangeReasonEnum reason) override { mReason = reason; }
+    void OnUpdateProgressChanged(app::DataModel::Nullable<uint8_t> percent) override {}
+
+    OTAChangeReasonEnum mReason = OTAChangeReasonEnum::kUnknown;
+};
+
+// The OTA Provider side of the transfer, which serves gImage the way BdxOtaSender does.
+class TestProvider
+{
+public:
+    CHIP_ERROR Init(BitFlags<TransferControlFlags> supportedModes)
+    {
+        return mSender.WaitForTransfer(TransferRole::kSender, supportedModes, kBlockSize, kTimeout);
+    }
+
+    // Handles one output of the Sender. Messages to send are delivered to the downloader right away, and messages from the
+    // downloader once the Sender has nothing left to do.
+    void Step(nlTestSuite * inSuite, BDXDownloader & downloader, TestMessenger & messenger, TestImageProcessor & processor,
+              TransferControlFlags mode)
+    {
+        TransferSession::OutputEvent event;
+        mSender.PollOutput(event, kNoAdvance);
+
+        switch (event.EventType)
+        {
+        case TransferSession::OutputEventType::kInitReceived: {
+            TransferSession::TransferAcceptData acceptData;
+            acceptData.ControlMode  = mode;
+            acceptData.MaxBlockSize = mSender.GetTransferBlockSize();
+            NL_TEST_ASSERT(inSuite, mSender.AcceptTransfer(acceptData) == CHIP_NO_ERROR);
+            break;
+        }
+        case TransferSession::OutputEventType::kQueryReceived:
+            PrepareNextBlock(inSuite);
+            break;
+        case TransferSession::OutputEventType::kMsgToSend: {
+            if (processor.mBlockPending && event.msgTypeData.HasMessageType(MessageType::Block))
+            {
+                mNumBlocksSentWhileProcessing++;
+            }
+            PayloadHeader payloadHeader;
+            payloadHeader.SetMessageType(event.msgTypeData.ProtocolId, event.msgTypeData.MessageType);
+            downloader.OnMessageReceived(payloadHeader, std::move(event.MsgData));
+            break;
+        }
+        case TransferSession::OutputEventType::kNone:
+            if (messenger.DeliverMessage(inSuite, mSender))
+            {
+                break;
+            }
+            // As in BdxOtaSender, Async mode sends Blocks without waiting for a query. Otherwise, let the image processor
+            // finish the Block it is working on.
+            if (mSender.CanPrepareBlock() && mSender.GetControlMode() == TransferControlFlags::kAsync)
+            {
+                PrepareNextBlock(inSuite);
+            }
+            else if (processor.mBlockPending)
+            {
+                processor.mBlockPending = false;
+                NL_TEST_ASSERT(inSuite, downloader.FetchNextData() == CHIP_NO_ERROR);
+            }
+            break;
+        case TransferSession::OutputEventType::kAckReceived:
+        case TransferSession::OutputEventType::kAckEOFReceived:
+            break;
+        default:
+            NL_TEST_ASSERT(inSuite, false);
+            break;
+        }
+    }
+
+    TransferSession mSender;
+    size_t mNumBytesSent                 = 0;
+    size_t mNumBlocksSentWhileProcessing = 0;
+
+private:
+    void PrepareNextBlock(nlTestSuite * inSuite)
+    {
+        TransferSession::BlockData blockData;
+        blockData.Data   = &gImage[mNumBytesSent];
+        blockData.Length = std::min(static_cast<size_t>(mSender.GetTransferBlockSize()), kImageSize - mNumBytesSent);
+        blockData.IsEof  = (mNumBytesSent + blockData.Length == kImageSize);
+        NL_TEST_ASSERT(inSuite, mSender.PrepareBlock(blockData) == CHIP_NO_ERROR);
+        mNumBytesSent += blockData.Length;
+    }
+};
+
+// Downloads gImage from a TestProvider that supports the given modes, and checks that the whole image was processed.
+void RunDownload(nlTestSuite * inSuite, BDXDownloader & downloader, TestStateDelegate & stateDelegate, TestProvider & provider,
+                 BitFlags<TransferControlFlags> proposedModes, TransferControlFlags acceptedMode)
+{
+    TestImageProcessor processor;
+    TestMessenger messenger;
+
+    downloader.SetImageProcessorDelegate(&processor);
+    downloader.SetMessageDelegate(&messenger);
+    downloader.SetStateDelegate(&stateDelegate);
+
+    TransferSession::TransferInitData initOptions;
+    initOptions.TransferCtlFlags = static_cast<TransferControlFlags>(proposedModes.Raw());
+    initOptions.MaxBlockSize     = kBlockSize;
+    initOptions.FileDesLength    = static_cast<uint16_t>(strlen(kFileDesignator));
+    initOptions.FileDesignator   = reinterpret_cast<const uint8_t *>(kFileDesignator);
+
+    NL_TEST_ASSERT(inSuite, downloader.SetBDXParams(initOptions, kTimeout) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, downloader.BeginPrepareDownload() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, downloader.OnPreparedForDownload(CHIP_NO_ERROR) == CHIP_NO_ERROR);
+
+    for (int i = 0; i < kMaxTransferSteps && downloader.GetState() == OTADownloader::State::kInProgress; i++)
+    {
+        provider.Step(inSuite, downloader, messenger, processor, acceptedMode);
+    }
+
+    NL_TEST_ASSERT(inSuite, downloader.GetState() == OTADownloader::State::kComplete);
+    NL_TEST_ASSERT(inSuite, stateDelegate.mReason == OTAChangeReasonEnum::kSuccess);
+    NL_TEST_ASSERT(inSuite, provider.mSender.GetControlMode() == acceptedMode);
+    NL_TEST_ASSERT(inSuite, processor.mFinalized && !processor.mAborted);
+    NL_TEST_ASSERT(inSuite, processor.mNumBytes == kImageSize);
+    NL_TEST_ASSERT(inSuite, memcmp(processor.mImage, gImage, kImageSize) == 0);
+
+    // Deliver the remaining BlockAcks and the BlockAckEOF to the Sender
+    TransferSession::OutputEvent event;
+    while (messenger.DeliverMessage(inSuite, provider.mSender))
+    {
+        provider.mSender.PollOutput(event, kNoAdvance);
+    }
+    NL_TEST_ASSERT(inSuite, event.EventType == TransferSession::OutputEventType::kAckEOFReceived);
+}
+
+void TestReceiverDriveDownload(nlTestSuite * inSuite, void * inContext)
+{
+    TestProvider provider;
+    NL_TEST_ASSERT(inSuite, provider.Init(BitFlags<TransferControlFlags>(TransferControlFlags::kReceiverDrive)) == CHIP_NO_ERROR);
+
+    BDXDownloader downloader;
+    TestStateDelegate stateDelegate;
+    RunDownload(inSuite, downloader, stateDelegate, provider, BitFlags<TransferControlFlags>(TransferControlFlags::kReceiverDrive),
+                TransferControlFlags::kReceiverDrive);
+    NL_TEST_ASSERT(inSuite, provider.mNumBlocksSentWhileProcessing == 0);
+}
+
+void TestAsyncDownload(nlTestSuite * inSuite, void * inContext)
+{
+    BitFlags<TransferControlFlags> modes(TransferControlFlags::kReceiverDrive, TransferControlFlags::kAsync);
+
+    TestProvider provider;
+    NL_TEST_ASSERT(inSuite, provider.Init(modes) == CHIP_NO_ERROR);
+
+    // Blocks keep arriving while the image processor works on the previous one, and the downloader queues them
+    BDXDownloader downloader;
+    TestStateDelegate stateDelegate;
+    RunDownload(inSuite, downloader, stateDelegate, provider, modes, TransferControlFlags::kAsync);
+    NL_TEST_ASSERT(inSuite, provider.mNumBlocksSentWhileProcessing > 0);
+}
+
+// A Provider that does not support Async mode still serves a Requestor that offers it.
+void TestAsyncFallbackToReceiverDrive(nlTestSuite * inSuite, void * inContext)
+{
+    TestProvider provider;
+    NL_TEST_ASSERT(inSuite, provider.Init(BitFlags<TransferControlFlags>(TransferControlFlags::kReceiverDrive)) == CHIP_NO_ERROR);
+
+    BDXDownloader downloader;
+    TestStateDelegate stateDelegate;
+    RunDownload(inSuite, downloader, stateDelegate, provider, BitFlags<TransferControlFlags>(TransferControlFlags::kReceiverDrive, TransferControlFlags::kAsync),
+                TransferControlFlags::kReceiverDrive);
+    NL_TEST_ASSERT(inSuite, provider.mNumBlocksSentWhileProcessing == 0);
+}
+
+// An image processor that verifies the image once the transfer has ended can still reject it.
+void TestRejectDownloadedImage(nlTestSuite * inSuite, void * inContext)
+{
+    TestProvider provider;
+    NL_TEST_ASSERT(inSuite, provider.Init(BitFlags<TransferControlFlags>(TransferControlFlags::kReceiverDrive)) == CHIP_NO_ERROR);
+
+    BDXDownloader downloader;
+    TestStateDelegate stateDelegate;
+    RunDownload(inSuite, downloader, stateDelegate, provider, BitFlags<TransferControlFlags>(TransferControlFlags::kReceiverDrive),
+                TransferControlFlags::kReceiverDrive);
+
+    // Other reasons do not apply to a completed download
+    downloader.EndDownload(CHIP_ERROR_CONNECTION_ABORTED);
+    NL_TEST_ASSERT(inSuite, downloader.GetState() == OTADownloader::State::kComplete);
+
+    downloader.EndDownload(CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+    NL_TEST_ASSERT(inSuite, downloader.GetState() == OTADownloader::State::kIdle);
+    NL_TEST_ASSERT(inSuite, stateDelegate.mReason == OTAChangeReasonEnum::kFailure);
+}
+
+int TestSetup(void * inContext)
+{
+    VerifyOrReturnError(Platform::MemoryInit() == CHIP_NO_ERROR, FAILURE);
+    VerifyOrReturnError(gSystemLayer.Init() == CHIP_NO_ERROR, FAILURE);
+    DeviceLayer::SetSystemLayerForTesting(&gSystemLayer);
+
+    for (size_t i = 0; i < kImageSize; i++)
+    {
+        gImage[i] = static_cast<uint8_t>(i * 7);
+    }
+    return SUCCESS;
+}
+
+int TestTeardown(void * inContext)
+{
+    DeviceLayer::SetSystemLayerForTesting(nullptr);
+    gSystemLayer.Shutdown();
+    Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
+const nlTest sTests[] = {
+    NL_TEST_DEF("TestReceiverDriveDownload", TestReceiverDriveDownload),
+    NL_TEST_DEF("TestAsyncDownload", TestAsyncDownload),
+    NL_TEST_DEF("TestAsyncFallbackToReceiverDrive", TestAsyncFallbackToReceiverDrive),
+    NL_TEST_DEF("TestRejectDownloadedImage", TestRejectDownloadedImage),
+    NL_TEST_SENTINEL(),
+};
+
+} // namespace
+
+int TestBDXDownloader()
+{
+    nlTestSuite theSuite = { "BDXDownloader", &sTests[0], TestSetup, TestTeardown };
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestBDXDownloader)
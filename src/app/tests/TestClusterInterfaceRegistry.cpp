@@ -0,0 +1,219 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for ClusterInterfaceRegistry
+ *
+ */
+
+#include <app/ClusterInterfaceRegistry.h>
+#include <app/CommandHandlerInterface.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <nlunit-test.h>
+
+#include <memory>
+#include <vector>
+
+namespace chip {
+namespace app {
+namespace TestClusterInterfaceRegistry {
+
+class TestHandler : public CommandHandlerInterface
+{
+public:
+    TestHandler(Optional<EndpointId> aEndpointId, ClusterId aClusterId) : CommandHandlerInterface(aEndpointId, aClusterId) {}
+
+    void InvokeCommand(HandlerContext & handlerContext) override {}
+};
+
+// A small bucket count so that most of the registrations below share buckets.
+using TestRegistry = ClusterInterfaceRegistry<CommandHandlerInterface, 3>;
+
+void TestFindSpecificAndWildcard(nlTestSuite * apSuite, void * apContext)
+{
+    TestRegistry registry;
+    TestHandler specific(MakeOptional<EndpointId>(1), 6);
+    TestHandler otherEndpoint(MakeOptional<EndpointId>(2), 6);
+    TestHandler wildcard(NullOptional, 8);
+
+    NL_TEST_ASSERT(apSuite, registry.Find(1, 6) == nullptr);
+
+    NL_TEST_ASSERT(apSuite, registry.Register(&specific));
+    NL_TEST_ASSERT(apSuite, registry.Register(&otherEndpoint));
+    NL_TEST_ASSERT(apSuite, registry.Register(&wildcard));
+
+    NL_TEST_ASSERT(apSuite, registry.Find(1, 6) == &specific);
+    NL_TEST_ASSERT(apSuite, registry.Find(2, 6) == &otherEndpoint);
+    NL_TEST_ASSERT(apSuite, registry.Find(3, 6) == nullptr);
+    NL_TEST_ASSERT(apSuite, registry.Find(1, 8) == &wildcard);
+    NL_TEST_ASSERT(apSuite, registry.Find(0xFFFE, 8) == &wildcard);
+    NL_TEST_ASSERT(apSuite, registry.Find(1, 7) == nullptr);
+
+    registry.Clear();
+    NL_TEST_ASSERT(apSuite, registry.Find(1, 6) == nullptr);
+    NL_TEST_ASSERT(apSuite, registry.Find(1, 8) == nullptr);
+    NL_TEST_ASSERT(apSuite, specific.GetNext() == nullptr);
+}
+
+void TestRejectOverlappingRegistrations(nlTestSuite * apSuite, void * apContext)
+{
+    TestRegistry registry;
+    TestHandler specific(MakeOptional<EndpointId>(1), 6);
+    TestHandler sameSpecific(MakeOptional<EndpointId>(1), 6);
+    TestHandler wildcard(NullOptional, 6);
+    TestHandler otherWildcard(NullOptional, 8);
+    TestHandler specificUnderWildcard(MakeOptional<EndpointId>(4), 8);
+
+    NL_TEST_ASSERT(apSuite, registry.Register(&specific));
+    NL_TEST_ASSERT(apSuite, !registry.Register(&sameSpecific));
+    NL_TEST_ASSERT(apSuite, !registry.Register(&wildcard));
+
+    NL_TEST_ASSERT(apSuite, registry.Register(&otherWildcard));
+    NL_TEST_ASSERT(apSuite, !registry.Register(&specificUnderWildcard));
+
+    NL_TEST_ASSERT(apSuite, registry.Find(1, 6) == &specific);
+    NL_TEST_ASSERT(apSuite, registry.Find(4, 8) == &otherWildcard);
+
+    registry.Clear();
+}
+
+void TestUnregister(nlTestSuite * apSuite, void * apContext)
+{
+    TestRegistry registry;
+    TestHandler first(MakeOptional<EndpointId>(1), 6);
+    TestHandler second(MakeOptional<EndpointId>(2), 6);
+    TestHandler third(MakeOptional<EndpointId>(3), 6);
+    TestHandler wildcard(NullOptional, 8);
+
+    NL_TEST_ASSERT(apSuite, registry.Register(&first));
+    NL_TEST_ASSERT(apSuite, registry.Register(&second));
+    NL_TEST_ASSERT(apSuite, registry.Register(&third));
+    NL_TEST_ASSERT(apSuite, registry.Register(&wildcard));
+
+    NL_TEST_ASSERT(apSuite, registry.Unregister(&second));
+    NL_TEST_ASSERT(apSuite, !registry.Unregister(&second));
+    NL_TEST_ASSERT(apSuite, registry.Find(1, 6) == &first);
+    NL_TEST_ASSERT(apSuite, registry.Find(2, 6) == nullptr);
+    NL_TEST_ASSERT(apSuite, registry.Find(3, 6) == &third);
+
+    // Unregistered interfaces can be registered again.
+    NL_TEST_ASSERT(apSuite, registry.Register(&second));
+    NL_TEST_ASSERT(apSuite, registry.Find(2, 6) == &second);
+
+    NL_TEST_ASSERT(apSuite, registry.Unregister(&wildcard));
+    NL_TEST_ASSERT(apSuite, registry.Find(1, 8) == nullptr);
+
+    registry.Clear();
+}
+
+void TestUnregisterAllForEndpoint(nlTestSuite * apSuite, void * apContext)
+{
+    TestRegistry registry;
+    TestHandler onOff(MakeOptional<EndpointId>(1), 6);
+    TestHandler levelControl(MakeOptional<EndpointId>(1), 8);
+    TestHandler otherEndpoint(MakeOptional<EndpointId>(2), 6);
+    TestHandler wildcard(NullOptional, 0x0300);
+
+    NL_TEST_ASSERT(apSuite, registry.Register(&onOff));
+    NL_TEST_ASSERT(apSuite, registry.Register(&levelControl));
+    NL_TEST_ASSERT(apSuite, registry.Register(&otherEndpoint));
+    NL_TEST_ASSERT(apSuite, registry.Register(&wildcard));
+
+    registry.UnregisterAllForEndpoint(1);
+
+    NL_TEST_ASSERT(apSuite, registry.Find(1, 6) == nullptr);
+    NL_TEST_ASSERT(apSuite, registry.Find(1, 8) == nullptr);
+    NL_TEST_ASSERT(apSuite, registry.Find(2, 6) == &otherEndpoint);
+    NL_TEST_ASSERT(apSuite, registry.Find(1, 0x0300) == &wildcard);
+    NL_TEST_ASSERT(apSuite, onOff.GetNext() == nullptr);
+    NL_TEST_ASSERT(apSuite, levelControl.GetNext() == nullptr);
+
+    registry.Clear();
+}
+
+void TestManyEndpoints(nlTestSuite * apSuite, void * apContext)
+{
+    // Roughly what a bridge with a few hundred bridged endpoints registers.
+    constexpr EndpointId kEndpointCount = 250;
+    constexpr ClusterId kClusters[]     = { 0x0006, 0x0008, 0x0039, 0xFFF1FC01 };
+    constexpr size_t kClusterCount      = sizeof(kClusters) / sizeof(kClusters[0]);
+
+    ClusterInterfaceRegistry<CommandHandlerInterface> registry;
+    std::vector<std::unique_ptr<TestHandler>> handlers;
+
+    for (EndpointId endpoint = 0; endpoint < kEndpointCount; endpoint++)
+    {
+        for (size_t i = 0; i < kClusterCount; i++)
+        {
+            handlers.emplace_back(new TestHandler(MakeOptional(endpoint), kClusters[i]));
+            NL_TEST_ASSERT(apSuite, registry.Register(handlers.back().get()));
+        }
+    }
+
+    for (EndpointId endpoint = 0; endpoint < kEndpointCount; endpoint++)
+    {
+        for (size_t i = 0; i < kClusterCount; i++)
+        {
+            NL_TEST_ASSERT(apSuite, registry.Find(endpoint, kClusters[i]) == handlers[endpoint * kClusterCount + i].get());
+        }
+        NL_TEST_ASSERT(apSuite, registry.Find(endpoint, 0x0300) == nullptr);
+    }
+
+    for (EndpointId endpoint = 0; endpoint < kEndpointCount; endpoint = static_cast<EndpointId>(endpoint + 2))
+    {
+        registry.UnregisterAllForEndpoint(endpoint);
+    }
+
+    for (EndpointId endpoint = 0; endpoint < kEndpointCount; endpoint++)
+    {
+        bool expectRegistered = (endpoint % 2) != 0;
+        NL_TEST_ASSERT(apSuite, (registry.Find(endpoint, kClusters[0]) != nullptr) == expectRegistered);
+    }
+
+    registry.Clear();
+}
+
+} // namespace TestClusterInterfaceRegistry
+} // namespace app
+} // namespace chip
+
+namespace {
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("TestFindSpecificAndWildcard", chip::app::TestClusterInterfaceRegistry::TestFindSpecificAndWildcard),
+    NL_TEST_DEF("TestRejectOverlappingRegistrations", chip::app::TestClusterInterfaceRegistry::TestRejectOverlappingRegistrations),
+    NL_TEST_DEF("TestUnregister", chip::app::TestClusterInterfaceRegistry::TestUnregister),
+    NL_TEST_DEF("TestUnregisterAllForEndpoint", chip::app::TestClusterInterfaceRegistry::TestUnregisterAllForEndpoint),
+    NL_TEST_DEF("TestManyEndpoints", chip::app::TestClusterInterfaceRegistry::TestManyEndpoints),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+} // namespace
+
+int TestClusterInterfaceRegistry()
+{
+    nlTestSuite theSuite = { "ClusterInterfaceRegistry", &sTests[0], nullptr, nullptr };
+
+    nlTestRunner(&theSuite, nullptr);
+
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestClusterInterfaceRegistry)
@@ -125,7 +125,7 @@ public:
 
     void SetExpectation() { mExpectedBuffers.clear(); }
 
-    void ValidateData(TLV::TLVReader & aData, bool isListOperation)
+    void ValidateData(TLV::TLVReader & aData)
     {
         NL_TEST_ASSERT(gSuite, !mExpectedBuffers.empty());
         if (!mExpectedBuffers.empty() > 0)
@@ -133,15 +133,8 @@ public:
             auto buffer = mExpectedBuffers.front();
             mExpectedBuffers.erase(mExpectedBuffers.begin());
             uint32_t length = static_cast<uint32_t>(buffer.size());
-            if (isListOperation)
-            {
-                // List operation will attach end of container
-                NL_TEST_ASSERT(gSuite, length < aData.GetRemainingLength());
-            }
-            else
-            {
-                NL_TEST_ASSERT(gSuite, length == aData.GetRemainingLength());
-            }
+            // Lists are reassembled by BufferedReadCallback into a buffer that holds exactly the encoded list
+            NL_TEST_ASSERT(gSuite, length == aData.GetRemainingLength());
             if (length <= aData.GetRemainingLength() && length > 0)
             {
                 NL_TEST_ASSERT(gSuite, memcmp(aData.GetReadPoint(), buffer.data(), length) == 0);
@@ -292,7 +285,7 @@ private:
             NL_TEST_ASSERT(gSuite, apData != nullptr);
             if (apData)
             {
-                mDataCallbackValidator.ValidateData(*apData, aPath.IsListOperation());
+                mDataCallbackValidator.ValidateData(*apData);
             }
         }
         else
@@ -614,10 +607,250 @@ void TestCache(nlTestSuite * apSuite, void * apContext)
                              AttributeInstruction(AttributeInstruction::kAttributeB, 0, AttributeInstruction::kData) });
 }
 
+class ChangeCounter : public ClusterStateCache::Callback
+{
+public:
+    void OnDone(ReadClient *) override {}
+    void OnAttributeChanged(ClusterStateCache * cache, const ConcreteAttributePath & path) override { mChangeCount++; }
+
+    uint32_t mChangeCount = 0;
+};
+
+void SendInt16uReport(ReadClient::Callback & aCallback, EndpointId aEndpointId, DataVersion aDataVersion, uint16_t aValue)
+{
+    ConcreteDataAttributePath path(aEndpointId, Clusters::UnitTesting::Id, Clusters::UnitTesting::Attributes::Int16u::Id);
+    path.mDataVersion.SetValue(aDataVersion);
+
+    uint8_t buffer[16];
+    TLV::TLVWriter writer;
+    writer.Init(buffer);
+    NL_TEST_ASSERT(gSuite, DataModel::Encode(writer, TLV::AnonymousTag(), aValue) == CHIP_NO_ERROR);
+    TLV::TLVReader reader;
+    reader.Init(buffer, writer.GetLengthWritten());
+    NL_TEST_ASSERT(gSuite, reader.Next() == CHIP_NO_ERROR);
+
+    aCallback.OnReportBegin();
+    aCallback.OnAttributeData(path, &reader, StatusIB());
+    aCallback.OnReportEnd();
+}
+
+uint32_t EncodeDataVersionFilters(ReadClient::Callback & aCallback, bool & aEncodedDataVersionList)
+{
+    AttributePathParams path(Clusters::UnitTesting::Id, kInvalidAttributeId);
+    uint8_t buffer[256];
+    TLV::TLVWriter writer;
+    DataVersionFilterIBs::Builder builder;
+
+    writer.Init(buffer);
+    NL_TEST_ASSERT(gSuite, builder.Init(&writer) == CHIP_NO_ERROR);
+    aEncodedDataVersionList = false;
+    NL_TEST_ASSERT(gSuite,
+                   aCallback.OnUpdateDataVersionFilterList(builder, Span<const AttributePathParams>(&path, 1), aEncodedDataVersionList) ==
+                       CHIP_NO_ERROR);
+    return writer.GetLengthWritten();
+}
+
+/*
+ * By default, every reported attribute is reported as changed, even if the cache already held the same value.
+ */
+void TestUnchangedAttributesReported(nlTestSuite * apSuite, void * apContext)
+{
+    ChangeCounter counter;
+    ClusterStateCache cache(counter);
+    ConcreteAttributePath path(1, Clusters::UnitTesting::Id, Clusters::UnitTesting::Attributes::Int16u::Id);
+    uint16_t value = 0;
+
+    SendInt16uReport(cache.GetBufferedCallback(), 1, 1, 5);
+    NL_TEST_ASSERT(apSuite, counter.mChangeCount == 1);
+
+    SendInt16uReport(cache.GetBufferedCallback(), 1, 2, 5);
+    NL_TEST_ASSERT(apSuite, counter.mChangeCount == 2);
+    NL_TEST_ASSERT(apSuite, cache.Get<Clusters::UnitTesting::Attributes::Int16u::TypeInfo>(path, value) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, value == 5);
+
+    SendInt16uReport(cache.GetBufferedCallback(), 1, 3, 6);
+    NL_TEST_ASSERT(apSuite, counter.mChangeCount == 3);
+    NL_TEST_ASSERT(apSuite, cache.Get<Clusters::UnitTesting::Attributes::Int16u::TypeInfo>(path, value) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, value == 6);
+}
+
+/*
+ * With SetSkipUnchangedAttributes, attributes that are reported again with the value the cache already holds, like the ones
+ * of a cluster that could not be filtered by data version on resubscribe, are not reported as changed.
+ */
+void TestUnchangedAttributesSkipped(nlTestSuite * apSuite, void * apContext)
+{
+    ChangeCounter counter;
+    ClusterStateCache cache(counter);
+    ConcreteAttributePath path(1, Clusters::UnitTesting::Id, Clusters::UnitTesting::Attributes::Int16u::Id);
+    uint16_t value = 0;
+
+    cache.SetSkipUnchangedAttributes(true);
+
+    SendInt16uReport(cache.GetBufferedCallback(), 1, 1, 5);
+    NL_TEST_ASSERT(apSuite, counter.mChangeCount == 1);
+
+    SendInt16uReport(cache.GetBufferedCallback(), 1, 2, 5);
+    NL_TEST_ASSERT(apSuite, counter.mChangeCount == 1);
+    NL_TEST_ASSERT(apSuite, cache.Get<Clusters::UnitTesting::Attributes::Int16u::TypeInfo>(path, value) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, value == 5);
+
+    SendInt16uReport(cache.GetBufferedCallback(), 1, 3, 6);
+    NL_TEST_ASSERT(apSuite, counter.mChangeCount == 2);
+    NL_TEST_ASSERT(apSuite, cache.Get<Clusters::UnitTesting::Attributes::Int16u::TypeInfo>(path, value) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, value == 6);
+}
+
+void TestDataVersionFilterBudget(nlTestSuite * apSuite, void * apContext)
+{
+    ChangeCounter counter;
+    ClusterStateCache cache(counter);
+    ReadClient::Callback & callback = cache.GetBufferedCallback();
+    bool encoded                    = false;
+
+    // Nothing is cached yet; this also records the wildcard path so that data versions get committed.
+    const uint32_t emptyLength = EncodeDataVersionFilters(callback, encoded);
+    NL_TEST_ASSERT(apSuite, !encoded);
+
+    SendInt16uReport(callback, 1, 1, 5);
+    SendInt16uReport(callback, 2, 1, 1000);
+
+    const uint32_t allLength = EncodeDataVersionFilters(callback, encoded);
+    NL_TEST_ASSERT(apSuite, encoded);
+    NL_TEST_ASSERT(apSuite, allLength > emptyLength);
+    const uint32_t filterLength = (allLength - emptyLength) / 2;
+
+    cache.SetDataVersionFilterBudget(filterLength);
+    NL_TEST_ASSERT(apSuite, EncodeDataVersionFilters(callback, encoded) == emptyLength + filterLength);
+    NL_TEST_ASSERT(apSuite, encoded);
+
+    cache.SetDataVersionFilterBudget(filterLength - 1);
+    NL_TEST_ASSERT(apSuite, EncodeDataVersionFilters(callback, encoded) == emptyLength);
+    NL_TEST_ASSERT(apSuite, !encoded);
+}
+
+void TestSnapshot(nlTestSuite * apSuite, void * apContext)
+{
+    ChangeCounter counter;
+    ClusterStateCache cache(counter, MakeOptional(static_cast<EventNumber>(42)));
+    ReadClient::Callback & callback = cache.GetBufferedCallback();
+    ConcreteAttributePath path(2, Clusters::UnitTesting::Id, Clusters::UnitTesting::Attributes::Int16u::Id);
+    bool encoded = false;
+
+    EncodeDataVersionFilters(callback, encoded);
+    SendInt16uReport(callback, 1, 7, 5);
+    SendInt16uReport(callback, 2, 9, 1000);
+    const uint32_t filtersLength = EncodeDataVersionFilters(callback, encoded);
+
+    std::vector<uint8_t> buffer(cache.GetSnapshotSizeUpperBound());
+    MutableByteSpan tooSmall(buffer.data(), 16);
+    NL_TEST_ASSERT(apSuite, cache.SaveSnapshot(tooSmall) == CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    MutableByteSpan snapshot(buffer.data(), buffer.size());
+    NL_TEST_ASSERT(apSuite, cache.SaveSnapshot(snapshot) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, snapshot.size() < buffer.size());
+
+    ChangeCounter loadedCounter;
+    ClusterStateCache loaded(loadedCounter);
+    NL_TEST_ASSERT(apSuite, loaded.LoadSnapshot(snapshot) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, loadedCounter.mChangeCount == 0);
+
+    uint16_t value = 0;
+    NL_TEST_ASSERT(apSuite, loaded.Get<Clusters::UnitTesting::Attributes::Int16u::TypeInfo>(path, value) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, value == 1000);
+
+    Optional<DataVersion> version;
+    NL_TEST_ASSERT(apSuite, loaded.GetVersion(ConcreteClusterPath(2, Clusters::UnitTesting::Id), version) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, version.HasValue() && version.Value() == 9);
+
+    Optional<EventNumber> eventNumber;
+    NL_TEST_ASSERT(apSuite, loaded.GetHighestReceivedEventNumber(eventNumber) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, eventNumber.HasValue() && eventNumber.Value() == 42);
+
+    // The loaded cache asks for the same data version filters.
+    NL_TEST_ASSERT(apSuite, EncodeDataVersionFilters(loaded.GetBufferedCallback(), encoded) == filtersLength);
+    NL_TEST_ASSERT(apSuite, encoded);
+
+    // A corrupted snapshot is rejected and leaves the cache as it was.
+    buffer[snapshot.size() - 2] ^= 0x01;
+    ClusterStateCache corrupted(loadedCounter);
+    NL_TEST_ASSERT(apSuite, corrupted.LoadSnapshot(snapshot) == CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+    NL_TEST_ASSERT(apSuite, corrupted.Get<Clusters::UnitTesting::Attributes::Int16u::TypeInfo>(path, value) != CHIP_NO_ERROR);
+}
+
+// Write a snapshot in the format of ClusterStateCache::SaveSnapshot() that lists the same cluster aClusterCount times.
+CHIP_ERROR WriteRepeatedClusterSnapshot(MutableByteSpan & aBuffer, size_t aClusterCount)
+{
+    TLV::TLVWriter writer;
+    TLV::TLVType outerType;
+    TLV::TLVType clustersType;
+    uint8_t emptyDigest[Crypto::kSHA256_Hash_Length] = { 0 };
+
+    writer.Init(aBuffer);
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outerType));
+    ReturnErrorOnFailure(writer.Put(TLV::ContextTag(1), static_cast<uint8_t>(1)));
+    ReturnErrorOnFailure(writer.Put(TLV::ContextTag(2), ByteSpan(emptyDigest)));
+    const size_t digestedStart = writer.GetLengthWritten();
+
+    ReturnErrorOnFailure(writer.StartContainer(TLV::ContextTag(4), TLV::kTLVType_Array, clustersType));
+    for (size_t i = 0; i < aClusterCount; i++)
+    {
+        TLV::TLVType clusterType;
+        TLV::TLVType attributesType;
+        ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, clusterType));
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(1), static_cast<EndpointId>(1)));
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(2), Clusters::UnitTesting::Id));
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(3), static_cast<DataVersion>(i)));
+        ReturnErrorOnFailure(writer.StartContainer(TLV::ContextTag(4), TLV::kTLVType_Array, attributesType));
+        ReturnErrorOnFailure(writer.EndContainer(attributesType));
+        ReturnErrorOnFailure(writer.EndContainer(clusterType));
+    }
+    ReturnErrorOnFailure(writer.EndContainer(clustersType));
+    ReturnErrorOnFailure(writer.EndContainer(outerType));
+    ReturnErrorOnFailure(writer.Finalize());
+
+    const size_t length = writer.GetLengthWritten();
+    ReturnErrorOnFailure(Crypto::Hash_SHA256(aBuffer.data() + digestedStart, length - digestedStart,
+                                             aBuffer.data() + digestedStart - Crypto::kSHA256_Hash_Length));
+    aBuffer.reduce_size(length);
+    return CHIP_NO_ERROR;
+}
+
+void TestSnapshotRejected(nlTestSuite * apSuite, void * apContext)
+{
+    ChangeCounter counter;
+    uint8_t buffer[256];
+    Optional<DataVersion> version;
+
+    MutableByteSpan snapshot(buffer);
+    NL_TEST_ASSERT(apSuite, WriteRepeatedClusterSnapshot(snapshot, 1) == CHIP_NO_ERROR);
+    ClusterStateCache cache(counter);
+    NL_TEST_ASSERT(apSuite, cache.LoadSnapshot(snapshot) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, cache.GetVersion(ConcreteClusterPath(1, Clusters::UnitTesting::Id), version) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, version.HasValue() && version.Value() == 0);
+
+    // A cache that does not store attribute data cannot hold a snapshot.
+    ClusterStateCache sizeOnlyCache(counter, Optional<EventNumber>::Missing(), false /* cacheData */);
+    NL_TEST_ASSERT(apSuite, sizeOnlyCache.LoadSnapshot(snapshot) == CHIP_ERROR_INCORRECT_STATE);
+
+    // A snapshot that lists a cluster twice is rejected instead of keeping either copy, and leaves the cache as it was.
+    snapshot = MutableByteSpan(buffer);
+    NL_TEST_ASSERT(apSuite, WriteRepeatedClusterSnapshot(snapshot, 2) == CHIP_NO_ERROR);
+    ClusterStateCache duplicated(counter);
+    NL_TEST_ASSERT(apSuite, duplicated.LoadSnapshot(snapshot) == CHIP_ERROR_INVALID_TLV_ELEMENT);
+    NL_TEST_ASSERT(apSuite,
+                   duplicated.GetVersion(ConcreteClusterPath(1, Clusters::UnitTesting::Id), version) != CHIP_NO_ERROR);
+}
+
 // clang-format off
 const nlTest sTests[] =
 {
     NL_TEST_DEF("TestCache", TestCache),
+    NL_TEST_DEF("TestUnchangedAttributesReported", TestUnchangedAttributesReported),
+    NL_TEST_DEF("TestUnchangedAttributesSkipped", TestUnchangedAttributesSkipped),
+    NL_TEST_DEF("TestDataVersionFilterBudget", TestDataVersionFilterBudget),
+    NL_TEST_DEF("TestSnapshot", TestSnapshot),
+    NL_TEST_DEF("TestSnapshotRejected", TestSnapshotRejected),
     NL_TEST_SENTINEL()
 };
 
@@ -81,7 +81,26 @@ constexpr ClusterId kTestClusterId                        = 3;
 constexpr CommandId kTestCommandIdWithData                = 4;
 constexpr CommandId kTestCommandIdNoData                  = 5;
 constexpr CommandId kTestCommandIdCommandSpecificResponse = 6;
-constexpr CommandId kTestNonExistCommandId                = 0;
+// Commands with this id or above are answered with a LargeResponse.
+constexpr CommandId kTestCommandIdLargeResponse = 0x100;
+constexpr CommandId kTestNonExistCommandId      = 0;
+
+// Only two responses of this size fit in one InvokeResponseMessage.
+constexpr size_t kLargeResponseSize = 400;
+
+struct LargeResponse
+{
+    static constexpr CommandId GetCommandId() { return kTestCommandIdLargeResponse; }
+
+    CHIP_ERROR Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
+    {
+        uint8_t data[kLargeResponseSize] = {};
+        TLV::TLVType outerContainerType;
+        ReturnErrorOnFailure(aWriter.StartContainer(aTag, TLV::kTLVType_Structure, outerContainerType));
+        ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(1), ByteSpan(data)));
+        return aWriter.EndContainer(outerContainerType);
+    }
+};
 } // namespace
 
 namespace app {
@@ -159,6 +178,10 @@ void DispatchSingleClusterCommand(const ConcreteCommandPath & aCommandPath, chip
         {
             apCommandObj->AddStatus(aCommandPath, Protocols::InteractionModel::Status::Success);
         }
+        else if (aCommandPath.mCommandId >= kTestCommandIdLargeResponse)
+        {
+            apCommandObj->AddResponse(aCommandPath, LargeResponse());
+        }
         else
         {
             apCommandObj->PrepareCommand(aCommandPath);
@@ -244,7 +267,9 @@ public:
     static void TestCommandHandlerWithSendEmptyResponse(nlTestSuite * apSuite, void * apContext);
 
     static void TestCommandHandlerWithProcessReceivedEmptyDataMsg(nlTestSuite * apSuite, void * apContext);
-    static void TestCommandHandlerRejectMultipleCommands(nlTestSuite * apSuite, void * apContext);
+    static void TestCommandSenderMultipleCommandsFlow(nlTestSuite * apSuite, void * apContext);
+    static void TestCommandSenderChunkedResponseFlow(nlTestSuite * apSuite, void * apContext);
+    static void TestCommandHandlerRejectDuplicateCommandPaths(nlTestSuite * apSuite, void * apContext);
 
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
     static void TestCommandHandlerReleaseWithExchangeClosed(nlTestSuite * apSuite, void * apContext);
@@ -257,6 +282,10 @@ public:
 
     static void TestCommandSenderAbruptDestruction(nlTestSuite * apSuite, void * apContext);
 
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    static void TestCommandHandlerBusyAtElasticLimit(nlTestSuite * apSuite, void * apContext);
+#endif
+
     static size_t GetNumActiveHandlerObjects()
     {
         return chip::app::InteractionModelEngine::GetInstance()->mCommandHandlerObjs.Allocated();
@@ -532,8 +561,10 @@ void TestCommandInteraction::TestCommandSenderWithSendCommand(nlTestSuite * apSu
     ctx.DrainAndServiceIO();
 
     GenerateInvokeResponse(apSuite, apContext, buf, kTestCommandIdWithData);
-    err = commandSender.ProcessInvokeResponse(std::move(buf));
+    bool moreChunkedMessages = true;
+    err                      = commandSender.ProcessInvokeResponse(std::move(buf), moreChunkedMessages);
     NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, !moreChunkedMessages);
 }
 
 void TestCommandInteraction::TestCommandHandlerWithSendEmptyCommand(nlTestSuite * apSuite, void * apContext)
@@ -569,8 +600,10 @@ void TestCommandInteraction::TestCommandSenderWithProcessReceivedMsg(nlTestSuite
     System::PacketBufferHandle buf = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize);
 
     GenerateInvokeResponse(apSuite, apContext, buf, kTestCommandIdWithData);
-    err = commandSender.ProcessInvokeResponse(std::move(buf));
+    bool moreChunkedMessages = true;
+    err                      = commandSender.ProcessInvokeResponse(std::move(buf), moreChunkedMessages);
     NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, !moreChunkedMessages);
 }
 
 void TestCommandInteraction::ValidateCommandHandlerWithSendCommand(nlTestSuite * apSuite, void * apContext, bool aNeedStatusCode)
@@ -1243,6 +1276,54 @@ void TestCommandInteraction::TestCommandSenderCommandAsyncSuccessResponseFlow(nl
     NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
 }
 
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+// With elastic pool limits, an invoke that finds every allowed command handler in use is answered with Busy, and the pending
+// invoke is not disturbed.
+void TestCommandInteraction::TestCommandHandlerBusyAtElasticLimit(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx               = *static_cast<TestContext *>(apContext);
+    InteractionModelEngine * engine = InteractionModelEngine::GetInstance();
+
+    InteractionModelEngine::ElasticPoolLimits limits;
+    limits.mMaxCommandHandlers = 1;
+    NL_TEST_ASSERT(apSuite, engine->SetElasticPoolLimits(limits) == CHIP_NO_ERROR);
+
+    mockCommandSenderDelegate.ResetCounter();
+    app::CommandSender commandSender(&mockCommandSenderDelegate, &ctx.GetExchangeManager());
+    AddInvokeRequestData(apSuite, apContext, &commandSender);
+    asyncCommand = true;
+    NL_TEST_ASSERT(apSuite, commandSender.SendCommandRequest(ctx.GetSessionBobToAlice()) == CHIP_NO_ERROR);
+    ctx.DrainAndServiceIO();
+    NL_TEST_ASSERT(apSuite, GetNumActiveHandlerObjects() == 1);
+
+    MockCommandSenderCallback busyDelegate;
+    {
+        app::CommandSender busyCommandSender(&busyDelegate, &ctx.GetExchangeManager());
+        AddInvokeRequestData(apSuite, apContext, &busyCommandSender);
+        NL_TEST_ASSERT(apSuite, busyCommandSender.SendCommandRequest(ctx.GetSessionBobToAlice()) == CHIP_NO_ERROR);
+        ctx.DrainAndServiceIO();
+    }
+    NL_TEST_ASSERT(apSuite,
+                   busyDelegate.onResponseCalledTimes == 0 && busyDelegate.onFinalCalledTimes == 1 &&
+                       busyDelegate.onErrorCalledTimes == 1);
+    NL_TEST_ASSERT(apSuite, busyDelegate.mError == CHIP_IM_GLOBAL_STATUS(Busy));
+    NL_TEST_ASSERT(apSuite, GetNumActiveHandlerObjects() == 1);
+    NL_TEST_ASSERT(apSuite, engine->GetPoolOccupancy().mCommandHandlersHighWater >= 1);
+
+    // Decrease CommandHandler refcount and send response
+    asyncCommandHandle = nullptr;
+    ctx.DrainAndServiceIO();
+
+    NL_TEST_ASSERT(apSuite,
+                   mockCommandSenderDelegate.onResponseCalledTimes == 1 && mockCommandSenderDelegate.onFinalCalledTimes == 1 &&
+                       mockCommandSenderDelegate.onErrorCalledTimes == 0);
+    NL_TEST_ASSERT(apSuite, GetNumActiveHandlerObjects() == 0);
+    NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
+
+    engine->ClearElasticPoolLimits();
+}
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
 void TestCommandInteraction::TestCommandSenderCommandSpecificResponseFlow(nlTestSuite * apSuite, void * apContext)
 {
     TestContext & ctx = *static_cast<TestContext *>(apContext);
@@ -1332,7 +1413,7 @@ void TestCommandInteraction::TestCommandSenderAbruptDestruction(nlTestSuite * ap
     NL_TEST_ASSERT(apSuite, GetNumActiveHandlerObjects() == 0);
 }
 
-void TestCommandInteraction::TestCommandHandlerRejectMultipleCommands(nlTestSuite * apSuite, void * apContext)
+void TestCommandInteraction::TestCommandSenderMultipleCommandsFlow(nlTestSuite * apSuite, void * apContext)
 {
     TestContext & ctx = *static_cast<TestContext *>(apContext);
     CHIP_ERROR err    = CHIP_NO_ERROR;
@@ -1341,37 +1422,69 @@ void TestCommandInteraction::TestCommandHandlerRejectMultipleCommands(nlTestSuit
     mockCommandSenderDelegate.ResetCounter();
     app::CommandSender commandSender(&mockCommandSenderDelegate, &ctx.GetExchangeManager());
 
+    // One command answered with a status and one answered with a data response, carried in a single invoke request.
+    AddInvokeRequestData(apSuite, apContext, &commandSender, kTestCommandIdWithData);
+    AddInvokeRequestData(apSuite, apContext, &commandSender, kTestCommandIdCommandSpecificResponse);
+    err = commandSender.SendCommandRequest(ctx.GetSessionBobToAlice());
+
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    ctx.DrainAndServiceIO();
+
+    NL_TEST_ASSERT(apSuite,
+                   mockCommandSenderDelegate.onResponseCalledTimes == 2 && mockCommandSenderDelegate.onFinalCalledTimes == 1 &&
+                       mockCommandSenderDelegate.onErrorCalledTimes == 0);
+    NL_TEST_ASSERT(apSuite, chip::isCommandDispatched);
+
+    NL_TEST_ASSERT(apSuite, GetNumActiveHandlerObjects() == 0);
+    NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
+}
+
+void TestCommandInteraction::TestCommandSenderChunkedResponseFlow(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+
+    isCommandDispatched = false;
+    mockCommandSenderDelegate.ResetCounter();
+    app::CommandSender commandSender(&mockCommandSenderDelegate, &ctx.GetExchangeManager());
+
+    // The responses to these commands do not fit in one InvokeResponseMessage, so they are sent in several chunks, each of
+    // them acknowledged by the command sender.
+    constexpr CommandId kCommandCount = 5;
+    for (CommandId i = 0; i < kCommandCount; i++)
     {
-        // Command ID is not important here, since the command handler should reject the commands without handling it.
-        auto commandPathParams = MakeTestCommandPath(kTestCommandIdCommandSpecificResponse);
+        AddInvokeRequestData(apSuite, apContext, &commandSender, kTestCommandIdLargeResponse + i);
+    }
+    err = commandSender.SendCommandRequest(ctx.GetSessionBobToAlice());
 
-        commandSender.AllocateBuffer();
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
 
-        // CommandSender does not support sending multiple commands with public API, so we craft a message manaully.
-        for (int i = 0; i < 2; i++)
-        {
-            InvokeRequests::Builder & invokeRequests = commandSender.mInvokeRequestBuilder.GetInvokeRequests();
-            CommandDataIB::Builder & invokeRequest   = invokeRequests.CreateCommandData();
-            NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == invokeRequests.GetError());
-            CommandPathIB::Builder & path = invokeRequest.CreatePath();
-            NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == invokeRequest.GetError());
-            NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == path.Encode(commandPathParams));
-            NL_TEST_ASSERT(apSuite,
-                           CHIP_NO_ERROR ==
-                               invokeRequest.GetWriter()->StartContainer(TLV::ContextTag(CommandDataIB::Tag::kFields),
-                                                                         TLV::kTLVType_Structure,
-                                                                         commandSender.mDataElementContainerType));
-            NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == invokeRequest.GetWriter()->PutBoolean(chip::TLV::ContextTag(1), true));
-            NL_TEST_ASSERT(apSuite,
-                           CHIP_NO_ERROR == invokeRequest.GetWriter()->EndContainer(commandSender.mDataElementContainerType));
-            NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == invokeRequest.EndOfCommandDataIB().GetError());
-        }
+    ctx.DrainAndServiceIO();
 
-        NL_TEST_ASSERT(apSuite,
-                       CHIP_NO_ERROR == commandSender.mInvokeRequestBuilder.GetInvokeRequests().EndOfInvokeRequests().GetError());
-        NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == commandSender.mInvokeRequestBuilder.EndOfInvokeRequestMessage().GetError());
+    NL_TEST_ASSERT(apSuite,
+                   mockCommandSenderDelegate.onResponseCalledTimes == kCommandCount &&
+                       mockCommandSenderDelegate.onFinalCalledTimes == 1 && mockCommandSenderDelegate.onErrorCalledTimes == 0);
+    NL_TEST_ASSERT(apSuite, chip::isCommandDispatched);
+
+    NL_TEST_ASSERT(apSuite, GetNumActiveHandlerObjects() == 0);
+    NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
+}
+
+void TestCommandInteraction::TestCommandHandlerRejectDuplicateCommandPaths(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
 
-        commandSender.MoveToState(app::CommandSender::State::AddedCommand);
+    isCommandDispatched = false;
+    mockCommandSenderDelegate.ResetCounter();
+    app::CommandSender commandSender(&mockCommandSenderDelegate, &ctx.GetExchangeManager());
+
+    // Responses are only tagged with the command path, so the command handler should reject the whole request without handling
+    // any of the commands.
+    for (int i = 0; i < 2; i++)
+    {
+        AddInvokeRequestData(apSuite, apContext, &commandSender, kTestCommandIdCommandSpecificResponse);
     }
 
     err = commandSender.SendCommandRequest(ctx.GetSessionBobToAlice());
@@ -1383,6 +1496,7 @@ void TestCommandInteraction::TestCommandHandlerRejectMultipleCommands(nlTestSuit
     NL_TEST_ASSERT(apSuite,
                    mockCommandSenderDelegate.onResponseCalledTimes == 0 && mockCommandSenderDelegate.onFinalCalledTimes == 1 &&
                        mockCommandSenderDelegate.onErrorCalledTimes == 1);
+    NL_TEST_ASSERT(apSuite, mockCommandSenderDelegate.mError == CHIP_IM_GLOBAL_STATUS(InvalidAction));
     NL_TEST_ASSERT(apSuite, !chip::isCommandDispatched);
 
     NL_TEST_ASSERT(apSuite, GetNumActiveHandlerObjects() == 0);
@@ -1445,7 +1559,9 @@ const nlTest sTests[] =
     NL_TEST_DEF("TestCommandHandlerWithSendSimpleStatusCode", chip::app::TestCommandInteraction::TestCommandHandlerWithSendSimpleStatusCode),
     NL_TEST_DEF("TestCommandHandlerWithProcessReceivedNotExistCommand", chip::app::TestCommandInteraction::TestCommandHandlerWithProcessReceivedNotExistCommand),
     NL_TEST_DEF("TestCommandHandlerWithProcessReceivedEmptyDataMsg", chip::app::TestCommandInteraction::TestCommandHandlerWithProcessReceivedEmptyDataMsg),
-    NL_TEST_DEF("TestCommandHandlerRejectMultipleCommands", chip::app::TestCommandInteraction::TestCommandHandlerRejectMultipleCommands),
+    NL_TEST_DEF("TestCommandSenderMultipleCommandsFlow", chip::app::TestCommandInteraction::TestCommandSenderMultipleCommandsFlow),
+    NL_TEST_DEF("TestCommandSenderChunkedResponseFlow", chip::app::TestCommandInteraction::TestCommandSenderChunkedResponseFlow),
+    NL_TEST_DEF("TestCommandHandlerRejectDuplicateCommandPaths", chip::app::TestCommandInteraction::TestCommandHandlerRejectDuplicateCommandPaths),
 
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
     NL_TEST_DEF("TestCommandHandlerReleaseWithExchangeClosed", chip::app::TestCommandInteraction::TestCommandHandlerReleaseWithExchangeClosed),
@@ -1455,6 +1571,9 @@ const nlTest sTests[] =
     NL_TEST_DEF("TestCommandSenderCommandAsyncSuccessResponseFlow", chip::app::TestCommandInteraction::TestCommandSenderCommandAsyncSuccessResponseFlow),
     NL_TEST_DEF("TestCommandSenderCommandSpecificResponseFlow", chip::app::TestCommandInteraction::TestCommandSenderCommandSpecificResponseFlow),
     NL_TEST_DEF("TestCommandSenderCommandFailureResponseFlow", chip::app::TestCommandInteraction::TestCommandSenderCommandFailureResponseFlow),
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    NL_TEST_DEF("TestCommandHandlerBusyAtElasticLimit", chip::app::TestCommandInteraction::TestCommandHandlerBusyAtElasticLimit),
+#endif
     NL_TEST_DEF("TestCommandSenderAbruptDestruction", chip::app::TestCommandInteraction::TestCommandSenderAbruptDestruction),
     NL_TEST_DEF("TestCommandHandlerInvalidMessageSync", chip::app::TestCommandInteraction::TestCommandHandlerInvalidMessageSync),
     NL_TEST_DEF("TestCommandHandlerInvalidMessageAsync", chip::app::TestCommandInteraction::TestCommandHandlerInvalidMessageAsync),
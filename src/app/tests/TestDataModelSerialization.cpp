@@ -47,6 +47,7 @@ public:
     static void TestDataModelSerialization_EncAndDecNestedStructList(nlTestSuite * apSuite, void * apContext);
     static void TestDataModelSerialization_EncAndDecDecodableNestedStructList(nlTestSuite * apSuite, void * apContext);
     static void TestDataModelSerialization_EncAndDecDecodableDoubleNestedStructList(nlTestSuite * apSuite, void * apContext);
+    static void TestDataModelSerialization_IndexedDecodableList(nlTestSuite * apSuite, void * apContext);
 
     static void TestDataModelSerialization_OptionalFields(nlTestSuite * apSuite, void * apContext);
     static void TestDataModelSerialization_ExtraField(nlTestSuite * apSuite, void * apContext);
@@ -556,6 +557,101 @@ void TestDataModelSerialization::TestDataModelSerialization_EncAndDecDecodableDo
     }
 }
 
+void TestDataModelSerialization::TestDataModelSerialization_IndexedDecodableList(nlTestSuite * apSuite, void * apContext)
+{
+    CHIP_ERROR err;
+    auto * _this = static_cast<TestDataModelSerialization *>(apContext);
+
+    _this->mpSuite = apSuite;
+    _this->SetupBuf();
+
+    //
+    // Encode items of different sizes.
+    //
+    {
+        Clusters::UnitTesting::Structs::NestedStructList::Type t;
+        Clusters::UnitTesting::Structs::SimpleStruct::Type structList[5];
+        const char * strings[5] = { "", "a", "chip", "matter", "connectedhomeip" };
+
+        for (uint8_t i = 0; i < 5; i++)
+        {
+            structList[i].a = static_cast<uint8_t>(i * 50);
+            structList[i].b = (i % 2) == 0;
+            structList[i].e = Span<const char>(strings[i], strlen(strings[i]));
+        }
+        t.d = structList;
+
+        err = DataModel::Encode(_this->mWriter, TLV::AnonymousTag(), t);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+        err = _this->mWriter.Finalize();
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    }
+
+    //
+    // Decode
+    //
+    {
+        Clusters::UnitTesting::Structs::NestedStructList::DecodableType t;
+        Clusters::UnitTesting::Structs::SimpleStruct::DecodableType item;
+        uint32_t offsets[6];
+        size_t size;
+
+        _this->SetupReader();
+
+        err = DataModel::Decode(_this->mReader, t);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+        NL_TEST_ASSERT(apSuite, !t.d.IsIndexed());
+        NL_TEST_ASSERT(apSuite, t.d.Get(0, item) == CHIP_ERROR_INCORRECT_STATE);
+
+        // One offset per item and the end of the list are needed.
+        NL_TEST_ASSERT(apSuite, t.d.BuildIndex(Span<uint32_t>(offsets, 5)) == CHIP_ERROR_BUFFER_TOO_SMALL);
+        NL_TEST_ASSERT(apSuite, !t.d.IsIndexed());
+
+        err = t.d.BuildIndex(Span<uint32_t>(offsets));
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, t.d.IsIndexed());
+
+        err = t.d.ComputeSize(&size);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, size == 5);
+
+        for (size_t i = 5; i-- > 0;)
+        {
+            err = t.d.Get(i, item);
+            NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(apSuite, item.a == i * 50);
+            NL_TEST_ASSERT(apSuite, item.b == ((i % 2) == 0));
+        }
+        NL_TEST_ASSERT(apSuite, t.d.Get(4, item) == CHIP_NO_ERROR && StringMatches(item.e, "connectedhomeip"));
+        NL_TEST_ASSERT(apSuite, t.d.Get(5, item) == CHIP_ERROR_NOT_FOUND);
+
+        // Iterating still works on an indexed list.
+        {
+            size_t i  = 0;
+            auto iter = t.d.begin();
+            while (iter.Next())
+            {
+                NL_TEST_ASSERT(apSuite, iter.GetValue().a == i * 50);
+                i++;
+            }
+            NL_TEST_ASSERT(apSuite, iter.GetStatus() == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(apSuite, i == 5);
+        }
+
+        // Empty lists are indexed too.
+        t.d.ClearReader();
+        NL_TEST_ASSERT(apSuite, !t.d.IsIndexed());
+        err = t.d.BuildIndex(Span<uint32_t>(offsets));
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        err = t.d.ComputeSize(&size);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, size == 0);
+        NL_TEST_ASSERT(apSuite, t.d.Get(0, item) == CHIP_ERROR_NOT_FOUND);
+    }
+}
+
 void TestDataModelSerialization::TestDataModelSerialization_OptionalFields(nlTestSuite * apSuite, void * apContext)
 {
     CHIP_ERROR err;
@@ -1113,6 +1209,7 @@ const nlTest sTests[] =
     NL_TEST_DEF("TestDataModelSerialization_EncAndDecNestedStruct", TestDataModelSerialization::TestDataModelSerialization_EncAndDecNestedStruct),
     NL_TEST_DEF("TestDataModelSerialization_EncAndDecDecodableNestedStructList",  TestDataModelSerialization::TestDataModelSerialization_EncAndDecDecodableNestedStructList),
     NL_TEST_DEF("TestDataModelSerialization_EncAndDecDecodableDoubleNestedStructList", TestDataModelSerialization::TestDataModelSerialization_EncAndDecDecodableDoubleNestedStructList),
+    NL_TEST_DEF("TestDataModelSerialization_IndexedDecodableList", TestDataModelSerialization::TestDataModelSerialization_IndexedDecodableList),
     NL_TEST_DEF("TestDataModelSerialization_OptionalFields", TestDataModelSerialization::TestDataModelSerialization_OptionalFields),
     NL_TEST_DEF("TestDataModelSerialization_ExtraField",  TestDataModelSerialization::TestDataModelSerialization_ExtraField),
     NL_TEST_DEF("TestDataModelSerialization_InvalidSimpleFieldTypes", TestDataModelSerialization::TestDataModelSerialization_InvalidSimpleFieldTypes),
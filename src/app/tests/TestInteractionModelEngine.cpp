@@ -48,6 +48,10 @@ class TestInteractionModelEngine
 public:
     static void TestAttributePathParamsPushRelease(nlTestSuite * apSuite, void * apContext);
     static void TestRemoveDuplicateConcreteAttribute(nlTestSuite * apSuite, void * apContext);
+    static void TestPoolOccupancy(nlTestSuite * apSuite, void * apContext);
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    static void TestElasticPoolLimits(nlTestSuite * apSuite, void * apContext);
+#endif
     static int GetAttributePathListLength(ObjectList<AttributePathParams> * apattributePathParamsList);
 };
 
@@ -223,6 +227,76 @@ void TestInteractionModelEngine::TestRemoveDuplicateConcreteAttribute(nlTestSuit
     InteractionModelEngine::GetInstance()->ReleaseAttributePathList(attributePathParamsList);
 }
 
+void TestInteractionModelEngine::TestPoolOccupancy(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx           = *static_cast<TestContext *>(apContext);
+    InteractionModelEngine * im = InteractionModelEngine::GetInstance();
+    NL_TEST_ASSERT(apSuite, im->Init(&ctx.GetExchangeManager(), &ctx.GetFabricTable()) == CHIP_NO_ERROR);
+
+    InteractionModelEngine::PoolOccupancy occupancy = im->GetPoolOccupancy();
+    NL_TEST_ASSERT(apSuite, occupancy.mReadHandlers == 0);
+    NL_TEST_ASSERT(apSuite, occupancy.mAttributePaths == 0);
+    NL_TEST_ASSERT(apSuite, occupancy.mCommandHandlers == 0);
+    NL_TEST_ASSERT(apSuite, occupancy.mWriteHandlers == 0);
+
+    ObjectList<AttributePathParams> * attributePathParamsList = nullptr;
+    AttributePathParams attributePathParams1;
+    AttributePathParams attributePathParams2;
+    attributePathParams1.mEndpointId = 1;
+    attributePathParams2.mEndpointId = 2;
+    im->PushFrontAttributePathList(attributePathParamsList, attributePathParams1);
+    im->PushFrontAttributePathList(attributePathParamsList, attributePathParams2);
+
+    occupancy = im->GetPoolOccupancy();
+    NL_TEST_ASSERT(apSuite, occupancy.mAttributePaths == 2);
+    NL_TEST_ASSERT(apSuite, occupancy.mAttributePathsHighWater >= 2);
+
+    im->ReleaseAttributePathList(attributePathParamsList);
+    occupancy = im->GetPoolOccupancy();
+    NL_TEST_ASSERT(apSuite, occupancy.mAttributePaths == 0);
+    NL_TEST_ASSERT(apSuite, occupancy.mAttributePathsHighWater >= 2);
+}
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+void TestInteractionModelEngine::TestElasticPoolLimits(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx           = *static_cast<TestContext *>(apContext);
+    InteractionModelEngine * im = InteractionModelEngine::GetInstance();
+    NL_TEST_ASSERT(apSuite, im->Init(&ctx.GetExchangeManager(), &ctx.GetFabricTable()) == CHIP_NO_ERROR);
+
+    // Heap-backed pools are unbounded until limits are set.
+    NL_TEST_ASSERT(apSuite, !im->IsHandlerQuotaEnforced());
+    NL_TEST_ASSERT(apSuite, im->GetMinGuaranteedSubscriptionsPerFabric() == UINT16_MAX);
+
+    InteractionModelEngine::ElasticPoolLimits limits;
+    limits.mMaxSubscriptions = 0;
+    NL_TEST_ASSERT(apSuite, im->SetElasticPoolLimits(limits) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(apSuite, !im->IsHandlerQuotaEnforced());
+
+    limits                   = InteractionModelEngine::ElasticPoolLimits();
+    limits.mMaxPathsForReads = 1;
+    NL_TEST_ASSERT(apSuite, im->SetElasticPoolLimits(limits) == CHIP_ERROR_INVALID_ARGUMENT);
+
+    // A bigger budget only ever grows the subscription limits.
+    InteractionModelEngine::ElasticPoolLimits small = InteractionModelEngine::ComputeElasticPoolLimits(0);
+    InteractionModelEngine::ElasticPoolLimits large = InteractionModelEngine::ComputeElasticPoolLimits(4 * 1024 * 1024);
+    NL_TEST_ASSERT(apSuite, small.mMaxSubscriptions == CHIP_IM_MAX_NUM_SUBSCRIPTIONS);
+    NL_TEST_ASSERT(apSuite, large.mMaxSubscriptions > small.mMaxSubscriptions);
+    NL_TEST_ASSERT(apSuite,
+                   large.mMaxPathsForSubscriptions >= large.mMaxSubscriptions * im->kMinSupportedPathsPerSubscription);
+    NL_TEST_ASSERT(apSuite, large.mMaxReads == small.mMaxReads);
+
+    NL_TEST_ASSERT(apSuite, im->SetElasticPoolLimits(large) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, im->IsHandlerQuotaEnforced());
+    NL_TEST_ASSERT(apSuite, im->GetReadHandlerPoolCapacityForSubscriptions() == large.mMaxSubscriptions);
+    NL_TEST_ASSERT(apSuite, im->GetMinGuaranteedSubscriptionsPerFabric() != UINT16_MAX);
+
+    im->ClearElasticPoolLimits();
+    NL_TEST_ASSERT(apSuite, !im->IsHandlerQuotaEnforced());
+    NL_TEST_ASSERT(apSuite, im->GetReadHandlerPoolCapacityForSubscriptions() == CHIP_IM_MAX_NUM_SUBSCRIPTIONS);
+}
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
 } // namespace app
 } // namespace chip
 
@@ -233,6 +307,10 @@ const nlTest sTests[] =
         {
                 NL_TEST_DEF("TestAttributePathParamsPushRelease", chip::app::TestInteractionModelEngine::TestAttributePathParamsPushRelease),
                 NL_TEST_DEF("TestRemoveDuplicateConcreteAttribute", chip::app::TestInteractionModelEngine::TestRemoveDuplicateConcreteAttribute),
+                NL_TEST_DEF("TestPoolOccupancy", chip::app::TestInteractionModelEngine::TestPoolOccupancy),
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+                NL_TEST_DEF("TestElasticPoolLimits", chip::app::TestInteractionModelEngine::TestElasticPoolLimits),
+#endif
                 NL_TEST_SENTINEL()
         };
 // clang-format on
@@ -0,0 +1,140 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/clusters/ota-requestor/OTAImageDigestVerifier.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+using namespace chip;
+
+namespace {
+
+constexpr size_t kPayloadSize = 1000;
+constexpr size_t kBlockSize   = 64;
+
+uint8_t gPayload[kPayloadSize];
+uint8_t gPayloadDigest[Crypto::kSHA256_Hash_Length];
+
+OTAImageHeader MakeHeader(OTAImageDigestType digestType = OTAImageDigestType::kSha256)
+{
+    OTAImageHeader header;
+    header.mPayloadSize     = kPayloadSize;
+    header.mImageDigestType = digestType;
+    header.mImageDigest     = ByteSpan(gPayloadDigest);
+    return header;
+}
+
+// Adds the payload in blocks, as an image processor does while the image is being downloaded.
+void AddPayload(nlTestSuite * inSuite, OTAImageDigestVerifier & verifier, const uint8_t * payload, size_t payloadSize)
+{
+    for (size_t offset = 0; offset < payloadSize; offset += kBlockSize)
+    {
+        size_t blockSize = std::min(kBlockSize, payloadSize - offset);
+        NL_TEST_ASSERT(inSuite, verifier.AddPayload(ByteSpan(&payload[offset], blockSize)) == CHIP_NO_ERROR);
+    }
+}
+
+void TestValidImage(nlTestSuite * inSuite, void * inContext)
+{
+    OTAImageDigestVerifier verifier;
+    NL_TEST_ASSERT(inSuite, verifier.Begin() == CHIP_NO_ERROR);
+    verifier.SetHeader(MakeHeader());
+    AddPayload(inSuite, verifier, gPayload, kPayloadSize);
+    NL_TEST_ASSERT(inSuite, verifier.Finish() == CHIP_NO_ERROR);
+}
+
+void TestCorruptedImage(nlTestSuite * inSuite, void * inContext)
+{
+    uint8_t corruptedPayload[kPayloadSize];
+    memcpy(corruptedPayload, gPayload, kPayloadSize);
+    corruptedPayload[kPayloadSize / 2] ^= 0x01;
+
+    OTAImageDigestVerifier verifier;
+    NL_TEST_ASSERT(inSuite, verifier.Begin() == CHIP_NO_ERROR);
+    verifier.SetHeader(MakeHeader());
+    AddPayload(inSuite, verifier, corruptedPayload, kPayloadSize);
+    NL_TEST_ASSERT(inSuite, verifier.Finish() == CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+
+    // The verifier can be reused for the next download
+    NL_TEST_ASSERT(inSuite, verifier.Begin() == CHIP_NO_ERROR);
+    verifier.SetHeader(MakeHeader());
+    AddPayload(inSuite, verifier, gPayload, kPayloadSize);
+    NL_TEST_ASSERT(inSuite, verifier.Finish() == CHIP_NO_ERROR);
+}
+
+void TestTruncatedImage(nlTestSuite * inSuite, void * inContext)
+{
+    OTAImageDigestVerifier verifier;
+    NL_TEST_ASSERT(inSuite, verifier.Begin() == CHIP_NO_ERROR);
+    verifier.SetHeader(MakeHeader());
+    AddPayload(inSuite, verifier, gPayload, kPayloadSize - 1);
+    NL_TEST_ASSERT(inSuite, verifier.Finish() == CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+}
+
+void TestUnsupportedDigestType(nlTestSuite * inSuite, void * inContext)
+{
+    // Only the payload size can be checked for digest types other than SHA-256
+    OTAImageDigestVerifier verifier;
+    NL_TEST_ASSERT(inSuite, verifier.Begin() == CHIP_NO_ERROR);
+    verifier.SetHeader(MakeHeader(OTAImageDigestType::kSha512));
+    AddPayload(inSuite, verifier, gPayload, kPayloadSize);
+    NL_TEST_ASSERT(inSuite, verifier.Finish() == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, verifier.Begin() == CHIP_NO_ERROR);
+    verifier.SetHeader(MakeHeader(OTAImageDigestType::kSha512));
+    AddPayload(inSuite, verifier, gPayload, kPayloadSize / 2);
+    NL_TEST_ASSERT(inSuite, verifier.Finish() == CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+}
+
+int TestSetup(void * inContext)
+{
+    VerifyOrReturnError(Platform::MemoryInit() == CHIP_NO_ERROR, FAILURE);
+
+    for (size_t i = 0; i < kPayloadSize; i++)
+    {
+        gPayload[i] = static_cast<uint8_t>(i * 13);
+    }
+    VerifyOrReturnError(Crypto::Hash_SHA256(gPayload, kPayloadSize, gPayloadDigest) == CHIP_NO_ERROR, FAILURE);
+    return SUCCESS;
+}
+
+int TestTeardown(void * inContext)
+{
+    Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
+const nlTest sTests[] = {
+    NL_TEST_DEF("TestValidImage", TestValidImage),
+    NL_TEST_DEF("TestCorruptedImage", TestCorruptedImage),
+    NL_TEST_DEF("TestTruncatedImage", TestTruncatedImage),
+    NL_TEST_DEF("TestUnsupportedDigestType", TestUnsupportedDigestType),
+    NL_TEST_SENTINEL(),
+};
+
+} // namespace
+
+int TestOTAImageDigestVerifier()
+{
+    nlTestSuite theSuite = { "OTAImageDigestVerifier", &sTests[0], TestSetup, TestTeardown };
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestOTAImageDigestVerifier)
@@ -29,6 +29,7 @@
 #include <app/InteractionModelHelper.h>
 #include <app/MessageDef/AttributeReportIBs.h>
 #include <app/MessageDef/EventDataIB.h>
+#include <app/ReadRequestTemplate.h>
 #include <app/tests/AppTestContext.h>
 #include <app/util/basic-types.h>
 #include <app/util/mock/Constants.h>
@@ -64,6 +65,9 @@ chip::EndpointId kInvalidTestEndpointId = 3;
 chip::DataVersion kTestDataVersion1     = 3;
 chip::DataVersion kTestDataVersion2     = 5;
 
+// Reports the fabric of the subject reading it, with a data version that can be shared between reports.
+chip::AttributeId kTestFabricIndexAttributeId = 5;
+
 class TestContext : public chip::Test::AppContext
 {
 public:
@@ -234,6 +238,29 @@ public:
     std::vector<chip::app::ConcreteAttributePath> mReceivedAttributePaths;
 };
 
+// Records the fabric index reported for kTestFabricIndexAttributeId.
+class FabricIndexReportCallback : public MockInteractionModelApp
+{
+public:
+    void OnAttributeData(const chip::app::ConcreteDataAttributePath & aPath, chip::TLV::TLVReader * apData,
+                         const chip::app::StatusIB & status) override
+    {
+        if (status.mStatus == chip::Protocols::InteractionModel::Status::Success &&
+            aPath.mAttributeId == kTestFabricIndexAttributeId)
+        {
+            chip::TLV::TLVReader reader;
+            reader.Init(*apData);
+            if (reader.Get(mLastFabricIndex) != CHIP_NO_ERROR)
+            {
+                mLastFabricIndex = chip::kUndefinedFabricIndex;
+            }
+        }
+        MockInteractionModelApp::OnAttributeData(aPath, apData, status);
+    }
+
+    chip::FabricIndex mLastFabricIndex = chip::kUndefinedFabricIndex;
+};
+
 //
 // This dummy callback is used with a bunch of the tests below that don't go through
 // the normal call-path of having the IM engine allocate the ReadHandler object. Instead,
@@ -284,6 +311,12 @@ CHIP_ERROR ReadSingleClusterData(const Access::SubjectDescriptor & aSubjectDescr
         return attributeReport.EndOfAttributeReportIB().GetError();
     }
 
+    if (aPath.mAttributeId == kTestFabricIndexAttributeId)
+    {
+        return AttributeValueEncoder(aAttributeReports, aSubjectDescriptor.fabricIndex, aPath, kTestDataVersion1)
+            .Encode(aSubjectDescriptor.fabricIndex);
+    }
+
     return AttributeValueEncoder(aAttributeReports, 0, aPath, 0).Encode(kTestFieldValue1);
 }
 
@@ -316,6 +349,7 @@ public:
     static void TestReadHandlerInvalidAttributePath(nlTestSuite * apSuite, void * apContext);
     static void TestProcessSubscribeRequest(nlTestSuite * apSuite, void * apContext);
     static void TestReadRoundtrip(nlTestSuite * apSuite, void * apContext);
+    static void TestReadRoundtripWithRequestTemplate(nlTestSuite * apSuite, void * apContext);
     static void TestPostSubscribeRoundtripChunkReport(nlTestSuite * apSuite, void * apContext);
     static void TestReadRoundtripWithDataVersionFilter(nlTestSuite * apSuite, void * apContext);
     static void TestReadRoundtripWithNoMatchPathDataVersionFilter(nlTestSuite * apSuite, void * apContext);
@@ -325,6 +359,8 @@ public:
     static void TestReadChunking(nlTestSuite * apSuite, void * apContext);
     static void TestSetDirtyBetweenChunks(nlTestSuite * apSuite, void * apContext);
     static void TestSubscribeRoundtrip(nlTestSuite * apSuite, void * apContext);
+    static void TestSubscribeRoundtripWithRequestTemplate(nlTestSuite * apSuite, void * apContext);
+    static void TestResubscribeWithRequestTemplate(nlTestSuite * apSuite, void * apContext);
     static void TestSubscribeUrgentWildcardEvent(nlTestSuite * apSuite, void * apContext);
     static void TestSubscribeWildcard(nlTestSuite * apSuite, void * apContext);
     static void TestSubscribePartialOverlap(nlTestSuite * apSuite, void * apContext);
@@ -360,6 +396,10 @@ public:
     static void TestShutdownSubscription(nlTestSuite * apSuite, void * apContext);
     static void TestSubscriptionReportWithDefunctSession(nlTestSuite * apSuite, void * apContext);
     static void TestReadHandlerMalformedSubscribeRequest(nlTestSuite * apSuite, void * apContext);
+#if CHIP_CONFIG_IM_REPORT_ENCODING_CACHE_SIZE > 0
+    static void TestSubscribeSharedReportEncoding(nlTestSuite * apSuite, void * apContext);
+    static void TestSubscribeReportEncodingNotSharedAcrossFabrics(nlTestSuite * apSuite, void * apContext);
+#endif
 
 private:
     static void GenerateReportData(nlTestSuite * apSuite, void * apContext, System::PacketBufferHandle & aPayload,
@@ -885,6 +925,109 @@ void TestReadInteraction::TestReadRoundtrip(nlTestSuite * apSuite, void * apCont
     NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
 }
 
+void TestReadInteraction::TestReadRoundtripWithRequestTemplate(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+
+    Messaging::ReliableMessageMgr * rm = ctx.GetExchangeManager().GetReliableMessageMgr();
+    // Shouldn't have anything in the retransmit table when starting the test.
+    NL_TEST_ASSERT(apSuite, rm->TestGetCountRetransTable() == 0);
+
+    GenerateEvents(apSuite, apContext);
+
+    MockInteractionModelApp delegate;
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    err           = engine->Init(&ctx.GetExchangeManager(), &ctx.GetFabricTable());
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, !delegate.mGotEventResponse);
+
+    chip::app::EventPathParams eventPathParams[1];
+    eventPathParams[0].mEndpointId = kTestEndpointId;
+    eventPathParams[0].mClusterId  = kTestClusterId;
+
+    chip::app::AttributePathParams attributePathParams[2];
+    attributePathParams[0].mEndpointId  = kTestEndpointId;
+    attributePathParams[0].mClusterId   = kTestClusterId;
+    attributePathParams[0].mAttributeId = 1;
+
+    attributePathParams[1].mEndpointId  = kTestEndpointId;
+    attributePathParams[1].mClusterId   = kTestClusterId;
+    attributePathParams[1].mAttributeId = 2;
+    attributePathParams[1].mListIndex   = 1;
+
+    chip::app::ReadRequestTemplate requestTemplate;
+    err = requestTemplate.Init(Span<const AttributePathParams>(attributePathParams), Span<const EventPathParams>(eventPathParams));
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    ReadPrepareParams readPrepareParams(ctx.GetSessionBobToAlice());
+    readPrepareParams.mpRequestTemplate = &requestTemplate;
+    readPrepareParams.mEventNumber.SetValue(1);
+
+    {
+        app::ReadClient readClient(chip::app::InteractionModelEngine::GetInstance(), &ctx.GetExchangeManager(), delegate,
+                                   chip::app::ReadClient::InteractionType::Read);
+
+        err = readClient.SendRequest(readPrepareParams);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+        ctx.DrainAndServiceIO();
+
+        NL_TEST_ASSERT(apSuite, delegate.mNumDataElementIndex == 1);
+        NL_TEST_ASSERT(apSuite, delegate.mGotEventResponse);
+        NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == 2);
+        NL_TEST_ASSERT(apSuite, delegate.mGotReport);
+        NL_TEST_ASSERT(apSuite, !delegate.mReadError);
+
+        delegate.mGotEventResponse     = false;
+        delegate.mNumAttributeResponse = 0;
+        delegate.mGotReport            = false;
+    }
+
+    // The data version filters of each request are encoded along with the paths of the template.
+    chip::app::DataVersionFilter dataVersionFilters[1];
+    dataVersionFilters[0].mEndpointId = kTestEndpointId;
+    dataVersionFilters[0].mClusterId  = kTestClusterId;
+    dataVersionFilters[0].mDataVersion.SetValue(kTestDataVersion1);
+
+    readPrepareParams.mpDataVersionFilterList    = dataVersionFilters;
+    readPrepareParams.mDataVersionFilterListSize = 1;
+
+    {
+        app::ReadClient readClient(chip::app::InteractionModelEngine::GetInstance(), &ctx.GetExchangeManager(), delegate,
+                                   chip::app::ReadClient::InteractionType::Read);
+
+        err = readClient.SendRequest(readPrepareParams);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+        ctx.DrainAndServiceIO();
+
+        NL_TEST_ASSERT(apSuite, delegate.mGotEventResponse);
+        NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == 0);
+        NL_TEST_ASSERT(apSuite, !delegate.mReadError);
+
+        // By now we should have closed all exchanges and sent all pending acks, so
+        // there should be no queued-up things in the retransmit table.
+        NL_TEST_ASSERT(apSuite, rm->TestGetCountRetransTable() == 0);
+    }
+
+    // The paths come either from the template or from the lists.
+    readPrepareParams.mpAttributePathParamsList    = attributePathParams;
+    readPrepareParams.mAttributePathParamsListSize = 2;
+
+    {
+        app::ReadClient readClient(chip::app::InteractionModelEngine::GetInstance(), &ctx.GetExchangeManager(), delegate,
+                                   chip::app::ReadClient::InteractionType::Read);
+
+        err = readClient.SendRequest(readPrepareParams);
+        NL_TEST_ASSERT(apSuite, err == CHIP_ERROR_INVALID_ARGUMENT);
+    }
+
+    NL_TEST_ASSERT(apSuite, engine->GetNumActiveReadClients() == 0);
+    engine->Shutdown();
+    NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
+}
+
 void TestReadInteraction::TestReadRoundtripWithDataVersionFilter(nlTestSuite * apSuite, void * apContext)
 {
     TestContext & ctx = *static_cast<TestContext *>(apContext);
@@ -1671,6 +1814,150 @@ void TestReadInteraction::TestSubscribeRoundtrip(nlTestSuite * apSuite, void * a
     NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
 }
 
+void TestReadInteraction::TestSubscribeRoundtripWithRequestTemplate(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+
+    Messaging::ReliableMessageMgr * rm = ctx.GetExchangeManager().GetReliableMessageMgr();
+    // Shouldn't have anything in the retransmit table when starting the test.
+    NL_TEST_ASSERT(apSuite, rm->TestGetCountRetransTable() == 0);
+
+    GenerateEvents(apSuite, apContext);
+
+    MockInteractionModelApp delegate;
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    err           = engine->Init(&ctx.GetExchangeManager(), &ctx.GetFabricTable());
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    chip::app::EventPathParams eventPathParams[2];
+    eventPathParams[0].mEndpointId = kTestEndpointId;
+    eventPathParams[0].mClusterId  = kTestClusterId;
+    eventPathParams[0].mEventId    = kTestEventIdDebug;
+
+    eventPathParams[1].mEndpointId = kTestEndpointId;
+    eventPathParams[1].mClusterId  = kTestClusterId;
+    eventPathParams[1].mEventId    = kTestEventIdCritical;
+
+    chip::app::AttributePathParams attributePathParams[2];
+    attributePathParams[0].mEndpointId  = kTestEndpointId;
+    attributePathParams[0].mClusterId   = kTestClusterId;
+    attributePathParams[0].mAttributeId = 1;
+
+    attributePathParams[1].mEndpointId  = kTestEndpointId;
+    attributePathParams[1].mClusterId   = kTestClusterId;
+    attributePathParams[1].mAttributeId = 2;
+
+    chip::app::ReadRequestTemplate requestTemplate;
+    err = requestTemplate.Init(Span<const AttributePathParams>(attributePathParams), Span<const EventPathParams>(eventPathParams));
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    ReadPrepareParams readPrepareParams(ctx.GetSessionBobToAlice());
+    readPrepareParams.mpRequestTemplate          = &requestTemplate;
+    readPrepareParams.mMinIntervalFloorSeconds   = 2;
+    readPrepareParams.mMaxIntervalCeilingSeconds = 5;
+
+    // Subscribing twice with the same template replaces the first subscription.
+    for (int i = 0; i < 2; i++)
+    {
+        app::ReadClient readClient(chip::app::InteractionModelEngine::GetInstance(), &ctx.GetExchangeManager(), delegate,
+                                   chip::app::ReadClient::InteractionType::Subscribe);
+        delegate.mGotReport            = false;
+        delegate.mGotEventResponse     = false;
+        delegate.mNumAttributeResponse = 0;
+
+        err = readClient.SendRequest(readPrepareParams);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+        ctx.DrainAndServiceIO();
+
+        NL_TEST_ASSERT(apSuite, delegate.mGotReport);
+        NL_TEST_ASSERT(apSuite, delegate.mGotEventResponse);
+        NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == 2);
+        NL_TEST_ASSERT(apSuite, engine->GetNumActiveReadHandlers(ReadHandler::InteractionType::Subscribe) == 1);
+    }
+
+    // By now we should have closed all exchanges and sent all pending acks, so
+    // there should be no queued-up things in the retransmit table.
+    NL_TEST_ASSERT(apSuite, rm->TestGetCountRetransTable() == 0);
+
+    NL_TEST_ASSERT(apSuite, engine->GetNumActiveReadClients() == 0);
+    engine->Shutdown();
+    NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
+}
+
+// A subscription whose paths come only from a request template must still be resubscribed when it is lost.
+void TestReadInteraction::TestResubscribeWithRequestTemplate(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+
+    class ResubscribeCallback : public MockInteractionModelApp
+    {
+    public:
+        void OnSubscriptionEstablished(SubscriptionId aSubscriptionId) override { mOnSubscriptionEstablishedCount++; }
+
+        CHIP_ERROR OnResubscriptionNeeded(ReadClient * apReadClient, CHIP_ERROR aTerminationCause) override
+        {
+            mOnResubscriptionsAttempted++;
+            return apReadClient->ScheduleResubscription(0, NullOptional, false);
+        }
+
+        int32_t mOnSubscriptionEstablishedCount = 0;
+        int32_t mOnResubscriptionsAttempted     = 0;
+    };
+
+    ResubscribeCallback delegate;
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    err           = engine->Init(&ctx.GetExchangeManager(), &ctx.GetFabricTable());
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    chip::app::AttributePathParams attributePathParams[1];
+    attributePathParams[0].mEndpointId  = kTestEndpointId;
+    attributePathParams[0].mClusterId   = kTestClusterId;
+    attributePathParams[0].mAttributeId = 1;
+
+    chip::app::ReadRequestTemplate requestTemplate;
+    err = requestTemplate.Init(Span<const AttributePathParams>(attributePathParams), Span<const EventPathParams>());
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    ReadPrepareParams readPrepareParams(ctx.GetSessionBobToAlice());
+    readPrepareParams.mpRequestTemplate          = &requestTemplate;
+    readPrepareParams.mMinIntervalFloorSeconds   = 0;
+    readPrepareParams.mMaxIntervalCeilingSeconds = 5;
+
+    {
+        app::ReadClient readClient(chip::app::InteractionModelEngine::GetInstance(), &ctx.GetExchangeManager(), delegate,
+                                   chip::app::ReadClient::InteractionType::Subscribe);
+
+        err = readClient.SendAutoResubscribeRequest(std::move(readPrepareParams));
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+        ctx.DrainAndServiceIO();
+
+        NL_TEST_ASSERT(apSuite, delegate.mOnSubscriptionEstablishedCount == 1);
+        NL_TEST_ASSERT(apSuite, engine->GetNumActiveReadHandlers(ReadHandler::InteractionType::Subscribe) == 1);
+
+        // Lose the subscription the way a liveness timeout would, and let the resubscription run.
+        delegate.mNumAttributeResponse = 0;
+        readClient.Close(CHIP_ERROR_TIMEOUT);
+        NL_TEST_ASSERT(apSuite, delegate.mOnResubscriptionsAttempted == 1);
+        NL_TEST_ASSERT(apSuite, !delegate.mReadError);
+
+        ctx.GetIOContext().DriveIOUntil(System::Clock::Seconds16(1),
+                                        [&]() { return delegate.mOnSubscriptionEstablishedCount == 2; });
+        ctx.DrainAndServiceIO();
+
+        NL_TEST_ASSERT(apSuite, delegate.mOnSubscriptionEstablishedCount == 2);
+        NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == 1);
+        NL_TEST_ASSERT(apSuite, engine->GetNumActiveReadHandlers(ReadHandler::InteractionType::Subscribe) == 1);
+    }
+
+    NL_TEST_ASSERT(apSuite, engine->GetNumActiveReadClients() == 0);
+    engine->Shutdown();
+    NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
+}
+
 void TestReadInteraction::TestSubscribeUrgentWildcardEvent(nlTestSuite * apSuite, void * apContext)
 {
     TestContext & ctx = *static_cast<TestContext *>(apContext);
@@ -2970,7 +3257,8 @@ void TestReadInteraction::TestPostSubscribeRoundtripChunkReport(nlTestSuite * ap
         delegate.mNumArrayItems        = 0;
 
         // wait for min interval 2 seconds(in test, we use 1.9second considering the time variation), expect no event is received,
-        // then wait for 0.5 seconds, then all chunked dirty reports are sent out, which would not honor minInterval
+        // then wait for 0.5 seconds, then all chunked dirty reports are sent out, which would not honor minInterval.  The report
+        // scheduler may move the end of the min interval up to one alignment step later.
         System::Clock::Timestamp startTime = System::SystemClock().GetMonotonicTimestamp();
         while (true)
         {
@@ -2984,7 +3272,8 @@ void TestReadInteraction::TestPostSubscribeRoundtripChunkReport(nlTestSuite * ap
         startTime = System::SystemClock().GetMonotonicTimestamp();
         while (true)
         {
-            if ((System::SystemClock().GetMonotonicTimestamp() - startTime) >= System::Clock::Milliseconds32(500))
+            if ((System::SystemClock().GetMonotonicTimestamp() - startTime) >=
+                System::Clock::Milliseconds32(500 + CHIP_CONFIG_IM_REPORT_SCHEDULER_ALIGNMENT_MS))
             {
                 break;
             }
@@ -4277,6 +4566,135 @@ void TestReadInteraction::TestSubscriptionReportWithDefunctSession(nlTestSuite *
     ctx.CreateSessionAliceToBob();
 }
 
+#if CHIP_CONFIG_IM_REPORT_ENCODING_CACHE_SIZE > 0
+// Two subscriptions from the same fabric to a dirty attribute are sent the same encoding of it.
+void TestReadInteraction::TestSubscribeSharedReportEncoding(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+
+    FabricIndexReportCallback delegate1;
+    FabricIndexReportCallback delegate2;
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    err           = engine->Init(&ctx.GetExchangeManager(), &ctx.GetFabricTable());
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    AttributePathParams attributePathParams(kTestEndpointId, kTestClusterId, kTestFabricIndexAttributeId);
+    ReadPrepareParams readPrepareParams(ctx.GetSessionBobToAlice());
+    readPrepareParams.mpAttributePathParamsList    = &attributePathParams;
+    readPrepareParams.mAttributePathParamsListSize = 1;
+    readPrepareParams.mMinIntervalFloorSeconds     = 0;
+    readPrepareParams.mMaxIntervalCeilingSeconds   = 10;
+    readPrepareParams.mKeepSubscriptions           = true;
+
+    {
+        app::ReadClient readClient1(engine, &ctx.GetExchangeManager(), delegate1, ReadClient::InteractionType::Subscribe);
+        app::ReadClient readClient2(engine, &ctx.GetExchangeManager(), delegate2, ReadClient::InteractionType::Subscribe);
+
+        size_t hitCount = engine->GetReportingEngine().GetSharedEncodingHitCount();
+
+        NL_TEST_ASSERT(apSuite, readClient1.SendRequest(readPrepareParams) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, readClient2.SendRequest(readPrepareParams) == CHIP_NO_ERROR);
+        ctx.DrainAndServiceIO();
+
+        NL_TEST_ASSERT(apSuite, delegate1.mGotReport && delegate2.mGotReport);
+        NL_TEST_ASSERT(apSuite, engine->GetNumActiveReadHandlers(ReadHandler::InteractionType::Subscribe) == 2);
+
+        // Priming reports are encoded for each subscription.
+        NL_TEST_ASSERT(apSuite, engine->GetReportingEngine().GetSharedEncodingHitCount() == hitCount);
+
+        engine->ActiveHandlerAt(0)->SetStateFlag(ReadHandler::ReadHandlerFlags::HoldReport, false);
+        engine->ActiveHandlerAt(1)->SetStateFlag(ReadHandler::ReadHandlerFlags::HoldReport, false);
+        delegate1.mGotReport            = false;
+        delegate1.mNumAttributeResponse = 0;
+        delegate2.mGotReport            = false;
+        delegate2.mNumAttributeResponse = 0;
+
+        err = engine->GetReportingEngine().SetDirty(attributePathParams);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        ctx.DrainAndServiceIO();
+
+        NL_TEST_ASSERT(apSuite, delegate1.mGotReport && delegate1.mNumAttributeResponse == 1);
+        NL_TEST_ASSERT(apSuite, delegate2.mGotReport && delegate2.mNumAttributeResponse == 1);
+        NL_TEST_ASSERT(apSuite, delegate1.mLastFabricIndex != kUndefinedFabricIndex);
+        NL_TEST_ASSERT(apSuite, delegate1.mLastFabricIndex == delegate2.mLastFabricIndex);
+
+        // The second report is a copy of the first one.
+        NL_TEST_ASSERT(apSuite, engine->GetReportingEngine().GetSharedEncodingHitCount() == hitCount + 1);
+    }
+
+    NL_TEST_ASSERT(apSuite, engine->GetNumActiveReadClients() == 0);
+    engine->Shutdown();
+    NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
+}
+
+// Subscriptions from different fabrics are each sent their own encoding of a dirty attribute, since its value can depend on
+// the accessing fabric.
+void TestReadInteraction::TestSubscribeReportEncodingNotSharedAcrossFabrics(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+
+    FabricIndexReportCallback delegate1;
+    FabricIndexReportCallback delegate2;
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    err           = engine->Init(&ctx.GetExchangeManager(), &ctx.GetFabricTable());
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    AttributePathParams attributePathParams(kTestEndpointId, kTestClusterId, kTestFabricIndexAttributeId);
+    ReadPrepareParams readPrepareParams1(ctx.GetSessionBobToAlice());
+    readPrepareParams1.mpAttributePathParamsList    = &attributePathParams;
+    readPrepareParams1.mAttributePathParamsListSize = 1;
+    readPrepareParams1.mMinIntervalFloorSeconds     = 0;
+    readPrepareParams1.mMaxIntervalCeilingSeconds   = 10;
+
+    ReadPrepareParams readPrepareParams2(ctx.GetSessionAliceToBob());
+    readPrepareParams2.mpAttributePathParamsList    = &attributePathParams;
+    readPrepareParams2.mAttributePathParamsListSize = 1;
+    readPrepareParams2.mMinIntervalFloorSeconds     = 0;
+    readPrepareParams2.mMaxIntervalCeilingSeconds   = 10;
+
+    {
+        app::ReadClient readClient1(engine, &ctx.GetExchangeManager(), delegate1, ReadClient::InteractionType::Subscribe);
+        app::ReadClient readClient2(engine, &ctx.GetExchangeManager(), delegate2, ReadClient::InteractionType::Subscribe);
+
+        NL_TEST_ASSERT(apSuite, readClient1.SendRequest(readPrepareParams1) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, readClient2.SendRequest(readPrepareParams2) == CHIP_NO_ERROR);
+        ctx.DrainAndServiceIO();
+
+        NL_TEST_ASSERT(apSuite, delegate1.mGotReport && delegate2.mGotReport);
+        NL_TEST_ASSERT(apSuite, engine->GetNumActiveReadHandlers(ReadHandler::InteractionType::Subscribe) == 2);
+
+        FabricIndex fabricIndex1 = delegate1.mLastFabricIndex;
+        FabricIndex fabricIndex2 = delegate2.mLastFabricIndex;
+        NL_TEST_ASSERT(apSuite, fabricIndex1 != kUndefinedFabricIndex && fabricIndex2 != kUndefinedFabricIndex);
+        NL_TEST_ASSERT(apSuite, fabricIndex1 != fabricIndex2);
+
+        engine->ActiveHandlerAt(0)->SetStateFlag(ReadHandler::ReadHandlerFlags::HoldReport, false);
+        engine->ActiveHandlerAt(1)->SetStateFlag(ReadHandler::ReadHandlerFlags::HoldReport, false);
+        delegate1.mGotReport       = false;
+        delegate1.mLastFabricIndex = kUndefinedFabricIndex;
+        delegate2.mGotReport       = false;
+        delegate2.mLastFabricIndex = kUndefinedFabricIndex;
+        size_t hitCount            = engine->GetReportingEngine().GetSharedEncodingHitCount();
+
+        err = engine->GetReportingEngine().SetDirty(attributePathParams);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        ctx.DrainAndServiceIO();
+
+        // Each subscription still sees the value for its own fabric, and no encoding was shared.
+        NL_TEST_ASSERT(apSuite, delegate1.mGotReport && delegate2.mGotReport);
+        NL_TEST_ASSERT(apSuite, delegate1.mLastFabricIndex == fabricIndex1);
+        NL_TEST_ASSERT(apSuite, delegate2.mLastFabricIndex == fabricIndex2);
+        NL_TEST_ASSERT(apSuite, engine->GetReportingEngine().GetSharedEncodingHitCount() == hitCount);
+    }
+
+    NL_TEST_ASSERT(apSuite, engine->GetNumActiveReadClients() == 0);
+    engine->Shutdown();
+    NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
+}
+#endif // CHIP_CONFIG_IM_REPORT_ENCODING_CACHE_SIZE > 0
+
 } // namespace app
 } // namespace chip
 
@@ -4290,6 +4708,7 @@ namespace {
 const nlTest sTests[] =
 {
     NL_TEST_DEF("TestReadRoundtrip", chip::app::TestReadInteraction::TestReadRoundtrip),
+    NL_TEST_DEF("TestReadRoundtripWithRequestTemplate", chip::app::TestReadInteraction::TestReadRoundtripWithRequestTemplate),
     NL_TEST_DEF("TestReadRoundtripWithDataVersionFilter", chip::app::TestReadInteraction::TestReadRoundtripWithDataVersionFilter),
     NL_TEST_DEF("TestReadRoundtripWithNoMatchPathDataVersionFilter", chip::app::TestReadInteraction::TestReadRoundtripWithNoMatchPathDataVersionFilter),
     NL_TEST_DEF("TestReadRoundtripWithMultiSamePathDifferentDataVersionFilter", chip::app::TestReadInteraction::TestReadRoundtripWithMultiSamePathDifferentDataVersionFilter),
@@ -4308,6 +4727,8 @@ const nlTest sTests[] =
     NL_TEST_DEF("TestReadHandlerInvalidAttributePath", chip::app::TestReadInteraction::TestReadHandlerInvalidAttributePath),
     NL_TEST_DEF("TestProcessSubscribeRequest", chip::app::TestReadInteraction::TestProcessSubscribeRequest),
     NL_TEST_DEF("TestSubscribeRoundtrip", chip::app::TestReadInteraction::TestSubscribeRoundtrip),
+    NL_TEST_DEF("TestSubscribeRoundtripWithRequestTemplate", chip::app::TestReadInteraction::TestSubscribeRoundtripWithRequestTemplate),
+    NL_TEST_DEF("TestResubscribeWithRequestTemplate", chip::app::TestReadInteraction::TestResubscribeWithRequestTemplate),
     NL_TEST_DEF("TestPostSubscribeRoundtripChunkReport", chip::app::TestReadInteraction::TestPostSubscribeRoundtripChunkReport),
     NL_TEST_DEF("TestReadClientReceiveInvalidMessage", chip::app::TestReadInteraction::TestReadClientReceiveInvalidMessage),
     NL_TEST_DEF("TestSubscribeClientReceiveInvalidStatusResponse", chip::app::TestReadInteraction::TestSubscribeClientReceiveInvalidStatusResponse),
@@ -4329,6 +4750,10 @@ const nlTest sTests[] =
     NL_TEST_DEF("TestSubscribeWildcard", chip::app::TestReadInteraction::TestSubscribeWildcard),
     NL_TEST_DEF("TestSubscribePartialOverlap", chip::app::TestReadInteraction::TestSubscribePartialOverlap),
     NL_TEST_DEF("TestSubscribeSetDirtyFullyOverlap", chip::app::TestReadInteraction::TestSubscribeSetDirtyFullyOverlap),
+#if CHIP_CONFIG_IM_REPORT_ENCODING_CACHE_SIZE > 0
+    NL_TEST_DEF("TestSubscribeSharedReportEncoding", chip::app::TestReadInteraction::TestSubscribeSharedReportEncoding),
+    NL_TEST_DEF("TestSubscribeReportEncodingNotSharedAcrossFabrics", chip::app::TestReadInteraction::TestSubscribeReportEncodingNotSharedAcrossFabrics),
+#endif
     NL_TEST_DEF("TestSubscribeEarlyShutdown", chip::app::TestReadInteraction::TestSubscribeEarlyShutdown),
     NL_TEST_DEF("TestSubscribeInvalidAttributePathRoundtrip", chip::app::TestReadInteraction::TestSubscribeInvalidAttributePathRoundtrip),
     NL_TEST_DEF("TestReadInvalidAttributePathRoundtrip", chip::app::TestReadInteraction::TestReadInvalidAttributePathRoundtrip),
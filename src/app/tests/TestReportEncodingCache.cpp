@@ -0,0 +1,215 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the ReportEncodingCache of the reporting engine
+ *
+ */
+
+#include <app/reporting/ReportEncodingCache.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <nlunit-test.h>
+
+#include <string.h>
+
+#if CHIP_CONFIG_IM_REPORT_ENCODING_CACHE_SIZE > 0
+
+namespace chip {
+namespace app {
+namespace reporting {
+namespace {
+
+using Status = Protocols::InteractionModel::Status;
+
+constexpr size_t kReportBufferSize = 256;
+
+struct ReportBuffer
+{
+    explicit ReportBuffer(size_t aSize = kReportBufferSize)
+    {
+        mWriter.Init(mBuffer, aSize);
+        mError = mBuilder.Init(&mWriter);
+    }
+
+    uint32_t LengthWritten() { return mWriter.GetLengthWritten(); }
+
+    uint8_t mBuffer[kReportBufferSize];
+    TLV::TLVWriter mWriter;
+    AttributeReportIBs::Builder mBuilder;
+    CHIP_ERROR mError;
+};
+
+ReportEncodingCache::Key MakeKey(AttributeId aAttributeId, uint64_t aGeneration = 1, FabricIndex aFabricIndex = 1)
+{
+    ReportEncodingCache::Key key;
+    key.mPath        = ConcreteAttributePath(1, 6, aAttributeId);
+    key.mGeneration  = aGeneration;
+    key.mFabricIndex = aFabricIndex;
+    return key;
+}
+
+void TestSharedEncoding(nlTestSuite * apSuite, void * apContext)
+{
+    ReportEncodingCache cache;
+    ReportEncodingCache::Key key = MakeKey(0);
+    size_t encodeCount           = 0;
+
+    auto encodeStatus = [&](AttributeReportIBs::Builder & aBuilder) {
+        encodeCount++;
+        return aBuilder.EncodeAttributeStatus(ConcreteReadAttributePath(1, 6, 0), StatusIB(Status::UnsupportedRead));
+    };
+
+    ReportBuffer first;
+    NL_TEST_ASSERT(apSuite, first.mError == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, cache.CopyOrEncode(key, first.mWriter, encodeStatus) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, encodeCount == 1);
+    NL_TEST_ASSERT(apSuite, cache.GetHitCount() == 0);
+
+    // Same key: the encoding is copied.
+    ReportBuffer second;
+    NL_TEST_ASSERT(apSuite, cache.CopyOrEncode(key, second.mWriter, encodeStatus) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, encodeCount == 1);
+    NL_TEST_ASSERT(apSuite, cache.GetHitCount() == 1);
+    NL_TEST_ASSERT(apSuite, first.LengthWritten() == second.LengthWritten());
+    NL_TEST_ASSERT(apSuite, memcmp(first.mBuffer, second.mBuffer, first.LengthWritten()) == 0);
+
+    // Another fabric, or a newer dirty set generation, needs its own encoding.
+    ReportBuffer otherFabric;
+    NL_TEST_ASSERT(apSuite, cache.CopyOrEncode(MakeKey(0, 1, 2), otherFabric.mWriter, encodeStatus) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, encodeCount == 2);
+
+    ReportBuffer newerGeneration;
+    NL_TEST_ASSERT(apSuite, cache.CopyOrEncode(MakeKey(0, 2), newerGeneration.mWriter, encodeStatus) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, encodeCount == 3);
+
+    cache.Clear();
+    ReportBuffer afterClear;
+    NL_TEST_ASSERT(apSuite, cache.CopyOrEncode(key, afterClear.mWriter, encodeStatus) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, encodeCount == 4);
+}
+
+void TestEvictionWithinGeneration(nlTestSuite * apSuite, void * apContext)
+{
+    ReportEncodingCache cache;
+    size_t encodeCount = 0;
+
+    auto encodeStatus = [&](AttributeReportIBs::Builder & aBuilder) {
+        encodeCount++;
+        return aBuilder.EncodeAttributeStatus(ConcreteReadAttributePath(1, 6, 0), StatusIB(Status::UnsupportedRead));
+    };
+
+    // More distinct attributes than entries: every one of them is still encoded correctly.
+    for (AttributeId attributeId = 0; attributeId < 2 * CHIP_CONFIG_IM_REPORT_ENCODING_CACHE_SIZE; attributeId++)
+    {
+        ReportBuffer report;
+        NL_TEST_ASSERT(apSuite, cache.CopyOrEncode(MakeKey(attributeId), report.mWriter, encodeStatus) == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(apSuite, encodeCount == 2 * CHIP_CONFIG_IM_REPORT_ENCODING_CACHE_SIZE);
+    NL_TEST_ASSERT(apSuite, cache.GetHitCount() == 0);
+
+    // The most recent one is still there.
+    ReportBuffer report;
+    NL_TEST_ASSERT(apSuite,
+                   cache.CopyOrEncode(MakeKey(2 * CHIP_CONFIG_IM_REPORT_ENCODING_CACHE_SIZE - 1), report.mWriter, encodeStatus) ==
+                       CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, cache.GetHitCount() == 1);
+}
+
+void TestUncacheable(nlTestSuite * apSuite, void * apContext)
+{
+    ReportEncodingCache cache;
+    size_t encodeCount = 0;
+
+    // Larger than an entry.
+    auto encodeLarge = [&](AttributeReportIBs::Builder & aBuilder) {
+        encodeCount++;
+        for (size_t i = 0; i < CHIP_CONFIG_IM_REPORT_ENCODING_CACHE_ENTRY_SIZE; i++)
+        {
+            ReturnErrorOnFailure(
+                aBuilder.EncodeAttributeStatus(ConcreteReadAttributePath(1, 6, 0), StatusIB(Status::UnsupportedRead)));
+        }
+        return CHIP_NO_ERROR;
+    };
+
+    ReportBuffer report;
+    NL_TEST_ASSERT(apSuite, cache.CopyOrEncode(MakeKey(1), report.mWriter, encodeLarge) == CHIP_ERROR_NOT_FOUND);
+    NL_TEST_ASSERT(apSuite, encodeCount == 1);
+
+    // The cache remembers that the attribute cannot be shared instead of encoding it again.
+    NL_TEST_ASSERT(apSuite, cache.CopyOrEncode(MakeKey(1), report.mWriter, encodeLarge) == CHIP_ERROR_NOT_FOUND);
+    NL_TEST_ASSERT(apSuite, encodeCount == 1);
+
+    auto encodeFailure = [&](AttributeReportIBs::Builder & aBuilder) {
+        encodeCount++;
+        return CHIP_ERROR_INTERNAL;
+    };
+    NL_TEST_ASSERT(apSuite, cache.CopyOrEncode(MakeKey(2), report.mWriter, encodeFailure) == CHIP_ERROR_NOT_FOUND);
+    NL_TEST_ASSERT(apSuite, encodeCount == 2);
+    NL_TEST_ASSERT(apSuite, cache.GetHitCount() == 0);
+}
+
+void TestReportOutOfSpace(nlTestSuite * apSuite, void * apContext)
+{
+    ReportEncodingCache cache;
+
+    auto encodeStatus = [&](AttributeReportIBs::Builder & aBuilder) {
+        return aBuilder.EncodeAttributeStatus(ConcreteReadAttributePath(1, 6, 0), StatusIB(Status::UnsupportedRead));
+    };
+
+    ReportBuffer smallReport(4);
+    NL_TEST_ASSERT(apSuite, smallReport.mError == CHIP_NO_ERROR);
+    CHIP_ERROR err = cache.CopyOrEncode(MakeKey(1), smallReport.mWriter, encodeStatus);
+    NL_TEST_ASSERT(apSuite, err == CHIP_ERROR_BUFFER_TOO_SMALL || err == CHIP_ERROR_NO_MEMORY);
+
+    // The entry itself is fine and can be copied into a report with enough space.
+    ReportBuffer report;
+    NL_TEST_ASSERT(apSuite, cache.CopyOrEncode(MakeKey(1), report.mWriter, encodeStatus) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, cache.GetHitCount() == 1);
+}
+
+} // namespace
+} // namespace reporting
+} // namespace app
+} // namespace chip
+
+namespace {
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("TestSharedEncoding", chip::app::reporting::TestSharedEncoding),
+    NL_TEST_DEF("TestEvictionWithinGeneration", chip::app::reporting::TestEvictionWithinGeneration),
+    NL_TEST_DEF("TestUncacheable", chip::app::reporting::TestUncacheable),
+    NL_TEST_DEF("TestReportOutOfSpace", chip::app::reporting::TestReportOutOfSpace),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+} // namespace
+
+int TestReportEncodingCache()
+{
+    nlTestSuite theSuite = { "ReportEncodingCache", &sTests[0], nullptr, nullptr };
+
+    nlTestRunner(&theSuite, nullptr);
+
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestReportEncodingCache)
+
+#endif // CHIP_CONFIG_IM_REPORT_ENCODING_CACHE_SIZE > 0
@@ -56,10 +56,21 @@ public:
     static void TestBuildAndSendSingleReportData(nlTestSuite * apSuite, void * apContext);
     static void TestMergeOverlappedAttributePath(nlTestSuite * apSuite, void * apContext);
     static void TestMergeAttributePathWhenDirtySetPoolExhausted(nlTestSuite * apSuite, void * apContext);
+    static void TestReportSchedulerDeadlines(nlTestSuite * apSuite, void * apContext);
+    static void TestReportSchedulerHandlers(nlTestSuite * apSuite, void * apContext);
+    static void TestReportSchedulerDueOrder(nlTestSuite * apSuite, void * apContext);
 
 private:
     static bool InsertToDirtySet(const AttributePathParams & aPath);
 
+    // Starts the min / max intervals of a subscription the way a subscribe request does.
+    static CHIP_ERROR StartSubscriptionIntervals(ReadHandler & aHandler, uint16_t aMinInterval, uint16_t aMaxInterval)
+    {
+        aHandler.mMinIntervalFloorSeconds = aMinInterval;
+        aHandler.mMaxInterval             = aMaxInterval;
+        return aHandler.RefreshSubscribeSyncTimer();
+    }
+
     struct ExpectedDirtySetContent : public AttributePathParams
     {
         ExpectedDirtySetContent(const AttributePathParams & path) : AttributePathParams(path) {}
@@ -321,6 +332,200 @@ void TestReportingEngine::TestMergeAttributePathWhenDirtySetPoolExhausted(nlTest
     InteractionModelEngine::GetInstance()->GetReportingEngine().Shutdown();
 }
 
+void TestReportingEngine::TestReportSchedulerDeadlines(nlTestSuite * apSuite, void * apContext)
+{
+    using namespace System::Clock;
+    using namespace System::Clock::Literals;
+    // Not the event Timestamp of chip::app.
+    using System::Clock::Timestamp;
+
+    constexpr Milliseconds64 kAlignment{ CHIP_CONFIG_IM_REPORT_SCHEDULER_ALIGNMENT_MS };
+    const Timestamp now = 12345678_ms64;
+    Timestamp minTimestamp;
+    Timestamp maxTimestamp;
+
+    // The deadlines always stay within the negotiated intervals.
+    const uint16_t intervals[][2] = { { 0, 0 }, { 0, 1 }, { 1, 1 }, { 1, 2 }, { 2, 60 }, { 59, 60 }, { 60, 60 }, { 0, 3600 } };
+    for (auto & interval : intervals)
+    {
+        const Timestamp min = now + Seconds16(interval[0]);
+        const Timestamp max = now + Seconds16(interval[1]);
+
+        ReportScheduler::ComputeDeadlines(now, Seconds16(interval[0]), Seconds16(interval[1]), minTimestamp, maxTimestamp);
+        NL_TEST_ASSERT(apSuite, minTimestamp >= min);
+        NL_TEST_ASSERT(apSuite, minTimestamp <= max);
+        NL_TEST_ASSERT(apSuite, maxTimestamp >= minTimestamp);
+        NL_TEST_ASSERT(apSuite, maxTimestamp <= max);
+#if CHIP_CONFIG_IM_REPORT_SCHEDULER_ALIGNMENT_MS > 0
+        // The keep-alive is never moved earlier than one grid step.
+        NL_TEST_ASSERT(apSuite, maxTimestamp + kAlignment > max);
+#endif
+
+        // Subscribers asking for a min interval of 0 get changes right away.
+        if (interval[0] == 0)
+        {
+            NL_TEST_ASSERT(apSuite, minTimestamp == now);
+        }
+    }
+
+#if CHIP_CONFIG_IM_REPORT_SCHEDULER_ALIGNMENT_MS > 0
+    // Subscriptions started at slightly different times with the same intervals share their deadlines.
+    Timestamp otherMinTimestamp;
+    Timestamp otherMaxTimestamp;
+    const Timestamp alignedNow((now.count() / kAlignment.count()) * kAlignment.count() + 1);
+    ReportScheduler::ComputeDeadlines(alignedNow, Seconds16(2), Seconds16(60), minTimestamp, maxTimestamp);
+    ReportScheduler::ComputeDeadlines(alignedNow + kAlignment / 2, Seconds16(2), Seconds16(60), otherMinTimestamp,
+                                      otherMaxTimestamp);
+    NL_TEST_ASSERT(apSuite, minTimestamp == otherMinTimestamp);
+    NL_TEST_ASSERT(apSuite, maxTimestamp == otherMaxTimestamp);
+#endif
+}
+
+void TestReportingEngine::TestReportSchedulerHandlers(nlTestSuite * apSuite, void * apContext)
+{
+    using namespace System::Clock;
+    // Not the event Timestamp of chip::app.
+    using System::Clock::Timestamp;
+
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = InteractionModelEngine::GetInstance()->Init(&ctx.GetExchangeManager(), &ctx.GetFabricTable());
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    ReportScheduler & scheduler = InteractionModelEngine::GetInstance()->GetReportingEngine().GetReportScheduler();
+    scheduler.ResetMetrics();
+
+    Internal::MockClock clock;
+    ClockBase * realClock = &System::SystemClock();
+    Internal::SetSystemClockForTesting(&clock);
+
+    constexpr Milliseconds64 kAlignment{ CHIP_CONFIG_IM_REPORT_SCHEDULER_ALIGNMENT_MS };
+    clock.SetMonotonic(Milliseconds64(100 * std::max<uint64_t>(kAlignment.count(), 1) + 1));
+
+    TestExchangeDelegate delegate;
+    DummyDelegate dummy;
+    Timestamp unscheduledDeadline;
+    {
+        ReadHandler handler1(dummy, ctx.NewExchangeToAlice(&delegate), ReadHandler::InteractionType::Subscribe);
+        ReadHandler handler2(dummy, ctx.NewExchangeToAlice(&delegate), ReadHandler::InteractionType::Subscribe);
+
+        NL_TEST_ASSERT(apSuite, StartSubscriptionIntervals(handler1, 2, 60) == CHIP_NO_ERROR);
+        {
+            // This subscription is due first, and goes away before its min interval elapses.
+            ReadHandler handler3(dummy, ctx.NewExchangeToAlice(&delegate), ReadHandler::InteractionType::Subscribe);
+            NL_TEST_ASSERT(apSuite, StartSubscriptionIntervals(handler3, 1, 1) == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(apSuite, ReportScheduler::IsScheduled(handler3));
+            unscheduledDeadline = handler3.mMinReportTimestamp;
+            NL_TEST_ASSERT(apSuite, unscheduledDeadline < handler1.mMinReportTimestamp);
+        }
+        clock.AdvanceMonotonic(kAlignment / 2);
+        NL_TEST_ASSERT(apSuite, StartSubscriptionIntervals(handler2, 2, 60) == CHIP_NO_ERROR);
+
+        NL_TEST_ASSERT(apSuite, ReportScheduler::IsScheduled(handler1) && ReportScheduler::IsScheduled(handler2));
+        NL_TEST_ASSERT(apSuite,
+                       handler1.mFlags.HasAll(ReadHandler::ReadHandlerFlags::HoldReport, ReadHandler::ReadHandlerFlags::HoldSync));
+        NL_TEST_ASSERT(apSuite,
+                       handler2.mFlags.HasAll(ReadHandler::ReadHandlerFlags::HoldReport, ReadHandler::ReadHandlerFlags::HoldSync));
+
+        // The timer was moved to the next subscription when the first one went away.
+        clock.SetMonotonic(unscheduledDeadline);
+        ctx.GetIOContext().DriveIO();
+        NL_TEST_ASSERT(apSuite, scheduler.GetMetrics().mWakeups == 0);
+
+#if CHIP_CONFIG_IM_REPORT_SCHEDULER_ALIGNMENT_MS > 0
+        // Subscriptions started within one alignment step reach the end of their min interval together.
+        NL_TEST_ASSERT(apSuite, handler1.mMinReportTimestamp == handler2.mMinReportTimestamp);
+        NL_TEST_ASSERT(apSuite, handler1.mMaxReportTimestamp == handler2.mMaxReportTimestamp);
+
+        clock.SetMonotonic(handler1.mMinReportTimestamp);
+        ctx.GetIOContext().DriveIO();
+        NL_TEST_ASSERT(apSuite, !handler1.mFlags.Has(ReadHandler::ReadHandlerFlags::HoldReport));
+        NL_TEST_ASSERT(apSuite, !handler2.mFlags.Has(ReadHandler::ReadHandlerFlags::HoldReport));
+        NL_TEST_ASSERT(apSuite, handler1.mFlags.Has(ReadHandler::ReadHandlerFlags::HoldSync));
+        NL_TEST_ASSERT(apSuite, handler2.mFlags.Has(ReadHandler::ReadHandlerFlags::HoldSync));
+        NL_TEST_ASSERT(apSuite, scheduler.GetMetrics().mWakeups == 1);
+        NL_TEST_ASSERT(apSuite, scheduler.GetMetrics().mDeadlinesHandled == 2);
+
+        // And send their keep-alive reports with the same wakeup.
+        clock.SetMonotonic(handler1.mMaxReportTimestamp);
+        ctx.GetIOContext().DriveIO();
+        NL_TEST_ASSERT(apSuite, !handler1.mFlags.Has(ReadHandler::ReadHandlerFlags::HoldSync));
+        NL_TEST_ASSERT(apSuite, !handler2.mFlags.Has(ReadHandler::ReadHandlerFlags::HoldSync));
+        NL_TEST_ASSERT(apSuite, scheduler.GetMetrics().mWakeups == 2);
+        NL_TEST_ASSERT(apSuite, scheduler.GetMetrics().mDeadlinesHandled == 4);
+        NL_TEST_ASSERT(apSuite, scheduler.GetMetrics().mMaxDeadlinesPerWakeup == 2);
+#endif // CHIP_CONFIG_IM_REPORT_SCHEDULER_ALIGNMENT_MS > 0
+
+        // A report restarts the intervals; tearing the handler down afterwards leaves nothing scheduled.
+        NL_TEST_ASSERT(apSuite, StartSubscriptionIntervals(handler1, 2, 60) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, ReportScheduler::IsScheduled(handler1));
+        unscheduledDeadline = handler1.mMaxReportTimestamp;
+    }
+
+    const uint32_t wakeups = scheduler.GetMetrics().mWakeups;
+    clock.SetMonotonic(unscheduledDeadline);
+    ctx.GetIOContext().DriveIO();
+    NL_TEST_ASSERT(apSuite, scheduler.GetMetrics().mWakeups == wakeups);
+
+    Internal::SetSystemClockForTesting(realClock);
+    InteractionModelEngine::GetInstance()->GetReportingEngine().Shutdown();
+}
+
+void TestReportingEngine::TestReportSchedulerDueOrder(nlTestSuite * apSuite, void * apContext)
+{
+    using namespace System::Clock;
+    // Not the event Timestamp of chip::app.
+    using System::Clock::Timestamp;
+
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = InteractionModelEngine::GetInstance()->Init(&ctx.GetExchangeManager(), &ctx.GetFabricTable());
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    ReportScheduler & scheduler = InteractionModelEngine::GetInstance()->GetReportingEngine().GetReportScheduler();
+    scheduler.ResetMetrics();
+
+    Internal::MockClock clock;
+    ClockBase * realClock = &System::SystemClock();
+    Internal::SetSystemClockForTesting(&clock);
+    clock.SetMonotonic(Seconds64(1000));
+
+    TestExchangeDelegate delegate;
+    DummyDelegate dummy;
+    {
+        ReadHandler handler1(dummy, ctx.NewExchangeToAlice(&delegate), ReadHandler::InteractionType::Subscribe);
+        ReadHandler handler2(dummy, ctx.NewExchangeToAlice(&delegate), ReadHandler::InteractionType::Subscribe);
+        ReadHandler handler3(dummy, ctx.NewExchangeToAlice(&delegate), ReadHandler::InteractionType::Subscribe);
+        NL_TEST_ASSERT(apSuite, StartSubscriptionIntervals(handler1, 0, 20) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, StartSubscriptionIntervals(handler2, 0, 10) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, StartSubscriptionIntervals(handler3, 0, 30) == CHIP_NO_ERROR);
+
+        // No keep-alive is released before the max interval of its handler elapses.
+        clock.SetMonotonic(handler2.mMaxReportTimestamp - Milliseconds64(1));
+        scheduler.HandleDeadlines();
+        NL_TEST_ASSERT(apSuite, scheduler.GetMetrics().mDeadlinesHandled == 3);
+        NL_TEST_ASSERT(apSuite, handler2.mFlags.Has(ReadHandler::ReadHandlerFlags::HoldSync));
+        NL_TEST_ASSERT(apSuite, scheduler.PopDueHandler() == nullptr);
+
+        // Handlers whose max intervals elapsed by the same wakeup are handed out in deadline order.
+        clock.SetMonotonic(handler3.mMaxReportTimestamp);
+        scheduler.HandleDeadlines();
+        NL_TEST_ASSERT(apSuite, scheduler.GetMetrics().mWakeups == 2);
+        NL_TEST_ASSERT(apSuite, scheduler.GetMetrics().mDeadlinesHandled == 6);
+        NL_TEST_ASSERT(apSuite, scheduler.GetMetrics().mMaxDeadlinesPerWakeup == 3);
+        NL_TEST_ASSERT(apSuite,
+                       scheduler.GetMetrics().mMaxLatency.count() ==
+                           (handler3.mMaxReportTimestamp - handler2.mMaxReportTimestamp).count());
+        NL_TEST_ASSERT(apSuite, !handler2.mFlags.Has(ReadHandler::ReadHandlerFlags::HoldSync));
+        NL_TEST_ASSERT(apSuite, scheduler.PopDueHandler() == &handler2);
+        NL_TEST_ASSERT(apSuite, scheduler.PopDueHandler() == &handler1);
+        NL_TEST_ASSERT(apSuite, scheduler.PopDueHandler() == &handler3);
+        NL_TEST_ASSERT(apSuite, scheduler.PopDueHandler() == nullptr);
+        NL_TEST_ASSERT(apSuite, !ReportScheduler::IsScheduled(handler1));
+    }
+
+    Internal::SetSystemClockForTesting(realClock);
+    InteractionModelEngine::GetInstance()->GetReportingEngine().Shutdown();
+}
+
 } // namespace reporting
 } // namespace app
 } // namespace chip
@@ -332,6 +537,9 @@ const nlTest sTests[] =
     NL_TEST_DEF("CheckBuildAndSendSingleReportData", chip::app::reporting::TestReportingEngine::TestBuildAndSendSingleReportData),
     NL_TEST_DEF("TestMergeOverlappedAttributePath", chip::app::reporting::TestReportingEngine::TestMergeOverlappedAttributePath),
     NL_TEST_DEF("TestMergeAttributePathWhenDirtySetPoolExhausted", chip::app::reporting::TestReportingEngine::TestMergeAttributePathWhenDirtySetPoolExhausted),
+    NL_TEST_DEF("TestReportSchedulerDeadlines", chip::app::reporting::TestReportingEngine::TestReportSchedulerDeadlines),
+    NL_TEST_DEF("TestReportSchedulerHandlers", chip::app::reporting::TestReportingEngine::TestReportSchedulerHandlers),
+    NL_TEST_DEF("TestReportSchedulerDueOrder", chip::app::reporting::TestReportingEngine::TestReportSchedulerDueOrder),
     NL_TEST_SENTINEL()
 };
 // clang-format on
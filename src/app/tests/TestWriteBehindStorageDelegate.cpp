@@ -0,0 +1,272 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/DefaultAttributePersistenceProvider.h>
+#include <app/WriteBehindStorageDelegate.h>
+#include <app/tests/AppTestContext.h>
+#include <lib/core/Optional.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <lib/support/UnitTestContext.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <nlunit-test.h>
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+using TestContext = chip::Test::AppContext;
+using namespace chip;
+using namespace chip::app;
+using namespace chip::System::Clock::Literals;
+
+namespace {
+
+// Records the operations that reach the storage, in order.
+class RecordingStorage : public TestPersistentStorageDelegate
+{
+public:
+    CHIP_ERROR SyncSetKeyValue(const char * key, const void * value, uint16_t size) override
+    {
+        mOperations.push_back(std::string("set:") + key);
+        return TestPersistentStorageDelegate::SyncSetKeyValue(key, value, size);
+    }
+
+    CHIP_ERROR SyncDeleteKeyValue(const char * key) override
+    {
+        mOperations.push_back(std::string("delete:") + key);
+        return TestPersistentStorageDelegate::SyncDeleteKeyValue(key);
+    }
+
+    std::vector<std::string> mOperations;
+};
+
+uint8_t ReadByte(PersistentStorageDelegate & storage, const char * key, CHIP_ERROR & err)
+{
+    uint8_t value = 0;
+    uint16_t size = sizeof(value);
+    err           = storage.SyncGetKeyValue(key, &value, size);
+    return value;
+}
+
+void TestReadYourWrites(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    RecordingStorage storage;
+    WriteBehindStorageDelegate writeBehind(storage, ctx.GetSystemLayer(), 60000_ms32);
+    CHIP_ERROR err;
+
+    const uint8_t values[] = { 1, 2, 3 };
+    for (uint8_t value : values)
+    {
+        NL_TEST_ASSERT(apSuite, writeBehind.SyncSetKeyValue("a", &value, sizeof(value)) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, ReadByte(writeBehind, "a", err) == value && err == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(apSuite, writeBehind.SyncSetKeyValue("b", &values[0], sizeof(values[0])) == CHIP_NO_ERROR);
+
+    // Nothing reached the storage yet, and the writes to "a" were coalesced.
+    NL_TEST_ASSERT(apSuite, storage.mOperations.empty());
+    NL_TEST_ASSERT(apSuite, writeBehind.GetPendingCount() == 2);
+    NL_TEST_ASSERT(apSuite, writeBehind.SyncDoesKeyExist("b"));
+
+    // The size of a queued value can be queried like with the storage.
+    uint16_t size = 0;
+    NL_TEST_ASSERT(apSuite, writeBehind.SyncGetKeyValue("a", nullptr, size) == CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    NL_TEST_ASSERT(apSuite, writeBehind.SyncFlush() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writeBehind.GetPendingCount() == 0);
+    NL_TEST_ASSERT(apSuite, storage.mOperations == std::vector<std::string>({ "set:a", "set:b" }));
+    NL_TEST_ASSERT(apSuite, ReadByte(storage, "a", err) == 3 && err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, ReadByte(storage, "b", err) == 1 && err == CHIP_NO_ERROR);
+}
+
+void TestDelete(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    RecordingStorage storage;
+    WriteBehindStorageDelegate writeBehind(storage, ctx.GetSystemLayer(), 60000_ms32);
+    const uint8_t value = 7;
+    CHIP_ERROR err;
+
+    NL_TEST_ASSERT(apSuite, storage.SyncSetKeyValue("stored", &value, sizeof(value)) == CHIP_NO_ERROR);
+    storage.mOperations.clear();
+
+    NL_TEST_ASSERT(apSuite, writeBehind.SyncDeleteKeyValue("missing") == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+
+    NL_TEST_ASSERT(apSuite, writeBehind.SyncDeleteKeyValue("stored") == CHIP_NO_ERROR);
+    ReadByte(writeBehind, "stored", err);
+    NL_TEST_ASSERT(apSuite, err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+    NL_TEST_ASSERT(apSuite, writeBehind.SyncDeleteKeyValue("stored") == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+
+    // A key written and deleted before being flushed never needs to exist in the storage.
+    NL_TEST_ASSERT(apSuite, writeBehind.SyncSetKeyValue("transient", &value, sizeof(value)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writeBehind.SyncDeleteKeyValue("transient") == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(apSuite, writeBehind.SyncFlush() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writeBehind.GetFlushErrorCount() == 0);
+    NL_TEST_ASSERT(apSuite, !storage.HasKey("stored"));
+    NL_TEST_ASSERT(apSuite, !storage.HasKey("transient"));
+}
+
+void TestBarrier(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    RecordingStorage storage;
+    WriteBehindStorageDelegate writeBehind(storage, ctx.GetSystemLayer(), 60000_ms32);
+    const uint8_t first  = 1;
+    const uint8_t second = 2;
+    CHIP_ERROR err;
+
+    NL_TEST_ASSERT(apSuite, writeBehind.SyncSetKeyValue("a", &first, sizeof(first)) == CHIP_NO_ERROR);
+    writeBehind.Barrier();
+    NL_TEST_ASSERT(apSuite, writeBehind.SyncSetKeyValue("b", &first, sizeof(first)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writeBehind.SyncSetKeyValue("a", &second, sizeof(second)) == CHIP_NO_ERROR);
+
+    // The second write of "a" is not merged into the first one, which has to reach the storage before "b".
+    NL_TEST_ASSERT(apSuite, writeBehind.GetPendingCount() == 3);
+    NL_TEST_ASSERT(apSuite, ReadByte(writeBehind, "a", err) == second && err == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(apSuite, writeBehind.SyncFlush() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, storage.mOperations == std::vector<std::string>({ "set:a", "set:b", "set:a" }));
+    NL_TEST_ASSERT(apSuite, ReadByte(storage, "a", err) == second && err == CHIP_NO_ERROR);
+}
+
+void TestRewriteOrder(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    RecordingStorage storage;
+    WriteBehindStorageDelegate writeBehind(storage, ctx.GetSystemLayer(), 60000_ms32);
+    const uint8_t first  = 1;
+    const uint8_t second = 2;
+    CHIP_ERROR err;
+
+    NL_TEST_ASSERT(apSuite, writeBehind.SyncSetKeyValue("a", &first, sizeof(first)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writeBehind.SyncSetKeyValue("b", &first, sizeof(first)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writeBehind.SyncSetKeyValue("a", &second, sizeof(second)) == CHIP_NO_ERROR);
+
+    // The second write of "a" replaces the first one, and is applied after "b", which was written before it.
+    NL_TEST_ASSERT(apSuite, writeBehind.GetPendingCount() == 2);
+    NL_TEST_ASSERT(apSuite, writeBehind.SyncFlush() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, storage.mOperations == std::vector<std::string>({ "set:b", "set:a" }));
+    NL_TEST_ASSERT(apSuite, ReadByte(storage, "a", err) == second && err == CHIP_NO_ERROR);
+}
+
+void TestFlushTriggers(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    RecordingStorage storage;
+    const uint8_t value = 1;
+
+    {
+        WriteBehindStorageDelegate writeBehind(storage, ctx.GetSystemLayer(), 10_ms32);
+        NL_TEST_ASSERT(apSuite, writeBehind.SyncSetKeyValue("timer", &value, sizeof(value)) == CHIP_NO_ERROR);
+        ctx.GetIOContext().DriveIOUntil(1000_ms32, [&]() { return writeBehind.GetPendingCount() == 0; });
+        NL_TEST_ASSERT(apSuite, storage.HasKey("timer"));
+    }
+
+    {
+        WriteBehindStorageDelegate writeBehind(storage, ctx.GetSystemLayer(), 200_ms32,
+                                               WriteBehindStorageDelegate::FlushDelayStart::kLastOperation);
+        NL_TEST_ASSERT(apSuite, writeBehind.SyncSetKeyValue("settled", &value, sizeof(value)) == CHIP_NO_ERROR);
+        ctx.GetIOContext().DriveIOUntil(120_ms32, []() { return false; });
+        NL_TEST_ASSERT(apSuite, writeBehind.SyncSetKeyValue("settled", &value, sizeof(value)) == CHIP_NO_ERROR);
+
+        // The flush delay started again with the second write.
+        ctx.GetIOContext().DriveIOUntil(120_ms32, []() { return false; });
+        NL_TEST_ASSERT(apSuite, !storage.HasKey("settled"));
+        ctx.GetIOContext().DriveIOUntil(1000_ms32, [&]() { return writeBehind.GetPendingCount() == 0; });
+        NL_TEST_ASSERT(apSuite, storage.HasKey("settled"));
+    }
+
+    {
+        WriteBehindStorageDelegate writeBehind(storage, ctx.GetSystemLayer(), 60000_ms32);
+        char key[PersistentStorageDelegate::kKeyLengthMax + 1];
+
+        // A full queue is flushed before taking another operation.
+        for (size_t i = 0; i <= CHIP_CONFIG_WRITE_BEHIND_STORAGE_MAX_PENDING_WRITES; i++)
+        {
+            snprintf(key, sizeof(key), "key%u", static_cast<unsigned>(i));
+            NL_TEST_ASSERT(apSuite, writeBehind.SyncSetKeyValue(key, &value, sizeof(value)) == CHIP_NO_ERROR);
+        }
+        NL_TEST_ASSERT(apSuite, writeBehind.GetPendingCount() == 1);
+        NL_TEST_ASSERT(apSuite, storage.HasKey("key0"));
+
+        // Destroying the delegate flushes what is left.
+    }
+    NL_TEST_ASSERT(apSuite, storage.GetNumKeys() == CHIP_CONFIG_WRITE_BEHIND_STORAGE_MAX_PENDING_WRITES + 3);
+}
+
+// Mirrors the CHIP_CONFIG_WRITE_BEHIND_ATTRIBUTE_STORAGE setup of the server's attribute persister.
+void TestAttributePersisterFlushOnShutdown(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    RecordingStorage storage;
+    Optional<WriteBehindStorageDelegate> attributeStorage;
+    DefaultAttributePersistenceProvider persister;
+
+    NL_TEST_ASSERT(apSuite,
+                   persister.Init(&attributeStorage.Emplace(storage, ctx.GetSystemLayer(), 60000_ms32)) == CHIP_NO_ERROR);
+
+    const ConcreteAttributePath path(1, 6, 0);
+    const StorageKeyName key = DefaultStorageKeyAllocator::AttributeValue(path.mEndpointId, path.mClusterId, path.mAttributeId);
+    const uint8_t first      = 1;
+    const uint8_t second     = 2;
+
+    NL_TEST_ASSERT(apSuite, persister.WriteValue(path, ByteSpan(&first, sizeof(first))) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, persister.WriteValue(path, ByteSpan(&second, sizeof(second))) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, storage.mOperations.empty());
+
+    // Shutting down commits the last value once.
+    persister.Shutdown();
+    NL_TEST_ASSERT(apSuite, attributeStorage.Value().SyncFlush() == CHIP_NO_ERROR);
+    attributeStorage.ClearValue();
+
+    CHIP_ERROR err;
+    NL_TEST_ASSERT(apSuite, storage.mOperations == std::vector<std::string>({ std::string("set:") + key.KeyName() }));
+    NL_TEST_ASSERT(apSuite, ReadByte(storage, key.KeyName(), err) == second && err == CHIP_NO_ERROR);
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("TestReadYourWrites", TestReadYourWrites),
+    NL_TEST_DEF("TestDelete", TestDelete),
+    NL_TEST_DEF("TestBarrier", TestBarrier),
+    NL_TEST_DEF("TestRewriteOrder", TestRewriteOrder),
+    NL_TEST_DEF("TestFlushTriggers", TestFlushTriggers),
+    NL_TEST_DEF("TestAttributePersisterFlushOnShutdown", TestAttributePersisterFlushOnShutdown),
+    NL_TEST_SENTINEL()
+};
+
+nlTestSuite sSuite =
+{
+    "TestWriteBehindStorageDelegate",
+    &sTests[0],
+    TestContext::Initialize,
+    TestContext::Finalize
+};
+// clang-format on
+
+} // namespace
+
+int TestWriteBehindStorageDelegate()
+{
+    return chip::ExecuteTestsWithContext<TestContext>(&sSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestWriteBehindStorageDelegate)
@@ -17,6 +17,7 @@
 
 #include "app/util/common.h"
 #include <app/AttributePersistenceProvider.h>
+#include <app/ClusterInterfaceRegistry.h>
 #include <app/InteractionModelEngine.h>
 #include <app/reporting/reporting.h>
 #include <app/util/af.h>
@@ -66,6 +67,9 @@ uint8_t singletonAttributeData[ACTUAL_SINGLETONS_SIZE];
 
 uint16_t emberEndpointCount = 0;
 
+// Changed whenever the set of enabled endpoints, and so of their clusters and attributes, changes.
+uint32_t metadataStructureGeneration = 0;
+
 // If we have attributes that are more than 4 bytes, then
 // we need this data block for the defaults
 #if (defined(GENERATED_DEFAULTS) && GENERATED_DEFAULTS_COUNT)
@@ -118,7 +122,7 @@ DataVersion fixedEndpointDataVersions[ZAP_FIXED_ENDPOINT_DATA_VERSION_COUNT];
 #define endpointTypeMacro(x) (&(generatedEmberAfEndpointTypes[fixedEmberAfEndpointTypes[x]]))
 #endif
 
-app::AttributeAccessInterface * gAttributeAccessOverrides = nullptr;
+app::ClusterInterfaceRegistry<app::AttributeAccessInterface> gAttributeAccessOverrides;
 } // anonymous namespace
 
 //------------------------------------------------------------------------------
@@ -184,11 +188,14 @@ void emberAfEndpointConfigure()
         }
     }
 #endif
+
+    metadataStructureGeneration++;
 }
 
 void emberAfSetDynamicEndpointCount(uint16_t dynamicEndpointCount)
 {
     emberEndpointCount = static_cast<uint16_t>(FIXED_ENDPOINT_COUNT + dynamicEndpointCount);
+    metadataStructureGeneration++;
 }
 
 uint16_t emberAfGetDynamicIndexFromEndpoint(EndpointId id)
@@ -298,6 +305,11 @@ bool emberAfEndpointIndexIsEnabled(uint16_t index)
     return (emAfEndpoints[index].bitmask & EMBER_AF_ENDPOINT_ENABLED);
 }
 
+uint32_t emberAfMetadataStructureGeneration()
+{
+    return metadataStructureGeneration;
+}
+
 bool emberAfIsStringAttributeType(EmberAfAttributeType attributeType)
 {
     return (attributeType == ZCL_OCTET_STRING_ATTRIBUTE_TYPE || attributeType == ZCL_CHAR_STRING_ATTRIBUTE_TYPE);
@@ -391,33 +403,7 @@ static void shutdownEndpoint(EmberAfDefinedEndpoint * definedEndpoint)
 
     // Clear out any attribute access overrides registered for this
     // endpoint.
-    app::AttributeAccessInterface * prev = nullptr;
-    app::AttributeAccessInterface * cur  = gAttributeAccessOverrides;
-    while (cur)
-    {
-        app::AttributeAccessInterface * next = cur->GetNext();
-        if (cur->MatchesEndpoint(definedEndpoint->endpoint))
-        {
-            // Remove it from the list
-            if (prev)
-            {
-                prev->SetNext(next);
-            }
-            else
-            {
-                gAttributeAccessOverrides = next;
-            }
-
-            cur->SetNext(nullptr);
-
-            // Do not change prev in this case.
-        }
-        else
-        {
-            prev = cur;
-        }
-        cur = next;
-    }
+    gAttributeAccessOverrides.UnregisterAllForEndpoint(definedEndpoint->endpoint);
 }
 
 // Calls the init functions.
@@ -950,6 +936,11 @@ bool emberAfEndpointEnableDisable(EndpointId endpoint, bool enable)
         emAfEndpoints[index].bitmask &= EMBER_AF_ENDPOINT_DISABLED;
     }
 
+    if (currentlyEnabled != enable)
+    {
+        metadataStructureGeneration++;
+    }
+
     return true;
 }
 
@@ -1374,16 +1365,11 @@ EmberAfGenericClusterFunction emberAfFindClusterFunction(const EmberAfCluster *
 
 bool registerAttributeAccessOverride(app::AttributeAccessInterface * attrOverride)
 {
-    for (auto * cur = gAttributeAccessOverrides; cur; cur = cur->GetNext())
+    if (!gAttributeAccessOverrides.Register(attrOverride))
     {
-        if (cur->Matches(*attrOverride))
-        {
-            ChipLogError(Zcl, "Duplicate attribute override registration failed");
-            return false;
-        }
+        ChipLogError(Zcl, "Duplicate attribute override registration failed");
+        return false;
     }
-    attrOverride->SetNext(gAttributeAccessOverrides);
-    gAttributeAccessOverrides = attrOverride;
     return true;
 }
 
@@ -1391,15 +1377,7 @@ namespace chip {
 namespace app {
 app::AttributeAccessInterface * GetAttributeAccessOverride(EndpointId endpointId, ClusterId clusterId)
 {
-    for (app::AttributeAccessInterface * cur = gAttributeAccessOverrides; cur; cur = cur->GetNext())
-    {
-        if (cur->Matches(endpointId, clusterId))
-        {
-            return cur;
-        }
-    }
-
-    return nullptr;
+    return gAttributeAccessOverrides.Find(endpointId, clusterId);
 }
 } // namespace app
 } // namespace chip
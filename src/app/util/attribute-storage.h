@@ -238,6 +238,10 @@ EmberAfStatus emberAfSetDynamicEndpoint(uint16_t index, chip::EndpointId id, con
 chip::EndpointId emberAfClearDynamicEndpoint(uint16_t index);
 uint16_t emberAfGetDynamicIndexFromEndpoint(chip::EndpointId id);
 
+// Returns a number that changes whenever endpoints are enabled or disabled, or the endpoint count changes, i.e. whenever the
+// set of endpoints, clusters and attributes reported by the functions below may change.
+uint32_t emberAfMetadataStructureGeneration();
+
 // Get the number of attributes of the specific cluster under the endpoint.
 // Returns 0 if the cluster does not exist.
 uint16_t emberAfGetServerAttributeCount(chip::EndpointId endpoint, chip::ClusterId cluster);
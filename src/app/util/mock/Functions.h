@@ -36,5 +36,6 @@ CHIP_ERROR ReadSingleMockClusterData(FabricIndex aAccessingFabricIndex, const ap
                                      app::AttributeValueEncoder::AttributeEncodeState * apEncoderState);
 void BumpVersion();
 DataVersion GetVersion();
+void BumpMetadataStructureGeneration();
 } // namespace Test
 } // namespace chip
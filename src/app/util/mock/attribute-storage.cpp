@@ -94,6 +94,8 @@ uint8_t mockAttribute4[256]  = {
     0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0xa, 0xb, 0xc, 0xd, 0xe, 0xf, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0xa, 0xb, 0xc, 0xd, 0xe, 0xf,
 };
 
+uint32_t metadataGeneration = 0;
+
 } // namespace
 
 uint16_t emberAfEndpointCount()
@@ -164,6 +166,11 @@ uint16_t emberAfGetServerAttributeIndexByAttributeId(chip::EndpointId endpoint,
     return UINT16_MAX;
 }
 
+uint32_t emberAfMetadataStructureGeneration()
+{
+    return metadataGeneration;
+}
+
 bool emberAfContainsAttribute(chip::EndpointId endpoint, chip::ClusterId clusterId, chip::AttributeId attributeId)
 {
     return !(emberAfGetServerAttributeIndexByAttributeId(endpoint, clusterId, attributeId) == UINT16_MAX);
@@ -289,6 +296,11 @@ DataVersion GetVersion()
     return dataVersion;
 }
 
+void BumpMetadataStructureGeneration()
+{
+    metadataGeneration++;
+}
+
 CHIP_ERROR ReadSingleMockClusterData(FabricIndex aAccessingFabricIndex, const ConcreteAttributePath & aPath,
                                      AttributeReportIBs::Builder & aAttributeReports,
                                      AttributeValueEncoder::AttributeEncodeState * apEncoderState)
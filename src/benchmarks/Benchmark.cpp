@@ -0,0 +1,156 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "Benchmark.h"
+
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace chip {
+namespace Benchmark {
+namespace {
+
+constexpr size_t kBenchmarksMax                 = 64;
+constexpr uint32_t kDefaultMinTimeMs            = 500;
+constexpr uint64_t kMaxIterations               = 1000000000;
+constexpr std::chrono::nanoseconds kMinTimeSlop = std::chrono::milliseconds(1);
+
+struct RegisteredBenchmark
+{
+    const char * mName;
+    BenchmarkFunction mFunction;
+};
+
+RegisteredBenchmark gBenchmarks[kBenchmarksMax];
+size_t gBenchmarkCount = 0;
+
+const char * ArgValue(const char * arg, const char * prefix)
+{
+    size_t prefixLength = strlen(prefix);
+    return (strncmp(arg, prefix, prefixLength) == 0) ? arg + prefixLength : nullptr;
+}
+
+// Run the benchmark with more and more iterations until it runs for at least minTime, like Google Benchmark does.
+bool RunBenchmark(const RegisteredBenchmark & benchmark, std::chrono::nanoseconds minTime)
+{
+    uint64_t iterations = 1;
+    while (true)
+    {
+        State state(iterations);
+        benchmark.mFunction(state);
+
+        if (state.GetError() != nullptr)
+        {
+            printf("{\"name\": \"%s\", \"error\": \"%s\"}\n", benchmark.mName, state.GetError());
+            return false;
+        }
+
+        std::chrono::nanoseconds elapsed = state.GetElapsed();
+        if (elapsed + kMinTimeSlop >= minTime || iterations >= kMaxIterations)
+        {
+            double elapsedNs      = static_cast<double>(elapsed.count());
+            double nsPerIteration = elapsedNs / static_cast<double>(state.GetIterations());
+            double bytesPerSecond = 0;
+            if (elapsedNs > 0)
+            {
+                bytesPerSecond = static_cast<double>(state.GetBytesPerIteration() * state.GetIterations()) * 1e9 / elapsedNs;
+            }
+            printf("{\"name\": \"%s\", \"iterations\": %" PRIu64 ", \"ns_per_iteration\": %.1f, \"bytes_per_second\": %.0f",
+                   benchmark.mName, state.GetIterations(), nsPerIteration, bytesPerSecond);
+            for (size_t i = 0; state.GetCounterName(i) != nullptr; i++)
+            {
+                printf(", \"%s\": %" PRIu64, state.GetCounterName(i), state.GetCounterValue(i));
+            }
+            printf("}\n");
+            return true;
+        }
+
+        // Aim for the minimum time with some margin, growing at most 10x per run as the first ones are noisy.
+        uint64_t next = iterations * 10;
+        if (elapsed.count() > 0)
+        {
+            double estimate = static_cast<double>(iterations) * 1.4 * static_cast<double>(minTime.count()) /
+                static_cast<double>(elapsed.count());
+            if (estimate < static_cast<double>(next))
+            {
+                next = static_cast<uint64_t>(estimate);
+            }
+        }
+        iterations = chip::min(chip::max(next, iterations + 1), kMaxIterations);
+    }
+}
+
+} // namespace
+
+CHIP_ERROR RegisterBenchmark(const char * name, BenchmarkFunction function)
+{
+    if (gBenchmarkCount >= kBenchmarksMax)
+    {
+        ChipLogError(Support, "Benchmark limit reached");
+        return CHIP_ERROR_NO_MEMORY;
+    }
+
+    gBenchmarks[gBenchmarkCount++] = { name, function };
+    return CHIP_NO_ERROR;
+}
+
+int RunRegisteredBenchmarks(int argc, char ** argv)
+{
+    const char * filter = nullptr;
+    uint32_t minTimeMs  = kDefaultMinTimeMs;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char * value;
+        if ((value = ArgValue(argv[i], "--filter=")) != nullptr)
+        {
+            filter = value;
+        }
+        else if ((value = ArgValue(argv[i], "--min-time-ms=")) != nullptr)
+        {
+            minTimeMs = static_cast<uint32_t>(strtoul(value, nullptr, 10));
+        }
+        else
+        {
+            fprintf(stderr, "Usage: %s [--filter=<substring>] [--min-time-ms=<ms>]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    int status = EXIT_SUCCESS;
+    for (size_t i = 0; i < gBenchmarkCount; i++)
+    {
+        if (filter != nullptr && strstr(gBenchmarks[i].mName, filter) == nullptr)
+        {
+            continue;
+        }
+        if (!RunBenchmark(gBenchmarks[i], std::chrono::milliseconds(minTimeMs)))
+        {
+            status = EXIT_FAILURE;
+        }
+        fflush(stdout);
+    }
+    return status;
+}
+
+} // namespace Benchmark
+} // namespace chip
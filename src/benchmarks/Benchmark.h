@@ -0,0 +1,206 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a minimal harness for benchmarks of the CHIP stack.
+ *
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/CodeUtils.h>
+
+#include <chrono>
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * @def CHIP_REGISTER_BENCHMARK(FUNCTION)
+ *
+ * @brief
+ *   Registers a benchmark
+ *
+ * Adds a function of the signature void(*)(chip::Benchmark::State &) to the
+ * list of benchmarks run by chip::Benchmark::RunRegisteredBenchmarks(). The
+ * benchmark is named after the function.
+ *
+ * The function sets up its fixture, runs the measured code while
+ * State::KeepRunning() returns true, then tears the fixture down. Only the
+ * loop is timed, and the function is called again with more iterations until
+ * the loop runs for long enough to be measured.
+ *
+ * Example:
+ *
+ * @code
+ * void BenchmarkFoo(chip::Benchmark::State & state)
+ * {
+ *     Foo foo;
+ *     if (foo.Init() != CHIP_NO_ERROR)
+ *     {
+ *         state.SkipWithError("Foo::Init failed");
+ *         return;
+ *     }
+ *     while (state.KeepRunning())
+ *     {
+ *         foo.DoSomething();
+ *     }
+ * }
+ *
+ * CHIP_REGISTER_BENCHMARK(BenchmarkFoo)
+ * @endcode
+ */
+#define CHIP_REGISTER_BENCHMARK(FUNCTION)                                                                                          \
+    static void __attribute__((constructor)) Register##FUNCTION(void)                                                              \
+    {                                                                                                                              \
+        VerifyOrDie(chip::Benchmark::RegisterBenchmark(#FUNCTION, &FUNCTION) == CHIP_NO_ERROR);                                    \
+    }
+
+namespace chip {
+namespace Benchmark {
+
+class State
+{
+public:
+    explicit State(uint64_t maxIterations) : mMaxIterations(maxIterations) {}
+
+    /**
+     * Returns true while the measured code has to run again. The clock starts on the first call and stops when it returns
+     * false.
+     */
+    bool KeepRunning()
+    {
+        if (!mStarted)
+        {
+            mStarted = true;
+            ResumeTiming();
+        }
+        if (mError == nullptr && mIterations < mMaxIterations)
+        {
+            mIterations++;
+            return true;
+        }
+        PauseTiming();
+        return false;
+    }
+
+    /**
+     * Exclude what runs until ResumeTiming() from the measurement, e.g. resetting the fixture between iterations.
+     */
+    void PauseTiming()
+    {
+        if (mRunning)
+        {
+            mElapsed += Clock::now() - mStart;
+            mRunning = false;
+        }
+    }
+
+    void ResumeTiming()
+    {
+        if (!mRunning)
+        {
+            mStart   = Clock::now();
+            mRunning = true;
+        }
+    }
+
+    /**
+     * Report throughput: the number of bytes handled by one iteration.
+     */
+    void SetBytesPerIteration(uint64_t bytes) { mBytesPerIteration = bytes; }
+
+    /**
+     * Report an additional measurement, e.g. memory use. aName must be a string literal, it is reported in the output
+     * along with the last value set. At most kMaxCounters counters are reported.
+     */
+    void SetCounter(const char * aName, uint64_t aValue)
+    {
+        for (size_t i = 0; i < kMaxCounters; i++)
+        {
+            if (mCounters[i].mName == nullptr || strcmp(mCounters[i].mName, aName) == 0)
+            {
+                mCounters[i] = { aName, aValue };
+                return;
+            }
+        }
+    }
+
+    /**
+     * Abort the benchmark. aMessage must be a string literal, it is reported in the output.
+     */
+    void SkipWithError(const char * aMessage)
+    {
+        if (mError == nullptr)
+        {
+            mError = aMessage;
+        }
+    }
+
+    uint64_t GetIterations() const { return mIterations; }
+    uint64_t GetBytesPerIteration() const { return mBytesPerIteration; }
+    const char * GetError() const { return mError; }
+    const char * GetCounterName(size_t index) const { return (index < kMaxCounters) ? mCounters[index].mName : nullptr; }
+    uint64_t GetCounterValue(size_t index) const { return mCounters[index].mValue; }
+    std::chrono::nanoseconds GetElapsed() const { return std::chrono::duration_cast<std::chrono::nanoseconds>(mElapsed); }
+
+    static constexpr size_t kMaxCounters = 4;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Counter
+    {
+        const char * mName = nullptr;
+        uint64_t mValue    = 0;
+    };
+
+    const uint64_t mMaxIterations;
+    uint64_t mIterations        = 0;
+    uint64_t mBytesPerIteration = 0;
+    const char * mError         = nullptr;
+    bool mStarted               = false;
+    bool mRunning               = false;
+    Clock::time_point mStart;
+    Clock::duration mElapsed = Clock::duration::zero();
+    Counter mCounters[kMaxCounters];
+};
+
+typedef void (*BenchmarkFunction)(State & state);
+
+CHIP_ERROR RegisterBenchmark(const char * name, BenchmarkFunction function);
+
+/**
+ * Run the registered benchmarks and print one JSON object per line for each of them on stdout:
+ *
+ *   {"name": "BenchmarkFoo", "iterations": 1000, "ns_per_iteration": 1234.5, "bytes_per_second": 0}
+ *
+ * with one more member per counter set with State::SetCounter(), or {"name": ..., "error": "..."} for a benchmark that
+ * failed.
+ *
+ * Accepted arguments:
+ *   --filter=<substring>   only run the benchmarks whose name contains <substring>.
+ *   --min-time-ms=<ms>     run each benchmark for at least that long (default 500).
+ *
+ * Returns 0 if every benchmark that ran succeeded.
+ */
+int RunRegisteredBenchmarks(int argc, char ** argv);
+
+} // namespace Benchmark
+} // namespace chip
@@ -0,0 +1,118 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmarks of AccessControl::Check against a full access control list.
+ *
+ */
+
+#include "Benchmark.h"
+
+#include <access/AccessControl.h>
+#include <access/examples/ExampleAccessControlDelegate.h>
+#include <lib/support/CHIPMem.h>
+
+using namespace chip;
+using namespace chip::Access;
+
+namespace {
+
+constexpr FabricIndex kFabricIndex = 1;
+constexpr NodeId kAdminNodeId      = 0x0123456789ABCDEF;
+constexpr NodeId kSubjectNodeId    = 0x0123456789ABCDF0;
+constexpr ClusterId kOnOffCluster  = 0x0000'0006;
+constexpr EndpointId kEndpoint     = 1;
+
+class DeviceTypeResolver : public AccessControl::DeviceTypeResolver
+{
+public:
+    bool IsDeviceTypeOnEndpoint(DeviceTypeId deviceType, EndpointId endpoint) override { return false; }
+} gDeviceTypeResolver;
+
+CHIP_ERROR AddEntry(AccessControl & accessControl, Privilege privilege, NodeId subject, ClusterId cluster)
+{
+    AccessControl::Entry entry;
+    ReturnErrorOnFailure(accessControl.PrepareEntry(entry));
+    ReturnErrorOnFailure(entry.SetFabricIndex(kFabricIndex));
+    ReturnErrorOnFailure(entry.SetPrivilege(privilege));
+    ReturnErrorOnFailure(entry.SetAuthMode(AuthMode::kCase));
+    ReturnErrorOnFailure(entry.AddSubject(nullptr, subject));
+    if (cluster != kInvalidClusterId)
+    {
+        using Target = AccessControl::Entry::Target;
+        ReturnErrorOnFailure(
+            entry.AddTarget(nullptr, { .flags = Target::kCluster | Target::kEndpoint, .cluster = cluster, .endpoint = kEndpoint }));
+    }
+    return accessControl.CreateEntry(nullptr, entry);
+}
+
+// Fill the fabric's access control list so that the subject only matches its last entry.
+CHIP_ERROR InitAccessControl(AccessControl & accessControl)
+{
+    ReturnErrorOnFailure(accessControl.Init(Examples::GetAccessControlDelegate(), gDeviceTypeResolver));
+
+    size_t maxEntries;
+    ReturnErrorOnFailure(accessControl.GetMaxEntriesPerFabric(maxEntries));
+    ReturnErrorOnFailure(AddEntry(accessControl, Privilege::kAdminister, kAdminNodeId, kInvalidClusterId));
+    for (size_t i = 2; i < maxEntries; i++)
+    {
+        ReturnErrorOnFailure(AddEntry(accessControl, Privilege::kOperate, kAdminNodeId + i, static_cast<ClusterId>(0x0100 + i)));
+    }
+    return AddEntry(accessControl, Privilege::kView, kSubjectNodeId, kOnOffCluster);
+}
+
+void RunCheck(Benchmark::State & state, NodeId subject, Privilege privilege, CHIP_ERROR expected)
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    AccessControl accessControl;
+    if (InitAccessControl(accessControl) != CHIP_NO_ERROR)
+    {
+        state.SkipWithError("Failed to fill the access control list");
+    }
+
+    SubjectDescriptor subjectDescriptor = { .fabricIndex = kFabricIndex, .authMode = AuthMode::kCase, .subject = subject };
+    RequestPath requestPath             = { .cluster = kOnOffCluster, .endpoint = kEndpoint };
+
+    while (state.KeepRunning())
+    {
+        if (accessControl.Check(subjectDescriptor, requestPath, privilege) != expected)
+        {
+            state.SkipWithError("Unexpected access control decision");
+        }
+    }
+
+    accessControl.Finish();
+    Platform::MemoryShutdown();
+}
+
+void BenchmarkAccessControlCheckAllowed(Benchmark::State & state)
+{
+    RunCheck(state, kSubjectNodeId, Privilege::kView, CHIP_NO_ERROR);
+}
+
+void BenchmarkAccessControlCheckDenied(Benchmark::State & state)
+{
+    RunCheck(state, kSubjectNodeId, Privilege::kOperate, CHIP_ERROR_ACCESS_DENIED);
+}
+
+} // namespace
+
+CHIP_REGISTER_BENCHMARK(BenchmarkAccessControlCheckAllowed)
+CHIP_REGISTER_BENCHMARK(BenchmarkAccessControlCheckDenied)
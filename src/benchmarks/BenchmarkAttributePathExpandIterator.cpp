@@ -0,0 +1,102 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmarks of wildcard path expansion by AttributePathExpandIterator over the mock attribute storage.
+ *
+ */
+
+#include "Benchmark.h"
+
+#include <app/AttributePathExpandIterator.h>
+#include <app/ObjectList.h>
+#include <app/util/mock/Constants.h>
+#include <app/util/mock/Functions.h>
+#include <lib/support/CHIPMem.h>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+// Expand the path once per iteration. If rebuild is set, the expansion table is rebuilt for every iteration, as it is after the
+// endpoint configuration changes.
+void RunExpansion(Benchmark::State & state, const AttributePathParams & attributePath, bool rebuild)
+{
+    if (Platform::MemoryInit() != CHIP_NO_ERROR)
+    {
+        state.SkipWithError("Failed to initialize memory");
+        return;
+    }
+
+    ObjectList<AttributePathParams> pathList;
+    pathList.mValue = attributePath;
+
+    uint64_t pathCount = 0;
+    while (state.KeepRunning())
+    {
+        if (rebuild)
+        {
+            Test::BumpMetadataStructureGeneration();
+        }
+
+        ConcreteAttributePath path;
+        pathCount = 0;
+        for (AttributePathExpandIterator iterator(&pathList); iterator.Get(path); iterator.Next())
+        {
+            pathCount++;
+        }
+        if (pathCount == 0)
+        {
+            state.SkipWithError("The path did not expand");
+            break;
+        }
+    }
+    state.SetCounter("paths", pathCount);
+
+    AttributePathExpandIterator::ReleaseExpansionTable();
+    Platform::MemoryShutdown();
+}
+
+// */*/*
+void BenchmarkAttributePathExpandAllWildcard(Benchmark::State & state)
+{
+    RunExpansion(state, AttributePathParams(), false);
+}
+
+// */*/* right after the endpoint configuration changed.
+void BenchmarkAttributePathExpandAllWildcardRebuild(Benchmark::State & state)
+{
+    RunExpansion(state, AttributePathParams(), true);
+}
+
+// */cluster/attribute, which looks up the cluster and attribute on every endpoint.
+void BenchmarkAttributePathExpandWildcardEndpoint(Benchmark::State & state)
+{
+    AttributePathParams attributePath;
+    attributePath.mClusterId   = Test::MockClusterId(3);
+    attributePath.mAttributeId = Test::MockAttributeId(3);
+    RunExpansion(state, attributePath, false);
+}
+
+} // namespace
+
+CHIP_REGISTER_BENCHMARK(BenchmarkAttributePathExpandAllWildcard)
+CHIP_REGISTER_BENCHMARK(BenchmarkAttributePathExpandAllWildcardRebuild)
+CHIP_REGISTER_BENCHMARK(BenchmarkAttributePathExpandWildcardEndpoint)
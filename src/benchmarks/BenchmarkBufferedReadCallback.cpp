@@ -0,0 +1,176 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmark of BufferedReadCallback reassembling a chunked list of 1000 ACL-like entries, delivered one
+ *      list item per AttributeDataIB as a publisher does when the list does not fit in a report.
+ *
+ */
+
+#include "Benchmark.h"
+
+#include <app/BufferedReadCallback.h>
+#include <lib/core/TLV.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/ScopedBuffer.h>
+
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+#include <malloc.h>
+#define BENCHMARK_HEAP_IN_USE 1
+#endif
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+constexpr size_t kListLength    = 1000;
+constexpr size_t kEntrySize     = 64;
+constexpr size_t kEmptyListSize = 8;
+
+uint64_t HeapInUse()
+{
+#if BENCHMARK_HEAP_IN_USE
+    return static_cast<uint64_t>(mallinfo2().uordblks);
+#else
+    return 0;
+#endif
+}
+
+CHIP_ERROR EncodeEntries(TLV::TLVWriter & writer)
+{
+    for (size_t i = 0; i < kListLength; i++)
+    {
+        TLV::TLVType entry;
+        TLV::TLVType subjects;
+        ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, entry));
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(1), static_cast<uint8_t>(5)));
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(2), static_cast<uint8_t>(2)));
+        ReturnErrorOnFailure(writer.StartContainer(TLV::ContextTag(3), TLV::kTLVType_Array, subjects));
+        ReturnErrorOnFailure(writer.Put(TLV::AnonymousTag(), static_cast<uint64_t>(0x0102030405060000 + i)));
+        ReturnErrorOnFailure(writer.EndContainer(subjects));
+        ReturnErrorOnFailure(writer.PutNull(TLV::ContextTag(4)));
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(254), static_cast<uint8_t>(1)));
+        ReturnErrorOnFailure(writer.EndContainer(entry));
+    }
+    return CHIP_NO_ERROR;
+}
+
+// Receives the reassembled list, and records how much heap was in use at that point, when the whole list is buffered.
+class ListConsumer : public ReadClient::Callback
+{
+public:
+    void OnAttributeData(const ConcreteDataAttributePath &, TLV::TLVReader * apData, const StatusIB &) override
+    {
+        mHeapInUse = HeapInUse();
+        mLength    = 0;
+
+        TLV::TLVType list;
+        if (apData == nullptr || apData->EnterContainer(list) != CHIP_NO_ERROR)
+        {
+            return;
+        }
+        while (apData->Next() == CHIP_NO_ERROR)
+        {
+            mLength++;
+        }
+    }
+
+    void OnDone(ReadClient *) override {}
+
+    uint64_t mHeapInUse = 0;
+    size_t mLength      = 0;
+};
+
+void BenchmarkBufferedReadCallbackChunkedList(Benchmark::State & state)
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    {
+        Platform::ScopedMemoryBuffer<uint8_t> entries;
+        Platform::ScopedMemoryBuffer<uint8_t> emptyList;
+        size_t entriesLength = kListLength * kEntrySize;
+        VerifyOrDie(entries.Alloc(entriesLength) && emptyList.Alloc(kEmptyListSize));
+
+        TLV::TLVWriter writer;
+        writer.Init(entries.Get(), entriesLength);
+        if (EncodeEntries(writer) != CHIP_NO_ERROR || writer.Finalize() != CHIP_NO_ERROR)
+        {
+            state.SkipWithError("Encoding failed");
+        }
+        entriesLength = writer.GetLengthWritten();
+
+        TLV::TLVType list;
+        writer.Init(emptyList.Get(), kEmptyListSize);
+        if (writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Array, list) != CHIP_NO_ERROR ||
+            writer.EndContainer(list) != CHIP_NO_ERROR || writer.Finalize() != CHIP_NO_ERROR)
+        {
+            state.SkipWithError("Encoding failed");
+        }
+        size_t emptyListLength = writer.GetLengthWritten();
+
+        ListConsumer consumer;
+        BufferedReadCallback bufferedCallback(consumer);
+        ReadClient::Callback & callback = bufferedCallback;
+        uint64_t heapBaseline           = HeapInUse();
+
+        while (state.KeepRunning())
+        {
+            ConcreteDataAttributePath path(0, 0x001F, 0);
+            TLV::TLVReader reader;
+
+            callback.OnReportBegin();
+
+            path.mListOp = ConcreteDataAttributePath::ListOperation::ReplaceAll;
+            reader.Init(emptyList.Get(), emptyListLength);
+            if (reader.Next() != CHIP_NO_ERROR)
+            {
+                state.SkipWithError("Invalid empty list");
+            }
+            callback.OnAttributeData(path, &reader, StatusIB());
+
+            path.mListOp = ConcreteDataAttributePath::ListOperation::AppendItem;
+            reader.Init(entries.Get(), entriesLength);
+            while (reader.Next() == CHIP_NO_ERROR)
+            {
+                callback.OnAttributeData(path, &reader, StatusIB());
+            }
+
+            callback.OnReportEnd();
+
+            if (consumer.mLength != kListLength)
+            {
+                state.SkipWithError("Unexpected list length");
+            }
+        }
+
+        state.SetBytesPerIteration(entriesLength);
+#if BENCHMARK_HEAP_IN_USE
+        state.SetCounter("heap_bytes_at_dispatch", consumer.mHeapInUse - heapBaseline);
+#else
+        (void) heapBaseline;
+#endif
+    }
+
+    Platform::MemoryShutdown();
+}
+
+} // namespace
+
+CHIP_REGISTER_BENCHMARK(BenchmarkBufferedReadCallbackChunkedList)
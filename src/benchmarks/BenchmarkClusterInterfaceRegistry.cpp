@@ -0,0 +1,142 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmarks of the attribute access override lookup done for every attribute read and written, on a bridge that
+ *      registers an AttributeAccessInterface per cluster of each of its dynamic endpoints.
+ *
+ */
+
+#include "Benchmark.h"
+
+#include <app/AttributeAccessInterface.h>
+#include <app/ClusterInterfaceRegistry.h>
+
+#include <vector>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+// A bridge exposing kBridgedEndpointCount devices, with an override for each of their kClustersPerEndpoint clusters.
+constexpr EndpointId kFirstBridgedEndpoint = 3;
+constexpr size_t kBridgedEndpointCount     = 100;
+constexpr size_t kClustersPerEndpoint      = 10;
+constexpr size_t kRegistrationCount        = kBridgedEndpointCount * kClustersPerEndpoint;
+
+// Bucket count of a registry sized for such a bridge.
+constexpr size_t kBridgeBucketCount = 256;
+
+class BridgedAttributeAccess : public AttributeAccessInterface
+{
+public:
+    BridgedAttributeAccess(EndpointId aEndpointId, ClusterId aClusterId) :
+        AttributeAccessInterface(MakeOptional(aEndpointId), aClusterId)
+    {}
+
+    CHIP_ERROR Read(const ConcreteReadAttributePath & aPath, AttributeValueEncoder & aEncoder) override { return CHIP_NO_ERROR; }
+};
+
+EndpointId BridgedEndpoint(size_t index)
+{
+    return static_cast<EndpointId>(kFirstBridgedEndpoint + index / kClustersPerEndpoint);
+}
+
+ClusterId BridgedCluster(size_t index)
+{
+    return static_cast<ClusterId>(index % kClustersPerEndpoint);
+}
+
+// Look up the override of one path per iteration, going through the registered paths in turn. Paths of clusters without an
+// override, which are served from attribute storage, use a cluster id past the registered ones.
+template <size_t kBucketCount>
+void RunLookups(Benchmark::State & state, bool registered)
+{
+    ClusterInterfaceRegistry<AttributeAccessInterface, kBucketCount> registry;
+
+    // The registry links the overrides, so they must not move once registered.
+    std::vector<BridgedAttributeAccess> overrides;
+    overrides.reserve(kRegistrationCount);
+    for (size_t i = 0; i < kRegistrationCount; i++)
+    {
+        overrides.emplace_back(BridgedEndpoint(i), BridgedCluster(i));
+        if (!registry.Register(&overrides.back()))
+        {
+            state.SkipWithError("Failed to register the overrides");
+        }
+    }
+
+    const ClusterId clusterIdOffset = registered ? 0 : kClustersPerEndpoint;
+    size_t index                    = 0;
+    while (state.KeepRunning())
+    {
+        AttributeAccessInterface * expected = registered ? &overrides[index] : nullptr;
+        if (registry.Find(BridgedEndpoint(index), BridgedCluster(index) + clusterIdOffset) != expected)
+        {
+            state.SkipWithError("Unexpected override");
+            break;
+        }
+        index = (index + 1) % kRegistrationCount;
+    }
+    state.SetCounter("registrations", kRegistrationCount);
+    state.SetCounter("buckets", kBucketCount);
+
+    registry.Clear();
+}
+
+// A single bucket, i.e. the list of every registered override that lookups used to walk.
+void BenchmarkClusterInterfaceRegistryList(Benchmark::State & state)
+{
+    RunLookups<1>(state, true);
+}
+
+void BenchmarkClusterInterfaceRegistryListNoOverride(Benchmark::State & state)
+{
+    RunLookups<1>(state, false);
+}
+
+void BenchmarkClusterInterfaceRegistryDefaultBuckets(Benchmark::State & state)
+{
+    RunLookups<CHIP_CONFIG_CLUSTER_INTERFACE_REGISTRY_BUCKETS>(state, true);
+}
+
+void BenchmarkClusterInterfaceRegistryDefaultBucketsNoOverride(Benchmark::State & state)
+{
+    RunLookups<CHIP_CONFIG_CLUSTER_INTERFACE_REGISTRY_BUCKETS>(state, false);
+}
+
+void BenchmarkClusterInterfaceRegistryBridgeBuckets(Benchmark::State & state)
+{
+    RunLookups<kBridgeBucketCount>(state, true);
+}
+
+void BenchmarkClusterInterfaceRegistryBridgeBucketsNoOverride(Benchmark::State & state)
+{
+    RunLookups<kBridgeBucketCount>(state, false);
+}
+
+} // namespace
+
+CHIP_REGISTER_BENCHMARK(BenchmarkClusterInterfaceRegistryList)
+CHIP_REGISTER_BENCHMARK(BenchmarkClusterInterfaceRegistryListNoOverride)
+CHIP_REGISTER_BENCHMARK(BenchmarkClusterInterfaceRegistryDefaultBuckets)
+CHIP_REGISTER_BENCHMARK(BenchmarkClusterInterfaceRegistryDefaultBucketsNoOverride)
+CHIP_REGISTER_BENCHMARK(BenchmarkClusterInterfaceRegistryBridgeBuckets)
+CHIP_REGISTER_BENCHMARK(BenchmarkClusterInterfaceRegistryBridgeBucketsNoOverride)
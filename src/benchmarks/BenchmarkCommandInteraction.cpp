@@ -0,0 +1,167 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmarks of the round trips of an invoke of many commands, sent in a single invoke request or in one invoke
+ *      request per command, over the loopback transport.
+ *
+ */
+
+#include "Benchmark.h"
+
+#include <app/CommandHandler.h>
+#include <app/CommandSender.h>
+#include <app/InteractionModelEngine.h>
+#include <app/tests/AppTestContext.h>
+#include <protocols/interaction_model/Constants.h>
+
+#include <memory>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace chip {
+namespace app {
+
+// The benchmarks serve every command on every endpoint, and answer each of them with a success status.
+Protocols::InteractionModel::Status ServerClusterCommandExists(const ConcreteCommandPath & aCommandPath)
+{
+    return Protocols::InteractionModel::Status::Success;
+}
+
+void DispatchSingleClusterCommand(const ConcreteCommandPath & aCommandPath, TLV::TLVReader & aReader,
+                                  CommandHandler * apCommandObj)
+{
+    apCommandObj->AddStatus(aCommandPath, Protocols::InteractionModel::Status::Success);
+}
+
+} // namespace app
+} // namespace chip
+
+namespace {
+
+// Number of commands of one invoke, e.g. a scene recalled on every light of a large room.
+constexpr EndpointId kCommandCount = 50;
+
+constexpr ClusterId kOnOffClusterId = 0x0006;
+constexpr CommandId kToggleCommandId = 0x0002;
+
+class CommandCallback : public CommandSender::Callback
+{
+public:
+    void OnResponse(CommandSender * apCommandSender, const ConcreteCommandPath & aPath, const StatusIB & aStatusIB,
+                    TLV::TLVReader * apData) override
+    {
+        mResponseCount++;
+    }
+
+    void OnError(const CommandSender * apCommandSender, CHIP_ERROR aError) override { mError = aError; }
+
+    void OnDone(CommandSender * apCommandSender) override { mDoneCount++; }
+
+    size_t mResponseCount = 0;
+    size_t mDoneCount     = 0;
+    CHIP_ERROR mError     = CHIP_NO_ERROR;
+};
+
+// Add the command toggling the light on aEndpointId to aCommandSender.
+CHIP_ERROR AddToggleCommand(CommandSender & aCommandSender, EndpointId aEndpointId)
+{
+    CommandPathParams path(aEndpointId, 0 /* group */, kOnOffClusterId, kToggleCommandId, CommandPathFlags::kEndpointIdValid);
+    ReturnErrorOnFailure(aCommandSender.PrepareCommand(path));
+    return aCommandSender.FinishCommand();
+}
+
+// Invoke kCommandCount commands per iteration, all of them in the same invoke request if aBatched, or one invoke request at a
+// time otherwise. The messages counter is the number of messages the loopback transport carried per iteration, including the
+// acknowledgements.
+void RunInvokes(Benchmark::State & state, bool aBatched)
+{
+    std::unique_ptr<Test::AppContext> ctx(new Test::AppContext());
+    if (ctx->Init() != CHIP_NO_ERROR)
+    {
+        state.SkipWithError("Failed to initialize the app context");
+        return;
+    }
+
+    {
+        const EndpointId requestCount       = aBatched ? 1 : kCommandCount;
+        const EndpointId commandsPerRequest = aBatched ? kCommandCount : 1;
+        const uint32_t sentMessageCount     = ctx->GetLoopback().mSentMessageCount;
+
+        CommandCallback callback;
+        while (state.KeepRunning())
+        {
+            callback.mResponseCount = 0;
+            callback.mDoneCount     = 0;
+            EndpointId endpointId   = 1;
+            for (EndpointId request = 0; request < requestCount; request++)
+            {
+                CommandSender commandSender(&callback, &ctx->GetExchangeManager());
+                CHIP_ERROR err = CHIP_NO_ERROR;
+                for (EndpointId command = 0; command < commandsPerRequest && err == CHIP_NO_ERROR; command++)
+                {
+                    err = AddToggleCommand(commandSender, endpointId++);
+                }
+                if (err == CHIP_NO_ERROR)
+                {
+                    err = commandSender.SendCommandRequest(ctx->GetSessionBobToAlice());
+                }
+                if (err != CHIP_NO_ERROR)
+                {
+                    state.SkipWithError("Failed to send the invoke request");
+                    break;
+                }
+                ctx->DrainAndServiceIO();
+            }
+
+            if (callback.mResponseCount != kCommandCount || callback.mDoneCount != requestCount ||
+                callback.mError != CHIP_NO_ERROR)
+            {
+                state.SkipWithError("Unexpected invoke result");
+                break;
+            }
+        }
+
+        state.SetCounter("commands", kCommandCount);
+        if (state.GetIterations() != 0)
+        {
+            state.SetCounter("messages", (ctx->GetLoopback().mSentMessageCount - sentMessageCount) / state.GetIterations());
+        }
+    }
+
+    ctx->Shutdown();
+}
+
+// Invoke the commands in one invoke request per command.
+void BenchmarkCommandInteractionSeparateInvokes(Benchmark::State & state)
+{
+    RunInvokes(state, false);
+}
+
+// Invoke the commands in a single invoke request.
+void BenchmarkCommandInteractionBatchedInvoke(Benchmark::State & state)
+{
+    RunInvokes(state, true);
+}
+
+} // namespace
+
+CHIP_REGISTER_BENCHMARK(BenchmarkCommandInteractionSeparateInvokes)
+CHIP_REGISTER_BENCHMARK(BenchmarkCommandInteractionBatchedInvoke)
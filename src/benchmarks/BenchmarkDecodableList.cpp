@@ -0,0 +1,332 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmarks of the decoding of list attributes into the DecodableLists of the generated cluster objects, iterated
+ *      or accessed at random positions, e.g. by a controller paging through a list.
+ *
+ */
+
+#include "Benchmark.h"
+
+#include <app-common/zap-generated/cluster-objects.h>
+#include <app/data-model/DecodableList.h>
+#include <app/data-model/Encode.h>
+#include <lib/core/TLV.h>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::Clusters;
+
+namespace {
+
+constexpr size_t kItemCount        = 64;
+constexpr size_t kBufferSize       = 4096;
+constexpr FabricIndex kFabricIndex = 1;
+
+// Standard and manufacturer specific clusters, e.g. the ServerList of a Descriptor.
+void FillItem(size_t i, ClusterId & item)
+{
+    item = static_cast<ClusterId>((i % 4 == 0) ? 0xFFF1'FC00 + i : 0x0003 + i);
+}
+
+uint64_t Checksum(ClusterId item)
+{
+    return item;
+}
+
+void FillItem(size_t i, Descriptor::Structs::DeviceTypeStruct::Type & item)
+{
+    item.deviceType = static_cast<DeviceTypeId>(0x0100 + i);
+    item.revision   = 1;
+}
+
+uint64_t Checksum(const Descriptor::Structs::DeviceTypeStruct::DecodableType & item)
+{
+    return item.deviceType + item.revision;
+}
+
+void FillItem(size_t i, AccessControl::Structs::AccessControlEntryStruct::Type & item)
+{
+    static const uint64_t kSubjects[] = { 0x0000'0000'0001'0001, 0x0000'0000'0001'0002, 0xFFFF'FFFF'FFFF'0003 };
+
+    item.privilege   = AccessControl::AccessControlEntryPrivilegeEnum::kOperate;
+    item.authMode    = AccessControl::AccessControlEntryAuthModeEnum::kCase;
+    item.fabricIndex = kFabricIndex;
+    item.subjects.SetNonNull(DataModel::List<const uint64_t>(kSubjects, 1 + i % 3));
+    item.targets.SetNull();
+}
+
+uint64_t Checksum(const AccessControl::Structs::AccessControlEntryStruct::DecodableType & item)
+{
+    return static_cast<uint64_t>(item.privilege) + item.fabricIndex;
+}
+
+template <typename Item, std::enable_if_t<!DataModel::IsFabricScoped<Item>::value, bool> = true>
+CHIP_ERROR EncodeItem(TLV::TLVWriter & writer, const Item & item)
+{
+    return DataModel::Encode(writer, TLV::AnonymousTag(), item);
+}
+
+template <typename Item, std::enable_if_t<DataModel::IsFabricScoped<Item>::value, bool> = true>
+CHIP_ERROR EncodeItem(TLV::TLVWriter & writer, const Item & item)
+{
+    return DataModel::EncodeForRead(writer, TLV::AnonymousTag(), kFabricIndex, item);
+}
+
+// A list of kItemCount items, encoded as in an attribute report.
+template <typename Item, typename DecodableItem>
+class EncodedList
+{
+public:
+    CHIP_ERROR Init()
+    {
+        TLV::TLVWriter writer;
+        TLV::TLVType list;
+        writer.Init(mBuffer);
+        ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Array, list));
+        for (size_t i = 0; i < kItemCount; i++)
+        {
+            Item item;
+            FillItem(i, item);
+            ReturnErrorOnFailure(EncodeItem(writer, item));
+        }
+        ReturnErrorOnFailure(writer.EndContainer(list));
+        ReturnErrorOnFailure(writer.Finalize());
+        mLength = writer.GetLengthWritten();
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR Decode(DataModel::DecodableList<DecodableItem> & decodableList) const
+    {
+        TLV::TLVReader reader;
+        reader.Init(mBuffer, mLength);
+        ReturnErrorOnFailure(reader.Next());
+        return decodableList.Decode(reader);
+    }
+
+    uint32_t GetLength() const { return mLength; }
+
+private:
+    uint8_t mBuffer[kBufferSize];
+    uint32_t mLength = 0;
+};
+
+// Decode the list and read all its items, once per iteration.
+template <typename Item, typename DecodableItem>
+void RunIterate(Benchmark::State & state)
+{
+    EncodedList<Item, DecodableItem> encodedList;
+    if (encodedList.Init() != CHIP_NO_ERROR)
+    {
+        state.SkipWithError("Encoding failed");
+        return;
+    }
+
+    volatile uint64_t sink = 0;
+    while (state.KeepRunning())
+    {
+        DataModel::DecodableList<DecodableItem> decodableList;
+        uint64_t checksum = 0;
+        if (encodedList.Decode(decodableList) != CHIP_NO_ERROR)
+        {
+            state.SkipWithError("Decoding failed");
+            break;
+        }
+
+        auto iter = decodableList.begin();
+        while (iter.Next())
+        {
+            checksum += Checksum(iter.GetValue());
+        }
+        if (iter.GetStatus() != CHIP_NO_ERROR)
+        {
+            state.SkipWithError("Decoding failed");
+            break;
+        }
+        sink = checksum;
+    }
+    (void) sink;
+
+    state.SetBytesPerIteration(encodedList.GetLength());
+    state.SetCounter("items", kItemCount);
+}
+
+// Decode the list and index it, once per iteration. This is what random access costs up front.
+template <typename Item, typename DecodableItem>
+void RunBuildIndex(Benchmark::State & state)
+{
+    EncodedList<Item, DecodableItem> encodedList;
+    if (encodedList.Init() != CHIP_NO_ERROR)
+    {
+        state.SkipWithError("Encoding failed");
+        return;
+    }
+
+    uint32_t offsets[kItemCount + 1];
+    while (state.KeepRunning())
+    {
+        DataModel::DecodableList<DecodableItem> decodableList;
+        if (encodedList.Decode(decodableList) != CHIP_NO_ERROR ||
+            decodableList.BuildIndex(Span<uint32_t>(offsets)) != CHIP_NO_ERROR)
+        {
+            state.SkipWithError("Indexing failed");
+            break;
+        }
+    }
+
+    state.SetBytesPerIteration(encodedList.GetLength());
+    state.SetCounter("items", kItemCount);
+}
+
+// Get the size of the list and one of its items, at a different position every iteration. Without an index, this means
+// counting the items and decoding all the items before the one wanted.
+template <typename Item, typename DecodableItem>
+void RunRandomAccess(Benchmark::State & state, bool indexed)
+{
+    EncodedList<Item, DecodableItem> encodedList;
+    DataModel::DecodableList<DecodableItem> decodableList;
+    uint32_t offsets[kItemCount + 1];
+    if (encodedList.Init() != CHIP_NO_ERROR || encodedList.Decode(decodableList) != CHIP_NO_ERROR ||
+        (indexed && decodableList.BuildIndex(Span<uint32_t>(offsets)) != CHIP_NO_ERROR))
+    {
+        state.SkipWithError("Decoding failed");
+        return;
+    }
+
+    volatile uint64_t sink = 0;
+    size_t position        = 0;
+    while (state.KeepRunning())
+    {
+        size_t size;
+        DecodableItem item;
+        if (decodableList.ComputeSize(&size) != CHIP_NO_ERROR || size != kItemCount)
+        {
+            state.SkipWithError("Unexpected list size");
+            break;
+        }
+
+        CHIP_ERROR err = CHIP_NO_ERROR;
+        if (indexed)
+        {
+            err = decodableList.Get(position, item);
+        }
+        else
+        {
+            auto iter = decodableList.begin();
+            for (size_t i = 0; i <= position && iter.Next(); i++)
+            {
+            }
+            err  = iter.GetStatus();
+            item = iter.GetValue();
+        }
+        if (err != CHIP_NO_ERROR)
+        {
+            state.SkipWithError("Decoding failed");
+            break;
+        }
+        sink = Checksum(item);
+
+        // Visit every position, in an order that is not sequential.
+        position = (position + 37) % kItemCount;
+    }
+    (void) sink;
+
+    state.SetCounter("items", kItemCount);
+}
+
+using DeviceTypeItem     = Descriptor::Structs::DeviceTypeStruct::Type;
+using AccessControlEntry = AccessControl::Structs::AccessControlEntryStruct::Type;
+using DecodableAclEntry  = AccessControl::Structs::AccessControlEntryStruct::DecodableType;
+
+void BenchmarkDecodableListClusterIdIterate(Benchmark::State & state)
+{
+    RunIterate<ClusterId, ClusterId>(state);
+}
+
+void BenchmarkDecodableListClusterIdBuildIndex(Benchmark::State & state)
+{
+    RunBuildIndex<ClusterId, ClusterId>(state);
+}
+
+void BenchmarkDecodableListClusterIdRandomAccess(Benchmark::State & state)
+{
+    RunRandomAccess<ClusterId, ClusterId>(state, false);
+}
+
+void BenchmarkDecodableListClusterIdRandomAccessIndexed(Benchmark::State & state)
+{
+    RunRandomAccess<ClusterId, ClusterId>(state, true);
+}
+
+void BenchmarkDecodableListDeviceTypeIterate(Benchmark::State & state)
+{
+    RunIterate<DeviceTypeItem, DeviceTypeItem>(state);
+}
+
+void BenchmarkDecodableListDeviceTypeBuildIndex(Benchmark::State & state)
+{
+    RunBuildIndex<DeviceTypeItem, DeviceTypeItem>(state);
+}
+
+void BenchmarkDecodableListDeviceTypeRandomAccess(Benchmark::State & state)
+{
+    RunRandomAccess<DeviceTypeItem, DeviceTypeItem>(state, false);
+}
+
+void BenchmarkDecodableListDeviceTypeRandomAccessIndexed(Benchmark::State & state)
+{
+    RunRandomAccess<DeviceTypeItem, DeviceTypeItem>(state, true);
+}
+
+// Fabric scoped, with a nested list.
+void BenchmarkDecodableListAccessControlEntryIterate(Benchmark::State & state)
+{
+    RunIterate<AccessControlEntry, DecodableAclEntry>(state);
+}
+
+void BenchmarkDecodableListAccessControlEntryBuildIndex(Benchmark::State & state)
+{
+    RunBuildIndex<AccessControlEntry, DecodableAclEntry>(state);
+}
+
+void BenchmarkDecodableListAccessControlEntryRandomAccess(Benchmark::State & state)
+{
+    RunRandomAccess<AccessControlEntry, DecodableAclEntry>(state, false);
+}
+
+void BenchmarkDecodableListAccessControlEntryRandomAccessIndexed(Benchmark::State & state)
+{
+    RunRandomAccess<AccessControlEntry, DecodableAclEntry>(state, true);
+}
+
+} // namespace
+
+CHIP_REGISTER_BENCHMARK(BenchmarkDecodableListClusterIdIterate)
+CHIP_REGISTER_BENCHMARK(BenchmarkDecodableListClusterIdBuildIndex)
+CHIP_REGISTER_BENCHMARK(BenchmarkDecodableListClusterIdRandomAccess)
+CHIP_REGISTER_BENCHMARK(BenchmarkDecodableListClusterIdRandomAccessIndexed)
+CHIP_REGISTER_BENCHMARK(BenchmarkDecodableListDeviceTypeIterate)
+CHIP_REGISTER_BENCHMARK(BenchmarkDecodableListDeviceTypeBuildIndex)
+CHIP_REGISTER_BENCHMARK(BenchmarkDecodableListDeviceTypeRandomAccess)
+CHIP_REGISTER_BENCHMARK(BenchmarkDecodableListDeviceTypeRandomAccessIndexed)
+CHIP_REGISTER_BENCHMARK(BenchmarkDecodableListAccessControlEntryIterate)
+CHIP_REGISTER_BENCHMARK(BenchmarkDecodableListAccessControlEntryBuildIndex)
+CHIP_REGISTER_BENCHMARK(BenchmarkDecodableListAccessControlEntryRandomAccess)
+CHIP_REGISTER_BENCHMARK(BenchmarkDecodableListAccessControlEntryRandomAccessIndexed)
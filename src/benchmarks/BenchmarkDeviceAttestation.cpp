@@ -0,0 +1,176 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmarks of the PAA lookup and Certification Declaration verification a commissioner does for every device it
+ *      commissions.
+ *
+ */
+
+#include "Benchmark.h"
+
+#include <credentials/CertificationDeclaration.h>
+#include <credentials/DeviceAttestationCredsProvider.h>
+#include <credentials/attestation_verifier/DefaultDeviceAttestationVerifier.h>
+#include <credentials/attestation_verifier/FileAttestationTrustStore.h>
+#include <credentials/examples/DeviceAttestationCredsExample.h>
+#include <credentials/tests/CHIPAttCert_test_vectors.h>
+#include <crypto/CHIPCryptoPAL.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace chip;
+using namespace chip::Credentials;
+using namespace chip::TestCerts;
+
+namespace {
+
+// Number of PAAs in the trust store of a commissioner that accepts the devices of every vendor.
+constexpr size_t kPaaCount = 500;
+
+using SubjectKeyId = std::array<uint8_t, Crypto::kSubjectKeyIdentifierLength>;
+
+// A directory of kPaaCount PAA certificates, each a copy of a test PAA with its own subject key identifier. The certificate
+// signatures no longer match, which the trust store does not check.
+class PaaDirectory
+{
+public:
+    ~PaaDirectory()
+    {
+        for (const std::string & path : mPaths)
+        {
+            unlink(path.c_str());
+        }
+        if (!mPath.empty())
+        {
+            rmdir(mPath.c_str());
+        }
+    }
+
+    CHIP_ERROR Init()
+    {
+        char path[] = "/tmp/chip-benchmark-paa-XXXXXX";
+        VerifyOrReturnError(mkdtemp(path) != nullptr, CHIP_ERROR_INTERNAL);
+        mPath = path;
+
+        SubjectKeyId skid;
+        MutableByteSpan skidSpan{ skid };
+        ReturnErrorOnFailure(Crypto::ExtractSKIDFromX509Cert(sTestCert_PAA_FFF1_Cert, skidSpan));
+
+        std::vector<uint8_t> certificate(sTestCert_PAA_FFF1_Cert.begin(), sTestCert_PAA_FFF1_Cert.end());
+        auto skidPosition = std::search(certificate.begin(), certificate.end(), skid.begin(), skid.end());
+        VerifyOrReturnError(skidPosition != certificate.end(), CHIP_ERROR_INTERNAL);
+
+        for (size_t i = 0; i < kPaaCount; i++)
+        {
+            skid[0] = static_cast<uint8_t>(i >> 8);
+            skid[1] = static_cast<uint8_t>(i);
+            std::copy(skid.begin(), skid.end(), skidPosition);
+            mSkids.push_back(skid);
+
+            std::string certificatePath = mPath + "/paa-" + std::to_string(i) + ".der";
+            FILE * file                 = fopen(certificatePath.c_str(), "wb");
+            VerifyOrReturnError(file != nullptr, CHIP_ERROR_INTERNAL);
+            mPaths.push_back(certificatePath);
+            const size_t written = fwrite(certificate.data(), 1, certificate.size(), file);
+            fclose(file);
+            VerifyOrReturnError(written == certificate.size(), CHIP_ERROR_INTERNAL);
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    const char * GetPath() const { return mPath.c_str(); }
+    const std::vector<SubjectKeyId> & GetSkids() const { return mSkids; }
+
+private:
+    std::string mPath;
+    std::vector<std::string> mPaths;
+    std::vector<SubjectKeyId> mSkids;
+};
+
+// Look up the PAA of one device per iteration, going through the PAAs of the store in turn.
+void BenchmarkDeviceAttestationPaaLookup(Benchmark::State & state)
+{
+    PaaDirectory directory;
+    if (directory.Init() != CHIP_NO_ERROR)
+    {
+        state.SkipWithError("Failed to write the PAA certificates");
+        return;
+    }
+
+    FileAttestationTrustStore trustStore(directory.GetPath());
+    if (trustStore.paaCount() != kPaaCount)
+    {
+        state.SkipWithError("Failed to load the PAA certificates");
+        return;
+    }
+
+    const std::vector<SubjectKeyId> & skids = directory.GetSkids();
+    uint8_t paaBuffer[kMaxDERCertLength];
+    size_t index = 0;
+    while (state.KeepRunning())
+    {
+        ByteSpan skid(skids[index].data(), skids[index].size());
+        MutableByteSpan paa{ paaBuffer };
+        if (trustStore.GetProductAttestationAuthorityCert(skid, paa) != CHIP_NO_ERROR ||
+            paa.size() != sTestCert_PAA_FFF1_Cert.size())
+        {
+            state.SkipWithError("FileAttestationTrustStore::GetProductAttestationAuthorityCert failed");
+            break;
+        }
+        index = (index + 1) % kPaaCount;
+    }
+    state.SetCounter("paas", kPaaCount);
+}
+
+// Verify the Certification Declaration of one device per iteration. Devices of one product carry the same Certification
+// Declaration, which the verifier only checks the signature of once unless CHIP_CONFIG_NUM_VERIFIED_CD_CACHE_ENTRIES is 0.
+void BenchmarkDeviceAttestationCertificationDeclaration(Benchmark::State & state)
+{
+    uint8_t cdBuffer[kMaxCMSSignedCDMessage];
+    MutableByteSpan cd{ cdBuffer };
+    if (Examples::GetExampleDACProvider()->GetCertificationDeclaration(cd) != CHIP_NO_ERROR)
+    {
+        state.SkipWithError("Failed to get the Certification Declaration");
+        return;
+    }
+
+    DeviceAttestationVerifier * verifier = GetDefaultDACVerifier(GetTestAttestationTrustStore());
+    while (state.KeepRunning())
+    {
+        ByteSpan cdContent;
+        if (verifier->ValidateCertificationDeclarationSignature(cd, cdContent) != AttestationVerificationResult::kSuccess)
+        {
+            state.SkipWithError("ValidateCertificationDeclarationSignature failed");
+            break;
+        }
+    }
+}
+
+} // namespace
+
+CHIP_REGISTER_BENCHMARK(BenchmarkDeviceAttestationPaaLookup)
+CHIP_REGISTER_BENCHMARK(BenchmarkDeviceAttestationCertificationDeclaration)
@@ -0,0 +1,150 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmark of the dispatch of incoming messages by the ExchangeManager while many exchanges are active, as on a
+ *      controller talking to a large number of nodes.
+ *
+ */
+
+#include "Benchmark.h"
+
+#include <messaging/ExchangeContext.h>
+#include <messaging/ExchangeDelegate.h>
+#include <messaging/tests/MessagingContext.h>
+#include <protocols/echo/Echo.h>
+
+#include <memory>
+#include <vector>
+
+using namespace chip;
+using namespace chip::Messaging;
+
+namespace {
+
+// Only reached when CHIP_SYSTEM_CONFIG_POOL_USE_HEAP is set, the pool stops at CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS otherwise.
+constexpr size_t kIdleExchangeCount = 10000;
+
+const uint8_t kPayload[64] = { 0 };
+
+class IdleDelegate : public ExchangeDelegate
+{
+public:
+    CHIP_ERROR OnMessageReceived(ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                                 System::PacketBufferHandle && payload) override
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    void OnResponseTimeout(ExchangeContext * ec) override {}
+};
+
+class CountingHandler : public UnsolicitedMessageHandler, public ExchangeDelegate
+{
+public:
+    CHIP_ERROR OnUnsolicitedMessageReceived(const PayloadHeader & payloadHeader, ExchangeDelegate *& newDelegate) override
+    {
+        newDelegate = this;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR OnMessageReceived(ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                                 System::PacketBufferHandle && payload) override
+    {
+        mReceivedCount++;
+        return CHIP_NO_ERROR;
+    }
+
+    void OnResponseTimeout(ExchangeContext * ec) override {}
+
+    uint64_t mReceivedCount = 0;
+};
+
+// Deliver unsolicited messages, which have to be looked up among the active exchanges before they reach their handler.
+void BenchmarkExchangeManagerDispatchWithManyExchanges(Benchmark::State & state)
+{
+    std::unique_ptr<Test::LoopbackMessagingContext> ctx(new Test::LoopbackMessagingContext());
+    if (ctx->Init() != CHIP_NO_ERROR)
+    {
+        state.SkipWithError("Failed to initialize the messaging context");
+        return;
+    }
+
+    CountingHandler handler;
+    IdleDelegate idleDelegate;
+    std::vector<ExchangeContext *> idleExchanges;
+    if (ctx->GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Protocols::Echo::MsgType::EchoRequest, &handler) !=
+        CHIP_NO_ERROR)
+    {
+        state.SkipWithError("Failed to register the message handler");
+    }
+
+    // Keep one exchange free for the incoming messages.
+    while (idleExchanges.size() < kIdleExchangeCount)
+    {
+        ExchangeContext * ec = ctx->NewExchangeToAlice(&idleDelegate);
+        if (ec == nullptr)
+        {
+            break;
+        }
+        idleExchanges.push_back(ec);
+    }
+    if (!idleExchanges.empty())
+    {
+        idleExchanges.back()->Close();
+        idleExchanges.pop_back();
+    }
+
+    {
+        SessionHandle session = ctx->GetSessionBobToAlice();
+        while (state.KeepRunning())
+        {
+            System::PacketBufferHandle buffer = MessagePacketBuffer::NewWithData(kPayload, sizeof(kPayload));
+            EncryptedPacketBufferHandle preparedMessage;
+            PayloadHeader payloadHeader;
+            payloadHeader.SetMessageType(Protocols::Echo::MsgType::EchoRequest);
+            payloadHeader.SetInitiator(true);
+
+            if (buffer.IsNull() ||
+                ctx->GetSecureSessionManager().PrepareMessage(session, payloadHeader, std::move(buffer), preparedMessage) !=
+                    CHIP_NO_ERROR ||
+                ctx->GetSecureSessionManager().SendPreparedMessage(session, preparedMessage) != CHIP_NO_ERROR)
+            {
+                state.SkipWithError("Failed to send the message");
+            }
+            ctx->DrainAndServiceIO();
+        }
+    }
+    if (state.GetError() == nullptr && handler.mReceivedCount != state.GetIterations())
+    {
+        state.SkipWithError("Messages were lost");
+    }
+    state.SetCounter("active_exchanges", idleExchanges.size());
+
+    for (auto * ec : idleExchanges)
+    {
+        ec->Close();
+    }
+    ctx->GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Protocols::Echo::MsgType::EchoRequest);
+    ctx->Shutdown();
+}
+
+} // namespace
+
+CHIP_REGISTER_BENCHMARK(BenchmarkExchangeManagerDispatchWithManyExchanges)
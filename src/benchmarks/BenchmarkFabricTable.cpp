@@ -0,0 +1,194 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmarks of the fabric lookups done by CASE, operational discovery and group message processing, on a fabric
+ *      table holding CHIP_CONFIG_MAX_FABRICS fabrics.
+ *
+ */
+
+#include "Benchmark.h"
+
+#include <credentials/FabricTable.h>
+#include <credentials/PersistentStorageOpCertStore.h>
+#include <credentials/TestOnlyLocalCertificateAuthority.h>
+#include <crypto/PersistentStorageOperationalKeystore.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+
+using namespace chip;
+
+namespace {
+
+constexpr NodeId kNodeId = 0x1234;
+
+// A full fabric table, in which every fabric has its own root.
+class FullFabricTable
+{
+public:
+    ~FullFabricTable()
+    {
+        mFabricTable.Shutdown();
+        mOpCertStore.Finish();
+        mOpKeyStore.Finish();
+    }
+
+    CHIP_ERROR Init()
+    {
+        ReturnErrorOnFailure(mOpKeyStore.Init(&mStorage));
+        ReturnErrorOnFailure(mOpCertStore.Init(&mStorage));
+
+        FabricTable::InitParams initParams;
+        initParams.storage             = &mStorage;
+        initParams.operationalKeystore = &mOpKeyStore;
+        initParams.opCertStore         = &mOpCertStore;
+        ReturnErrorOnFailure(mFabricTable.Init(initParams));
+
+        for (auto & fabric : mFabrics)
+        {
+            ReturnErrorOnFailure(AddFabric(fabric));
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    struct Fabric
+    {
+        FabricIndex mFabricIndex;
+        FabricId mFabricId;
+        CompressedFabricId mCompressedFabricId;
+        Crypto::P256PublicKey mRootPublicKey;
+    };
+
+    FabricTable mFabricTable;
+    Fabric mFabrics[CHIP_CONFIG_MAX_FABRICS];
+
+private:
+    CHIP_ERROR AddFabric(Fabric & fabric)
+    {
+        Credentials::TestOnlyLocalCertificateAuthority certAuthority;
+        ReturnErrorOnFailure(certAuthority.Init().GetStatus());
+
+        uint8_t csrBuf[Crypto::kMAX_CSR_Length];
+        MutableByteSpan csrSpan{ csrBuf };
+        ReturnErrorOnFailure(mFabricTable.AllocatePendingOperationalKey(NullOptional, csrSpan));
+
+        fabric.mFabricId = 0xFAB0'0000'0000'0000ull + mFabricTable.FabricCount();
+        ReturnErrorOnFailure(certAuthority.GenerateNocChain(fabric.mFabricId, kNodeId, csrSpan).GetStatus());
+        ReturnErrorOnFailure(mFabricTable.AddNewPendingTrustedRootCert(certAuthority.GetRcac()));
+        ReturnErrorOnFailure(mFabricTable.AddNewPendingFabricWithOperationalKeystore(certAuthority.GetNoc(), ByteSpan{},
+                                                                                     VendorId::TestVendor1, &fabric.mFabricIndex));
+        ReturnErrorOnFailure(mFabricTable.CommitPendingFabricData());
+
+        const FabricInfo * fabricInfo = mFabricTable.FindFabricWithIndex(fabric.mFabricIndex);
+        VerifyOrReturnError(fabricInfo != nullptr, CHIP_ERROR_INTERNAL);
+        fabric.mCompressedFabricId = fabricInfo->GetCompressedFabricId();
+        return fabricInfo->FetchRootPubkey(fabric.mRootPublicKey);
+    }
+
+    TestPersistentStorageDelegate mStorage;
+    PersistentStorageOperationalKeystore mOpKeyStore;
+    Credentials::PersistentStorageOpCertStore mOpCertStore;
+};
+
+// Run the lookup for every fabric in turn, one per iteration. The lookup returns whether it found the expected fabric.
+template <typename Lookup>
+void RunLookups(Benchmark::State & state, Lookup lookup)
+{
+    if (Platform::MemoryInit() != CHIP_NO_ERROR)
+    {
+        state.SkipWithError("Failed to initialize memory");
+        return;
+    }
+
+    {
+        Platform::UniquePtr<FullFabricTable> table(Platform::New<FullFabricTable>());
+        if (!table || table->Init() != CHIP_NO_ERROR)
+        {
+            state.SkipWithError("Failed to fill the fabric table");
+        }
+        else
+        {
+            size_t fabricPosition = 0;
+            while (state.KeepRunning())
+            {
+                if (!lookup(table->mFabricTable, table->mFabrics[fabricPosition]))
+                {
+                    state.SkipWithError("Unexpected lookup result");
+                    break;
+                }
+                fabricPosition = (fabricPosition + 1) % CHIP_CONFIG_MAX_FABRICS;
+            }
+            state.SetCounter("fabrics", CHIP_CONFIG_MAX_FABRICS);
+        }
+    }
+
+    Platform::MemoryShutdown();
+}
+
+// Done for most messages, e.g. to get the fabric of a session.
+void BenchmarkFabricTableFindFabricWithIndex(Benchmark::State & state)
+{
+    RunLookups(state, [](const FabricTable & fabricTable, const FullFabricTable::Fabric & fabric) {
+        const FabricInfo * fabricInfo = fabricTable.FindFabricWithIndex(fabric.mFabricIndex);
+        return fabricInfo != nullptr && fabricInfo->GetFabricId() == fabric.mFabricId;
+    });
+}
+
+// Done to match the operational instance names found by discovery.
+void BenchmarkFabricTableFindFabricWithCompressedId(Benchmark::State & state)
+{
+    RunLookups(state, [](const FabricTable & fabricTable, const FullFabricTable::Fabric & fabric) {
+        const FabricInfo * fabricInfo = fabricTable.FindFabricWithCompressedId(fabric.mCompressedFabricId);
+        return fabricInfo != nullptr && fabricInfo->GetFabricIndex() == fabric.mFabricIndex;
+    });
+}
+
+// Operational instance names of other fabrics on the network, which are not found.
+void BenchmarkFabricTableFindFabricWithUnknownCompressedId(Benchmark::State & state)
+{
+    RunLookups(state, [](const FabricTable & fabricTable, const FullFabricTable::Fabric & fabric) {
+        return fabricTable.FindFabricWithCompressedId(~fabric.mCompressedFabricId) == nullptr;
+    });
+}
+
+// Done by CASE to find the fabric of a peer from its certificates.
+void BenchmarkFabricTableFindFabric(Benchmark::State & state)
+{
+    RunLookups(state, [](const FabricTable & fabricTable, const FullFabricTable::Fabric & fabric) {
+        const FabricInfo * fabricInfo = fabricTable.FindFabric(fabric.mRootPublicKey, fabric.mFabricId);
+        return fabricInfo != nullptr && fabricInfo->GetFabricIndex() == fabric.mFabricIndex;
+    });
+}
+
+// Done by CASE to find the identity a peer is looking for.
+void BenchmarkFabricTableFindIdentity(Benchmark::State & state)
+{
+    RunLookups(state, [](const FabricTable & fabricTable, const FullFabricTable::Fabric & fabric) {
+        const FabricInfo * fabricInfo = fabricTable.FindIdentity(fabric.mRootPublicKey, fabric.mFabricId, kNodeId);
+        return fabricInfo != nullptr && fabricInfo->GetFabricIndex() == fabric.mFabricIndex;
+    });
+}
+
+} // namespace
+
+CHIP_REGISTER_BENCHMARK(BenchmarkFabricTableFindFabricWithIndex)
+CHIP_REGISTER_BENCHMARK(BenchmarkFabricTableFindFabricWithCompressedId)
+CHIP_REGISTER_BENCHMARK(BenchmarkFabricTableFindFabricWithUnknownCompressedId)
+CHIP_REGISTER_BENCHMARK(BenchmarkFabricTableFindFabric)
+CHIP_REGISTER_BENCHMARK(BenchmarkFabricTableFindIdentity)
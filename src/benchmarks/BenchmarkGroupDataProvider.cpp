@@ -0,0 +1,180 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmarks of the group session lookup done by SessionManager for every group message it receives, on a group data
+ *      provider with fully populated group key maps.
+ *
+ */
+
+#include "Benchmark.h"
+
+#include <credentials/GroupDataProviderImpl.h>
+#include <crypto/DefaultSessionKeystore.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+
+using namespace chip;
+using namespace chip::Credentials;
+
+namespace {
+
+// The group session index covers the group key maps of two fabrics by default.
+constexpr FabricIndex kFabricCount = 2;
+
+// Key sets of each fabric, mapped to its groups in turn. Key set 0 is the IPK, which is not used for groups.
+constexpr KeysetId kKeysetCount = CHIP_CONFIG_MAX_GROUP_KEYS_PER_FABRIC - 1;
+
+// Group data provider with CHIP_CONFIG_MAX_GROUPS_PER_FABRIC groups on each fabric, every one of them mapped to a key set of
+// three epoch keys.
+class PopulatedGroupDataProvider
+{
+public:
+    ~PopulatedGroupDataProvider() { mProvider.Finish(); }
+
+    CHIP_ERROR Init()
+    {
+        mProvider.SetStorageDelegate(&mStorage);
+        mProvider.SetSessionKeystore(&mSessionKeystore);
+        ReturnErrorOnFailure(mProvider.Init());
+
+        for (FabricIndex fabricIndex = 1; fabricIndex <= kFabricCount; fabricIndex++)
+        {
+            const uint8_t compressedFabricId[] = { 0x87, 0xe1, 0xb0, 0x04, 0xe2, 0x35, 0xa1, fabricIndex };
+            for (KeysetId keysetId = 1; keysetId <= kKeysetCount; keysetId++)
+            {
+                GroupDataProvider::KeySet keySet(keysetId, GroupDataProvider::SecurityPolicy::kTrustFirst,
+                                                 GroupDataProvider::KeySet::kEpochKeysMax);
+                for (uint8_t keyIndex = 0; keyIndex < GroupDataProvider::KeySet::kEpochKeysMax; keyIndex++)
+                {
+                    GroupDataProvider::EpochKey & epochKey = keySet.epoch_keys[keyIndex];
+                    epochKey.start_time                    = 1000u * keyIndex;
+                    memset(epochKey.key, 0, sizeof(epochKey.key));
+                    epochKey.key[0] = fabricIndex;
+                    epochKey.key[1] = static_cast<uint8_t>(keysetId);
+                    epochKey.key[2] = keyIndex;
+                }
+                ReturnErrorOnFailure(mProvider.SetKeySet(fabricIndex, ByteSpan(compressedFabricId), keySet));
+            }
+
+            for (uint16_t i = 0; i < CHIP_CONFIG_MAX_GROUPS_PER_FABRIC; i++)
+            {
+                GroupId groupId = static_cast<GroupId>(0x100 + i);
+                ReturnErrorOnFailure(mProvider.SetGroupInfoAt(fabricIndex, i, GroupDataProvider::GroupInfo(groupId, "Group")));
+                ReturnErrorOnFailure(mProvider.SetGroupKeyAt(
+                    fabricIndex, i, GroupDataProvider::GroupKey(groupId, static_cast<KeysetId>(1 + i % kKeysetCount))));
+            }
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    // Session id of the messages sent to the last group of the last fabric, which every lookup has to reach.
+    CHIP_ERROR GetLastGroupSessionId(uint16_t & sessionId)
+    {
+        Crypto::SymmetricKeyContext * keyContext =
+            mProvider.GetKeyContext(kFabricCount, static_cast<GroupId>(0x100 + CHIP_CONFIG_MAX_GROUPS_PER_FABRIC - 1));
+        VerifyOrReturnError(keyContext != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+        sessionId = keyContext->GetKeyHash();
+        keyContext->Release();
+        return CHIP_NO_ERROR;
+    }
+
+    GroupDataProviderImpl mProvider{ CHIP_CONFIG_MAX_GROUPS_PER_FABRIC, CHIP_CONFIG_MAX_GROUP_KEYS_PER_FABRIC };
+
+private:
+    TestPersistentStorageDelegate mStorage;
+    Crypto::DefaultSessionKeystore mSessionKeystore;
+};
+
+// Look up the candidate sessions of a group message once per iteration, and go through them the way SessionManager does
+// when it tries to decrypt the message.
+void RunLookups(Benchmark::State & state, bool knownSession)
+{
+    if (Platform::MemoryInit() != CHIP_NO_ERROR)
+    {
+        state.SkipWithError("Failed to initialize memory");
+        return;
+    }
+
+    {
+        Platform::UniquePtr<PopulatedGroupDataProvider> groups(Platform::New<PopulatedGroupDataProvider>());
+        uint16_t sessionId = 0;
+        if (!groups || groups->Init() != CHIP_NO_ERROR || groups->GetLastGroupSessionId(sessionId) != CHIP_NO_ERROR)
+        {
+            state.SkipWithError("Failed to populate the group data provider");
+        }
+        else
+        {
+            // Messages of groups that are not on the device, e.g. of other fabrics on the same network, match no key.
+            size_t expectedCount = 1;
+            if (!knownSession)
+            {
+                sessionId     = static_cast<uint16_t>(sessionId + 1);
+                expectedCount = 0;
+            }
+
+            size_t candidateCount = 0;
+            while (state.KeepRunning())
+            {
+                GroupDataProvider::GroupSessionIterator * iterator = groups->mProvider.IterateGroupSessions(sessionId);
+                if (iterator == nullptr)
+                {
+                    state.SkipWithError("IterateGroupSessions failed");
+                    break;
+                }
+
+                GroupDataProvider::GroupSession session;
+                candidateCount = 0;
+                while (iterator->Next(session))
+                {
+                    candidateCount++;
+                }
+                iterator->Release();
+
+                if (candidateCount < expectedCount || (!knownSession && candidateCount != 0))
+                {
+                    state.SkipWithError("Unexpected group sessions");
+                    break;
+                }
+            }
+            state.SetCounter("fabrics", kFabricCount);
+            state.SetCounter("groups", kFabricCount * CHIP_CONFIG_MAX_GROUPS_PER_FABRIC);
+            state.SetCounter("candidates", candidateCount);
+        }
+    }
+
+    Platform::MemoryShutdown();
+}
+
+// A message sent to a group of the device.
+void BenchmarkGroupDataProviderGroupSession(Benchmark::State & state)
+{
+    RunLookups(state, true);
+}
+
+// A message whose session id matches no group key of the device.
+void BenchmarkGroupDataProviderUnknownGroupSession(Benchmark::State & state)
+{
+    RunLookups(state, false);
+}
+
+} // namespace
+
+CHIP_REGISTER_BENCHMARK(BenchmarkGroupDataProviderGroupSession)
+CHIP_REGISTER_BENCHMARK(BenchmarkGroupDataProviderUnknownGroupSession)
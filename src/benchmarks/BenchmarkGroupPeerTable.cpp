@@ -0,0 +1,135 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmarks of the group message counter checks done by SessionManager for every group message it receives.
+ *
+ */
+
+#include "Benchmark.h"
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <transport/GroupPeerMessageCounter.h>
+
+using namespace chip;
+using namespace chip::Transport;
+
+namespace {
+
+// Number of nodes sending groupcast messages to the device, e.g. the switches and sensors of a large installation.
+constexpr size_t kFanInSenderCount = 500;
+
+// The number of data senders the table tracks without evicting any.
+constexpr size_t kTrackedSenderCount = CHIP_CONFIG_MAX_FABRICS * CHIP_CONFIG_MAX_GROUP_DATA_PEERS;
+
+constexpr size_t kMaxSenderCount = kTrackedSenderCount > kFanInSenderCount ? kTrackedSenderCount : kFanInSenderCount;
+
+// Receive one message per iteration from senderCount senders in turn, spread over fabricCount fabrics, and check its counter
+// the way SessionManager does.
+void ReceiveMessages(Benchmark::State & state, GroupPeerTable & table, size_t senderCount, size_t fabricCount)
+{
+    uint32_t messageCounters[kMaxSenderCount] = {};
+    size_t senderIndex                        = 0;
+    while (state.KeepRunning())
+    {
+        FabricIndex fabricIndex = static_cast<FabricIndex>(1 + senderIndex % fabricCount);
+        NodeId nodeId           = 1 + senderIndex;
+        uint32_t messageCounter = ++messageCounters[senderIndex];
+
+        GroupSender * sender = nullptr;
+        if (table.FindOrAddPeer(fabricIndex, nodeId, false, sender) != CHIP_NO_ERROR ||
+            sender->msgCounter.VerifyOrTrustFirstGroup(messageCounter) != CHIP_NO_ERROR)
+        {
+            state.SkipWithError("Group message rejected");
+            return;
+        }
+        table.CommitCounter(*sender, messageCounter);
+
+        senderIndex = (senderIndex + 1) % senderCount;
+    }
+
+    GroupPeerTable::Stats stats = table.GetStats();
+    state.SetCounter("senders", senderCount);
+    state.SetCounter("peak_peers", stats.mPeakPeerCount);
+    state.SetCounter("evictions", stats.mEvictionCount);
+}
+
+void RunFanIn(Benchmark::State & state, size_t senderCount, size_t fabricCount, bool persist)
+{
+    if (Platform::MemoryInit() != CHIP_NO_ERROR)
+    {
+        state.SkipWithError("Failed to initialize memory");
+        return;
+    }
+
+    {
+        TestPersistentStorageDelegate storage;
+        GroupPeerTable table;
+        if (persist && table.Init(&storage) != CHIP_NO_ERROR)
+        {
+            state.SkipWithError("Failed to initialize the table");
+        }
+        else
+        {
+            ReceiveMessages(state, table, senderCount, fabricCount);
+        }
+    }
+
+    Platform::MemoryShutdown();
+}
+
+// As many senders as the table tracks, so that every message finds its sender.
+void BenchmarkGroupPeerTableTracked(Benchmark::State & state)
+{
+    RunFanIn(state, kTrackedSenderCount, CHIP_CONFIG_MAX_FABRICS, false);
+}
+
+// 500 senders on a single fabric. When the fabric tracks fewer senders, most of them replace the least recently used one.
+void BenchmarkGroupPeerTableFanIn(Benchmark::State & state)
+{
+#if CHIP_CONFIG_GROUP_PEER_TABLE_LRU_EVICTION || CHIP_CONFIG_MAX_GROUP_DATA_PEERS >= 500
+    RunFanIn(state, kFanInSenderCount, 1, false);
+#else
+    state.SkipWithError("Needs CHIP_CONFIG_GROUP_PEER_TABLE_LRU_EVICTION or CHIP_CONFIG_MAX_GROUP_DATA_PEERS >= 500");
+#endif // CHIP_CONFIG_GROUP_PEER_TABLE_LRU_EVICTION || CHIP_CONFIG_MAX_GROUP_DATA_PEERS >= 500
+}
+
+// 500 senders spread over all the fabrics.
+void BenchmarkGroupPeerTableFanInAllFabrics(Benchmark::State & state)
+{
+#if CHIP_CONFIG_GROUP_PEER_TABLE_LRU_EVICTION || CHIP_CONFIG_MAX_GROUP_DATA_PEERS * CHIP_CONFIG_MAX_FABRICS >= 500
+    RunFanIn(state, kFanInSenderCount, CHIP_CONFIG_MAX_FABRICS, false);
+#else
+    state.SkipWithError("Needs CHIP_CONFIG_GROUP_PEER_TABLE_LRU_EVICTION or room for 500 senders");
+#endif // CHIP_CONFIG_GROUP_PEER_TABLE_LRU_EVICTION || CHIP_CONFIG_MAX_GROUP_DATA_PEERS * CHIP_CONFIG_MAX_FABRICS >= 500
+}
+
+// As BenchmarkGroupPeerTableTracked, persisting the counters.
+void BenchmarkGroupPeerTableTrackedPersisted(Benchmark::State & state)
+{
+    RunFanIn(state, kTrackedSenderCount, CHIP_CONFIG_MAX_FABRICS, true);
+}
+
+} // namespace
+
+CHIP_REGISTER_BENCHMARK(BenchmarkGroupPeerTableTracked)
+CHIP_REGISTER_BENCHMARK(BenchmarkGroupPeerTableFanIn)
+CHIP_REGISTER_BENCHMARK(BenchmarkGroupPeerTableFanInAllFabrics)
+CHIP_REGISTER_BENCHMARK(BenchmarkGroupPeerTableTrackedPersisted)
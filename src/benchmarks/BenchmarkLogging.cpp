@@ -0,0 +1,106 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmarks of the cost of a log statement for the calling thread, with the text
+ *      and binary Linux logging backends.
+ *
+ */
+
+#include "Benchmark.h"
+
+#include <lib/support/EnforceFormat.h>
+#include <platform/Linux/BinaryLogging.h>
+#include <platform/logging/LogV.h>
+
+#include <fcntl.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <unistd.h>
+
+using namespace chip;
+
+namespace {
+
+void ENFORCE_FORMAT(1, 2) Log(const char * msg, ...)
+{
+    va_list args;
+    va_start(args, msg);
+    Logging::Platform::LogV("IM", Logging::kLogCategory_Progress, msg, args);
+    va_end(args);
+}
+
+void LogTypicalMessage(uint32_t i)
+{
+    Log("Received report for endpoint %u cluster 0x%08x attribute 0x%08x from %s, %zu bytes", 1, 0x0006, i, "fabric 1 node 0x1234",
+        static_cast<size_t>(i % 1280));
+}
+
+void BenchmarkLoggingText(Benchmark::State & state)
+{
+    // The text backend writes to stdout, which carries the benchmark results: point it to /dev/null meanwhile.
+    fflush(stdout);
+    int savedStdout = dup(STDOUT_FILENO);
+    int devNull     = open("/dev/null", O_WRONLY);
+    if (savedStdout < 0 || devNull < 0 || dup2(devNull, STDOUT_FILENO) < 0)
+    {
+        state.SkipWithError("Failed to redirect stdout");
+    }
+    else
+    {
+        uint32_t i = 0;
+        while (state.KeepRunning())
+        {
+            LogTypicalMessage(i++);
+        }
+        fflush(stdout);
+        dup2(savedStdout, STDOUT_FILENO);
+    }
+
+    if (devNull >= 0)
+    {
+        close(devNull);
+    }
+    if (savedStdout >= 0)
+    {
+        close(savedStdout);
+    }
+}
+
+void BenchmarkLoggingBinary(Benchmark::State & state)
+{
+    if (DeviceLayer::BinaryLogging::Start("/dev/null") != CHIP_NO_ERROR)
+    {
+        state.SkipWithError("Failed to start binary logging");
+        return;
+    }
+
+    uint32_t i = 0;
+    while (state.KeepRunning())
+    {
+        LogTypicalMessage(i++);
+    }
+
+    DeviceLayer::BinaryLogging::Stop();
+}
+
+} // namespace
+
+CHIP_REGISTER_BENCHMARK(BenchmarkLoggingText)
+CHIP_REGISTER_BENCHMARK(BenchmarkLoggingBinary)
@@ -0,0 +1,47 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "Benchmark.h"
+
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <stdarg.h>
+#include <stdio.h>
+
+namespace {
+
+// Logging would dominate the measurements, and stdout is reserved for the results: only print errors, on stderr.
+void LogErrorsToStderr(const char * module, uint8_t category, const char * msg, va_list args)
+{
+    if (category != chip::Logging::kLogCategory_Error)
+    {
+        return;
+    }
+    fprintf(stderr, "CHIP:%s: ", module);
+    vfprintf(stderr, msg, args);
+    fprintf(stderr, "\n");
+}
+
+} // namespace
+
+int main(int argc, char ** argv)
+{
+    chip::Logging::SetLogRedirectCallback(LogErrorsToStderr);
+
+    return chip::Benchmark::RunRegisteredBenchmarks(argc, argv);
+}
@@ -0,0 +1,170 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmarks of minimal mDNS packet parsing, on a response advertising an operational node.
+ *
+ */
+
+#include "Benchmark.h"
+
+#include <inet/IPAddress.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/dnssd/minimal_mdns/Parser.h>
+#include <lib/dnssd/minimal_mdns/RecordData.h>
+#include <lib/dnssd/minimal_mdns/ResponseBuilder.h>
+#include <lib/dnssd/minimal_mdns/records/IP.h>
+#include <lib/dnssd/minimal_mdns/records/Ptr.h>
+#include <lib/dnssd/minimal_mdns/records/Srv.h>
+#include <lib/dnssd/minimal_mdns/records/Txt.h>
+#include <lib/support/CHIPMem.h>
+#include <system/SystemPacketBuffer.h>
+
+using namespace chip;
+using namespace mdns::Minimal;
+
+namespace {
+
+constexpr size_t kRecordCount = 6;
+
+const QNamePart kServiceName[]  = { "_matter", "_tcp", "local" };
+const QNamePart kSubtypeName[]  = { "_I2906C908D115D362", "_sub", "_matter", "_tcp", "local" };
+const QNamePart kInstanceName[] = { "2906C908D115D362-8FC7772401CD0696", "_matter", "_tcp", "local" };
+const QNamePart kHostName[]     = { "E45F0149AE290000", "local" };
+const char * kTxtEntries[]      = { "SII=5000", "SAI=300", "SAT=4000", "T=1" };
+
+CHIP_ERROR BuildResponse(System::PacketBufferHandle & packet)
+{
+    Inet::IPAddress ipv6;
+    Inet::IPAddress ipv4;
+    VerifyOrReturnError(Inet::IPAddress::FromString("fe80::e65f:1ff:fe49:ae29", ipv6), CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(Inet::IPAddress::FromString("192.168.1.20", ipv4), CHIP_ERROR_INTERNAL);
+
+    ResponseBuilder builder(System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize));
+    VerifyOrReturnError(builder.HasPacketBuffer(), CHIP_ERROR_NO_MEMORY);
+
+    builder.AddRecord(ResourceType::kAnswer, PtrResourceRecord(kServiceName, kInstanceName))
+        .AddRecord(ResourceType::kAnswer, PtrResourceRecord(kSubtypeName, kInstanceName))
+        .AddRecord(ResourceType::kAdditional, SrvResourceRecord(kInstanceName, kHostName, CHIP_PORT))
+        .AddRecord(ResourceType::kAdditional, TxtResourceRecord(kInstanceName, kTxtEntries))
+        .AddRecord(ResourceType::kAdditional, IPResourceRecord(kHostName, ipv6))
+        .AddRecord(ResourceType::kAdditional, IPResourceRecord(kHostName, ipv4));
+    VerifyOrReturnError(builder.Ok(), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    packet = builder.ReleasePacket();
+    return CHIP_NO_ERROR;
+}
+
+// Decodes every record like the resolver does, walking the names so that compressed labels get followed.
+class RecordDecoder : public ParserDelegate, public TxtRecordDelegate
+{
+public:
+    RecordDecoder(const BytesRange & packet) : mPacket(packet) {}
+
+    size_t GetRecordCount() const { return mRecordCount; }
+
+    void OnHeader(ConstHeaderRef & header) override {}
+    void OnQuery(const QueryData & data) override {}
+
+    void OnResource(ResourceType type, const ResourceData & data) override
+    {
+        mRecordCount++;
+        WalkName(data.GetName());
+
+        switch (data.GetType())
+        {
+        case QType::PTR: {
+            SerializedQNameIterator name;
+            if (ParsePtrRecord(data.GetData(), mPacket, &name))
+            {
+                WalkName(name);
+            }
+            break;
+        }
+        case QType::SRV: {
+            SrvRecord srv;
+            if (srv.Parse(data.GetData(), mPacket))
+            {
+                WalkName(srv.GetName());
+            }
+            break;
+        }
+        case QType::TXT:
+            ParseTxtRecord(data.GetData(), this);
+            break;
+        case QType::A: {
+            Inet::IPAddress addr;
+            ParseARecord(data.GetData(), &addr);
+            break;
+        }
+        case QType::AAAA: {
+            Inet::IPAddress addr;
+            ParseAAAARecord(data.GetData(), &addr);
+            break;
+        }
+        default:
+            break;
+        }
+    }
+
+    void OnRecord(const BytesRange & name, const BytesRange & value) override {}
+
+private:
+    static void WalkName(SerializedQNameIterator name)
+    {
+        while (name.Next())
+        {
+        }
+    }
+
+    BytesRange mPacket;
+    size_t mRecordCount = 0;
+};
+
+void BenchmarkMinimalMdnsParseResponse(Benchmark::State & state)
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    System::PacketBufferHandle packet;
+    if (BuildResponse(packet) != CHIP_NO_ERROR)
+    {
+        state.SkipWithError("Failed to build the response");
+    }
+
+    while (state.KeepRunning())
+    {
+        BytesRange packetRange(packet->Start(), packet->Start() + packet->DataLength());
+        RecordDecoder decoder(packetRange);
+        if (!ParsePacket(packetRange, &decoder) || decoder.GetRecordCount() != kRecordCount)
+        {
+            state.SkipWithError("Failed to parse the response");
+        }
+    }
+    if (!packet.IsNull())
+    {
+        state.SetBytesPerIteration(packet->DataLength());
+    }
+
+    packet = nullptr;
+    Platform::MemoryShutdown();
+}
+
+} // namespace
+
+CHIP_REGISTER_BENCHMARK(BenchmarkMinimalMdnsParseResponse)
@@ -0,0 +1,96 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmarks of PacketBuffer allocation.
+ *
+ */
+
+#include "Benchmark.h"
+
+#include <lib/support/CHIPMem.h>
+#include <system/SystemPacketBuffer.h>
+
+using namespace chip;
+
+namespace {
+
+constexpr size_t kBurstSize = 8;
+
+const uint8_t kPayload[64] = { 0 };
+
+void BenchmarkPacketBufferNew(Benchmark::State & state)
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    while (state.KeepRunning())
+    {
+        System::PacketBufferHandle buffer = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize);
+        if (buffer.IsNull())
+        {
+            state.SkipWithError("PacketBufferHandle::New failed");
+        }
+    }
+
+    Platform::MemoryShutdown();
+}
+
+void BenchmarkPacketBufferNewWithData(Benchmark::State & state)
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    while (state.KeepRunning())
+    {
+        System::PacketBufferHandle buffer = System::PacketBufferHandle::NewWithData(kPayload, sizeof(kPayload));
+        if (buffer.IsNull())
+        {
+            state.SkipWithError("PacketBufferHandle::NewWithData failed");
+        }
+    }
+    state.SetBytesPerIteration(sizeof(kPayload));
+
+    Platform::MemoryShutdown();
+}
+
+// Several buffers in flight at once, like a message being sent while others wait for acknowledgements.
+void BenchmarkPacketBufferBurst(Benchmark::State & state)
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    while (state.KeepRunning())
+    {
+        System::PacketBufferHandle buffers[kBurstSize];
+        for (auto & buffer : buffers)
+        {
+            buffer = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize);
+            if (buffer.IsNull())
+            {
+                state.SkipWithError("PacketBufferHandle::New failed");
+            }
+        }
+    }
+
+    Platform::MemoryShutdown();
+}
+
+} // namespace
+
+CHIP_REGISTER_BENCHMARK(BenchmarkPacketBufferNew)
+CHIP_REGISTER_BENCHMARK(BenchmarkPacketBufferNewWithData)
+CHIP_REGISTER_BENCHMARK(BenchmarkPacketBufferBurst)
@@ -0,0 +1,761 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmarks of report generation by the reporting engine, and of the reads and subscriptions a controller does
+ *      across many nodes, reading the mock attribute storage over the loopback transport of the app tests.
+ *
+ */
+
+#include "Benchmark.h"
+
+#include <app/AttributePathParams.h>
+#include <app/ClusterStateCache.h>
+#include <app/InteractionModelEngine.h>
+#include <app/ReadClient.h>
+#include <app/ReadPrepareParams.h>
+#include <app/ReadRequestTemplate.h>
+#include <app/tests/AppTestContext.h>
+#include <app/util/mock/Constants.h>
+#include <app/util/mock/Functions.h>
+#include <controller/FanOutAttributeReader.h>
+#include <controller/ReadInteraction.h>
+#include <system/SystemClock.h>
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <vector>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace chip {
+namespace app {
+
+// The benchmarks serve the mock attribute storage, like the app unit tests do.
+CHIP_ERROR ReadSingleClusterData(const Access::SubjectDescriptor & aSubjectDescriptor, bool aIsFabricFiltered,
+                                 const ConcreteReadAttributePath & aPath, AttributeReportIBs::Builder & aAttributeReports,
+                                 AttributeValueEncoder::AttributeEncodeState * apEncoderState)
+{
+    return Test::ReadSingleMockClusterData(aSubjectDescriptor.fabricIndex, aPath, aAttributeReports, apEncoderState);
+}
+
+bool IsClusterDataVersionEqual(const ConcreteClusterPath & aConcreteClusterPath, DataVersion aRequiredVersion)
+{
+    return Test::GetVersion() == aRequiredVersion;
+}
+
+bool IsDeviceTypeOnEndpoint(DeviceTypeId deviceType, EndpointId endpoint)
+{
+    return false;
+}
+
+bool ConcreteAttributePathExists(const ConcreteAttributePath & aPath)
+{
+    return true;
+}
+
+} // namespace app
+} // namespace chip
+
+namespace {
+
+class ReadCallback : public ReadClient::Callback
+{
+public:
+    void OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus) override
+    {
+        mAttributeCount++;
+    }
+
+    void OnError(CHIP_ERROR aError) override { mError = aError; }
+
+    void OnDone(ReadClient * apReadClient) override { mDone = true; }
+
+    void OnSubscriptionEstablished(SubscriptionId aSubscriptionId) override { mSubscriptionEstablished = true; }
+
+    size_t mAttributeCount        = 0;
+    CHIP_ERROR mError             = CHIP_NO_ERROR;
+    bool mDone                    = false;
+    bool mSubscriptionEstablished = false;
+};
+
+// A node reached over the loopback session of the app context.
+class LoopbackDeviceProxy : public DeviceProxy
+{
+public:
+    LoopbackDeviceProxy(Messaging::ExchangeManager & aExchangeMgr, const SessionHandle & aSession) : mExchangeMgr(aExchangeMgr)
+    {
+        mSession.Grab(aSession);
+    }
+
+    void Disconnect() override {}
+    NodeId GetDeviceId() const override { return kUndefinedNodeId; }
+    Messaging::ExchangeManager * GetExchangeManager() const override { return &mExchangeMgr; }
+    Optional<SessionHandle> GetSecureSession() const override { return mSession.Get(); }
+
+protected:
+    bool IsSecureConnected() const override { return static_cast<bool>(mSession); }
+
+private:
+    Messaging::ExchangeManager & mExchangeMgr;
+    SessionHolder mSession;
+};
+
+// Number of nodes a controller subscribes to, e.g. after its network came back.
+constexpr size_t kSubscriptionCount = 5000;
+
+// Number of subscriptions a device serves for the same attribute, e.g. from the controllers and apps of a large home.
+constexpr size_t kSharedReportSubscriptionCount = 64;
+
+// Number of subscriptions a device serves with the same max interval, whose keep-alive reports all fall due together.
+constexpr size_t kKeepAliveSubscriptionCount = 64;
+constexpr uint16_t kKeepAliveMaxInterval     = 60;
+constexpr size_t kKeepAliveMaxDrivePasses    = 100;
+
+// Number of nodes whose cached model a controller resubscribes to at once, e.g. after a network blip.
+constexpr size_t kResubscribeNodeCount = 32;
+
+// Number of nodes a controller reads an attribute from, e.g. to show the state of every light of a building.
+constexpr size_t kFanOutNodeCount = 1000;
+
+// Number of reads the controller keeps in flight.
+constexpr size_t kFanOutReadsInFlight = CHIP_CONFIG_CONTROLLER_MAX_FAN_OUT_READS;
+
+// The profile the controller subscribes to on every node: the global and first mock attributes of every mock cluster.
+constexpr size_t kProfileClusterCount = 9;
+constexpr size_t kProfilePathCount    = kProfileClusterCount * 3;
+
+void GetProfilePaths(AttributePathParams (&aPaths)[kProfilePathCount])
+{
+    const EndpointId endpoints[kProfileClusterCount] = { Test::kMockEndpoint1, Test::kMockEndpoint1, Test::kMockEndpoint2,
+                                                         Test::kMockEndpoint2, Test::kMockEndpoint2, Test::kMockEndpoint3,
+                                                         Test::kMockEndpoint3, Test::kMockEndpoint3, Test::kMockEndpoint3 };
+    const ClusterId clusters[kProfileClusterCount]   = { Test::MockClusterId(1), Test::MockClusterId(2), Test::MockClusterId(1),
+                                                         Test::MockClusterId(2), Test::MockClusterId(3), Test::MockClusterId(1),
+                                                         Test::MockClusterId(2), Test::MockClusterId(3), Test::MockClusterId(4) };
+    const AttributeId attributes[]                   = { Clusters::Globals::Attributes::ClusterRevision::Id,
+                                                         Clusters::Globals::Attributes::FeatureMap::Id, Test::MockAttributeId(1) };
+
+    size_t pathIndex = 0;
+    for (size_t i = 0; i < kProfileClusterCount; i++)
+    {
+        for (AttributeId attribute : attributes)
+        {
+            aPaths[pathIndex++] = AttributePathParams(endpoints[i], clusters[i], attribute);
+        }
+    }
+}
+
+// Read every attribute of the mock endpoints, which the engine reports in several chunks.
+void BenchmarkReportingEngineWildcardRead(Benchmark::State & state)
+{
+    std::unique_ptr<Test::AppContext> ctx(new Test::AppContext());
+    if (ctx->Init() != CHIP_NO_ERROR)
+    {
+        state.SkipWithError("Failed to initialize the app context");
+        return;
+    }
+
+    {
+        AttributePathParams attributePath;
+        ReadPrepareParams readPrepareParams(ctx->GetSessionBobToAlice());
+        readPrepareParams.mpAttributePathParamsList    = &attributePath;
+        readPrepareParams.mAttributePathParamsListSize = 1;
+
+        size_t attributeCount = 0;
+        while (state.KeepRunning())
+        {
+            ReadCallback callback;
+            ReadClient readClient(InteractionModelEngine::GetInstance(), &ctx->GetExchangeManager(), callback,
+                                  ReadClient::InteractionType::Read);
+            if (readClient.SendRequest(readPrepareParams) != CHIP_NO_ERROR)
+            {
+                state.SkipWithError("ReadClient::SendRequest failed");
+                break;
+            }
+            ctx->DrainAndServiceIO();
+
+            if (!callback.mDone || callback.mError != CHIP_NO_ERROR || callback.mAttributeCount == 0 ||
+                (attributeCount != 0 && callback.mAttributeCount != attributeCount))
+            {
+                state.SkipWithError("Unexpected read result");
+            }
+            attributeCount = callback.mAttributeCount;
+        }
+    }
+
+    ctx->Shutdown();
+}
+
+// Establish kSubscriptionCount subscriptions to the profile per iteration, one after the other. The device does not keep
+// subscriptions, so each one replaces the previous one, as it would on a device of its own.
+void RunSubscriptions(Benchmark::State & state, bool useTemplate)
+{
+    std::unique_ptr<Test::AppContext> ctx(new Test::AppContext());
+    if (ctx->Init() != CHIP_NO_ERROR)
+    {
+        state.SkipWithError("Failed to initialize the app context");
+        return;
+    }
+
+    {
+        AttributePathParams paths[kProfilePathCount];
+        GetProfilePaths(paths);
+
+        ReadRequestTemplate requestTemplate;
+        if (useTemplate &&
+            requestTemplate.Init(Span<const AttributePathParams>(paths), Span<const EventPathParams>()) != CHIP_NO_ERROR)
+        {
+            state.SkipWithError("Failed to initialize the request template");
+        }
+
+        while (state.KeepRunning())
+        {
+            for (size_t i = 0; i < kSubscriptionCount; i++)
+            {
+                ReadPrepareParams readPrepareParams(ctx->GetSessionBobToAlice());
+                if (useTemplate)
+                {
+                    readPrepareParams.mpRequestTemplate = &requestTemplate;
+                }
+                else
+                {
+                    readPrepareParams.mpAttributePathParamsList    = paths;
+                    readPrepareParams.mAttributePathParamsListSize = kProfilePathCount;
+                }
+                readPrepareParams.mMinIntervalFloorSeconds   = 0;
+                readPrepareParams.mMaxIntervalCeilingSeconds = 60;
+
+                ReadCallback callback;
+                ReadClient readClient(InteractionModelEngine::GetInstance(), &ctx->GetExchangeManager(), callback,
+                                      ReadClient::InteractionType::Subscribe);
+                if (readClient.SendRequest(readPrepareParams) != CHIP_NO_ERROR)
+                {
+                    state.SkipWithError("ReadClient::SendRequest failed");
+                    break;
+                }
+                ctx->DrainAndServiceIO();
+
+                if (!callback.mSubscriptionEstablished || callback.mError != CHIP_NO_ERROR ||
+                    callback.mAttributeCount != kProfilePathCount)
+                {
+                    state.SkipWithError("Unexpected subscription result");
+                    break;
+                }
+            }
+        }
+        state.SetCounter("subscriptions", kSubscriptionCount);
+        state.SetCounter("paths", kProfilePathCount);
+    }
+
+    ctx->Shutdown();
+}
+
+// Encode the paths of every subscription request.
+void BenchmarkReportingEngineSubscribe(Benchmark::State & state)
+{
+    RunSubscriptions(state, false);
+}
+
+// Copy the paths of every subscription request from a ReadRequestTemplate.
+void BenchmarkReportingEngineSubscribeWithTemplate(Benchmark::State & state)
+{
+    RunSubscriptions(state, true);
+}
+
+// Establish kSharedReportSubscriptionCount subscriptions to one attribute, then change the attribute once per iteration and
+// wait for every subscription to be sent a report of it. The reporting engine shares one encoding of the attribute between
+// the reports, unless CHIP_CONFIG_IM_REPORT_ENCODING_CACHE_SIZE is 0.
+void BenchmarkReportingEngineSharedReport(Benchmark::State & state)
+{
+    std::unique_ptr<Test::AppContext> ctx(new Test::AppContext());
+    if (ctx->Init() != CHIP_NO_ERROR)
+    {
+        state.SkipWithError("Failed to initialize the app context");
+        return;
+    }
+
+    {
+        reporting::Engine & reportingEngine = InteractionModelEngine::GetInstance()->GetReportingEngine();
+
+        AttributePathParams attributePath(Test::kMockEndpoint3, Test::MockClusterId(2), Test::MockAttributeId(2));
+        ReadPrepareParams readPrepareParams(ctx->GetSessionBobToAlice());
+        readPrepareParams.mpAttributePathParamsList    = &attributePath;
+        readPrepareParams.mAttributePathParamsListSize = 1;
+        readPrepareParams.mMinIntervalFloorSeconds     = 0;
+        readPrepareParams.mMaxIntervalCeilingSeconds   = 60;
+        readPrepareParams.mKeepSubscriptions           = true;
+
+        ReadCallback callbacks[kSharedReportSubscriptionCount];
+        std::unique_ptr<ReadClient> readClients[kSharedReportSubscriptionCount];
+        for (size_t i = 0; i < kSharedReportSubscriptionCount; i++)
+        {
+            readClients[i].reset(new ReadClient(InteractionModelEngine::GetInstance(), &ctx->GetExchangeManager(), callbacks[i],
+                                                ReadClient::InteractionType::Subscribe));
+            if (readClients[i]->SendRequest(readPrepareParams) != CHIP_NO_ERROR)
+            {
+                state.SkipWithError("ReadClient::SendRequest failed");
+                break;
+            }
+            ctx->DrainAndServiceIO();
+            if (!callbacks[i].mSubscriptionEstablished)
+            {
+                state.SkipWithError("Failed to establish the subscriptions");
+                break;
+            }
+        }
+
+        auto getReportCount = [&]() {
+            size_t reportCount = 0;
+            for (const auto & callback : callbacks)
+            {
+                reportCount += callback.mAttributeCount;
+            }
+            return reportCount;
+        };
+
+        size_t expectedReportCount = getReportCount();
+#if CHIP_CONFIG_IM_REPORT_ENCODING_CACHE_SIZE > 0
+        size_t sharedEncodingCount = reportingEngine.GetSharedEncodingHitCount();
+#endif
+        while (state.KeepRunning())
+        {
+            expectedReportCount += kSharedReportSubscriptionCount;
+            Test::BumpVersion();
+            if (reportingEngine.SetDirty(attributePath) != CHIP_NO_ERROR)
+            {
+                state.SkipWithError("Engine::SetDirty failed");
+                break;
+            }
+            ctx->GetIOContext().DriveIOUntil(System::Clock::Seconds16(1),
+                                             [&]() { return getReportCount() == expectedReportCount; });
+            ctx->DrainAndServiceIO();
+            if (getReportCount() != expectedReportCount)
+            {
+                state.SkipWithError("Missing reports");
+                break;
+            }
+        }
+        state.SetCounter("subscriptions", kSharedReportSubscriptionCount);
+#if CHIP_CONFIG_IM_REPORT_ENCODING_CACHE_SIZE > 0
+        sharedEncodingCount = reportingEngine.GetSharedEncodingHitCount() - sharedEncodingCount;
+        state.SetCounter("shared_per_change", sharedEncodingCount / std::max<uint64_t>(state.GetIterations(), 1));
+#endif
+    }
+
+    ctx->Shutdown();
+}
+
+// Establish kKeepAliveSubscriptionCount subscriptions with the same max interval, then move a mock clock to the end of the
+// max interval once per iteration and wait for every subscription to send its keep-alive report. The counters are the report
+// scheduler wakeups per iteration and the most deadlines one wakeup handled.
+void BenchmarkReportingEngineKeepAliveStorm(Benchmark::State & state)
+{
+    std::unique_ptr<Test::AppContext> ctx(new Test::AppContext());
+    if (ctx->Init() != CHIP_NO_ERROR)
+    {
+        state.SkipWithError("Failed to initialize the app context");
+        return;
+    }
+
+    System::Clock::Internal::MockClock clock;
+    System::Clock::ClockBase * realClock = &System::SystemClock();
+    System::Clock::Internal::SetSystemClockForTesting(&clock);
+    clock.SetMonotonic(System::Clock::Seconds64(1000));
+
+    {
+        reporting::ReportScheduler & scheduler = InteractionModelEngine::GetInstance()->GetReportingEngine().GetReportScheduler();
+
+        AttributePathParams attributePath(Test::kMockEndpoint3, Test::MockClusterId(2), Test::MockAttributeId(2));
+        ReadPrepareParams readPrepareParams(ctx->GetSessionBobToAlice());
+        readPrepareParams.mpAttributePathParamsList    = &attributePath;
+        readPrepareParams.mAttributePathParamsListSize = 1;
+        readPrepareParams.mMinIntervalFloorSeconds     = 0;
+        readPrepareParams.mMaxIntervalCeilingSeconds   = kKeepAliveMaxInterval;
+        readPrepareParams.mKeepSubscriptions           = true;
+
+        ReadCallback callbacks[kKeepAliveSubscriptionCount];
+        std::unique_ptr<ReadClient> readClients[kKeepAliveSubscriptionCount];
+        for (size_t i = 0; i < kKeepAliveSubscriptionCount; i++)
+        {
+            readClients[i].reset(new ReadClient(InteractionModelEngine::GetInstance(), &ctx->GetExchangeManager(), callbacks[i],
+                                                ReadClient::InteractionType::Subscribe));
+            if (readClients[i]->SendRequest(readPrepareParams) != CHIP_NO_ERROR)
+            {
+                state.SkipWithError("ReadClient::SendRequest failed");
+                break;
+            }
+            ctx->DrainAndServiceIO();
+            if (!callbacks[i].mSubscriptionEstablished)
+            {
+                state.SkipWithError("Failed to establish the subscriptions");
+                break;
+            }
+        }
+
+        // Keep-alive reports carry no data, so the clients do not see them.  Instead, every subscription handles the deadline
+        // of its max interval, sends its keep-alive and then handles the end of the min interval that report started.
+        auto isDone = [&](uint32_t aExpectedDeadlines) {
+            return scheduler.GetMetrics().mDeadlinesHandled >= aExpectedDeadlines &&
+                ctx->GetExchangeManager().GetNumActiveExchanges() == 0;
+        };
+
+        scheduler.ResetMetrics();
+        uint32_t expectedDeadlines = 0;
+        while (state.KeepRunning())
+        {
+            expectedDeadlines += 2 * kKeepAliveSubscriptionCount;
+            clock.AdvanceMonotonic(System::Clock::Seconds64(kKeepAliveMaxInterval));
+            // The mock clock does not move while the IO is driven, so bound the number of passes instead of the time.
+            for (size_t pass = 0; pass < kKeepAliveMaxDrivePasses && !isDone(expectedDeadlines); pass++)
+            {
+                ctx->DrainAndServiceIO();
+            }
+            if (!isDone(expectedDeadlines))
+            {
+                state.SkipWithError("Missing keep-alive reports");
+                break;
+            }
+        }
+        state.SetCounter("subscriptions", kKeepAliveSubscriptionCount);
+        state.SetCounter("wakeups", scheduler.GetMetrics().mWakeups / std::max<uint64_t>(state.GetIterations(), 1));
+        state.SetCounter("max_per_wakeup", scheduler.GetMetrics().mMaxDeadlinesPerWakeup);
+    }
+
+    System::Clock::Internal::SetSystemClockForTesting(realClock);
+    ctx->Shutdown();
+}
+
+class CacheCallback : public ClusterStateCache::Callback
+{
+public:
+    void OnError(CHIP_ERROR aError) override { mError = aError; }
+
+    void OnDone(ReadClient * apReadClient) override { mDone = true; }
+
+    void OnSubscriptionEstablished(SubscriptionId aSubscriptionId) override { mSubscriptionEstablished = true; }
+
+    CHIP_ERROR mError             = CHIP_NO_ERROR;
+    bool mDone                    = false;
+    bool mSubscriptionEstablished = false;
+};
+
+// Fill a cache with every attribute of the mock endpoints, the way a controller primes its model of a node.
+CHIP_ERROR PrimeCache(Test::AppContext & aCtx, ClusterStateCache & aCache, CacheCallback & aCallback)
+{
+    AttributePathParams attributePath;
+    ReadPrepareParams readPrepareParams(aCtx.GetSessionBobToAlice());
+    readPrepareParams.mpAttributePathParamsList    = &attributePath;
+    readPrepareParams.mAttributePathParamsListSize = 1;
+
+    ReadClient readClient(InteractionModelEngine::GetInstance(), &aCtx.GetExchangeManager(), aCache.GetBufferedCallback(),
+                          ReadClient::InteractionType::Read);
+    ReturnErrorOnFailure(readClient.SendRequest(readPrepareParams));
+    aCtx.DrainAndServiceIO();
+    VerifyOrReturnError(aCallback.mDone, CHIP_ERROR_INCORRECT_STATE);
+    return aCallback.mError;
+}
+
+// Build the model of a node per iteration by priming a ClusterStateCache with a wildcard read.
+void BenchmarkReportingEngineClusterStateCachePrime(Benchmark::State & state)
+{
+    std::unique_ptr<Test::AppContext> ctx(new Test::AppContext());
+    if (ctx->Init() != CHIP_NO_ERROR)
+    {
+        state.SkipWithError("Failed to initialize the app context");
+        return;
+    }
+
+    while (state.KeepRunning())
+    {
+        CacheCallback callback;
+        ClusterStateCache cache(callback);
+        if (PrimeCache(*ctx, cache, callback) != CHIP_NO_ERROR)
+        {
+            state.SkipWithError("Failed to prime the cache");
+            break;
+        }
+    }
+
+    ctx->Shutdown();
+}
+
+// Build the same model per iteration by loading a snapshot of a primed ClusterStateCache, as a controller does for the
+// nodes it already knows when it restarts.
+void BenchmarkReportingEngineClusterStateCacheLoadSnapshot(Benchmark::State & state)
+{
+    std::unique_ptr<Test::AppContext> ctx(new Test::AppContext());
+    if (ctx->Init() != CHIP_NO_ERROR)
+    {
+        state.SkipWithError("Failed to initialize the app context");
+        return;
+    }
+
+    {
+        CacheCallback callback;
+        ClusterStateCache primedCache(callback);
+        std::vector<uint8_t> buffer;
+        MutableByteSpan snapshot;
+        if (PrimeCache(*ctx, primedCache, callback) == CHIP_NO_ERROR)
+        {
+            buffer.resize(primedCache.GetSnapshotSizeUpperBound());
+            snapshot = MutableByteSpan(buffer.data(), buffer.size());
+        }
+        if (buffer.empty() || primedCache.SaveSnapshot(snapshot) != CHIP_NO_ERROR)
+        {
+            state.SkipWithError("Failed to save a snapshot of the cache");
+        }
+        else
+        {
+            while (state.KeepRunning())
+            {
+                CacheCallback loadedCallback;
+                ClusterStateCache cache(loadedCallback);
+                if (cache.LoadSnapshot(snapshot) != CHIP_NO_ERROR)
+                {
+                    state.SkipWithError("ClusterStateCache::LoadSnapshot failed");
+                    break;
+                }
+            }
+            state.SetCounter("snapshot_bytes", snapshot.size());
+        }
+    }
+
+    ctx->Shutdown();
+}
+
+// Subscribe to every attribute of kResubscribeNodeCount nodes through their ClusterStateCache, then drop every subscription
+// and resubscribe to all the nodes at once per iteration, as a controller does after a network blip. Nothing changed on the
+// nodes, so with data version filters the nodes only confirm the subscriptions. The bytes and messages counters are what the
+// loopback transport carried per iteration, in both directions.
+void RunResubscribeStorm(Benchmark::State & state, bool useFilters)
+{
+    std::unique_ptr<Test::AppContext> ctx(new Test::AppContext());
+    if (ctx->Init() != CHIP_NO_ERROR)
+    {
+        state.SkipWithError("Failed to initialize the app context");
+        return;
+    }
+
+    {
+        InteractionModelEngine * engine = InteractionModelEngine::GetInstance();
+
+        AttributePathParams attributePath;
+        ReadPrepareParams readPrepareParams(ctx->GetSessionBobToAlice());
+        readPrepareParams.mpAttributePathParamsList    = &attributePath;
+        readPrepareParams.mAttributePathParamsListSize = 1;
+        readPrepareParams.mMinIntervalFloorSeconds     = 0;
+        readPrepareParams.mMaxIntervalCeilingSeconds   = 60;
+        readPrepareParams.mKeepSubscriptions           = true;
+
+        std::unique_ptr<CacheCallback[]> callbacks(new CacheCallback[kResubscribeNodeCount]);
+        std::vector<std::unique_ptr<ClusterStateCache>> caches;
+        std::vector<std::unique_ptr<ReadClient>> readClients(kResubscribeNodeCount);
+        for (size_t i = 0; i < kResubscribeNodeCount; i++)
+        {
+            caches.emplace_back(new ClusterStateCache(callbacks[i]));
+            if (!useFilters)
+            {
+                caches.back()->SetDataVersionFilterBudget(0);
+            }
+        }
+
+        auto subscribeAll = [&]() {
+            for (size_t i = 0; i < kResubscribeNodeCount; i++)
+            {
+                callbacks[i].mSubscriptionEstablished = false;
+                readClients[i].reset(new ReadClient(engine, &ctx->GetExchangeManager(), caches[i]->GetBufferedCallback(),
+                                                    ReadClient::InteractionType::Subscribe));
+                ReturnErrorOnFailure(readClients[i]->SendRequest(readPrepareParams));
+            }
+            // The engine only has CHIP_IM_MAX_REPORTS_IN_FLIGHT priming reports in flight at a time.
+            auto allEstablished = [&]() {
+                return std::all_of(callbacks.get(), callbacks.get() + kResubscribeNodeCount,
+                                   [](const CacheCallback & aCallback) { return aCallback.mSubscriptionEstablished; });
+            };
+            ctx->GetIOContext().DriveIOUntil(System::Clock::Seconds16(5), allEstablished);
+            ctx->DrainAndServiceIO();
+            VerifyOrReturnError(allEstablished(), CHIP_ERROR_INCORRECT_STATE);
+            for (size_t i = 0; i < kResubscribeNodeCount; i++)
+            {
+                ReturnErrorOnFailure(callbacks[i].mError);
+            }
+            return CHIP_NO_ERROR;
+        };
+
+        if (subscribeAll() != CHIP_NO_ERROR)
+        {
+            state.SkipWithError("Failed to prime the caches");
+        }
+
+        uint64_t sentByteCount    = 0;
+        uint64_t sentMessageCount = 0;
+        while (state.KeepRunning())
+        {
+            state.PauseTiming();
+            engine->ShutdownActiveReads();
+            ctx->DrainAndServiceIO();
+            const uint64_t startByteCount    = ctx->GetLoopback().mSentByteCount;
+            const uint32_t startMessageCount = ctx->GetLoopback().mSentMessageCount;
+            state.ResumeTiming();
+
+            if (subscribeAll() != CHIP_NO_ERROR)
+            {
+                state.SkipWithError("Failed to resubscribe");
+                break;
+            }
+            sentByteCount += ctx->GetLoopback().mSentByteCount - startByteCount;
+            sentMessageCount += ctx->GetLoopback().mSentMessageCount - startMessageCount;
+        }
+        state.SetCounter("nodes", kResubscribeNodeCount);
+        if (state.GetIterations() != 0)
+        {
+            state.SetCounter("bytes", sentByteCount / state.GetIterations());
+            state.SetCounter("messages", sentMessageCount / state.GetIterations());
+        }
+
+        engine->ShutdownActiveReads();
+        ctx->DrainAndServiceIO();
+    }
+
+    ctx->Shutdown();
+}
+
+// Resubscribe without data version filters, so every node reports every attribute again.
+void BenchmarkReportingEngineResubscribeStorm(Benchmark::State & state)
+{
+    RunResubscribeStorm(state, false);
+}
+
+// Resubscribe with the data version filters of the cached clusters.
+void BenchmarkReportingEngineResubscribeStormWithFilters(Benchmark::State & state)
+{
+    RunResubscribeStorm(state, true);
+}
+
+// Read the ClusterRevision of the first mock cluster from kFanOutNodeCount nodes per iteration, with kFanOutReadsInFlight reads
+// in flight. The read of a node either uses ReadAttribute(), starting the read of the next node from its callbacks, or a
+// FanOutAttributeReader.
+void RunFanOutRead(Benchmark::State & state, bool useFanOutReader)
+{
+    std::unique_ptr<Test::AppContext> ctx(new Test::AppContext());
+    if (ctx->Init() != CHIP_NO_ERROR)
+    {
+        state.SkipWithError("Failed to initialize the app context");
+        return;
+    }
+
+    {
+        LoopbackDeviceProxy proxy(ctx->GetExchangeManager(), ctx->GetSessionBobToAlice());
+        std::unique_ptr<DeviceProxy * []> nodes(new DeviceProxy *[kFanOutNodeCount]);
+        for (size_t i = 0; i < kFanOutNodeCount; i++)
+        {
+            nodes[i] = &proxy;
+        }
+        Span<DeviceProxy * const> nodeSpan(nodes.get(), kFanOutNodeCount);
+
+        Controller::FanOutAttributeReader<uint16_t, kFanOutReadsInFlight> reader(&ctx->GetSystemLayer());
+        size_t startedCount = 0;
+        size_t successCount = 0;
+
+        // Passing of stack variables by reference is only safe because the reads complete before they go out of scope.
+        std::function<void()> startNextRead = [&]() {
+            DeviceProxy * node = nodes[startedCount++];
+            Controller::ReadAttribute<uint16_t>(
+                node->GetExchangeManager(), node->GetSecureSession().Value(), Test::kMockEndpoint1, Test::MockClusterId(1),
+                Clusters::Globals::Attributes::ClusterRevision::Id,
+                [&](const ConcreteDataAttributePath & aPath, const uint16_t & aData) {
+                    successCount++;
+                    if (startedCount < kFanOutNodeCount)
+                    {
+                        startNextRead();
+                    }
+                },
+                [&](const ConcreteDataAttributePath * aPath, CHIP_ERROR aError) {
+                    if (startedCount < kFanOutNodeCount)
+                    {
+                        startNextRead();
+                    }
+                });
+        };
+
+        while (state.KeepRunning())
+        {
+            startedCount = 0;
+            successCount = 0;
+            if (useFanOutReader)
+            {
+                CHIP_ERROR err = reader.Read(
+                    nodeSpan, Test::kMockEndpoint1, Test::MockClusterId(1), Clusters::Globals::Attributes::ClusterRevision::Id,
+                    nullptr, nullptr, [&](const Controller::FanOutReadResult & aResult) { successCount = aResult.mSuccessCount; });
+                if (err != CHIP_NO_ERROR)
+                {
+                    state.SkipWithError("FanOutAttributeReader::Read failed");
+                    break;
+                }
+            }
+            else
+            {
+                while (startedCount < kFanOutReadsInFlight)
+                {
+                    startNextRead();
+                }
+            }
+            ctx->DrainAndServiceIO();
+
+            if (successCount != kFanOutNodeCount)
+            {
+                state.SkipWithError("Unexpected read result");
+                break;
+            }
+        }
+        state.SetCounter("nodes", kFanOutNodeCount);
+        state.SetCounter("in_flight", kFanOutReadsInFlight);
+    }
+
+    ctx->Shutdown();
+}
+
+// Chain ReadAttribute() calls, which allocate the state of every read.
+void BenchmarkReportingEngineFanOutReadAttribute(Benchmark::State & state)
+{
+    RunFanOutRead(state, false);
+}
+
+// Read from every node with a FanOutAttributeReader.
+void BenchmarkReportingEngineFanOutReader(Benchmark::State & state)
+{
+    RunFanOutRead(state, true);
+}
+
+} // namespace
+
+CHIP_REGISTER_BENCHMARK(BenchmarkReportingEngineWildcardRead)
+CHIP_REGISTER_BENCHMARK(BenchmarkReportingEngineSubscribe)
+CHIP_REGISTER_BENCHMARK(BenchmarkReportingEngineSubscribeWithTemplate)
+CHIP_REGISTER_BENCHMARK(BenchmarkReportingEngineSharedReport)
+CHIP_REGISTER_BENCHMARK(BenchmarkReportingEngineKeepAliveStorm)
+CHIP_REGISTER_BENCHMARK(BenchmarkReportingEngineClusterStateCachePrime)
+CHIP_REGISTER_BENCHMARK(BenchmarkReportingEngineClusterStateCacheLoadSnapshot)
+CHIP_REGISTER_BENCHMARK(BenchmarkReportingEngineResubscribeStorm)
+CHIP_REGISTER_BENCHMARK(BenchmarkReportingEngineResubscribeStormWithFilters)
+CHIP_REGISTER_BENCHMARK(BenchmarkReportingEngineFanOutReadAttribute)
+CHIP_REGISTER_BENCHMARK(BenchmarkReportingEngineFanOutReader)
@@ -0,0 +1,150 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmarks of SessionManager message encryption and decryption, over the loopback transport of the messaging tests.
+ *
+ */
+
+#include "Benchmark.h"
+
+#include <messaging/ExchangeContext.h>
+#include <messaging/ExchangeDelegate.h>
+#include <messaging/tests/MessagingContext.h>
+#include <protocols/echo/Echo.h>
+#include <transport/SessionManager.h>
+
+#include <memory>
+
+using namespace chip;
+using namespace chip::Messaging;
+
+namespace {
+
+// Typical size of an Interaction Model message.
+constexpr size_t kPayloadSize = 256;
+
+const uint8_t kPayload[kPayloadSize] = { 0 };
+
+// Counts the messages that made it through decryption to the exchange layer.
+class CountingHandler : public UnsolicitedMessageHandler, public ExchangeDelegate
+{
+public:
+    CHIP_ERROR OnUnsolicitedMessageReceived(const PayloadHeader & payloadHeader, ExchangeDelegate *& newDelegate) override
+    {
+        newDelegate = this;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR OnMessageReceived(ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                                 System::PacketBufferHandle && payload) override
+    {
+        mReceivedCount++;
+        return CHIP_NO_ERROR;
+    }
+
+    void OnResponseTimeout(ExchangeContext * ec) override {}
+
+    uint64_t mReceivedCount = 0;
+};
+
+CHIP_ERROR PrepareMessage(Test::LoopbackMessagingContext & ctx, const SessionHandle & session,
+                          EncryptedPacketBufferHandle & preparedMessage)
+{
+    System::PacketBufferHandle buffer = MessagePacketBuffer::NewWithData(kPayload, sizeof(kPayload));
+    VerifyOrReturnError(!buffer.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+    // An unsolicited message that does not ask for an acknowledgement, so that the receiver does not answer.
+    PayloadHeader payloadHeader;
+    payloadHeader.SetMessageType(Protocols::Echo::MsgType::EchoRequest);
+    payloadHeader.SetInitiator(true);
+
+    return ctx.GetSecureSessionManager().PrepareMessage(session, payloadHeader, std::move(buffer), preparedMessage);
+}
+
+void BenchmarkSessionManagerEncrypt(Benchmark::State & state)
+{
+    std::unique_ptr<Test::LoopbackMessagingContext> ctx(new Test::LoopbackMessagingContext());
+    if (ctx->Init() != CHIP_NO_ERROR)
+    {
+        state.SkipWithError("Failed to initialize the messaging context");
+        return;
+    }
+
+    {
+        // The session handle has to be released before the context shuts down.
+        SessionHandle session = ctx->GetSessionBobToAlice();
+        while (state.KeepRunning())
+        {
+            EncryptedPacketBufferHandle preparedMessage;
+            if (PrepareMessage(*ctx, session, preparedMessage) != CHIP_NO_ERROR)
+            {
+                state.SkipWithError("SessionManager::PrepareMessage failed");
+            }
+        }
+    }
+    state.SetBytesPerIteration(kPayloadSize);
+
+    ctx->Shutdown();
+}
+
+// Encrypt, send over the loopback transport, decrypt and dispatch to the exchange layer.
+void BenchmarkSessionManagerEncryptDecrypt(Benchmark::State & state)
+{
+    std::unique_ptr<Test::LoopbackMessagingContext> ctx(new Test::LoopbackMessagingContext());
+    if (ctx->Init() != CHIP_NO_ERROR)
+    {
+        state.SkipWithError("Failed to initialize the messaging context");
+        return;
+    }
+
+    CountingHandler handler;
+    if (ctx->GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Protocols::Echo::MsgType::EchoRequest, &handler) !=
+        CHIP_NO_ERROR)
+    {
+        state.SkipWithError("Failed to register the message handler");
+    }
+
+    {
+        SessionHandle session = ctx->GetSessionBobToAlice();
+        while (state.KeepRunning())
+        {
+            EncryptedPacketBufferHandle preparedMessage;
+            if (PrepareMessage(*ctx, session, preparedMessage) != CHIP_NO_ERROR ||
+                ctx->GetSecureSessionManager().SendPreparedMessage(session, preparedMessage) != CHIP_NO_ERROR)
+            {
+                state.SkipWithError("Failed to send the message");
+            }
+            ctx->DrainAndServiceIO();
+        }
+    }
+    if (state.GetError() == nullptr && handler.mReceivedCount != state.GetIterations())
+    {
+        state.SkipWithError("Messages were lost");
+    }
+    state.SetBytesPerIteration(kPayloadSize);
+
+    ctx->GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Protocols::Echo::MsgType::EchoRequest);
+    ctx->Shutdown();
+}
+
+} // namespace
+
+CHIP_REGISTER_BENCHMARK(BenchmarkSessionManagerEncrypt)
+CHIP_REGISTER_BENCHMARK(BenchmarkSessionManagerEncryptDecrypt)
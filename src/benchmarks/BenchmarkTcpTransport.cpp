@@ -0,0 +1,135 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmark of a bulk transfer over the TCP transport, on a loopback connection.
+ *
+ */
+
+#include "Benchmark.h"
+
+#include <inet/InetConfig.h>
+
+#if INET_CONFIG_ENABLE_TCP_ENDPOINT
+
+#include <inet/IPAddress.h>
+#include <transport/TransportMgr.h>
+#include <transport/TransportMgrBase.h>
+#include <transport/raw/MessageHeader.h>
+#include <transport/raw/TCP.h>
+#include <transport/raw/tests/NetworkTestHelpers.h>
+
+#include <string.h>
+
+using namespace chip;
+
+namespace {
+
+// Messages queued back to back per iteration, each about the size of a BDX block of an OTA image.
+constexpr size_t kMessagesPerIteration = 32;
+constexpr uint16_t kPayloadSize        = 1024;
+
+// The transport connects to itself, which takes a connection on each side.
+using TCPImpl = Transport::TCP<2 /* active connections */, kMessagesPerIteration /* pending packets */>;
+
+class CountingDelegate : public TransportMgrDelegate
+{
+public:
+    void OnMessageReceived(const Transport::PeerAddress & source, System::PacketBufferHandle && msgBuf) override
+    {
+        mReceivedCount++;
+    }
+
+    size_t mReceivedCount = 0;
+};
+
+CHIP_ERROR QueueMessages(TCPImpl & tcp, const Transport::PeerAddress & peer, uint32_t & messageCounter)
+{
+    for (size_t i = 0; i < kMessagesPerIteration; i++)
+    {
+        System::PacketBufferHandle buffer = System::PacketBufferHandle::New(kPayloadSize);
+        VerifyOrReturnError(!buffer.IsNull(), CHIP_ERROR_NO_MEMORY);
+        memset(buffer->Start(), 0, kPayloadSize);
+        buffer->SetDataLength(kPayloadSize);
+
+        PacketHeader header;
+        header.SetMessageCounter(messageCounter++);
+        ReturnErrorOnFailure(header.EncodeBeforeData(buffer));
+        ReturnErrorOnFailure(tcp.SendMessage(peer, std::move(buffer)));
+    }
+    return CHIP_NO_ERROR;
+}
+
+// Send kMessagesPerIteration messages on one connection and wait until they have all been received. The first iteration
+// includes setting up the connection.
+void BenchmarkTcpTransportLoopbackThroughput(Benchmark::State & state)
+{
+    Test::IOContext io;
+    if (io.Init() != CHIP_NO_ERROR)
+    {
+        state.SkipWithError("Failed to initialize the IO context");
+        return;
+    }
+
+    {
+        Inet::IPAddress address;
+        Inet::IPAddress::FromString("::1", address);
+        const Transport::PeerAddress peer = Transport::PeerAddress::TCP(address);
+
+        TCPImpl tcp;
+        TransportMgrBase transportMgr;
+        CountingDelegate delegate;
+        if (tcp.Init(Transport::TcpListenParameters(io.GetTCPEndPointManager()).SetAddressType(address.Type())) !=
+                CHIP_NO_ERROR ||
+            transportMgr.Init(&tcp) != CHIP_NO_ERROR)
+        {
+            state.SkipWithError("Failed to initialize the TCP transport");
+        }
+        transportMgr.SetSessionManager(&delegate);
+
+        uint32_t messageCounter = 0;
+        while (state.KeepRunning())
+        {
+            const size_t expectedCount = delegate.mReceivedCount + kMessagesPerIteration;
+            if (QueueMessages(tcp, peer, messageCounter) != CHIP_NO_ERROR)
+            {
+                state.SkipWithError("Failed to send the messages");
+                break;
+            }
+            io.DriveIOUntil(System::Clock::Seconds16(5), [&]() { return delegate.mReceivedCount >= expectedCount; });
+            if (delegate.mReceivedCount < expectedCount)
+            {
+                state.SkipWithError("Timed out waiting for the messages");
+                break;
+            }
+        }
+        state.SetBytesPerIteration(kMessagesPerIteration * kPayloadSize);
+
+        tcp.Disconnect(peer);
+        io.DriveIOUntil(System::Clock::Seconds16(5), [&tcp]() { return !tcp.HasActiveConnections(); });
+    }
+
+    io.Shutdown();
+}
+
+} // namespace
+
+CHIP_REGISTER_BENCHMARK(BenchmarkTcpTransportLoopbackThroughput)
+
+#endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
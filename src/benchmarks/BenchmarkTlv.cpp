@@ -0,0 +1,156 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmarks of TLV encoding and decoding, on a structure shaped like an attribute report.
+ *
+ */
+
+#include "Benchmark.h"
+
+#include <lib/core/TLV.h>
+
+using namespace chip;
+
+namespace {
+
+constexpr size_t kBufferSize  = 1024;
+constexpr size_t kReportCount = 8;
+
+CHIP_ERROR EncodeReports(TLV::TLVWriter & writer)
+{
+    TLV::TLVType outer;
+    TLV::TLVType reports;
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outer));
+    ReturnErrorOnFailure(writer.StartContainer(TLV::ContextTag(1), TLV::kTLVType_Array, reports));
+    for (size_t i = 0; i < kReportCount; i++)
+    {
+        TLV::TLVType report;
+        TLV::TLVType path;
+        ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, report));
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(0), static_cast<uint32_t>(0x1234 + i)));
+        ReturnErrorOnFailure(writer.StartContainer(TLV::ContextTag(1), TLV::kTLVType_List, path));
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(2), static_cast<uint16_t>(1)));
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(3), static_cast<uint32_t>(0x0006)));
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(4), static_cast<uint32_t>(i)));
+        ReturnErrorOnFailure(writer.EndContainer(path));
+        ReturnErrorOnFailure(writer.PutString(TLV::ContextTag(2), "benchmark value"));
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(3), static_cast<int64_t>(-1) * static_cast<int64_t>(i << 20)));
+        ReturnErrorOnFailure(writer.PutBoolean(TLV::ContextTag(4), (i % 2) == 0));
+        ReturnErrorOnFailure(writer.EndContainer(report));
+    }
+    ReturnErrorOnFailure(writer.EndContainer(reports));
+    ReturnErrorOnFailure(writer.Put(TLV::ContextTag(0xFF), static_cast<uint8_t>(1)));
+    return writer.EndContainer(outer);
+}
+
+// Visit every element, reading the scalar values like a decoder of the structure would.
+CHIP_ERROR DecodeElements(TLV::TLVReader & reader, uint64_t & checksum)
+{
+    CHIP_ERROR err;
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        switch (reader.GetType())
+        {
+        case TLV::kTLVType_Structure:
+        case TLV::kTLVType_Array:
+        case TLV::kTLVType_List: {
+            TLV::TLVType container;
+            ReturnErrorOnFailure(reader.EnterContainer(container));
+            ReturnErrorOnFailure(DecodeElements(reader, checksum));
+            ReturnErrorOnFailure(reader.ExitContainer(container));
+            break;
+        }
+        case TLV::kTLVType_UnsignedInteger: {
+            uint64_t value;
+            ReturnErrorOnFailure(reader.Get(value));
+            checksum += value;
+            break;
+        }
+        case TLV::kTLVType_SignedInteger: {
+            int64_t value;
+            ReturnErrorOnFailure(reader.Get(value));
+            checksum += static_cast<uint64_t>(value);
+            break;
+        }
+        case TLV::kTLVType_UTF8String: {
+            CharSpan value;
+            ReturnErrorOnFailure(reader.Get(value));
+            checksum += value.size();
+            break;
+        }
+        default:
+            break;
+        }
+    }
+    return (err == CHIP_END_OF_TLV) ? CHIP_NO_ERROR : err;
+}
+
+void BenchmarkTlvEncode(Benchmark::State & state)
+{
+    uint8_t buffer[kBufferSize];
+    uint32_t length = 0;
+
+    while (state.KeepRunning())
+    {
+        TLV::TLVWriter writer;
+        writer.Init(buffer);
+        if (EncodeReports(writer) != CHIP_NO_ERROR || writer.Finalize() != CHIP_NO_ERROR)
+        {
+            state.SkipWithError("Encoding failed");
+        }
+        length = writer.GetLengthWritten();
+    }
+
+    state.SetBytesPerIteration(length);
+}
+
+void BenchmarkTlvDecode(Benchmark::State & state)
+{
+    uint8_t buffer[kBufferSize];
+    TLV::TLVWriter writer;
+    writer.Init(buffer);
+    if (EncodeReports(writer) != CHIP_NO_ERROR || writer.Finalize() != CHIP_NO_ERROR)
+    {
+        state.SkipWithError("Encoding failed");
+        return;
+    }
+    uint32_t length = writer.GetLengthWritten();
+
+    volatile uint64_t sink = 0;
+    while (state.KeepRunning())
+    {
+        TLV::TLVReader reader;
+        uint64_t checksum = 0;
+        reader.Init(buffer, length);
+        if (DecodeElements(reader, checksum) != CHIP_NO_ERROR)
+        {
+            state.SkipWithError("Decoding failed");
+        }
+        sink = checksum;
+    }
+    (void) sink;
+
+    state.SetBytesPerIteration(length);
+}
+
+} // namespace
+
+CHIP_REGISTER_BENCHMARK(BenchmarkTlvEncode)
+CHIP_REGISTER_BENCHMARK(BenchmarkTlvDecode)
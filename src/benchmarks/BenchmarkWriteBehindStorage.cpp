@@ -0,0 +1,151 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmarks of how long a burst of persistent storage writes stalls the event loop, written directly to a storage
+ *      that commits every write or through a WriteBehindStorageDelegate.
+ *
+ */
+
+#include "Benchmark.h"
+
+#include <app/WriteBehindStorageDelegate.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <transport/raw/tests/NetworkTestHelpers.h>
+
+#include <chrono>
+#include <stdio.h>
+#include <thread>
+
+using namespace chip;
+using namespace chip::System::Clock::Literals;
+
+namespace {
+
+// A burst of attribute writes, e.g. the level of kKeyCount lights reported kWritesPerKey times during a transition.
+constexpr size_t kKeyCount     = 8;
+constexpr size_t kWritesPerKey = 4;
+
+// Time the storage takes to commit one write, e.g. to rewrite and sync the file holding every key.
+constexpr std::chrono::microseconds kCommitTime(200);
+
+// A storage that takes kCommitTime to commit each write or delete.
+class SlowStorage : public TestPersistentStorageDelegate
+{
+public:
+    CHIP_ERROR SyncSetKeyValue(const char * key, const void * value, uint16_t size) override
+    {
+        mCommitCount++;
+        std::this_thread::sleep_for(kCommitTime);
+        return TestPersistentStorageDelegate::SyncSetKeyValue(key, value, size);
+    }
+
+    CHIP_ERROR SyncDeleteKeyValue(const char * key) override
+    {
+        mCommitCount++;
+        std::this_thread::sleep_for(kCommitTime);
+        return TestPersistentStorageDelegate::SyncDeleteKeyValue(key);
+    }
+
+    uint64_t mCommitCount = 0;
+};
+
+CHIP_ERROR WriteBurst(PersistentStorageDelegate & storage, uint32_t iteration)
+{
+    char key[PersistentStorageDelegate::kKeyLengthMax + 1];
+    for (size_t write = 0; write < kWritesPerKey; write++)
+    {
+        for (size_t i = 0; i < kKeyCount; i++)
+        {
+            snprintf(key, sizeof(key), "a/%u", static_cast<unsigned>(i));
+            const uint32_t value = iteration;
+            ReturnErrorOnFailure(storage.SyncSetKeyValue(key, &value, sizeof(value)));
+        }
+    }
+    return CHIP_NO_ERROR;
+}
+
+// Write each burst directly to the storage.
+void BenchmarkWriteBehindStorageWriteThrough(Benchmark::State & state)
+{
+    SlowStorage storage;
+    uint32_t iteration = 0;
+    while (state.KeepRunning())
+    {
+        if (WriteBurst(storage, iteration++) != CHIP_NO_ERROR)
+        {
+            state.SkipWithError("Failed to write the burst");
+            break;
+        }
+    }
+    state.SetCounter("writes", kKeyCount * kWritesPerKey);
+    state.SetCounter("commits", state.GetIterations() == 0 ? 0 : storage.mCommitCount / state.GetIterations());
+}
+
+// Queue each burst in a WriteBehindStorageDelegate. Only the time the writer is blocked is measured; the flush_ns counter is
+// the time the flush that the timer would run later blocks the event loop for.
+void BenchmarkWriteBehindStorageQueued(Benchmark::State & state)
+{
+    Test::IOContext io;
+    if (io.Init() != CHIP_NO_ERROR)
+    {
+        state.SkipWithError("Failed to initialize the IO context");
+        return;
+    }
+
+    {
+        SlowStorage storage;
+        app::WriteBehindStorageDelegate writeBehind(storage, io.GetSystemLayer(), 60000_ms32);
+        std::chrono::nanoseconds flushTime(0);
+        uint32_t iteration = 0;
+        while (state.KeepRunning())
+        {
+            if (WriteBurst(writeBehind, iteration++) != CHIP_NO_ERROR)
+            {
+                state.SkipWithError("Failed to write the burst");
+                break;
+            }
+
+            state.PauseTiming();
+            const auto flushStart = std::chrono::steady_clock::now();
+            const CHIP_ERROR err  = writeBehind.SyncFlush();
+            flushTime += std::chrono::steady_clock::now() - flushStart;
+            state.ResumeTiming();
+            if (err != CHIP_NO_ERROR)
+            {
+                state.SkipWithError("Failed to flush the burst");
+                break;
+            }
+        }
+
+        state.SetCounter("writes", kKeyCount * kWritesPerKey);
+        if (state.GetIterations() != 0)
+        {
+            state.SetCounter("commits", storage.mCommitCount / state.GetIterations());
+            state.SetCounter("flush_ns", static_cast<uint64_t>(flushTime.count()) / state.GetIterations());
+        }
+    }
+
+    io.Shutdown();
+}
+
+} // namespace
+
+CHIP_REGISTER_BENCHMARK(BenchmarkWriteBehindStorageWriteThrough)
+CHIP_REGISTER_BENCHMARK(BenchmarkWriteBehindStorageQueued)
@@ -483,6 +483,9 @@ void DeviceCommissioner::Shutdown()
 
     mSetUpCodePairer.CommissionerShuttingDown();
 
+    mCommissioningQueue.Clear();
+    mSystemState->SystemLayer()->CancelTimer(StartNextQueuedCommission, this);
+
     // Check to see if pairing in progress before shutting down
     CommissioneeDeviceProxy * device = mDeviceInPASEEstablishment;
     if (device != nullptr && device->IsSessionSetupInProgress())
@@ -856,6 +859,54 @@ CHIP_ERROR DeviceCommissioner::Commission(NodeId remoteDeviceId)
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR DeviceCommissioner::QueueCommission(NodeId remoteDeviceId)
+{
+    VerifyOrReturnError(mState == State::Initialized, CHIP_ERROR_INCORRECT_STATE);
+
+    if (!IsCommissioningInProgress() && mCommissioningQueue.IsEmpty())
+    {
+        return Commission(remoteDeviceId);
+    }
+
+    ReturnErrorOnFailure(mCommissioningQueue.Enqueue(remoteDeviceId));
+
+    ChipLogProgress(Controller, "Queued commissioning of node ID 0x" ChipLogFormatX64 " (%u waiting)",
+                    ChipLogValueX64(remoteDeviceId), static_cast<unsigned>(mCommissioningQueue.Count()));
+    return CHIP_NO_ERROR;
+}
+
+void DeviceCommissioner::ScheduleNextQueuedCommission()
+{
+    if (mCommissioningQueue.IsEmpty())
+    {
+        return;
+    }
+
+    // Start the next commissioning from a fresh call stack, since we may be inside the completion callbacks of the previous one.
+    CHIP_ERROR err = mSystemState->SystemLayer()->StartTimer(System::Clock::kZero, StartNextQueuedCommission, this);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Controller, "Failed to schedule queued commissioning: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+}
+
+void DeviceCommissioner::StartNextQueuedCommission(System::Layer * systemLayer, void * context)
+{
+    auto * commissioner = static_cast<DeviceCommissioner *>(context);
+    VerifyOrReturn(!commissioner->IsCommissioningInProgress());
+    commissioner->mCommissioningQueue.StartNext(*commissioner);
+}
+
+void DeviceCommissioner::OnQueuedCommissioningFailed(NodeId nodeId, CHIP_ERROR error)
+{
+    ChipLogError(Controller, "Failed to start queued commissioning of node ID 0x" ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
+                 ChipLogValueX64(nodeId), error.Format());
+    if (mPairingDelegate != nullptr)
+    {
+        mPairingDelegate->OnCommissioningComplete(nodeId, error);
+    }
+}
+
 CHIP_ERROR
 DeviceCommissioner::ContinueCommissioningAfterDeviceAttestation(DeviceProxy * device,
                                                                 Credentials::AttestationVerificationResult attestationResult)
@@ -938,6 +989,13 @@ void DeviceCommissioner::RendezvousCleanup(CHIP_ERROR status)
         {
             mPairingDelegate->OnPairingComplete(status);
         }
+
+        // The device we were going to commission once connected is gone, so move on to any queued commissioning.
+        if (mRunCommissioningAfterConnection)
+        {
+            mRunCommissioningAfterConnection = false;
+            ScheduleNextQueuedCommission();
+        }
     }
 }
 
@@ -1665,6 +1723,8 @@ void DeviceCommissioner::DisarmDone()
 void DeviceCommissioner::SendCommissioningCompleteCallbacks(NodeId nodeId, const CompletionStatus & completionStatus)
 {
     mCommissioningStage = CommissioningStage::kSecurePairing;
+    ScheduleNextQueuedCommission();
+
     if (mPairingDelegate == nullptr)
     {
         return;
@@ -39,6 +39,7 @@
 #include <controller/CHIPDeviceControllerSystemState.h>
 #include <controller/CommissioneeDeviceProxy.h>
 #include <controller/CommissioningDelegate.h>
+#include <controller/CommissioningQueue.h>
 #include <controller/DevicePairingDelegate.h>
 #include <controller/OperationalCredentialsDelegate.h>
 #include <controller/SetUpCodePairer.h>
@@ -384,7 +385,8 @@ class DLL_EXPORT DeviceCommissioner : public DeviceController,
                                       public Protocols::UserDirectedCommissioning::InstanceNameResolver,
 #endif
                                       public SessionEstablishmentDelegate,
-                                      public app::ClusterStateCache::Callback
+                                      public app::ClusterStateCache::Callback,
+                                      public CommissioningQueue<kNumMaxActiveDevices>::Delegate
 {
 public:
     DeviceCommissioner();
@@ -509,6 +511,33 @@ public:
     CHIP_ERROR Commission(NodeId remoteDeviceId, CommissioningParameters & params);
     CHIP_ERROR Commission(NodeId remoteDeviceId);
 
+    /**
+     * @brief
+     *   Queue auto-commissioning of a node that has (or is establishing) a PASE connection. If no commissioning is in
+     *   progress, this is the same as Commission(). Otherwise the node is commissioned once the commissioning ahead of it
+     *   completes, which allows PASE connections to further devices to be established with EstablishPASEConnection while
+     *   another device is being commissioned.
+     *
+     *   Queued nodes are commissioned in order, with the commissioning parameters the default commissioner has when their
+     *   commissioning starts. If commissioning of a queued node cannot be started, OnCommissioningComplete is called with
+     *   the error for that node.
+     *
+     *   This does not commission nodes concurrently: attestation, CSR, NOC issuance and network setup of a queued node only
+     *   start once the node ahead of it has completed all of them. Commissioning N nodes still takes N times as long as
+     *   commissioning one, less the PASE establishment that overlaps.
+     *
+     * @param[in] remoteDeviceId        The remote device Id.
+     *
+     * @return CHIP_ERROR_NO_MEMORY if the queue is full.
+     */
+    CHIP_ERROR QueueCommission(NodeId remoteDeviceId);
+
+    /**
+     * @brief
+     *   Returns the number of nodes waiting in the commissioning queue.
+     */
+    size_t GetQueuedCommissionCount() const { return mCommissioningQueue.Count(); }
+
     /**
      * @brief
      *   This function instructs the commissioner to proceed to the next stage of commissioning after
@@ -713,6 +742,9 @@ private:
     CommissioningStage mCommissioningStage = CommissioningStage::kSecurePairing;
     bool mRunCommissioningAfterConnection  = false;
 
+    // Nodes waiting for the current commissioning to complete, in order (see QueueCommission).
+    CommissioningQueue<kNumMaxActiveDevices> mCommissioningQueue;
+
     ObjectPool<CommissioneeDeviceProxy, kNumMaxActiveDevices> mCommissioneeDevicePool;
 
 #if CHIP_DEVICE_CONFIG_ENABLE_COMMISSIONER_DISCOVERY // make this commissioner discoverable
@@ -908,6 +940,17 @@ private:
     // OnCommissioningComplete and either OnCommissioningSuccess or OnCommissioningFailure depending on the given completion status.
     void SendCommissioningCompleteCallbacks(NodeId nodeId, const CompletionStatus & completionStatus);
 
+    bool IsCommissioningInProgress() const
+    {
+        return mCommissioningStage != CommissioningStage::kSecurePairing || mRunCommissioningAfterConnection;
+    }
+    void ScheduleNextQueuedCommission();
+    static void StartNextQueuedCommission(System::Layer * systemLayer, void * context);
+
+    // CommissioningQueue::Delegate
+    CHIP_ERROR StartQueuedCommissioning(NodeId nodeId) override { return Commission(nodeId); }
+    void OnQueuedCommissioningFailed(NodeId nodeId, CHIP_ERROR error) override;
+
     // Cleans up and resets failsafe as appropriate depending on the error and the failed stage.
     // For success, sends completion report with the CommissioningDelegate and sends callbacks to the PairingDelegate
     // For failures after AddNOC succeeds, sends completion report with the CommissioningDelegate and sends callbacks to the
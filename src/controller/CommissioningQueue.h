@@ -0,0 +1,105 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/NodeId.h>
+#include <lib/support/CodeUtils.h>
+
+#include <stddef.h>
+#include <string.h>
+
+namespace chip {
+namespace Controller {
+
+/**
+ * Nodes waiting for the commissioning ahead of them to complete, in the order they were queued (see
+ * DeviceCommissioner::QueueCommission).
+ *
+ * This is a serial FIFO: DeviceCommissioner still runs a single commissioning state machine, so nodes are commissioned one
+ * at a time and no commissioning stage of one node overlaps with a stage of another. Only the PASE sessions of the nodes
+ * waiting here can be established while a node ahead of them is being commissioned.
+ */
+template <size_t kCapacity>
+class CommissioningQueue
+{
+public:
+    class Delegate
+    {
+    public:
+        virtual ~Delegate() {}
+
+        /**
+         * Starts commissioning a node taken off the queue.
+         *
+         * @return an error if commissioning of the node could not be started.
+         */
+        virtual CHIP_ERROR StartQueuedCommissioning(NodeId nodeId) = 0;
+
+        /**
+         * Called when commissioning of a node taken off the queue could not be started.
+         */
+        virtual void OnQueuedCommissioningFailed(NodeId nodeId, CHIP_ERROR error) = 0;
+    };
+
+    /**
+     * Adds a node at the end of the queue.
+     *
+     * @return CHIP_ERROR_NO_MEMORY if the queue is full.
+     */
+    CHIP_ERROR Enqueue(NodeId nodeId)
+    {
+        VerifyOrReturnError(mCount < kCapacity, CHIP_ERROR_NO_MEMORY);
+        mNodeIds[mCount++] = nodeId;
+        return CHIP_NO_ERROR;
+    }
+
+    /**
+     * Starts commissioning the node at the head of the queue. A node whose commissioning cannot be started is reported to
+     * the delegate, and the next node is tried, until one starts or the queue is empty.
+     */
+    void StartNext(Delegate & delegate)
+    {
+        while (mCount > 0)
+        {
+            NodeId nodeId = mNodeIds[0];
+            mCount--;
+            memmove(&mNodeIds[0], &mNodeIds[1], mCount * sizeof(mNodeIds[0]));
+
+            CHIP_ERROR err = delegate.StartQueuedCommissioning(nodeId);
+            if (err == CHIP_NO_ERROR)
+            {
+                return;
+            }
+            delegate.OnQueuedCommissioningFailed(nodeId, err);
+        }
+    }
+
+    void Clear() { mCount = 0; }
+
+    size_t Count() const { return mCount; }
+    bool IsEmpty() const { return mCount == 0; }
+
+private:
+    NodeId mNodeIds[kCapacity];
+    size_t mCount = 0;
+};
+
+} // namespace Controller
+} // namespace chip
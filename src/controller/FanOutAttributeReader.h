@@ -0,0 +1,344 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/AttributePathParams.h>
+#include <app/BufferedReadCallback.h>
+#include <app/ConcreteAttributePath.h>
+#include <app/DeviceProxy.h>
+#include <app/InteractionModelEngine.h>
+#include <app/ReadClient.h>
+#include <app/ReadPrepareParams.h>
+#include <app/data-model/Decode.h>
+#include <lib/support/Pool.h>
+#include <lib/support/Span.h>
+#include <system/SystemLayer.h>
+
+#include <functional>
+#include <type_traits>
+
+namespace chip {
+namespace Controller {
+
+/*
+ * The outcome of a fan-out read, in number of nodes.
+ */
+struct FanOutReadResult
+{
+    size_t mSuccessCount   = 0;
+    size_t mFailureCount   = 0;
+    size_t mCancelledCount = 0;
+};
+
+/*
+ * Reads the same attribute from many nodes, e.g. the state of every light of an installation, and tells when all of them
+ * are done.
+ *
+ * ReadAttribute() allocates the state of each read, and leaves it to the caller to chain the reads and to keep track of the
+ * ones still in flight. A FanOutAttributeReader instead keeps up to N reads in flight, in a pool allocated along with it,
+ * starts the read of the next node as soon as one completes, and calls the done callback once every node has answered,
+ * failed or been cancelled.
+ *
+ * The node callbacks are called as the nodes answer, with the position of the node in the span given to Read(); the decoded
+ * value is only valid during the callback. The done callback is called exactly once per Read(), never from within Read() or
+ * from a node callback, and may destroy the reader or start another fan-out. The reader must not be destroyed from a node
+ * callback.
+ */
+template <typename DecodableAttributeType, size_t N = CHIP_CONFIG_CONTROLLER_MAX_FAN_OUT_READS>
+class FanOutAttributeReader
+{
+public:
+    using OnNodeSuccessCallbackType = std::function<void(size_t aNodeIndex, const DecodableAttributeType & aData)>;
+    using OnNodeErrorCallbackType   = std::function<void(size_t aNodeIndex, CHIP_ERROR aError)>;
+    using OnDoneCallbackType        = std::function<void(const FanOutReadResult & aResult)>;
+
+    FanOutAttributeReader(System::Layer * aSystemLayer) : mSystemLayer(aSystemLayer) {}
+
+    ~FanOutAttributeReader()
+    {
+        mSystemLayer->CancelTimer(HandleStart, this);
+        mOperations.ReleaseAll();
+    }
+
+    FanOutAttributeReader(const FanOutAttributeReader &) = delete;
+    FanOutAttributeReader & operator=(const FanOutAttributeReader &) = delete;
+
+    /*
+     * Read the attribute from every node. The nodes must stay valid until the done callback is called. The node callbacks
+     * are optional.
+     *
+     * The reads start from the event loop, after Read() returns. Nodes without a secure session fail with
+     * CHIP_ERROR_NOT_CONNECTED, and nodes that answer without the attribute fail with CHIP_ERROR_NOT_FOUND.
+     *
+     * @retval CHIP_ERROR_INCORRECT_STATE if a fan-out is already in progress.
+     */
+    CHIP_ERROR Read(const Span<DeviceProxy * const> & aNodes, EndpointId aEndpointId, ClusterId aClusterId,
+                    AttributeId aAttributeId, OnNodeSuccessCallbackType aOnNodeSuccess, OnNodeErrorCallbackType aOnNodeError,
+                    OnDoneCallbackType aOnDone, bool aFabricFiltered = true)
+    {
+        VerifyOrReturnError(!mActive, CHIP_ERROR_INCORRECT_STATE);
+        VerifyOrReturnError(aOnDone, CHIP_ERROR_INVALID_ARGUMENT);
+        ReturnErrorOnFailure(mSystemLayer->StartTimer(System::Clock::kZero, HandleStart, this));
+
+        mNodes           = aNodes;
+        mPath            = app::AttributePathParams(aEndpointId, aClusterId, aAttributeId);
+        mFabricFiltered  = aFabricFiltered;
+        mOnNodeSuccess   = std::move(aOnNodeSuccess);
+        mOnNodeError     = std::move(aOnNodeError);
+        mOnDone          = std::move(aOnDone);
+        mResult          = FanOutReadResult();
+        mNextNodeIndex   = 0;
+        mCancelRequested = false;
+        mActive          = true;
+        return CHIP_NO_ERROR;
+    }
+
+    /*
+     * A typed way to read an attribute from every node. The AttributeTypeInfo is a ClusterName::Attributes::AttributeName::TypeInfo
+     * struct, see ReadAttribute().
+     */
+    template <typename AttributeTypeInfo>
+    CHIP_ERROR Read(const Span<DeviceProxy * const> & aNodes, EndpointId aEndpointId, OnNodeSuccessCallbackType aOnNodeSuccess,
+                    OnNodeErrorCallbackType aOnNodeError, OnDoneCallbackType aOnDone, bool aFabricFiltered = true)
+    {
+        static_assert(std::is_same<typename AttributeTypeInfo::DecodableType, DecodableAttributeType>::value,
+                      "The attribute must decode to the type of the reader");
+        return Read(aNodes, aEndpointId, AttributeTypeInfo::GetClusterId(), AttributeTypeInfo::GetAttributeId(),
+                    std::move(aOnNodeSuccess), std::move(aOnNodeError), std::move(aOnDone), aFabricFiltered);
+    }
+
+    bool IsActive() const { return mActive; }
+
+    /*
+     * Stop the fan-out in progress: abort the reads in flight, and count the nodes that have not answered yet as cancelled.
+     *
+     * The done callback is called before Cancel() returns or, when Cancel() is called from a node callback, as soon as that
+     * callback returns.
+     */
+    void Cancel()
+    {
+        VerifyOrReturn(mActive);
+        if (mInNodeCallback)
+        {
+            mCancelRequested = true;
+            return;
+        }
+
+        mSystemLayer->CancelTimer(HandleStart, this);
+        mOperations.ReleaseAll();
+        mInFlightCount = 0;
+        Finish();
+    }
+
+private:
+    // The read of one node, which lives in the pool of the reader while it is in flight.
+    class Operation final : public app::ReadClient::Callback
+    {
+    public:
+        Operation(FanOutAttributeReader & aReader, size_t aNodeIndex, Messaging::ExchangeManager * apExchangeMgr) :
+            mReader(aReader), mNodeIndex(aNodeIndex), mBufferedReadAdapter(*this),
+            mReadClient(app::InteractionModelEngine::GetInstance(), apExchangeMgr, mBufferedReadAdapter,
+                        app::ReadClient::InteractionType::Read)
+        {}
+
+        CHIP_ERROR SendRequest(app::ReadPrepareParams & aReadParams) { return mReadClient.SendRequest(aReadParams); }
+
+        size_t GetNodeIndex() const { return mNodeIndex; }
+        bool HasAnswered() const { return mAnswered; }
+
+    private:
+        void OnAttributeData(const app::ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
+                             const app::StatusIB & aStatus) override
+        {
+            // Only the first answer of the node counts, as with ReadAttribute().
+            VerifyOrReturn(!mAnswered);
+            mAnswered = true;
+
+            CHIP_ERROR err = CHIP_NO_ERROR;
+            DecodableAttributeType value;
+
+            //
+            // List item operations are handled by the buffered read callback.
+            //
+            VerifyOrDie(!aPath.IsListItemOperation());
+
+            VerifyOrExit(aStatus.IsSuccess(), err = aStatus.ToChipError());
+            VerifyOrExit(aPath.mClusterId == mReader.mPath.mClusterId && aPath.mAttributeId == mReader.mPath.mAttributeId,
+                         err = CHIP_ERROR_SCHEMA_MISMATCH);
+            VerifyOrExit(apData != nullptr, err = CHIP_ERROR_INVALID_ARGUMENT);
+
+            SuccessOrExit(err = app::DataModel::Decode(*apData, value));
+
+            mReader.OnNodeSuccess(mNodeIndex, value);
+
+        exit:
+            if (err != CHIP_NO_ERROR)
+            {
+                mReader.OnNodeError(mNodeIndex, err);
+            }
+        }
+
+        void OnError(CHIP_ERROR aError) override
+        {
+            VerifyOrReturn(!mAnswered);
+            mAnswered = true;
+
+            mReader.OnNodeError(mNodeIndex, aError);
+        }
+
+        void OnDone(app::ReadClient *) override { mReader.OnOperationDone(*this); }
+
+        FanOutAttributeReader & mReader;
+        const size_t mNodeIndex;
+        bool mAnswered = false;
+        app::BufferedReadCallback mBufferedReadAdapter;
+        // Last, so that the ReadClient is released before its callbacks.
+        app::ReadClient mReadClient;
+    };
+
+    static void HandleStart(System::Layer * aSystemLayer, void * aAppState)
+    {
+        static_cast<FanOutAttributeReader *>(aAppState)->StartReadsOrFinish();
+    }
+
+    // Start reads until N are in flight, and finish once every node is done.
+    void StartReadsOrFinish()
+    {
+        while (mInFlightCount < N && mNextNodeIndex < mNodes.size())
+        {
+            size_t nodeIndex = mNextNodeIndex++;
+            CHIP_ERROR err   = StartRead(nodeIndex);
+            if (err != CHIP_NO_ERROR)
+            {
+                OnNodeError(nodeIndex, err);
+                if (mCancelRequested)
+                {
+                    Cancel();
+                    return;
+                }
+            }
+        }
+
+        if (mInFlightCount == 0)
+        {
+            Finish();
+        }
+    }
+
+    CHIP_ERROR StartRead(size_t aNodeIndex)
+    {
+        DeviceProxy * node = mNodes[aNodeIndex];
+        VerifyOrReturnError(node != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+        Optional<SessionHandle> session = node->GetSecureSession();
+        VerifyOrReturnError(session.HasValue(), CHIP_ERROR_NOT_CONNECTED);
+
+        Operation * operation = mOperations.CreateObject(*this, aNodeIndex, node->GetExchangeManager());
+        VerifyOrReturnError(operation != nullptr, CHIP_ERROR_NO_MEMORY);
+
+        app::ReadPrepareParams readParams(session.Value());
+        readParams.mpAttributePathParamsList    = &mPath;
+        readParams.mAttributePathParamsListSize = 1;
+        readParams.mIsFabricFiltered            = mFabricFiltered;
+        CHIP_ERROR err                          = operation->SendRequest(readParams);
+        if (err != CHIP_NO_ERROR)
+        {
+            mOperations.ReleaseObject(operation);
+            return err;
+        }
+
+        mInFlightCount++;
+        return CHIP_NO_ERROR;
+    }
+
+    void OnNodeSuccess(size_t aNodeIndex, const DecodableAttributeType & aData)
+    {
+        mResult.mSuccessCount++;
+        if (mOnNodeSuccess)
+        {
+            mInNodeCallback = true;
+            mOnNodeSuccess(aNodeIndex, aData);
+            mInNodeCallback = false;
+        }
+    }
+
+    void OnNodeError(size_t aNodeIndex, CHIP_ERROR aError)
+    {
+        mResult.mFailureCount++;
+        if (mOnNodeError)
+        {
+            mInNodeCallback = true;
+            mOnNodeError(aNodeIndex, aError);
+            mInNodeCallback = false;
+        }
+    }
+
+    // Called by the ReadClient of the operation when it is done, which allows releasing it.
+    void OnOperationDone(Operation & aOperation)
+    {
+        size_t nodeIndex = aOperation.GetNodeIndex();
+        bool answered    = aOperation.HasAnswered();
+        mOperations.ReleaseObject(&aOperation);
+        mInFlightCount--;
+
+        if (!answered)
+        {
+            OnNodeError(nodeIndex, CHIP_ERROR_NOT_FOUND);
+        }
+
+        if (mCancelRequested)
+        {
+            Cancel();
+            return;
+        }
+
+        StartReadsOrFinish();
+    }
+
+    void Finish()
+    {
+        mResult.mCancelledCount = mNodes.size() - mResult.mSuccessCount - mResult.mFailureCount;
+        mActive                 = false;
+        mOnNodeSuccess          = nullptr;
+        mOnNodeError            = nullptr;
+
+        // The callback may destroy the reader, or start another fan-out.
+        FanOutReadResult result   = mResult;
+        OnDoneCallbackType onDone = std::move(mOnDone);
+        mOnDone                   = nullptr;
+        onDone(result);
+    }
+
+    System::Layer * mSystemLayer;
+    ObjectPool<Operation, N, ObjectPoolMem::kInline> mOperations;
+    Span<DeviceProxy * const> mNodes;
+    app::AttributePathParams mPath;
+    OnNodeSuccessCallbackType mOnNodeSuccess;
+    OnNodeErrorCallbackType mOnNodeError;
+    OnDoneCallbackType mOnDone;
+    FanOutReadResult mResult;
+    size_t mNextNodeIndex = 0;
+    size_t mInFlightCount = 0;
+    bool mFabricFiltered  = true;
+    bool mActive          = false;
+    bool mInNodeCallback  = false;
+    bool mCancelRequested = false;
+};
+
+} // namespace Controller
+} // namespace chip
@@ -0,0 +1,168 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <controller/CommissioningQueue.h>
+#include <lib/support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+using namespace chip;
+using namespace chip::Controller;
+
+namespace {
+
+constexpr size_t kQueueCapacity = 4;
+using TestQueue                 = CommissioningQueue<kQueueCapacity>;
+
+// Records the commissionings started and failed, the way DeviceCommissioner starts and reports them.
+class TestDelegate : public TestQueue::Delegate
+{
+public:
+    CHIP_ERROR StartQueuedCommissioning(NodeId nodeId) override
+    {
+        VerifyOrReturnError(nodeId != mUnreachableNodeId, CHIP_ERROR_INCORRECT_STATE);
+        mStarted[mNumStarted++] = nodeId;
+        return CHIP_NO_ERROR;
+    }
+
+    void OnQueuedCommissioningFailed(NodeId nodeId, CHIP_ERROR error) override
+    {
+        mFailed[mNumFailed++] = nodeId;
+        mLastError            = error;
+    }
+
+    NodeId mUnreachableNodeId = kUndefinedNodeId;
+    NodeId mStarted[2 * kQueueCapacity];
+    size_t mNumStarted = 0;
+    NodeId mFailed[2 * kQueueCapacity];
+    size_t mNumFailed     = 0;
+    CHIP_ERROR mLastError = CHIP_NO_ERROR;
+};
+
+void TestCommissionInOrder(nlTestSuite * inSuite, void * inContext)
+{
+    TestQueue queue;
+    TestDelegate delegate;
+
+    NL_TEST_ASSERT(inSuite, queue.Enqueue(1) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, queue.Enqueue(2) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, queue.Enqueue(3) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, queue.Count() == 3);
+
+    // Each call starts a single commissioning, in the order the nodes were queued
+    for (NodeId nodeId = 1; nodeId <= 3; nodeId++)
+    {
+        queue.StartNext(delegate);
+        NL_TEST_ASSERT(inSuite, delegate.mNumStarted == nodeId);
+        NL_TEST_ASSERT(inSuite, delegate.mStarted[nodeId - 1] == nodeId);
+        NL_TEST_ASSERT(inSuite, queue.Count() == 3 - nodeId);
+    }
+
+    // Nothing left to start
+    queue.StartNext(delegate);
+    NL_TEST_ASSERT(inSuite, delegate.mNumStarted == 3);
+    NL_TEST_ASSERT(inSuite, delegate.mNumFailed == 0);
+    NL_TEST_ASSERT(inSuite, queue.IsEmpty());
+}
+
+void TestContinueAfterFailure(nlTestSuite * inSuite, void * inContext)
+{
+    TestQueue queue;
+    TestDelegate delegate;
+    delegate.mUnreachableNodeId = 2;
+
+    NL_TEST_ASSERT(inSuite, queue.Enqueue(1) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, queue.Enqueue(2) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, queue.Enqueue(3) == CHIP_NO_ERROR);
+
+    queue.StartNext(delegate);
+    NL_TEST_ASSERT(inSuite, delegate.mNumStarted == 1 && delegate.mStarted[0] == 1);
+
+    // Node 2 cannot be commissioned: it is reported, and node 3 starts in its place
+    queue.StartNext(delegate);
+    NL_TEST_ASSERT(inSuite, delegate.mNumFailed == 1 && delegate.mFailed[0] == 2);
+    NL_TEST_ASSERT(inSuite, delegate.mLastError == CHIP_ERROR_INCORRECT_STATE);
+    NL_TEST_ASSERT(inSuite, delegate.mNumStarted == 2 && delegate.mStarted[1] == 3);
+    NL_TEST_ASSERT(inSuite, queue.IsEmpty());
+}
+
+void TestAllQueuedNodesFail(nlTestSuite * inSuite, void * inContext)
+{
+    TestQueue queue;
+    TestDelegate delegate;
+    delegate.mUnreachableNodeId = 5;
+
+    NL_TEST_ASSERT(inSuite, queue.Enqueue(5) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, queue.Enqueue(5) == CHIP_NO_ERROR);
+
+    // Every failure is reported, and the queue ends up empty
+    queue.StartNext(delegate);
+    NL_TEST_ASSERT(inSuite, delegate.mNumStarted == 0);
+    NL_TEST_ASSERT(inSuite, delegate.mNumFailed == 2);
+    NL_TEST_ASSERT(inSuite, queue.IsEmpty());
+}
+
+void TestQueueCapacity(nlTestSuite * inSuite, void * inContext)
+{
+    TestQueue queue;
+    TestDelegate delegate;
+
+    for (NodeId nodeId = 1; nodeId <= kQueueCapacity; nodeId++)
+    {
+        NL_TEST_ASSERT(inSuite, queue.Enqueue(nodeId) == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(inSuite, queue.Enqueue(kQueueCapacity + 1) == CHIP_ERROR_NO_MEMORY);
+    NL_TEST_ASSERT(inSuite, queue.Count() == kQueueCapacity);
+
+    // Starting a commissioning makes room for another node, which goes to the end of the queue
+    queue.StartNext(delegate);
+    NL_TEST_ASSERT(inSuite, queue.Enqueue(kQueueCapacity + 1) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, queue.Enqueue(kQueueCapacity + 2) == CHIP_ERROR_NO_MEMORY);
+
+    for (size_t i = 0; i < kQueueCapacity; i++)
+    {
+        queue.StartNext(delegate);
+    }
+    NL_TEST_ASSERT(inSuite, delegate.mNumStarted == kQueueCapacity + 1);
+    NL_TEST_ASSERT(inSuite, delegate.mStarted[kQueueCapacity] == kQueueCapacity + 1);
+    NL_TEST_ASSERT(inSuite, queue.IsEmpty());
+
+    // Clear() drops the waiting nodes without starting them
+    NL_TEST_ASSERT(inSuite, queue.Enqueue(1) == CHIP_NO_ERROR);
+    queue.Clear();
+    NL_TEST_ASSERT(inSuite, queue.IsEmpty());
+}
+
+const nlTest sTests[] = {
+    NL_TEST_DEF("TestCommissionInOrder", TestCommissionInOrder),
+    NL_TEST_DEF("TestContinueAfterFailure", TestContinueAfterFailure),
+    NL_TEST_DEF("TestAllQueuedNodesFail", TestAllQueuedNodesFail),
+    NL_TEST_DEF("TestQueueCapacity", TestQueueCapacity),
+    NL_TEST_SENTINEL(),
+};
+
+} // namespace
+
+int TestCommissioningQueue()
+{
+    nlTestSuite theSuite = { "CommissioningQueue", &sTests[0], nullptr, nullptr };
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestCommissioningQueue)
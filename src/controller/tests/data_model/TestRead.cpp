@@ -24,6 +24,7 @@
 #include <app/tests/AppTestContext.h>
 #include <app/util/mock/Constants.h>
 #include <app/util/mock/Functions.h>
+#include <controller/FanOutAttributeReader.h>
 #include <controller/ReadInteraction.h>
 #include <lib/support/ErrorStr.h>
 #include <lib/support/UnitTestContext.h>
@@ -244,6 +245,29 @@ bool ConcreteAttributePathExists(const ConcreteAttributePath & aPath)
 
 namespace {
 
+// A node reached over a session of the test context, or not connected when it has no session.
+class TestDeviceProxy : public DeviceProxy
+{
+public:
+    TestDeviceProxy(Messaging::ExchangeManager & aExchangeMgr) : mExchangeMgr(aExchangeMgr) {}
+    TestDeviceProxy(Messaging::ExchangeManager & aExchangeMgr, const SessionHandle & aSession) : mExchangeMgr(aExchangeMgr)
+    {
+        mSession.Grab(aSession);
+    }
+
+    void Disconnect() override {}
+    NodeId GetDeviceId() const override { return kUndefinedNodeId; }
+    Messaging::ExchangeManager * GetExchangeManager() const override { return &mExchangeMgr; }
+    Optional<SessionHandle> GetSecureSession() const override { return mSession.Get(); }
+
+protected:
+    bool IsSecureConnected() const override { return static_cast<bool>(mSession); }
+
+private:
+    Messaging::ExchangeManager & mExchangeMgr;
+    SessionHolder mSession;
+};
+
 class TestReadInteraction : public app::ReadHandler::ApplicationCallback
 {
 public:
@@ -251,6 +275,8 @@ public:
 
     static void TestReadAttributeResponse(nlTestSuite * apSuite, void * apContext);
     static void TestReadAttributeError(nlTestSuite * apSuite, void * apContext);
+    static void TestFanOutReadAttribute(nlTestSuite * apSuite, void * apContext);
+    static void TestFanOutReadAttributeCancel(nlTestSuite * apSuite, void * apContext);
     static void TestReadAttributeTimeout(nlTestSuite * apSuite, void * apContext);
     static void TestSubscribeAttributeTimeout(nlTestSuite * apSuite, void * apContext);
     static void TestResubscribeAttributeTimeout(nlTestSuite * apSuite, void * apContext);
@@ -285,6 +311,10 @@ public:
     static void TestReadAttribute_ManyErrors(nlTestSuite * apSuite, void * apContext);
     static void TestSubscribeAttributeDeniedNotExistPath(nlTestSuite * apSuite, void * apContext);
     static void TestReadHandler_KeepSubscriptionTest(nlTestSuite * apSuite, void * apContext);
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    static void TestReadHandler_ElasticPoolSubscriptions(nlTestSuite * apSuite, void * apContext);
+    static void TestReadHandler_ElasticPoolSubscriptionStress(nlTestSuite * apSuite, void * apContext);
+#endif
 
 private:
     static uint16_t mMaxInterval;
@@ -1563,6 +1593,131 @@ void TestReadInteraction::TestReadAttributeError(nlTestSuite * apSuite, void * a
     NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
 }
 
+void TestReadInteraction::TestFanOutReadAttribute(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx           = *static_cast<TestContext *>(apContext);
+    constexpr size_t kNodeCount = 10;
+
+    responseDirective = kSendDataResponse;
+
+    // Nodes 3 and 7 are not connected.
+    TestDeviceProxy connectedProxy(ctx.GetExchangeManager(), ctx.GetSessionBobToAlice());
+    TestDeviceProxy disconnectedProxy(ctx.GetExchangeManager());
+    DeviceProxy * nodes[kNodeCount];
+    for (size_t i = 0; i < kNodeCount; i++)
+    {
+        nodes[i] = (i == 3 || i == 7) ? &disconnectedProxy : &connectedProxy;
+    }
+
+    Controller::FanOutReadResult result;
+    CHIP_ERROR errors[kNodeCount];
+    uint16_t values[kNodeCount] = {};
+    uint16_t previousReadCount  = totalReadCount;
+    size_t doneCount            = 0;
+
+    // Passing of stack variables by reference is only safe because of synchronous completion of the interaction. Otherwise, it's
+    // not safe to do so.
+    auto onNodeSuccess = [&values](size_t aNodeIndex, const uint16_t & aData) { values[aNodeIndex] = aData; };
+    auto onNodeError   = [&errors](size_t aNodeIndex, CHIP_ERROR aError) { errors[aNodeIndex] = aError; };
+    auto onDone        = [&doneCount, &result](const Controller::FanOutReadResult & aResult) {
+        doneCount++;
+        result = aResult;
+    };
+
+    Controller::FanOutAttributeReader<uint16_t, 4> reader(&ctx.GetSystemLayer());
+    CHIP_ERROR err = reader.Read<Clusters::UnitTesting::Attributes::Int16u::TypeInfo>(
+        Span<DeviceProxy * const>(nodes), kTestEndpointId, onNodeSuccess, onNodeError, onDone);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, reader.IsActive());
+
+    // Only one fan-out at a time, and nothing happens before the event loop runs.
+    err = reader.Read<Clusters::UnitTesting::Attributes::Int16u::TypeInfo>(Span<DeviceProxy * const>(nodes), kTestEndpointId,
+                                                                           onNodeSuccess, onNodeError, onDone);
+    NL_TEST_ASSERT(apSuite, err == CHIP_ERROR_INCORRECT_STATE);
+    NL_TEST_ASSERT(apSuite, doneCount == 0);
+
+    ctx.DrainAndServiceIO();
+
+    NL_TEST_ASSERT(apSuite, !reader.IsActive());
+    NL_TEST_ASSERT(apSuite, doneCount == 1);
+    NL_TEST_ASSERT(apSuite, result.mSuccessCount == 8 && result.mFailureCount == 2 && result.mCancelledCount == 0);
+    NL_TEST_ASSERT(apSuite, totalReadCount == previousReadCount + 8);
+    for (size_t i = 0; i < kNodeCount; i++)
+    {
+        if (i == 3 || i == 7)
+        {
+            NL_TEST_ASSERT(apSuite, values[i] == 0 && errors[i] == CHIP_ERROR_NOT_CONNECTED);
+        }
+        else
+        {
+            NL_TEST_ASSERT(apSuite, values[i] > previousReadCount && values[i] <= totalReadCount);
+        }
+    }
+
+    NL_TEST_ASSERT(apSuite, app::InteractionModelEngine::GetInstance()->GetNumActiveReadClients() == 0);
+    NL_TEST_ASSERT(apSuite, app::InteractionModelEngine::GetInstance()->GetNumActiveReadHandlers() == 0);
+    NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
+}
+
+void TestReadInteraction::TestFanOutReadAttributeCancel(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx           = *static_cast<TestContext *>(apContext);
+    constexpr size_t kNodeCount = 10;
+
+    responseDirective = kSendDataResponse;
+
+    TestDeviceProxy proxy(ctx.GetExchangeManager(), ctx.GetSessionBobToAlice());
+    DeviceProxy * nodes[kNodeCount];
+    for (auto & node : nodes)
+    {
+        node = &proxy;
+    }
+
+    Controller::FanOutAttributeReader<uint16_t, 2> reader(&ctx.GetSystemLayer());
+    size_t successCount = 0;
+    size_t doneCount    = 0;
+    Controller::FanOutReadResult result;
+
+    // Passing of stack variables by reference is only safe because of synchronous completion of the interaction. Otherwise, it's
+    // not safe to do so.
+    auto onDone = [&doneCount, &result](const Controller::FanOutReadResult & aResult) {
+        doneCount++;
+        result = aResult;
+    };
+
+    // Cancelled before any read starts.
+    CHIP_ERROR err = reader.Read<Clusters::UnitTesting::Attributes::Int16u::TypeInfo>(Span<DeviceProxy * const>(nodes),
+                                                                                      kTestEndpointId, nullptr, nullptr, onDone);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    reader.Cancel();
+    NL_TEST_ASSERT(apSuite, !reader.IsActive());
+    NL_TEST_ASSERT(apSuite, doneCount == 1);
+    NL_TEST_ASSERT(apSuite, result.mSuccessCount == 0 && result.mFailureCount == 0 && result.mCancelledCount == kNodeCount);
+
+    ctx.DrainAndServiceIO();
+    NL_TEST_ASSERT(apSuite, doneCount == 1);
+
+    // Cancelled by the first answer, with another read in flight.
+    auto onNodeSuccess = [&successCount, &reader](size_t aNodeIndex, const uint16_t & aData) {
+        successCount++;
+        reader.Cancel();
+    };
+    err = reader.Read<Clusters::UnitTesting::Attributes::Int16u::TypeInfo>(Span<DeviceProxy * const>(nodes), kTestEndpointId,
+                                                                           onNodeSuccess, nullptr, onDone);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    ctx.DrainAndServiceIO();
+
+    NL_TEST_ASSERT(apSuite, !reader.IsActive());
+    NL_TEST_ASSERT(apSuite, doneCount == 2);
+    NL_TEST_ASSERT(apSuite, successCount == 1);
+    NL_TEST_ASSERT(apSuite, result.mSuccessCount == 1 && result.mFailureCount == 0 && result.mCancelledCount == kNodeCount - 1);
+
+    NL_TEST_ASSERT(apSuite, app::InteractionModelEngine::GetInstance()->GetNumActiveReadClients() == 0);
+    NL_TEST_ASSERT(apSuite, app::InteractionModelEngine::GetInstance()->GetNumActiveReadHandlers() == 0);
+    NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
+}
+
 void TestReadInteraction::TestReadAttributeTimeout(nlTestSuite * apSuite, void * apContext)
 {
     TestContext & ctx       = *static_cast<TestContext *>(apContext);
@@ -3394,6 +3549,157 @@ void TestReadInteraction::TestReadHandler_KillOldestSubscriptions(nlTestSuite *
     app::InteractionModelEngine::GetInstance()->SetPathPoolCapacityForSubscriptions(-1);
 }
 
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+void TestReadInteraction::TestReadHandler_ElasticPoolSubscriptions(nlTestSuite * apSuite, void * apContext)
+{
+    using namespace SubscriptionPathQuotaHelpers;
+    TestContext & ctx                    = *static_cast<TestContext *>(apContext);
+    app::InteractionModelEngine * engine = app::InteractionModelEngine::GetInstance();
+
+    const size_t kFabricCount           = ctx.GetFabricTable().FabricCount();
+    const size_t kExpectedParallelSubs  = app::InteractionModelEngine::kMinSupportedSubscriptionsPerFabric * kFabricCount;
+    const size_t kExpectedParallelPaths = kExpectedParallelSubs * app::InteractionModelEngine::kMinSupportedPathsPerSubscription;
+    app::AttributePathParams path(kTestEndpointId, Clusters::UnitTesting::Id, Clusters::UnitTesting::Attributes::Int16u::Id);
+
+    engine->RegisterReadHandlerAppCallback(&gTestReadInteraction);
+    engine->SetConfigMaxFabrics(static_cast<int32_t>(kFabricCount));
+
+    app::InteractionModelEngine::ElasticPoolLimits limits;
+    limits.mMaxSubscriptions         = kExpectedParallelSubs;
+    limits.mMaxPathsForSubscriptions = kExpectedParallelPaths;
+    NL_TEST_ASSERT(apSuite, engine->SetElasticPoolLimits(limits) == CHIP_NO_ERROR);
+
+    // The oldest subscription reports to its own callback, so that its eviction can be told apart from the others.
+    TestReadCallback oldestCallback;
+    TestReadCallback readCallback;
+    std::vector<std::unique_ptr<app::ReadClient>> readClients;
+
+    // Until the limit is reached, a single fabric may use every subscription.
+    EstablishReadOrSubscriptions(apSuite, ctx.GetSessionBobToAlice(), 1,
+                                 app::InteractionModelEngine::kMinSupportedPathsPerSubscription, path,
+                                 app::ReadClient::InteractionType::Subscribe, &oldestCallback, readClients);
+    ctx.DrainAndServiceIO();
+    EstablishReadOrSubscriptions(apSuite, ctx.GetSessionBobToAlice(), kExpectedParallelSubs - 1,
+                                 app::InteractionModelEngine::kMinSupportedPathsPerSubscription, path,
+                                 app::ReadClient::InteractionType::Subscribe, &readCallback, readClients);
+    ctx.DrainAndServiceIO();
+
+    NL_TEST_ASSERT(apSuite, oldestCallback.mOnSubscriptionEstablishedCount == 1);
+    NL_TEST_ASSERT(apSuite, readCallback.mOnSubscriptionEstablishedCount == kExpectedParallelSubs - 1);
+    NL_TEST_ASSERT(apSuite, engine->GetPoolOccupancy().mSubscriptions == kExpectedParallelSubs);
+
+    // At the limit, a subscription that exceeds the minimas is rejected.
+    {
+        TestReadCallback callback;
+        std::vector<std::unique_ptr<app::ReadClient>> outReadClient;
+        EstablishReadOrSubscriptions(apSuite, ctx.GetSessionBobToAlice(), 1,
+                                     app::InteractionModelEngine::kMinSupportedPathsPerSubscription + 1, path,
+                                     app::ReadClient::InteractionType::Subscribe, &callback, outReadClient);
+        ctx.DrainAndServiceIO();
+
+        NL_TEST_ASSERT(apSuite, callback.mOnError == 1);
+        NL_TEST_ASSERT(apSuite, callback.mLastError == CHIP_IM_GLOBAL_STATUS(PathsExhausted));
+    }
+
+    // A compliant one takes the place of the oldest subscription, which no longer gets reports.
+    readCallback.ClearCounters();
+    EstablishReadOrSubscriptions(apSuite, ctx.GetSessionBobToAlice(), 1,
+                                 app::InteractionModelEngine::kMinSupportedPathsPerSubscription, path,
+                                 app::ReadClient::InteractionType::Subscribe, &readCallback, readClients);
+    ctx.DrainAndServiceIO();
+
+    NL_TEST_ASSERT(apSuite, readCallback.mOnSubscriptionEstablishedCount == 1);
+    NL_TEST_ASSERT(apSuite,
+                   engine->GetNumActiveReadHandlers(app::ReadHandler::InteractionType::Subscribe) == kExpectedParallelSubs);
+
+    oldestCallback.ClearCounters();
+    readCallback.ClearCounters();
+    engine->GetReportingEngine().SetDirty(path);
+    ctx.DrainAndServiceIO();
+    NL_TEST_ASSERT(apSuite, oldestCallback.mOnReportEnd == 0);
+    NL_TEST_ASSERT(apSuite, readCallback.mOnReportEnd == kExpectedParallelSubs);
+
+    // Subscriptions of a fabric within its quota evict those of the fabric over its quota.
+    TestReadCallback readCallbackFabric2;
+    EstablishReadOrSubscriptions(apSuite, ctx.GetSessionAliceToBob(),
+                                 app::InteractionModelEngine::kMinSupportedSubscriptionsPerFabric,
+                                 app::InteractionModelEngine::kMinSupportedPathsPerSubscription, path,
+                                 app::ReadClient::InteractionType::Subscribe, &readCallbackFabric2, readClients);
+    ctx.DrainAndServiceIO();
+
+    NL_TEST_ASSERT(apSuite,
+                   readCallbackFabric2.mOnSubscriptionEstablishedCount ==
+                       app::InteractionModelEngine::kMinSupportedSubscriptionsPerFabric);
+    NL_TEST_ASSERT(apSuite,
+                   engine->GetNumActiveReadHandlers(app::ReadHandler::InteractionType::Subscribe, ctx.GetAliceFabricIndex()) ==
+                       app::InteractionModelEngine::kMinSupportedSubscriptionsPerFabric);
+    NL_TEST_ASSERT(apSuite,
+                   engine->GetNumActiveReadHandlers(app::ReadHandler::InteractionType::Subscribe, ctx.GetBobFabricIndex()) ==
+                       app::InteractionModelEngine::kMinSupportedSubscriptionsPerFabric);
+
+    engine->ShutdownActiveReads();
+    ctx.DrainAndServiceIO();
+    readClients.clear();
+
+    NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
+    engine->ClearElasticPoolLimits();
+    engine->SetConfigMaxFabrics(-1);
+}
+
+void TestReadInteraction::TestReadHandler_ElasticPoolSubscriptionStress(nlTestSuite * apSuite, void * apContext)
+{
+    using namespace SubscriptionPathQuotaHelpers;
+    TestContext & ctx                    = *static_cast<TestContext *>(apContext);
+    app::InteractionModelEngine * engine = app::InteractionModelEngine::GetInstance();
+
+    // A gateway serving many controllers, with the subscriptions split between two fabrics.
+    constexpr size_t kSubscriptionCount = 1000;
+    app::AttributePathParams path(kTestEndpointId, Clusters::UnitTesting::Id, Clusters::UnitTesting::Attributes::Int16u::Id);
+
+    app::InteractionModelEngine::ElasticPoolLimits limits;
+    limits.mMaxSubscriptions         = kSubscriptionCount;
+    limits.mMaxPathsForSubscriptions = kSubscriptionCount;
+    NL_TEST_ASSERT(apSuite, engine->SetElasticPoolLimits(limits) == CHIP_NO_ERROR);
+
+    app::ReadPrepareParams readParams(ctx.GetSessionBobToAlice());
+    readParams.mpAttributePathParamsList    = &path;
+    readParams.mAttributePathParamsListSize = 1;
+    readParams.mMaxIntervalCeilingSeconds   = 60;
+    readParams.mKeepSubscriptions           = true;
+
+    TestReadCallback readCallback;
+    std::vector<std::unique_ptr<app::ReadClient>> readClients;
+    for (size_t i = 0; i < kSubscriptionCount; i++)
+    {
+        readParams.mSessionHolder.Grab(i % 2 == 0 ? ctx.GetSessionBobToAlice() : ctx.GetSessionAliceToBob());
+        readClients.push_back(std::make_unique<app::ReadClient>(engine, &ctx.GetExchangeManager(), readCallback,
+                                                                app::ReadClient::InteractionType::Subscribe));
+        NL_TEST_ASSERT(apSuite, readClients.back()->SendRequest(readParams) == CHIP_NO_ERROR);
+        ctx.DrainAndServiceIO();
+    }
+
+    // Every subscription is admitted, none is evicted, and all of them get the report of a change.
+    NL_TEST_ASSERT(apSuite, readCallback.mOnSubscriptionEstablishedCount == kSubscriptionCount);
+    NL_TEST_ASSERT(apSuite, readCallback.mOnError == 0);
+    NL_TEST_ASSERT(apSuite, engine->GetPoolOccupancy().mSubscriptions == kSubscriptionCount);
+    NL_TEST_ASSERT(apSuite, engine->GetPoolOccupancy().mReadHandlersHighWater >= kSubscriptionCount);
+
+    readCallback.ClearCounters();
+    engine->GetReportingEngine().SetDirty(path);
+    ctx.GetIOContext().DriveIOUntil(System::Clock::Seconds16(30),
+                                    [&]() { return readCallback.mOnReportEnd == kSubscriptionCount; });
+    NL_TEST_ASSERT(apSuite, readCallback.mOnReportEnd == kSubscriptionCount);
+    NL_TEST_ASSERT(apSuite, engine->GetNumActiveReadHandlers(app::ReadHandler::InteractionType::Subscribe) == kSubscriptionCount);
+
+    engine->ShutdownActiveReads();
+    ctx.DrainAndServiceIO();
+    readClients.clear();
+
+    NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
+    engine->ClearElasticPoolLimits();
+}
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
 struct TestReadHandler_ParallelReads_TestCase_Parameters
 {
     int ReadHandlerCapacity = -1;
@@ -4654,6 +4960,8 @@ const nlTest sTests[] =
     NL_TEST_DEF("TestReadAttributeResponse", TestReadInteraction::TestReadAttributeResponse),
     NL_TEST_DEF("TestReadEventResponse", TestReadInteraction::TestReadEventResponse),
     NL_TEST_DEF("TestReadAttributeError", TestReadInteraction::TestReadAttributeError),
+    NL_TEST_DEF("TestFanOutReadAttribute", TestReadInteraction::TestFanOutReadAttribute),
+    NL_TEST_DEF("TestFanOutReadAttributeCancel", TestReadInteraction::TestFanOutReadAttributeCancel),
     NL_TEST_DEF("TestReadFabricScopedWithoutFabricFilter", TestReadInteraction::TestReadFabricScopedWithoutFabricFilter),
     NL_TEST_DEF("TestReadFabricScopedWithFabricFilter", TestReadInteraction::TestReadFabricScopedWithFabricFilter),
     NL_TEST_DEF("TestReadHandler_MultipleSubscriptions", TestReadInteraction::TestReadHandler_MultipleSubscriptions),
@@ -4687,6 +4995,11 @@ const nlTest sTests[] =
     NL_TEST_DEF("TestResubscribeAttributeTimeout", TestReadInteraction::TestResubscribeAttributeTimeout),
     NL_TEST_DEF("TestSubscribeAttributeTimeout", TestReadInteraction::TestSubscribeAttributeTimeout),
     NL_TEST_DEF("TestReadHandler_KeepSubscriptionTest", TestReadInteraction::TestReadHandler_KeepSubscriptionTest),
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    NL_TEST_DEF("TestReadHandler_ElasticPoolSubscriptions", TestReadInteraction::TestReadHandler_ElasticPoolSubscriptions),
+    NL_TEST_DEF("TestReadHandler_ElasticPoolSubscriptionStress",
+                TestReadInteraction::TestReadHandler_ElasticPoolSubscriptionStress),
+#endif
     NL_TEST_SENTINEL()
 };
 // clang-format on
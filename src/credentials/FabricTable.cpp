@@ -435,75 +435,91 @@ CHIP_ERROR FabricTable::VerifyCredentials(const ByteSpan & noc, const ByteSpan &
     return CHIP_NO_ERROR;
 }
 
-const FabricInfo * FabricTable::FindFabric(const Crypto::P256PublicKey & rootPubKey, FabricId fabricId) const
+uint64_t FabricTable::RootKeyLookupKey(const Crypto::P256PublicKey & rootPubKey, FabricId fabricId)
 {
-    return FindFabricCommon(rootPubKey, fabricId);
+    // Skip the uncompressed point marker.
+    return Encoding::BigEndian::Get64(rootPubKey.ConstBytes() + 1) ^ fabricId;
 }
 
-const FabricInfo * FabricTable::FindIdentity(const Crypto::P256PublicKey & rootPubKey, FabricId fabricId, NodeId nodeId) const
+void FabricTable::InsertInLookupIndex(uint8_t (&buckets)[kLookupBucketCount], uint64_t key, uint8_t entry)
 {
-    return FindFabricCommon(rootPubKey, fabricId, nodeId);
+    size_t bucket = LookupBucket(key);
+    while (buckets[bucket] != 0)
+    {
+        bucket = (bucket + 1) & (kLookupBucketCount - 1);
+    }
+    buckets[bucket] = entry;
 }
 
-const FabricInfo * FabricTable::FindFabricCommon(const Crypto::P256PublicKey & rootPubKey, FabricId fabricId, NodeId nodeId) const
+template <typename Predicate>
+const FabricInfo * FabricTable::FindInLookupIndex(const uint8_t (&buckets)[kLookupBucketCount], uint64_t key,
+                                                  Predicate predicate) const
 {
-    P256PublicKey candidatePubKey;
-
-    // Try to match pending fabric first if available
-    if (HasPendingFabricUpdate())
+    // There are more buckets than entries, so probing ends on an empty bucket.
+    for (size_t bucket = LookupBucket(key); buckets[bucket] != 0; bucket = (bucket + 1) & (kLookupBucketCount - 1))
     {
-        bool pubKeyAvailable = (mPendingFabric.FetchRootPubkey(candidatePubKey) == CHIP_NO_ERROR);
-        auto matchingNodeId  = (nodeId == kUndefinedNodeId) ? mPendingFabric.GetNodeId() : nodeId;
-        if (pubKeyAvailable && rootPubKey.Matches(candidatePubKey) && fabricId == mPendingFabric.GetFabricId() &&
-            matchingNodeId == mPendingFabric.GetNodeId())
+        const FabricInfo & fabric = mStates[buckets[bucket] - 1];
+        if (predicate(fabric))
         {
-            return &mPendingFabric;
+            return &fabric;
         }
     }
+    return nullptr;
+}
 
-    for (auto & fabric : mStates)
-    {
-        auto matchingNodeId = (nodeId == kUndefinedNodeId) ? fabric.GetNodeId() : nodeId;
+void FabricTable::UpdateLookupIndex()
+{
+    memset(mFabricIndexBuckets, 0, sizeof(mFabricIndexBuckets));
+    memset(mCompressedFabricIdBuckets, 0, sizeof(mCompressedFabricIdBuckets));
+    memset(mRootKeyBuckets, 0, sizeof(mRootKeyBuckets));
 
+    for (size_t i = 0; i < ArraySize(mStates); i++)
+    {
+        const FabricInfo & fabric = mStates[i];
         if (!fabric.IsInitialized())
         {
             continue;
         }
-        if (fabric.FetchRootPubkey(candidatePubKey) != CHIP_NO_ERROR)
-        {
-            continue;
-        }
-        if (rootPubKey.Matches(candidatePubKey) && fabricId == fabric.GetFabricId() && matchingNodeId == fabric.GetNodeId())
-        {
-            return &fabric;
-        }
+
+        auto entry = static_cast<uint8_t>(i + 1);
+        InsertInLookupIndex(mFabricIndexBuckets, fabric.GetFabricIndex(), entry);
+        InsertInLookupIndex(mCompressedFabricIdBuckets, fabric.GetCompressedFabricId(), entry);
+        InsertInLookupIndex(mRootKeyBuckets, RootKeyLookupKey(fabric.mRootPublicKey, fabric.GetFabricId()), entry);
     }
+}
 
-    return nullptr;
+const FabricInfo * FabricTable::FindFabric(const Crypto::P256PublicKey & rootPubKey, FabricId fabricId) const
+{
+    return FindFabricCommon(rootPubKey, fabricId);
 }
 
-FabricInfo * FabricTable::GetMutableFabricByIndex(FabricIndex fabricIndex)
+const FabricInfo * FabricTable::FindIdentity(const Crypto::P256PublicKey & rootPubKey, FabricId fabricId, NodeId nodeId) const
 {
+    return FindFabricCommon(rootPubKey, fabricId, nodeId);
+}
+
+const FabricInfo * FabricTable::FindFabricCommon(const Crypto::P256PublicKey & rootPubKey, FabricId fabricId, NodeId nodeId) const
+{
+    // Root public keys are not secret, so they do not need the constant-time comparison of P256PublicKey::Matches.
+    auto matches = [&](const FabricInfo & fabric) {
+        auto matchingNodeId = (nodeId == kUndefinedNodeId) ? fabric.GetNodeId() : nodeId;
+        return fabricId == fabric.GetFabricId() && matchingNodeId == fabric.GetNodeId() &&
+            memcmp(rootPubKey.ConstBytes(), fabric.mRootPublicKey.ConstBytes(), rootPubKey.Length()) == 0;
+    };
+
     // Try to match pending fabric first if available
-    if (HasPendingFabricUpdate() && (mPendingFabric.GetFabricIndex() == fabricIndex))
+    if (HasPendingFabricUpdate() && matches(mPendingFabric))
     {
         return &mPendingFabric;
     }
 
-    for (auto & fabric : mStates)
-    {
-        if (!fabric.IsInitialized())
-        {
-            continue;
-        }
-
-        if (fabric.GetFabricIndex() == fabricIndex)
-        {
-            return &fabric;
-        }
-    }
+    return FindInLookupIndex(mRootKeyBuckets, RootKeyLookupKey(rootPubKey, fabricId), matches);
+}
 
-    return nullptr;
+FabricInfo * FabricTable::GetMutableFabricByIndex(FabricIndex fabricIndex)
+{
+    // Same lookup as FindFabricWithIndex, on entries that we own.
+    return const_cast<FabricInfo *>(FindFabricWithIndex(fabricIndex));
 }
 
 const FabricInfo * FabricTable::FindFabricWithIndex(FabricIndex fabricIndex) const
@@ -514,20 +530,8 @@ const FabricInfo * FabricTable::FindFabricWithIndex(FabricIndex fabricIndex) con
         return &mPendingFabric;
     }
 
-    for (const auto & fabric : mStates)
-    {
-        if (!fabric.IsInitialized())
-        {
-            continue;
-        }
-
-        if (fabric.GetFabricIndex() == fabricIndex)
-        {
-            return &fabric;
-        }
-    }
-
-    return nullptr;
+    return FindInLookupIndex(mFabricIndexBuckets, fabricIndex,
+                             [&](const FabricInfo & fabric) { return fabric.GetFabricIndex() == fabricIndex; });
 }
 
 const FabricInfo * FabricTable::FindFabricWithCompressedId(CompressedFabricId compressedFabricId) const
@@ -538,19 +542,8 @@ const FabricInfo * FabricTable::FindFabricWithCompressedId(CompressedFabricId co
         return &mPendingFabric;
     }
 
-    for (auto & fabric : mStates)
-    {
-        if (!fabric.IsInitialized())
-        {
-            continue;
-        }
-
-        if (compressedFabricId == fabric.GetPeerId().GetCompressedFabricId())
-        {
-            return &fabric;
-        }
-    }
-    return nullptr;
+    return FindInLookupIndex(mCompressedFabricIdBuckets, compressedFabricId,
+                             [&](const FabricInfo & fabric) { return fabric.GetCompressedFabricId() == compressedFabricId; });
 }
 
 CHIP_ERROR FabricTable::FetchRootCert(FabricIndex fabricIndex, MutableByteSpan & outCert) const
@@ -868,7 +861,12 @@ FabricTable::AddOrUpdateInner(FabricIndex fabricIndex, bool isAddition, Crypto::
     }
 
     // Update local copy of fabric data. For add it's a new entry, for update, it's `mPendingFabric` shadow entry.
-    ReturnErrorOnFailure(fabricEntry->Init(newFabricInfo));
+    CHIP_ERROR initErr = fabricEntry->Init(newFabricInfo);
+    if (isAddition)
+    {
+        UpdateLookupIndex();
+    }
+    ReturnErrorOnFailure(initErr);
 
     // Set the label, matching add/update semantics of empty/existing.
     fabricEntry->SetFabricLabel(fabricLabel);
@@ -970,6 +968,7 @@ CHIP_ERROR FabricTable::Delete(FabricIndex fabricIndex)
 
     // Since fabricIsInitialized was true, fabric is not null.
     fabricInfo->Reset();
+    UpdateLookupIndex();
 
     if (!mNextAvailableFabricIndex.HasValue())
     {
@@ -1048,6 +1047,7 @@ CHIP_ERROR FabricTable::Init(const FabricTable::InitParams & initParams)
     {
         fabric.Reset();
     }
+    UpdateLookupIndex();
     mNextAvailableFabricIndex.SetValue(kMinValidFabricIndex);
 
     // Init failure of Last Known Good Time is non-fatal.  If Last Known Good
@@ -1071,6 +1071,7 @@ CHIP_ERROR FabricTable::Init(const FabricTable::InitParams & initParams)
 
         // TODO: A safer way would be to just clean-up the entire fabric table on this situation...
         err = ReadFabricInfo(reader);
+        UpdateLookupIndex();
         if (err != CHIP_NO_ERROR)
         {
             ChipLogError(FabricProvisioning, "Error loading fabric table: %" CHIP_ERROR_FORMAT ", we are in a bad state!",
@@ -1112,6 +1113,7 @@ void FabricTable::Forget(FabricIndex fabricIndex)
 
     RevertPendingFabricData();
     fabricInfo->Reset();
+    UpdateLookupIndex();
 }
 
 void FabricTable::Shutdown()
@@ -1135,6 +1137,7 @@ void FabricTable::Shutdown()
         // direct lookups fail.
         fabricInfo.Reset();
     }
+    UpdateLookupIndex();
 
     mStorage = nullptr;
 }
@@ -1891,6 +1894,7 @@ CHIP_ERROR FabricTable::CommitPendingFabricData()
             // Commit the pending entry to local in-memory fabric metadata, which
             // also moves operational keys if not backed by OperationalKeystore
             *existingFabricToUpdate = std::move(mPendingFabric);
+            UpdateLookupIndex();
         }
 
         // Store pending metadata first
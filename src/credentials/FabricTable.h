@@ -334,6 +334,12 @@ private:
     }
 };
 
+// Smallest power of two that is at least minCount.
+constexpr size_t FabricLookupBucketCount(size_t minCount, size_t bucketCount = 1)
+{
+    return (bucketCount >= minCount) ? bucketCount : FabricLookupBucketCount(minCount, bucketCount * 2);
+}
+
 class DLL_EXPORT FabricTable
 {
 public:
@@ -1128,7 +1134,38 @@ private:
     CHIP_ERROR StoreCommitMarker(const CommitMarker & commitMarker);
     CHIP_ERROR GetCommitMarker(CommitMarker & outCommitMarker);
 
+    // Number of buckets of each lookup index: a power of two at least twice CHIP_CONFIG_MAX_FABRICS, so that probing is short
+    // and always ends on an empty bucket.
+    static constexpr size_t kLookupBucketCount = FabricLookupBucketCount(2 * CHIP_CONFIG_MAX_FABRICS);
+    static_assert(CHIP_CONFIG_MAX_FABRICS < UINT8_MAX, "Lookup index entries must fit in a uint8_t");
+
+    static size_t LookupBucket(uint64_t key)
+    {
+        return static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> 32) & (kLookupBucketCount - 1);
+    }
+
+    // Lookup key of a fabric by <Root Public Key, Fabric ID>. Public keys are uniformly distributed, so the leading bytes
+    // of the X coordinate are a good enough hash of the root public key.
+    static uint64_t RootKeyLookupKey(const Crypto::P256PublicKey & rootPubKey, FabricId fabricId);
+
+    static void InsertInLookupIndex(uint8_t (&buckets)[kLookupBucketCount], uint64_t key, uint8_t entry);
+
+    // Returns the first entry of mStates, in the order of mStates, that has the given lookup key and matches the predicate.
+    template <typename Predicate>
+    const FabricInfo * FindInLookupIndex(const uint8_t (&buckets)[kLookupBucketCount], uint64_t key, Predicate predicate) const;
+
+    /**
+     * Rebuild the lookup indices from mStates. Must be called whenever an entry of mStates is initialized, reset or replaced.
+     */
+    void UpdateLookupIndex();
+
     FabricInfo mStates[CHIP_CONFIG_MAX_FABRICS];
+    // Lookup indices of the initialized entries of mStates, by fabric index, by compressed fabric ID and by
+    // <Root Public Key, Fabric ID>. A bucket holds 1 + the position of an entry in mStates, or 0 if it is empty. Collisions
+    // are resolved by linear probing, so that entries with the same key are found in the order of mStates.
+    uint8_t mFabricIndexBuckets[kLookupBucketCount]        = {};
+    uint8_t mCompressedFabricIdBuckets[kLookupBucketCount] = {};
+    uint8_t mRootKeyBuckets[kLookupBucketCount]            = {};
     // Used for UpdateNOC pending fabric updates
     FabricInfo mPendingFabric;
     PersistentStorageDelegate * mStorage                    = nullptr;
@@ -832,12 +832,14 @@ void GroupDataProviderImpl::Finish()
     mKeySetIterators.ReleaseAll();
     mGroupSessionsIterator.ReleaseAll();
     mGroupKeyContexPool.ReleaseAll();
+    InvalidateGroupSessionIndex();
 }
 
 void GroupDataProviderImpl::SetStorageDelegate(PersistentStorageDelegate * storage)
 {
     VerifyOrDie(storage != nullptr);
     mStorage = storage;
+    InvalidateGroupSessionIndex();
 }
 
 //
@@ -1349,6 +1351,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveEndpoints(chip::FabricIndex fabric_index
 CHIP_ERROR GroupDataProviderImpl::SetGroupKeyAt(chip::FabricIndex fabric_index, size_t index, const GroupKey & in_map)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionIndex();
 
     FabricData fabric(fabric_index);
     KeyMapData map(fabric_index);
@@ -1415,6 +1418,7 @@ CHIP_ERROR GroupDataProviderImpl::GetGroupKeyAt(chip::FabricIndex fabric_index,
 CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeyAt(chip::FabricIndex fabric_index, size_t index)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionIndex();
 
     FabricData fabric(fabric_index);
     KeyMapData map;
@@ -1447,6 +1451,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeyAt(chip::FabricIndex fabric_inde
 CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeys(chip::FabricIndex fabric_index)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionIndex();
 
     FabricData fabric(fabric_index);
     VerifyOrReturnError(CHIP_NO_ERROR == fabric.Load(mStorage), CHIP_ERROR_INVALID_FABRIC_INDEX);
@@ -1523,6 +1528,7 @@ CHIP_ERROR GroupDataProviderImpl::SetKeySet(chip::FabricIndex fabric_index, cons
                                             const KeySet & in_keyset)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionIndex();
 
     FabricData fabric(fabric_index);
     KeySetData keyset;
@@ -1594,6 +1600,7 @@ CHIP_ERROR GroupDataProviderImpl::GetKeySet(chip::FabricIndex fabric_index, uint
 CHIP_ERROR GroupDataProviderImpl::RemoveKeySet(chip::FabricIndex fabric_index, uint16_t target_id)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionIndex();
 
     FabricData fabric(fabric_index);
     KeySetData keyset;
@@ -1695,6 +1702,8 @@ void GroupDataProviderImpl::KeySetIteratorImpl::Release()
 
 CHIP_ERROR GroupDataProviderImpl::RemoveFabric(chip::FabricIndex fabric_index)
 {
+    InvalidateGroupSessionIndex();
+
     FabricData fabric(fabric_index);
 
     // Fabric data defaults to zero, so if not entry is found, no mappings, or keys are removed
@@ -1839,12 +1848,73 @@ CHIP_ERROR GroupDataProviderImpl::GroupKeyContext::PrivacyDecrypt(const ByteSpan
 GroupDataProviderImpl::GroupSessionIterator * GroupDataProviderImpl::IterateGroupSessions(uint16_t session_id)
 {
     VerifyOrReturnError(IsInitialized(), nullptr);
+    if (mGroupSessionIndexState == GroupSessionIndexState::kStale)
+    {
+        BuildGroupSessionIndex();
+    }
     return mGroupSessionsIterator.CreateObject(*this, session_id);
 }
 
+void GroupDataProviderImpl::InvalidateGroupSessionIndex()
+{
+    mGroupSessionIndexState = GroupSessionIndexState::kStale;
+    mGroupSessionIndexCount = 0;
+    mGroupSessionIndexGeneration++;
+}
+
+void GroupDataProviderImpl::BuildGroupSessionIndex()
+{
+    mGroupSessionIndexCount = 0;
+    mGroupSessionIndexState = GroupSessionIndexState::kOverflow;
+
+    FabricList fabric_list;
+    VerifyOrReturn(CHIP_NO_ERROR == fabric_list.Load(mStorage));
+
+    FabricData fabric(fabric_list.first_entry);
+    for (size_t i = 0; i < fabric_list.entry_count; i++, fabric.fabric_index = fabric.next)
+    {
+        VerifyOrReturn(CHIP_NO_ERROR == fabric.Load(mStorage));
+
+        KeyMapData mapping(fabric.fabric_index, fabric.first_map);
+        for (uint16_t j = 0; j < fabric.map_count; ++j, mapping.id = mapping.next)
+        {
+            VerifyOrReturn(CHIP_NO_ERROR == mapping.Load(mStorage));
+
+            KeySetData keyset(fabric.fabric_index, mapping.keyset_id);
+            if (CHIP_NO_ERROR != keyset.Load(mStorage))
+            {
+                // Mapping to a key set that doesn't exist (yet), nothing to decrypt with
+                continue;
+            }
+
+            for (uint8_t k = 0; k < keyset.keys_count; ++k)
+            {
+                VerifyOrReturn(mGroupSessionIndexCount < mGroupSessionIndex.size());
+
+                GroupSessionIndexEntry & entry = mGroupSessionIndex[mGroupSessionIndexCount++];
+                entry.fabric_index             = fabric.fabric_index;
+                entry.group_id                 = mapping.group_id;
+                entry.keyset_id                = mapping.keyset_id;
+                entry.hash                     = keyset.operational_keys[k].hash;
+                entry.key_index                = k;
+            }
+        }
+    }
+
+    mGroupSessionIndexState = GroupSessionIndexState::kValid;
+}
+
 GroupDataProviderImpl::GroupSessionIteratorImpl::GroupSessionIteratorImpl(GroupDataProviderImpl & provider, uint16_t session_id) :
     mProvider(provider), mSessionId(session_id), mGroupKeyContext(provider)
 {
+    if (provider.mGroupSessionIndexState == GroupSessionIndexState::kValid)
+    {
+        mUseIndex        = true;
+        mIndexPosition   = 0;
+        mIndexGeneration = provider.mGroupSessionIndexGeneration;
+        return;
+    }
+
     FabricList fabric_list;
     ReturnOnFailure(fabric_list.Load(provider.mStorage));
     mFirstFabric = fabric_list.first_entry;
@@ -1857,9 +1927,23 @@ GroupDataProviderImpl::GroupSessionIteratorImpl::GroupSessionIteratorImpl(GroupD
 
 size_t GroupDataProviderImpl::GroupSessionIteratorImpl::Count()
 {
-    FabricData fabric(mFirstFabric);
     size_t count = 0;
 
+    if (mUseIndex)
+    {
+        VerifyOrReturnValue(mIndexGeneration == mProvider.mGroupSessionIndexGeneration, 0);
+        for (size_t i = 0; i < mProvider.mGroupSessionIndexCount; i++)
+        {
+            if (mProvider.mGroupSessionIndex[i].hash == mSessionId)
+            {
+                count++;
+            }
+        }
+        return count;
+    }
+
+    FabricData fabric(mFirstFabric);
+
     for (size_t i = 0; i < mFabricTotal; i++, fabric.fabric_index = fabric.next)
     {
         if (CHIP_NO_ERROR != fabric.Load(mProvider.mStorage))
@@ -1896,8 +1980,44 @@ size_t GroupDataProviderImpl::GroupSessionIteratorImpl::Count()
     return count;
 }
 
+bool GroupDataProviderImpl::GroupSessionIteratorImpl::NextFromIndex(GroupSession & output)
+{
+    // The index was rebuilt or invalidated since this iterator was created, so its positions no longer apply
+    VerifyOrReturnError(mIndexGeneration == mProvider.mGroupSessionIndexGeneration, false);
+
+    while (mIndexPosition < mProvider.mGroupSessionIndexCount)
+    {
+        const GroupSessionIndexEntry & entry = mProvider.mGroupSessionIndex[mIndexPosition++];
+        if (entry.hash != mSessionId)
+        {
+            continue;
+        }
+
+        KeySetData keyset(entry.fabric_index, entry.keyset_id);
+        VerifyOrReturnError(CHIP_NO_ERROR == keyset.Load(mProvider.mStorage), false);
+        VerifyOrReturnError(entry.key_index < keyset.keys_count, false);
+
+        Crypto::GroupOperationalCredentials & creds = keyset.operational_keys[entry.key_index];
+        VerifyOrReturnError(creds.hash == mSessionId, false);
+
+        mGroupKeyContext.Initialize(creds.encryption_key, mSessionId, creds.privacy_key);
+        output.fabric_index    = entry.fabric_index;
+        output.group_id        = entry.group_id;
+        output.security_policy = keyset.policy;
+        output.keyContext      = &mGroupKeyContext;
+        return true;
+    }
+
+    return false;
+}
+
 bool GroupDataProviderImpl::GroupSessionIteratorImpl::Next(GroupSession & output)
 {
+    if (mUseIndex)
+    {
+        return NextFromIndex(output);
+    }
+
     while (mFabricCount < mFabricTotal)
     {
         FabricData fabric(mFabric);
@@ -21,6 +21,8 @@
 #include <lib/core/CHIPPersistentStorageDelegate.h>
 #include <lib/support/Pool.h>
 
+#include <array>
+
 namespace chip {
 namespace Credentials {
 
@@ -230,21 +232,47 @@ protected:
         void Release() override;
 
     protected:
+        bool NextFromIndex(GroupSession & output);
+
         GroupDataProviderImpl & mProvider;
-        uint16_t mSessionId      = 0;
-        FabricIndex mFirstFabric = kUndefinedFabricIndex;
-        FabricIndex mFabric      = kUndefinedFabricIndex;
-        uint16_t mFabricCount    = 0;
-        uint16_t mFabricTotal    = 0;
-        uint16_t mMapping        = 0;
-        uint16_t mMapCount       = 0;
-        uint16_t mKeyIndex       = 0;
-        uint16_t mKeyCount       = 0;
-        bool mFirstMap           = true;
+        uint16_t mSessionId       = 0;
+        bool mUseIndex            = false;
+        size_t mIndexPosition     = 0;
+        uint32_t mIndexGeneration = 0;
+        FabricIndex mFirstFabric  = kUndefinedFabricIndex;
+        FabricIndex mFabric       = kUndefinedFabricIndex;
+        uint16_t mFabricCount     = 0;
+        uint16_t mFabricTotal     = 0;
+        uint16_t mMapping         = 0;
+        uint16_t mMapCount        = 0;
+        uint16_t mKeyIndex        = 0;
+        uint16_t mKeyCount        = 0;
+        bool mFirstMap            = true;
         GroupKeyContext mGroupKeyContext;
     };
+
+    // Location of one operational group key, keyed by its session id (key hash). The keys themselves stay in
+    // persistent storage; only the key set holding a matching key is read when a group message is received.
+    struct GroupSessionIndexEntry
+    {
+        FabricIndex fabric_index = kUndefinedFabricIndex;
+        GroupId group_id         = kUndefinedGroupId;
+        KeysetId keyset_id       = 0;
+        uint16_t hash            = 0;
+        uint8_t key_index        = 0;
+    };
+
+    enum class GroupSessionIndexState : uint8_t
+    {
+        kStale,    // Must be rebuilt from persistent storage before use
+        kValid,    // Holds every operational group key of every fabric
+        kOverflow, // Too many keys to index, lookups walk persistent storage until the next change
+    };
+
     bool IsInitialized() { return (mStorage != nullptr); }
     CHIP_ERROR RemoveEndpoints(FabricIndex fabric_index, GroupId group_id);
+    void BuildGroupSessionIndex();
+    void InvalidateGroupSessionIndex();
 
     PersistentStorageDelegate * mStorage       = nullptr;
     Crypto::SessionKeystore * mSessionKeystore = nullptr;
@@ -254,6 +282,11 @@ protected:
     ObjectPool<KeySetIteratorImpl, kIteratorsMax> mKeySetIterators;
     ObjectPool<GroupSessionIteratorImpl, kIteratorsMax> mGroupSessionsIterator;
     ObjectPool<GroupKeyContext, kIteratorsMax> mGroupKeyContexPool;
+
+    std::array<GroupSessionIndexEntry, CHIP_CONFIG_MAX_GROUP_SESSION_INDEX_ENTRIES> mGroupSessionIndex;
+    size_t mGroupSessionIndexCount                 = 0;
+    uint32_t mGroupSessionIndexGeneration          = 0;
+    GroupSessionIndexState mGroupSessionIndexState = GroupSessionIndexState::kStale;
 };
 
 } // namespace Credentials
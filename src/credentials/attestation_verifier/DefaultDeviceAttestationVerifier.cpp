@@ -478,12 +478,71 @@ AttestationVerificationResult DefaultDACVerifier::ValidateCertificationDeclarati
         return AttestationVerificationResult::kCertificationDeclarationNoCertificateFound;
     }
 
+    // Devices of the same product carry byte-identical CDs, so a CD whose signature was already verified only needs its
+    // content extracted. The key lookups above are still done every time since the trust stores may have changed, and the
+    // cache is keyed on the verifying key as well as the envelope, so a CD is verified again if its key ID now maps to a
+    // different key.
+    uint8_t verifiedCdHash[kSHA256_Hash_Length];
+    VerifyOrReturnError(HashCertificationDeclaration(cmsEnvelopeBuffer, verifyingKey, verifiedCdHash) == CHIP_NO_ERROR,
+                        AttestationVerificationResult::kInternalError);
+
+    if (IsCertificationDeclarationVerified(verifiedCdHash))
+    {
+        VerifyOrReturnError(CMS_ExtractCDContent(cmsEnvelopeBuffer, certDeclBuffer) == CHIP_NO_ERROR,
+                            AttestationVerificationResult::kCertificationDeclarationInvalidFormat);
+        return AttestationVerificationResult::kSuccess;
+    }
+
     VerifyOrReturnError(CMS_Verify(cmsEnvelopeBuffer, verifyingKey, certDeclBuffer) == CHIP_NO_ERROR,
                         AttestationVerificationResult::kCertificationDeclarationInvalidSignature);
 
+    MarkCertificationDeclarationVerified(verifiedCdHash);
+
     return AttestationVerificationResult::kSuccess;
 }
 
+CHIP_ERROR DefaultDACVerifier::HashCertificationDeclaration(const ByteSpan & cmsEnvelopeBuffer,
+                                                            const Crypto::P256PublicKey & verifyingKey,
+                                                            uint8_t (&verifiedCdHash)[kSHA256_Hash_Length])
+{
+    Hash_SHA256_stream hash;
+    MutableByteSpan hashSpan{ verifiedCdHash };
+    ReturnErrorOnFailure(hash.Begin());
+    ReturnErrorOnFailure(hash.AddData(cmsEnvelopeBuffer));
+    ReturnErrorOnFailure(hash.AddData(ByteSpan{ verifyingKey.ConstBytes(), verifyingKey.Length() }));
+    return hash.Finish(hashSpan);
+}
+
+bool DefaultDACVerifier::IsCertificationDeclarationVerified(const uint8_t (&verifiedCdHash)[kSHA256_Hash_Length]) const
+{
+#if CHIP_CONFIG_NUM_VERIFIED_CD_CACHE_ENTRIES > 0
+    for (size_t i = 0; i < mNumVerifiedCdHashes; i++)
+    {
+        if (memcmp(mVerifiedCdHashes[i], verifiedCdHash, kSHA256_Hash_Length) == 0)
+        {
+            return true;
+        }
+    }
+#else
+    IgnoreUnusedVariable(verifiedCdHash);
+#endif // CHIP_CONFIG_NUM_VERIFIED_CD_CACHE_ENTRIES > 0
+    return false;
+}
+
+void DefaultDACVerifier::MarkCertificationDeclarationVerified(const uint8_t (&verifiedCdHash)[kSHA256_Hash_Length])
+{
+#if CHIP_CONFIG_NUM_VERIFIED_CD_CACHE_ENTRIES > 0
+    memcpy(mVerifiedCdHashes[mNextVerifiedCdHashIndex], verifiedCdHash, kSHA256_Hash_Length);
+    mNextVerifiedCdHashIndex = (mNextVerifiedCdHashIndex + 1) % CHIP_CONFIG_NUM_VERIFIED_CD_CACHE_ENTRIES;
+    if (mNumVerifiedCdHashes < CHIP_CONFIG_NUM_VERIFIED_CD_CACHE_ENTRIES)
+    {
+        mNumVerifiedCdHashes++;
+    }
+#else
+    IgnoreUnusedVariable(verifiedCdHash);
+#endif // CHIP_CONFIG_NUM_VERIFIED_CD_CACHE_ENTRIES > 0
+}
+
 AttestationVerificationResult DefaultDACVerifier::ValidateCertificateDeclarationPayload(const ByteSpan & certDeclBuffer,
                                                                                         const ByteSpan & firmwareInfo,
                                                                                         const DeviceInfoForAttestation & deviceInfo)
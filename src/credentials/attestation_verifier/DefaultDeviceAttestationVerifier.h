@@ -79,8 +79,24 @@ public:
 protected:
     DefaultDACVerifier() {}
 
+    // Hashes a CMS envelope together with the key that verifies it, to key the cache of verified CDs.
+    static CHIP_ERROR HashCertificationDeclaration(const ByteSpan & cmsEnvelopeBuffer, const Crypto::P256PublicKey & verifyingKey,
+                                                   uint8_t (&verifiedCdHash)[Crypto::kSHA256_Hash_Length]);
+
+    // Returns true if a CMS envelope and verifying key with the given hash were previously verified successfully.
+    bool IsCertificationDeclarationVerified(const uint8_t (&verifiedCdHash)[Crypto::kSHA256_Hash_Length]) const;
+    void MarkCertificationDeclarationVerified(const uint8_t (&verifiedCdHash)[Crypto::kSHA256_Hash_Length]);
+
     CsaCdKeysTrustStore mCdKeysTrustStore;
     const AttestationTrustStore * mAttestationTrustStore;
+
+#if CHIP_CONFIG_NUM_VERIFIED_CD_CACHE_ENTRIES > 0
+    // Hashes of CMS-signed Certification Declarations and their verifying keys whose signature has been verified, oldest
+    // entry replaced first.
+    uint8_t mVerifiedCdHashes[CHIP_CONFIG_NUM_VERIFIED_CD_CACHE_ENTRIES][Crypto::kSHA256_Hash_Length];
+    size_t mNumVerifiedCdHashes     = 0;
+    size_t mNextVerifiedCdHashIndex = 0;
+#endif // CHIP_CONFIG_NUM_VERIFIED_CD_CACHE_ENTRIES > 0
 };
 
 /**
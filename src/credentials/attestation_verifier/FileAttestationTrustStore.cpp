@@ -20,6 +20,7 @@
 #include <cstdio>
 #include <cstring>
 #include <string>
+#include <utility>
 
 extern "C" {
 #include <dirent.h>
@@ -48,11 +49,32 @@ FileAttestationTrustStore::FileAttestationTrustStore(const char * paaTrustStoreP
     {
         mPAADerCerts = LoadAllX509DerCerts(paaTrustStorePath);
         VerifyOrReturn(paaCount());
+        BuildIndex();
     }
 
     mIsInitialized = true;
 }
 
+void FileAttestationTrustStore::BuildIndex()
+{
+    mPAAIndex.clear();
+
+    for (size_t i = 0; i < mPAADerCerts.size(); i++)
+    {
+        SubjectKeyId skid;
+        MutableByteSpan skidSpan{ skid };
+        const auto & certificate = mPAADerCerts[i];
+        if (CHIP_NO_ERROR != Crypto::ExtractSKIDFromX509Cert(ByteSpan{ certificate.data(), certificate.size() }, skidSpan) ||
+            skidSpan.size() != skid.size())
+        {
+            continue;
+        }
+
+        // If several PAAs share a subject key identifier, the first one loaded wins, as with a linear search.
+        mPAAIndex.emplace(skid, i);
+    }
+}
+
 std::vector<std::vector<uint8_t>> LoadAllX509DerCerts(const char * trustStorePath)
 {
     std::vector<std::vector<uint8_t>> certs;
@@ -95,14 +117,10 @@ std::vector<std::vector<uint8_t>> LoadAllX509DerCerts(const char * trustStorePat
                         MutableByteSpan kidSpan{ kidBuf };
                         ByteSpan certSpan{ certificate.data(), certificate.size() };
 
-                        if (CHIP_NO_ERROR != VerifyAttestationCertificateFormat(certSpan, Crypto::AttestationCertType::kPAA))
+                        if (CHIP_NO_ERROR == VerifyAttestationCertificateFormat(certSpan, Crypto::AttestationCertType::kPAA) &&
+                            CHIP_NO_ERROR == Crypto::ExtractSKIDFromX509Cert(certSpan, kidSpan))
                         {
-                            continue;
-                        }
-
-                        if (CHIP_NO_ERROR == Crypto::ExtractSKIDFromX509Cert(certSpan, kidSpan))
-                        {
-                            certs.push_back(certificate);
+                            certs.push_back(std::move(certificate));
                         }
                     }
                 }
@@ -123,6 +141,7 @@ FileAttestationTrustStore::~FileAttestationTrustStore()
 void FileAttestationTrustStore::Cleanup()
 {
     mPAADerCerts.clear();
+    mPAAIndex.clear();
     mIsInitialized = false;
 }
 
@@ -140,23 +159,14 @@ CHIP_ERROR FileAttestationTrustStore::GetProductAttestationAuthorityCert(const B
     VerifyOrReturnError(!skid.empty() && (skid.data() != nullptr), CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(skid.size() == Crypto::kSubjectKeyIdentifierLength, CHIP_ERROR_INVALID_ARGUMENT);
 
-    for (auto candidate : mPAADerCerts)
-    {
-        uint8_t skidBuf[Crypto::kSubjectKeyIdentifierLength] = { 0 };
-        MutableByteSpan candidateSkidSpan{ skidBuf };
-        if (CHIP_NO_ERROR != Crypto::ExtractSKIDFromX509Cert(ByteSpan{ candidate.data(), candidate.size() }, candidateSkidSpan))
-        {
-            continue;
-        }
+    SubjectKeyId key;
+    memcpy(key.data(), skid.data(), key.size());
 
-        if (skid.data_equal(candidateSkidSpan))
-        {
-            // Found a match
-            return CopySpanToMutableSpan(ByteSpan{ candidate.data(), candidate.size() }, outPaaDerBuffer);
-        }
-    }
+    auto match = mPAAIndex.find(key);
+    VerifyOrReturnError(match != mPAAIndex.end(), CHIP_ERROR_CA_CERT_NOT_FOUND);
 
-    return CHIP_ERROR_CA_CERT_NOT_FOUND;
+    const auto & candidate = mPAADerCerts[match->second];
+    return CopySpanToMutableSpan(ByteSpan{ candidate.data(), candidate.size() }, outPaaDerBuffer);
 }
 
 } // namespace Credentials
@@ -18,8 +18,10 @@
 
 #include <credentials/CHIPCert.h>
 #include <credentials/attestation_verifier/DeviceAttestationVerifier.h>
+#include <crypto/CHIPCryptoPAL.h>
 
 #include <array>
+#include <map>
 #include <vector>
 
 namespace chip {
@@ -52,8 +54,15 @@ protected:
     std::vector<std::vector<uint8_t>> mPAADerCerts;
 
 private:
+    using SubjectKeyId = std::array<uint8_t, Crypto::kSubjectKeyIdentifierLength>;
+
+    // Maps each PAA's subject key identifier to its index in mPAADerCerts, built once when the certificates are loaded
+    // so that lookups don't have to parse every certificate in the store.
+    std::map<SubjectKeyId, size_t> mPAAIndex;
+
     bool mIsInitialized = false;
 
+    void BuildIndex();
     void Cleanup();
 };
 
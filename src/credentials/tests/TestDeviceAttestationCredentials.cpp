@@ -28,11 +28,14 @@
 
 #include <lib/core/CHIPError.h>
 #include <lib/support/CHIPMem.h>
+#include <lib/support/CHIPMemString.h>
 #include <lib/support/Span.h>
 #include <lib/support/UnitTestRegistration.h>
 
 #include <nlunit-test.h>
 
+#include <new>
+
 #include "CHIPAttCert_test_vectors.h"
 
 using namespace chip;
@@ -274,6 +277,20 @@ static void TestDACVerifierExample_CertDeclarationVerification(nlTestSuite * inS
 
     NL_TEST_ASSERT(inSuite, cd_payload.data_equal(ByteSpan(sTestCMS_CDContent)));
 
+    // Verifying the same CD again is served from the verified CD cache and yields the same payload
+    cd_payload         = ByteSpan();
+    attestation_result = default_verifier->ValidateCertificationDeclarationSignature(ByteSpan(sTest_CD), cd_payload);
+    NL_TEST_ASSERT(inSuite, attestation_result == AttestationVerificationResult::kSuccess);
+    NL_TEST_ASSERT(inSuite, cd_payload.data_equal(ByteSpan(sTestCMS_CDContent)));
+
+    // A CD with a corrupted signature must still fail, even though a valid CD with the same content was cached
+    uint8_t corrupted_cd[sizeof(sTest_CD)];
+    memcpy(corrupted_cd, sTest_CD, sizeof(sTest_CD));
+    corrupted_cd[sizeof(corrupted_cd) - 1] ^= 0x01;
+    ByteSpan corrupted_cd_payload;
+    attestation_result = default_verifier->ValidateCertificationDeclarationSignature(ByteSpan(corrupted_cd), corrupted_cd_payload);
+    NL_TEST_ASSERT(inSuite, attestation_result == AttestationVerificationResult::kCertificationDeclarationInvalidSignature);
+
     DeviceInfoForAttestation deviceInfo{
         .vendorId     = sTestCMS_CertElements.VendorId,
         .productId    = sTestCMS_CertElements.ProductIds[0],
@@ -287,6 +304,66 @@ static void TestDACVerifierExample_CertDeclarationVerification(nlTestSuite * inS
     NL_TEST_ASSERT(inSuite, attestation_result == AttestationVerificationResult::kSuccess);
 }
 
+// DefaultDACVerifier whose CD signing keys can be replaced, to change the key a key ID maps to.
+class CdKeySwappingDACVerifier : public DefaultDACVerifier
+{
+public:
+    CdKeySwappingDACVerifier() : DefaultDACVerifier(GetTestAttestationTrustStore()) {}
+
+    CHIP_ERROR SetCdSigningKey(const ByteSpan & kid, const P256PublicKey & pubKey)
+    {
+        // The trust store is not assignable and keys cannot be removed from it, so start over with an empty one.
+        mCdKeysTrustStore.~CsaCdKeysTrustStore();
+        new (&mCdKeysTrustStore) CsaCdKeysTrustStore();
+        return mCdKeysTrustStore.AddTrustedKey(kid, pubKey);
+    }
+};
+
+static void TestDACVerifierExample_CertDeclarationKeySwap(nlTestSuite * inSuite, void * inContext)
+{
+    static constexpr uint8_t sTestKid[] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a,
+                                            0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14 };
+
+    CertificationElements certElements;
+    certElements.FormatVersion   = 1;
+    certElements.VendorId        = 0xFFF1;
+    certElements.ProductIds[0]   = 0x8000;
+    certElements.ProductIdsCount = 1;
+    certElements.DeviceTypeId    = 0x1234;
+    Platform::CopyString(certElements.CertificateId, "ZIG20141ZB330001-24");
+
+    uint8_t cd_content_buf[kMaxCMSSignedCDMessage];
+    MutableByteSpan cd_content(cd_content_buf);
+    NL_TEST_ASSERT(inSuite, EncodeCertificationElements(certElements, cd_content) == CHIP_NO_ERROR);
+
+    P256Keypair signingKeypair;
+    P256Keypair otherKeypair;
+    NL_TEST_ASSERT(inSuite, signingKeypair.Initialize(ECPKeyTarget::ECDSA) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, otherKeypair.Initialize(ECPKeyTarget::ECDSA) == CHIP_NO_ERROR);
+
+    uint8_t cd_buf[kMaxCMSSignedCDMessage];
+    MutableByteSpan cd(cd_buf);
+    NL_TEST_ASSERT(inSuite, CMS_Sign(cd_content, ByteSpan(sTestKid), signingKeypair, cd) == CHIP_NO_ERROR);
+
+    CdKeySwappingDACVerifier verifier;
+    NL_TEST_ASSERT(inSuite, verifier.SetCdSigningKey(ByteSpan(sTestKid), signingKeypair.Pubkey()) == CHIP_NO_ERROR);
+
+    ByteSpan cd_payload;
+    AttestationVerificationResult attestation_result = verifier.ValidateCertificationDeclarationSignature(cd, cd_payload);
+    NL_TEST_ASSERT(inSuite, attestation_result == AttestationVerificationResult::kSuccess);
+    NL_TEST_ASSERT(inSuite, cd_payload.data_equal(cd_content));
+
+    // The CD was verified and cached, but its key ID now maps to a key that did not sign it
+    NL_TEST_ASSERT(inSuite, verifier.SetCdSigningKey(ByteSpan(sTestKid), otherKeypair.Pubkey()) == CHIP_NO_ERROR);
+    attestation_result = verifier.ValidateCertificationDeclarationSignature(cd, cd_payload);
+    NL_TEST_ASSERT(inSuite, attestation_result == AttestationVerificationResult::kCertificationDeclarationInvalidSignature);
+
+    // Going back to the signing key verifies the CD again
+    NL_TEST_ASSERT(inSuite, verifier.SetCdSigningKey(ByteSpan(sTestKid), signingKeypair.Pubkey()) == CHIP_NO_ERROR);
+    attestation_result = verifier.ValidateCertificationDeclarationSignature(cd, cd_payload);
+    NL_TEST_ASSERT(inSuite, attestation_result == AttestationVerificationResult::kSuccess);
+}
+
 static void TestDACVerifierExample_NocsrInformationVerification(nlTestSuite * inSuite, void * inContext)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -440,6 +517,7 @@ static const nlTest sTests[] = {
     NL_TEST_DEF("Test the 'for testing' Paa Root Store", TestAttestationTrustStore),
     NL_TEST_DEF("Test Example Device Attestation Information Verification", TestDACVerifierExample_AttestationInfoVerification),
     NL_TEST_DEF("Test Example Device Attestation Certification Declaration Verification", TestDACVerifierExample_CertDeclarationVerification),
+    NL_TEST_DEF("Test Certification Declaration Verification After Key Change", TestDACVerifierExample_CertDeclarationKeySwap),
     NL_TEST_DEF("Test Example Device Attestation Node Operational CSR Information Verification", TestDACVerifierExample_NocsrInformationVerification),
     NL_TEST_SENTINEL()
 };
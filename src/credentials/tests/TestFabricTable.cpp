@@ -2185,6 +2185,96 @@ void TestFabricLookup(nlTestSuite * inSuite, void * inContext)
     }
 }
 
+// Validate the lookups by fabric index, compressed fabric ID and <root public key, fabric ID> on a full table, across
+// deletions, additions and reloading from storage.
+void TestFabricLookupFullTable(nlTestSuite * inSuite, void * inContext)
+{
+    Credentials::TestOnlyLocalCertificateAuthority fabricCertAuthority;
+    NL_TEST_ASSERT(inSuite, fabricCertAuthority.Init().IsSuccess());
+
+    chip::TestPersistentStorageDelegate storage;
+    constexpr uint16_t kVendorId      = 0xFFF1u;
+    constexpr FabricId kFirstFabricId = 1000;
+
+    // All the fabrics chain to the same root, so that only their fabric IDs tell them apart.
+    auto addFabric = [&](FabricTable & fabricTable, FabricId fabricId) {
+        uint8_t csrBuf[chip::Crypto::kMAX_CSR_Length];
+        MutableByteSpan csrSpan{ csrBuf };
+        NL_TEST_ASSERT_SUCCESS(inSuite, fabricTable.AllocatePendingOperationalKey(chip::NullOptional, csrSpan));
+        NL_TEST_ASSERT_SUCCESS(inSuite,
+                               fabricCertAuthority.SetIncludeIcac(false).GenerateNocChain(fabricId, 55, csrSpan).GetStatus());
+        NL_TEST_ASSERT_SUCCESS(inSuite, fabricTable.AddNewPendingTrustedRootCert(fabricCertAuthority.GetRcac()));
+        FabricIndex newFabricIndex = kUndefinedFabricIndex;
+        NL_TEST_ASSERT_SUCCESS(inSuite,
+                               fabricTable.AddNewPendingFabricWithOperationalKeystore(fabricCertAuthority.GetNoc(), ByteSpan{},
+                                                                                      kVendorId, &newFabricIndex));
+        NL_TEST_ASSERT_SUCCESS(inSuite, fabricTable.CommitPendingFabricData());
+        return newFabricIndex;
+    };
+
+    // Check that the fabric at each index up to lastFabricIndex has fabric ID kFirstFabricId + index, or is not found if it
+    // was deleted.
+    auto checkLookups = [&](const FabricTable & fabricTable, FabricIndex lastFabricIndex, FabricIndex deletedFabricIndex) {
+        Crypto::P256PublicKey rootPublicKey;
+        NL_TEST_ASSERT_SUCCESS(inSuite, fabricTable.FetchRootPubkey(kMinValidFabricIndex, rootPublicKey));
+
+        for (FabricIndex fabricIndex = kMinValidFabricIndex; fabricIndex <= lastFabricIndex; fabricIndex++)
+        {
+            FabricId fabricId             = kFirstFabricId + fabricIndex;
+            const FabricInfo * fabricInfo = fabricTable.FindFabricWithIndex(fabricIndex);
+            if (fabricIndex == deletedFabricIndex)
+            {
+                NL_TEST_ASSERT(inSuite, fabricInfo == nullptr);
+                NL_TEST_ASSERT(inSuite, fabricTable.FindFabric(rootPublicKey, fabricId) == nullptr);
+                continue;
+            }
+
+            NL_TEST_ASSERT(inSuite, fabricInfo != nullptr);
+            if (fabricInfo == nullptr)
+            {
+                continue;
+            }
+            NL_TEST_ASSERT_EQUALS(inSuite, fabricInfo->GetFabricId(), fabricId);
+            NL_TEST_ASSERT(inSuite, fabricTable.FindFabricWithCompressedId(fabricInfo->GetCompressedFabricId()) == fabricInfo);
+            NL_TEST_ASSERT(inSuite, fabricTable.FindFabric(rootPublicKey, fabricId) == fabricInfo);
+            NL_TEST_ASSERT(inSuite, fabricTable.FindIdentity(rootPublicKey, fabricId, 55) == fabricInfo);
+            NL_TEST_ASSERT(inSuite, fabricTable.FindIdentity(rootPublicKey, fabricId, 66) == nullptr);
+        }
+        NL_TEST_ASSERT(inSuite, fabricTable.FindFabric(rootPublicKey, kFirstFabricId) == nullptr);
+        NL_TEST_ASSERT(inSuite, fabricTable.FindFabricWithCompressedId(kUndefinedCompressedFabricId) == nullptr);
+    };
+
+    constexpr FabricIndex kDeletedFabricIndex = (CHIP_CONFIG_MAX_FABRICS + 1) / 2;
+    {
+        ScopedFabricTable fabricTableHolder;
+        NL_TEST_ASSERT(inSuite, fabricTableHolder.Init(&storage) == CHIP_NO_ERROR);
+        FabricTable & fabricTable = fabricTableHolder.GetFabricTable();
+
+        for (FabricIndex fabricIndex = kMinValidFabricIndex; fabricIndex <= CHIP_CONFIG_MAX_FABRICS; fabricIndex++)
+        {
+            NL_TEST_ASSERT_EQUALS(inSuite, addFabric(fabricTable, kFirstFabricId + fabricIndex), fabricIndex);
+        }
+        NL_TEST_ASSERT_EQUALS(inSuite, fabricTable.FabricCount(), CHIP_CONFIG_MAX_FABRICS);
+        checkLookups(fabricTable, CHIP_CONFIG_MAX_FABRICS, kUndefinedFabricIndex);
+
+        NL_TEST_ASSERT_SUCCESS(inSuite, fabricTable.Delete(kDeletedFabricIndex));
+        checkLookups(fabricTable, CHIP_CONFIG_MAX_FABRICS, kDeletedFabricIndex);
+    }
+
+    // Reload the table, then add a fabric in the free entry. It gets the next fabric index.
+    {
+        ScopedFabricTable fabricTableHolder;
+        NL_TEST_ASSERT(inSuite, fabricTableHolder.Init(&storage) == CHIP_NO_ERROR);
+        FabricTable & fabricTable = fabricTableHolder.GetFabricTable();
+        NL_TEST_ASSERT_EQUALS(inSuite, fabricTable.FabricCount(), CHIP_CONFIG_MAX_FABRICS - 1);
+        checkLookups(fabricTable, CHIP_CONFIG_MAX_FABRICS, kDeletedFabricIndex);
+
+        constexpr FabricIndex kNextFabricIndex = CHIP_CONFIG_MAX_FABRICS + 1;
+        NL_TEST_ASSERT_EQUALS(inSuite, addFabric(fabricTable, kFirstFabricId + kNextFabricIndex), kNextFabricIndex);
+        checkLookups(fabricTable, kNextFabricIndex, kDeletedFabricIndex);
+    }
+}
+
 void TestFetchCATs(nlTestSuite * inSuite, void * inContext)
 {
     // Initialize a fabric table.
@@ -2796,6 +2886,7 @@ static const nlTest sTests[] =
     NL_TEST_DEF("Test fabric label changes", TestFabricLabelChange),
     NL_TEST_DEF("Test compressed fabric ID is properly generated", TestCompressedFabricId),
     NL_TEST_DEF("Test fabric lookup by <root public key, fabric ID>", TestFabricLookup),
+    NL_TEST_DEF("Test fabric lookups on a full fabric table", TestFabricLookupFullTable),
     NL_TEST_DEF("Test Fetching CATs", TestFetchCATs),
     NL_TEST_DEF("Test AddNOC root collision", TestAddNocRootCollision),
     NL_TEST_DEF("Test invalid chaining in AddNOC and UpdateNOC", TestInvalidChaining),
@@ -1188,6 +1188,29 @@ void TestGroupDecryption(nlTestSuite * apSuite, void * apContext)
         NL_TEST_ASSERT(apSuite, count == total);
         it->Release();
     }
+
+    // Removing the group's key mapping must drop its keys from the session lookup
+    NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider->RemoveGroupKeyAt(kFabric2, 0));
+    it = provider->IterateGroupSessions(session_id);
+    NL_TEST_ASSERT(apSuite, it);
+    if (it)
+    {
+        NL_TEST_ASSERT(apSuite, 0 == it->Count());
+        NL_TEST_ASSERT(apSuite, !it->Next(session));
+        it->Release();
+    }
+
+    // Restoring the mapping makes the session resolvable again
+    NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider->SetGroupKeyAt(kFabric2, 0, kGroup2Keyset1));
+    it = provider->IterateGroupSessions(session_id);
+    NL_TEST_ASSERT(apSuite, it);
+    if (it)
+    {
+        NL_TEST_ASSERT(apSuite, expected.size() == it->Count());
+        NL_TEST_ASSERT(apSuite, it->Next(session));
+        NL_TEST_ASSERT(apSuite, session.fabric_index == kFabric2 && session.group_id == kGroup2);
+        it->Release();
+    }
 }
 
 } // namespace TestGroups
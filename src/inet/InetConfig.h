@@ -213,6 +213,25 @@
 #define INET_CONFIG_TCP_SEND_QUEUE_POLL_INTERVAL_MSEC      500
 #endif // INET_CONFIG_TCP_SEND_QUEUE_POLL_INTERVAL_MSEC
 
+/**
+ *  @def INET_CONFIG_TCP_SEND_MAX_GATHER_BUFFERS
+ *
+ *  @brief
+ *    The maximum number of queued packet buffers that a
+ *    socket-based TCP endpoint writes with a single
+ *    gathering send call.
+ *
+ *  @details
+ *    When several messages are queued on a TCP endpoint
+ *    (for example, messages sent while a connection was
+ *    still being established), they are handed to the
+ *    kernel together rather than one system call per
+ *    packet buffer.
+ */
+#ifndef INET_CONFIG_TCP_SEND_MAX_GATHER_BUFFERS
+#define INET_CONFIG_TCP_SEND_MAX_GATHER_BUFFERS            8
+#endif // INET_CONFIG_TCP_SEND_MAX_GATHER_BUFFERS
+
 /**
  *  @def INET_CONFIG_DEFAULT_TCP_USER_TIMEOUT_MSEC
  *
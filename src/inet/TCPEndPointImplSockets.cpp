@@ -41,6 +41,7 @@
 #include <sys/ioctl.h>
 #include <sys/select.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 // SOCK_CLOEXEC not defined on all platforms, e.g. iOS/macOS:
@@ -483,9 +484,31 @@ CHIP_ERROR TCPEndPointImplSockets::DriveSendingImpl()
 
     while (!mSendQueue.IsNull())
     {
-        uint16_t bufLen = mSendQueue->DataLength();
+        // Gather as many queued buffers as allowed into a single sendmsg() call, so that a chain of
+        // messages queued on the endpoint is written with one system call instead of one per buffer.
+        // The total is kept within what a single OnDataSent call can report.
+        struct iovec sendIOV[INET_CONFIG_TCP_SEND_MAX_GATHER_BUFFERS];
+        size_t iovCount  = 0;
+        size_t queuedLen = 0;
+
+        for (System::PacketBufferHandle buf = mSendQueue.Retain(); !buf.IsNull() && iovCount < ArraySize(sendIOV); buf.Advance())
+        {
+            if (iovCount > 0 && queuedLen + buf->DataLength() > UINT16_MAX)
+            {
+                break;
+            }
+            sendIOV[iovCount].iov_base = buf->Start();
+            sendIOV[iovCount].iov_len  = buf->DataLength();
+            queuedLen += buf->DataLength();
+            iovCount++;
+        }
+
+        struct msghdr msgHeader;
+        memset(&msgHeader, 0, sizeof(msgHeader));
+        msgHeader.msg_iov    = sendIOV;
+        msgHeader.msg_iovlen = static_cast<decltype(msgHeader.msg_iovlen)>(iovCount);
 
-        ssize_t lenSentRaw = send(mSocket, mSendQueue->Start(), bufLen, sendFlags);
+        ssize_t lenSentRaw = sendmsg(mSocket, &msgHeader, sendFlags);
 
         if (lenSentRaw == -1)
         {
@@ -496,43 +519,57 @@ CHIP_ERROR TCPEndPointImplSockets::DriveSendingImpl()
             break;
         }
 
-        if (lenSentRaw < 0 || lenSentRaw > bufLen)
+        if (lenSentRaw < 0 || static_cast<size_t>(lenSentRaw) > queuedLen)
         {
             err = CHIP_ERROR_INCORRECT_STATE;
             break;
         }
 
-        // Cast is safe because bufLen is uint16_t.
-        uint16_t lenSent = static_cast<uint16_t>(lenSentRaw);
+        size_t lenSent = static_cast<size_t>(lenSentRaw);
 
         // Mark the connection as being active.
         MarkActive();
 
-        if (lenSent < bufLen)
+        // Release the buffers that were completely written and consume the written part of a partially
+        // written one. Empty buffers at the head of the queue are released as well.
+        size_t lenRemaining = lenSent;
+        while (!mSendQueue.IsNull() && (lenRemaining > 0 || mSendQueue->DataLength() == 0))
         {
-            mSendQueue->ConsumeHead(lenSent);
-        }
-        else
-        {
-            mSendQueue.FreeHead();
-            if (mSendQueue.IsNull())
+            uint16_t bufLen = mSendQueue->DataLength();
+            uint16_t bufSent;
+
+            if (lenRemaining < bufLen)
             {
-                // Do not wait for ability to write on this endpoint.
-                err = static_cast<System::LayerSockets &>(GetSystemLayer()).ClearCallbackOnPendingWrite(mWatch);
-                if (err != CHIP_NO_ERROR)
-                {
-                    break;
-                }
+                // Cast is safe because lenRemaining < bufLen, which is uint16_t.
+                bufSent = static_cast<uint16_t>(lenRemaining);
+                mSendQueue->ConsumeHead(bufSent);
+            }
+            else
+            {
+                bufSent = bufLen;
+                mSendQueue.FreeHead();
             }
+            lenRemaining -= bufSent;
         }
 
         if (OnDataSent != nullptr)
         {
-            OnDataSent(this, lenSent);
+            // Cast is safe because lenSent <= queuedLen, which is at most UINT16_MAX.
+            OnDataSent(this, static_cast<uint16_t>(lenSent));
+        }
+
+        if (mSendQueue.IsNull())
+        {
+            // Do not wait for ability to write on this endpoint.
+            err = static_cast<System::LayerSockets &>(GetSystemLayer()).ClearCallbackOnPendingWrite(mWatch);
+            if (err != CHIP_NO_ERROR)
+            {
+                break;
+            }
         }
 
 #if INET_CONFIG_OVERRIDE_SYSTEM_TCP_USER_TIMEOUT
-        mBytesWrittenSinceLastProbe += lenSent;
+        mBytesWrittenSinceLastProbe += static_cast<uint32_t>(lenSent);
 
         bool isProgressing = false;
 
@@ -558,7 +595,7 @@ CHIP_ERROR TCPEndPointImplSockets::DriveSendingImpl()
         }
 #endif // INET_CONFIG_OVERRIDE_SYSTEM_TCP_USER_TIMEOUT
 
-        if (lenSent < bufLen)
+        if (lenSent < queuedLen)
         {
             break;
         }
@@ -615,6 +615,39 @@
 #define CHIP_CONFIG_PERSISTED_STORAGE_MAX_KEY_LENGTH 16
 #endif
 
+/**
+ * @def CHIP_CONFIG_WRITE_BEHIND_STORAGE_MAX_PENDING_WRITES
+ *
+ * @brief The number of writes and deletes a WriteBehindStorageDelegate can hold before it has to flush them to the
+ *   underlying storage synchronously.  Repeated writes to the same key only take one slot.
+ */
+#ifndef CHIP_CONFIG_WRITE_BEHIND_STORAGE_MAX_PENDING_WRITES
+#define CHIP_CONFIG_WRITE_BEHIND_STORAGE_MAX_PENDING_WRITES 16
+#endif
+
+/**
+ * @def CHIP_CONFIG_WRITE_BEHIND_ATTRIBUTE_STORAGE
+ *
+ * @brief Have the server's default attribute persister write through a WriteBehindStorageDelegate, so that attribute
+ *   values written in a burst are committed to persistent storage together, after
+ *   CHIP_CONFIG_WRITE_BEHIND_ATTRIBUTE_STORAGE_FLUSH_DELAY_MS.  Values still queued are committed on Server::Shutdown();
+ *   values written shortly before a power loss may be lost.  Platforms whose storage commits every write on its own, such
+ *   as Linux, enable it.
+ */
+#ifndef CHIP_CONFIG_WRITE_BEHIND_ATTRIBUTE_STORAGE
+#define CHIP_CONFIG_WRITE_BEHIND_ATTRIBUTE_STORAGE 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_WRITE_BEHIND_ATTRIBUTE_STORAGE_FLUSH_DELAY_MS
+ *
+ * @brief How long attribute values are queued before being committed when CHIP_CONFIG_WRITE_BEHIND_ATTRIBUTE_STORAGE
+ *   is enabled.
+ */
+#ifndef CHIP_CONFIG_WRITE_BEHIND_ATTRIBUTE_STORAGE_FLUSH_DELAY_MS
+#define CHIP_CONFIG_WRITE_BEHIND_ATTRIBUTE_STORAGE_FLUSH_DELAY_MS 1000
+#endif
+
 /**
  * @def CHIP_CONFIG_PERSISTED_COUNTER_DEBUG_LOGGING
  *
@@ -718,10 +751,15 @@
  *  @brief
  *    Maximum number of Peer within a fabric that can send group data message to a device.
  *
- *  // TODO: Determine a better value for this
+ *    Senders are only allocated as they show up when CHIP_SYSTEM_CONFIG_POOL_USE_HEAP is enabled, so large systems default
+ *    to tracking the senders of a large installation (e.g. 500 switches and sensors on one fabric) without evicting any.
  */
 #ifndef CHIP_CONFIG_MAX_GROUP_DATA_PEERS
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#define CHIP_CONFIG_MAX_GROUP_DATA_PEERS 500
+#else
 #define CHIP_CONFIG_MAX_GROUP_DATA_PEERS 15
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 #endif // CHIP_CONFIG_MAX_GROUP_DATA_PEERS
 
 /**
@@ -734,6 +772,60 @@
 #define CHIP_CONFIG_MAX_GROUP_CONTROL_PEERS 2
 #endif // CHIP_CONFIG_MAX_GROUP_CONTROL_PEER
 
+/**
+ *  @def CHIP_CONFIG_GROUP_PEER_TABLE_LRU_EVICTION
+ *
+ *  @brief
+ *    When a fabric already tracks the maximum number of group data (or control) peers, whether a new peer replaces the least
+ *    recently used one. When disabled, the messages of the new peer are dropped.
+ *
+ *    Eviction reuses the entry of the evicted peer and takes no RAM of its own. An evicted peer is trusted again on its next
+ *    message, so messages it sent before being evicted can be replayed; this is why it is disabled by default.
+ */
+#ifndef CHIP_CONFIG_GROUP_PEER_TABLE_LRU_EVICTION
+#define CHIP_CONFIG_GROUP_PEER_TABLE_LRU_EVICTION 0
+#endif // CHIP_CONFIG_GROUP_PEER_TABLE_LRU_EVICTION
+
+/**
+ *  @def CHIP_CONFIG_GROUP_PEER_TABLE_BUCKETS
+ *
+ *  @brief
+ *    Number of hash buckets used to look up the group peers of all fabrics. Must be a power of two.
+ *
+ *    The buckets take CHIP_CONFIG_GROUP_PEER_TABLE_BUCKETS pointers. Each group peer takes four pointers more than its node id
+ *    and message counter (its fabric, the next peer in its bucket and its neighbours in the recently used order), for up to
+ *    CHIP_CONFIG_MAX_FABRICS * (CHIP_CONFIG_MAX_GROUP_DATA_PEERS + CHIP_CONFIG_MAX_GROUP_CONTROL_PEERS) peers, which are
+ *    allocated as needed when CHIP_SYSTEM_CONFIG_POOL_USE_HEAP is enabled.
+ */
+#ifndef CHIP_CONFIG_GROUP_PEER_TABLE_BUCKETS
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#define CHIP_CONFIG_GROUP_PEER_TABLE_BUCKETS 512
+#else
+#define CHIP_CONFIG_GROUP_PEER_TABLE_BUCKETS 32
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#endif // CHIP_CONFIG_GROUP_PEER_TABLE_BUCKETS
+
+/**
+ *  @def CHIP_CONFIG_PERSIST_GROUP_PEER_COUNTERS
+ *
+ *  @brief
+ *    Persist the message counters of group peers, so that group messages sent before a reboot cannot be replayed after it.
+ */
+#ifndef CHIP_CONFIG_PERSIST_GROUP_PEER_COUNTERS
+#define CHIP_CONFIG_PERSIST_GROUP_PEER_COUNTERS 0
+#endif // CHIP_CONFIG_PERSIST_GROUP_PEER_COUNTERS
+
+/**
+ *  @def CHIP_CONFIG_GROUP_PEER_COUNTER_PERSIST_INTERVAL
+ *
+ *  @brief
+ *    When group peer counters are persisted, how far the counter of a peer moves forward before it is written again. Up to that
+ *    many messages of a peer may be replayed after a reboot.
+ */
+#ifndef CHIP_CONFIG_GROUP_PEER_COUNTER_PERSIST_INTERVAL
+#define CHIP_CONFIG_GROUP_PEER_COUNTER_PERSIST_INTERVAL 1000
+#endif // CHIP_CONFIG_GROUP_PEER_COUNTER_PERSIST_INTERVAL
+
 /**
  *  @def CHIP_CONFIG_SLOW_CRYPTO
  *
@@ -874,6 +966,44 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_SERVER_MAX_NUM_DIRTY_SET 8
 #endif
 
+/**
+ * @def CHIP_CONFIG_IM_REPORT_SCHEDULER_ALIGNMENT_MS
+ *
+ * @brief Defines the grid, in milliseconds, that the ends of the min and max intervals of subscriptions are aligned to when
+ *        that keeps them within the negotiated intervals, so that one wakeup can serve several subscriptions.  Set to 0 to
+ *        disable alignment.
+ */
+#ifndef CHIP_CONFIG_IM_REPORT_SCHEDULER_ALIGNMENT_MS
+#define CHIP_CONFIG_IM_REPORT_SCHEDULER_ALIGNMENT_MS 1000
+#endif
+
+/**
+ * @def CHIP_CONFIG_IM_REPORT_ENCODING_CACHE_SIZE
+ *
+ * @brief Defines the number of encoded attribute reports the reporting engine keeps around so that subscriptions reporting the
+ *        same dirty attribute can share one encoding.  Set to 0 to disable sharing.
+ *
+ *        The cache takes CHIP_CONFIG_IM_REPORT_ENCODING_CACHE_SIZE * CHIP_CONFIG_IM_REPORT_ENCODING_CACHE_ENTRY_SIZE bytes of RAM,
+ *        so it is only enabled by default on large systems (see CHIP_SYSTEM_CONFIG_POOL_USE_HEAP).
+ */
+#ifndef CHIP_CONFIG_IM_REPORT_ENCODING_CACHE_SIZE
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#define CHIP_CONFIG_IM_REPORT_ENCODING_CACHE_SIZE 4
+#else
+#define CHIP_CONFIG_IM_REPORT_ENCODING_CACHE_SIZE 0
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#endif
+
+/**
+ * @def CHIP_CONFIG_IM_REPORT_ENCODING_CACHE_ENTRY_SIZE
+ *
+ * @brief Defines the size in bytes of each entry of the report encoding cache.  Attributes whose encoding does not fit are
+ *        encoded separately for every subscription.
+ */
+#ifndef CHIP_CONFIG_IM_REPORT_ENCODING_CACHE_ENTRY_SIZE
+#define CHIP_CONFIG_IM_REPORT_ENCODING_CACHE_ENTRY_SIZE 128
+#endif
+
 /**
  * @def CHIP_IM_MAX_NUM_WRITE_HANDLER
  *
@@ -883,6 +1013,17 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_MAX_NUM_WRITE_HANDLER 4
 #endif
 
+/**
+ * @def CHIP_CONFIG_CLUSTER_INTERFACE_REGISTRY_BUCKETS
+ *
+ * @brief Defines the number of hash buckets used to index registered CommandHandlerInterface and
+ *        AttributeAccessInterface instances by (endpoint, cluster).  Each bucket costs one pointer per registry;
+ *        devices that register many per-endpoint interfaces (e.g. bridges) should raise this.
+ */
+#ifndef CHIP_CONFIG_CLUSTER_INTERFACE_REGISTRY_BUCKETS
+#define CHIP_CONFIG_CLUSTER_INTERFACE_REGISTRY_BUCKETS 16
+#endif
+
 /**
  * @def CHIP_IM_MAX_NUM_WRITE_CLIENT
  *
@@ -971,6 +1112,15 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_CONTROLLER_MAX_ACTIVE_CASE_CLIENTS 16
 #endif
 
+/**
+ * @def CHIP_CONFIG_CONTROLLER_MAX_FAN_OUT_READS
+ *
+ * @brief Number of reads a Controller::FanOutAttributeReader has in flight at once, each to a different node.
+ */
+#ifndef CHIP_CONFIG_CONTROLLER_MAX_FAN_OUT_READS
+#define CHIP_CONFIG_CONTROLLER_MAX_FAN_OUT_READS 8
+#endif
+
 /**
  * @def CHIP_CONFIG_DEVICE_MAX_ACTIVE_CASE_CLIENTS
  *
@@ -1046,6 +1196,21 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MAX_GROUP_CONCURRENT_ITERATORS 2
 #endif
 
+/**
+ * @def CHIP_CONFIG_MAX_GROUP_SESSION_INDEX_ENTRIES
+ *
+ * @brief Defines the number of operational group keys, across all fabrics, that the group data provider
+ *        keeps in its in-memory group session index.
+ *
+ * Each group/key set mapping contributes one entry per key in the key set (up to 3). Incoming group
+ * messages are matched against this index instead of walking persistent storage. If the installed keys
+ * do not fit, lookups fall back to walking persistent storage. The default covers fully populated group
+ * key maps on two fabrics. Set to 0 to disable the index.
+ */
+#ifndef CHIP_CONFIG_MAX_GROUP_SESSION_INDEX_ENTRIES
+#define CHIP_CONFIG_MAX_GROUP_SESSION_INDEX_ENTRIES (2 * 3 * CHIP_CONFIG_MAX_GROUPS_PER_FABRIC)
+#endif
+
 /**
  * @def CHIP_CONFIG_MAX_GROUP_NAME_LENGTH
  *
@@ -1355,6 +1520,30 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_NUM_CD_KEY_SLOTS 5
 #endif // CHIP_CONFIG_NUM_CD_KEY_SLOTS
 
+/**
+ * @def CHIP_CONFIG_NUM_VERIFIED_CD_CACHE_ENTRIES
+ *
+ * @brief Number of Certification Declarations whose CMS signature the default DAC verifier
+ *        remembers as verified, so that commissioning many devices of the same product only
+ *        pays for the signature verification once. Set to 0 to disable the cache.
+ *
+ */
+#ifndef CHIP_CONFIG_NUM_VERIFIED_CD_CACHE_ENTRIES
+#define CHIP_CONFIG_NUM_VERIFIED_CD_CACHE_ENTRIES 4
+#endif // CHIP_CONFIG_NUM_VERIFIED_CD_CACHE_ENTRIES
+
+/**
+ * @def CHIP_CONFIG_BDX_ASYNC_MAX_BLOCKS_IN_FLIGHT
+ *
+ * @brief Number of Blocks a BDX Sender sends in Asynchronous mode before it waits for
+ *        a BlockAck. A Receiver may have to buffer this many Blocks while it processes
+ *        the previous ones.
+ *
+ */
+#ifndef CHIP_CONFIG_BDX_ASYNC_MAX_BLOCKS_IN_FLIGHT
+#define CHIP_CONFIG_BDX_ASYNC_MAX_BLOCKS_IN_FLIGHT 4
+#endif // CHIP_CONFIG_BDX_ASYNC_MAX_BLOCKS_IN_FLIGHT
+
 /**
  * @def CHIP_CONFIG_MAX_CLIENT_REG_PER_FABRIC
  *
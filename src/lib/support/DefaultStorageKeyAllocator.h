@@ -133,6 +133,7 @@ public:
     // Group Message Counters
     static StorageKeyName GroupDataCounter() { return StorageKeyName::FromConst("g/gdc"); }
     static StorageKeyName GroupControlCounter() { return StorageKeyName::FromConst("g/gcc"); }
+    static StorageKeyName FabricGroupPeerCounters(FabricIndex fabric) { return StorageKeyName::Formatted("f/%x/gpc", fabric); }
 
     // Device Information Provider
     static StorageKeyName UserLabelLengthKey(EndpointId endpoint) { return StorageKeyName::Formatted("g/userlbl/%x", endpoint); }
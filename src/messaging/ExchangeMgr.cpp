@@ -98,6 +98,16 @@ void ExchangeManager::Shutdown()
 
     mReliableMessageMgr.Shutdown();
 
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    if (mIndexedExchanges == 0 && mExchangeIndex != mExchangeIndexInline)
+    {
+        // Return the grown index to the heap; the inline buckets are all empty as well.
+        mExchangeIndex        = mExchangeIndexInline;
+        mExchangeIndexBuckets = kExchangeIndexInlineBuckets;
+        mExchangeIndexHeap.Free();
+    }
+#endif
+
     if (mSessionManager != nullptr)
     {
         mSessionManager->SetMessageDelegate(nullptr);
@@ -115,7 +125,87 @@ ExchangeContext * ExchangeManager::NewContext(const SessionHandle & session, Exc
         ChipLogError(ExchangeManager, "NewContext failed: session inactive");
         return nullptr;
     }
-    return mContextPool.CreateObject(this, mNextExchangeId++, session, isInitiator, delegate);
+    return AllocateContext(mNextExchangeId++, session, isInitiator, delegate);
+}
+
+ExchangeContext *& ExchangeManager::ExchangeIndexBucket(uint16_t exchangeId, bool isInitiator)
+{
+    size_t key = (static_cast<size_t>(exchangeId) << 1) | (isInitiator ? 1u : 0u);
+    return mExchangeIndex[key % mExchangeIndexBuckets];
+}
+
+void ExchangeManager::AddToExchangeIndex(ExchangeContext * ec)
+{
+    if (mIndexedExchanges >= mExchangeIndexBuckets)
+    {
+        GrowExchangeIndex();
+    }
+
+    ExchangeContext *& bucket = ExchangeIndexBucket(ec->GetExchangeId(), ec->IsInitiator());
+    ec->mNextInIndex          = bucket;
+    bucket                    = ec;
+    mIndexedExchanges++;
+}
+
+void ExchangeManager::RemoveFromExchangeIndex(ExchangeContext * ec)
+{
+    ExchangeContext ** link = &ExchangeIndexBucket(ec->GetExchangeId(), ec->IsInitiator());
+    while (*link != nullptr)
+    {
+        if (*link == ec)
+        {
+            *link            = ec->mNextInIndex;
+            ec->mNextInIndex = nullptr;
+            mIndexedExchanges--;
+            return;
+        }
+        link = &(*link)->mNextInIndex;
+    }
+}
+
+void ExchangeManager::GrowExchangeIndex()
+{
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    size_t newBuckets = mExchangeIndexBuckets * 2;
+    Platform::ScopedMemoryBuffer<ExchangeContext *> newIndex;
+    if (!newIndex.Calloc(newBuckets))
+    {
+        // Keep the current buckets: lookups get slower but stay correct.
+        return;
+    }
+
+    ExchangeContext ** oldIndex = mExchangeIndex;
+    size_t oldBuckets           = mExchangeIndexBuckets;
+    mExchangeIndex              = newIndex.Get();
+    mExchangeIndexBuckets       = newBuckets;
+
+    for (size_t i = 0; i < oldBuckets; i++)
+    {
+        while (oldIndex[i] != nullptr)
+        {
+            ExchangeContext * ec      = oldIndex[i];
+            oldIndex[i]               = ec->mNextInIndex;
+            ExchangeContext *& bucket = ExchangeIndexBucket(ec->GetExchangeId(), ec->IsInitiator());
+            ec->mNextInIndex          = bucket;
+            bucket                    = ec;
+        }
+    }
+
+    // Frees the previous heap buckets, if any. The inline ones are left empty.
+    mExchangeIndexHeap = std::move(newIndex);
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+}
+
+ExchangeContext * ExchangeManager::FindExchange(const SessionHandle & session, const PacketHeader & packetHeader,
+                                                const PayloadHeader & payloadHeader)
+{
+    // A message from the initiator of an exchange is for the responder side of it, and vice versa.
+    ExchangeContext * ec = ExchangeIndexBucket(payloadHeader.GetExchangeID(), !payloadHeader.IsInitiator());
+    while (ec != nullptr && !ec->MatchExchange(session, packetHeader, payloadHeader))
+    {
+        ec = ec->mNextInIndex;
+    }
+    return ec;
 }
 
 CHIP_ERROR ExchangeManager::RegisterUnsolicitedMessageHandlerForProtocol(Protocols::Id protocolId,
@@ -238,23 +328,14 @@ void ExchangeManager::OnMessageReceived(const PacketHeader & packetHeader, const
     if (!packetHeader.IsGroupSession())
     {
         // Search for an existing exchange that the message applies to. If a match is found...
-        bool found = false;
-        mContextPool.ForEachActiveObject([&](auto * ec) {
-            if (ec->MatchExchange(session, packetHeader, payloadHeader))
-            {
-                ChipLogDetail(ExchangeManager, "Found matching exchange: " ChipLogFormatExchange ", Delegate: %p",
-                              ChipLogValueExchange(ec), ec->GetDelegate());
-
-                // Matched ExchangeContext; send to message handler.
-                ec->HandleMessage(packetHeader.GetMessageCounter(), payloadHeader, msgFlags, std::move(msgBuf));
-                found = true;
-                return Loop::Break;
-            }
-            return Loop::Continue;
-        });
-
-        if (found)
+        ExchangeContext * ec = FindExchange(session, packetHeader, payloadHeader);
+        if (ec != nullptr)
         {
+            ChipLogDetail(ExchangeManager, "Found matching exchange: " ChipLogFormatExchange ", Delegate: %p",
+                          ChipLogValueExchange(ec), ec->GetDelegate());
+
+            // Matched ExchangeContext; send to message handler.
+            ec->HandleMessage(packetHeader.GetMessageCounter(), payloadHeader, msgFlags, std::move(msgBuf));
             return;
         }
     }
@@ -321,7 +402,7 @@ void ExchangeManager::OnMessageReceived(const PacketHeader & packetHeader, const
             return;
         }
 
-        ExchangeContext * ec = mContextPool.CreateObject(this, payloadHeader.GetExchangeID(), session, false, delegate);
+        ExchangeContext * ec = AllocateContext(payloadHeader.GetExchangeID(), session, false, delegate);
 
         if (ec == nullptr)
         {
@@ -371,8 +452,8 @@ void ExchangeManager::SendStandaloneAckIfNeeded(const PacketHeader & packetHeade
     // If rcvd msg is from initiator then this exchange is created as not Initiator.
     // If rcvd msg is not from initiator then this exchange is created as Initiator.
     // Create a EphemeralExchange to generate a StandaloneAck
-    ExchangeContext * ec = mContextPool.CreateObject(this, payloadHeader.GetExchangeID(), session, !payloadHeader.IsInitiator(),
-                                                     nullptr, true /* IsEphemeralExchange */);
+    ExchangeContext * ec =
+        AllocateContext(payloadHeader.GetExchangeID(), session, !payloadHeader.IsInitiator(), nullptr, true /* IsEphemeralExchange */);
 
     if (ec == nullptr)
     {
@@ -25,9 +25,13 @@
 #pragma once
 
 #include <array>
+#include <stdint.h>
+#include <utility>
 
+#include <lib/support/CodeUtils.h>
 #include <lib/support/DLLUtil.h>
 #include <lib/support/Pool.h>
+#include <lib/support/ScopedBuffer.h>
 #include <lib/support/TypeTraits.h>
 #include <messaging/ExchangeContext.h>
 #include <messaging/ReliableMessageMgr.h>
@@ -193,6 +197,13 @@ public:
 
     size_t GetNumActiveExchanges() { return mContextPool.Allocated(); }
 
+    /**
+     * Limit the number of simultaneously active exchanges, including the ones created for unsolicited messages
+     * and standalone acknowledgements. Exchanges are never allocated past CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS,
+     * unless CHIP_SYSTEM_CONFIG_POOL_USE_HEAP is set, in which case there is no limit by default.
+     */
+    void SetMaxExchanges(size_t maxExchanges) { mMaxExchanges = maxExchanges; }
+
 private:
     enum class State
     {
@@ -229,12 +240,46 @@ private:
     FabricIndex mFabricIndex = 0;
 
     ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> mContextPool;
+    size_t mMaxExchanges = SIZE_MAX;
+
+    //
+    // Index of the exchanges by exchange id and initiator flag, so that an incoming message is matched to its
+    // exchange without visiting every active exchange. Exchanges in the same bucket are chained through
+    // ExchangeContext::mNextInIndex. The session is not part of the key since an exchange can move to another
+    // session (see ExchangeContext::ExchangeSessionHolder): MatchExchange() checks it within the bucket.
+    //
+    // The inline buckets are enough for CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS. With heap pools, the index is moved
+    // to a bigger heap allocation whenever it holds more exchanges than it has buckets.
+    //
+    static constexpr size_t kExchangeIndexInlineBuckets = CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS;
+
+    ExchangeContext * mExchangeIndexInline[kExchangeIndexInlineBuckets] = {};
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    Platform::ScopedMemoryBuffer<ExchangeContext *> mExchangeIndexHeap;
+#endif
+    ExchangeContext ** mExchangeIndex = mExchangeIndexInline;
+    size_t mExchangeIndexBuckets      = kExchangeIndexInlineBuckets;
+    size_t mIndexedExchanges          = 0;
 
     SessionManager * mSessionManager;
     ReliableMessageMgr mReliableMessageMgr;
 
     UnsolicitedMessageHandlerSlot UMHandlerPool[CHIP_CONFIG_MAX_UNSOLICITED_MESSAGE_HANDLERS];
 
+    template <typename... Args>
+    ExchangeContext * AllocateContext(Args &&... args)
+    {
+        VerifyOrReturnValue(mContextPool.Allocated() < mMaxExchanges, nullptr);
+        return mContextPool.CreateObject(this, std::forward<Args>(args)...);
+    }
+
+    ExchangeContext *& ExchangeIndexBucket(uint16_t exchangeId, bool isInitiator);
+    void AddToExchangeIndex(ExchangeContext * ec);
+    void RemoveFromExchangeIndex(ExchangeContext * ec);
+    void GrowExchangeIndex();
+    ExchangeContext * FindExchange(const SessionHandle & session, const PacketHeader & packetHeader,
+                                   const PayloadHeader & payloadHeader);
+
     CHIP_ERROR RegisterUMH(Protocols::Id protocolId, int16_t msgType, UnsolicitedMessageHandler * handler);
     CHIP_ERROR UnregisterUMH(Protocols::Id protocolId, int16_t msgType);
 
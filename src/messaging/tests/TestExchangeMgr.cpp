@@ -99,6 +99,45 @@ class ExpireSessionFromTimeoutDelegate : public WaitForTimeoutDelegate
     }
 };
 
+// Answers every unsolicited message on the exchange it was received on.
+class EchoingDelegate : public UnsolicitedMessageHandler, public ExchangeDelegate
+{
+public:
+    CHIP_ERROR OnUnsolicitedMessageReceived(const PayloadHeader & payloadHeader, ExchangeDelegate *& newDelegate) override
+    {
+        newDelegate = this;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR OnMessageReceived(ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                                 System::PacketBufferHandle && buffer) override
+    {
+        return ec->SendMessage(Protocols::BDX::Id, kMsgType_TEST2, std::move(buffer),
+                               SendFlags(Messaging::SendMessageFlags::kNoAutoRequestAck));
+    }
+
+    void OnResponseTimeout(ExchangeContext * ec) override {}
+};
+
+class ResponseCountingDelegate : public ExchangeDelegate
+{
+public:
+    CHIP_ERROR OnMessageReceived(ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                                 System::PacketBufferHandle && buffer) override
+    {
+        if (payloadHeader.HasProtocol(Protocols::BDX::Id) && payloadHeader.HasMessageType(to_underlying(kMsgType_TEST2)) &&
+            ec->IsInitiator())
+        {
+            mResponseCount++;
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    void OnResponseTimeout(ExchangeContext * ec) override {}
+
+    size_t mResponseCount = 0;
+};
+
 void CheckNewContextTest(nlTestSuite * inSuite, void * inContext)
 {
     TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
@@ -259,6 +298,67 @@ void CheckExchangeMessages(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
 }
 
+void CheckMatchingWithManyExchanges(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    // Every request has an exchange on both sides.
+    constexpr size_t kRequestCount = CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS / 2 - 1;
+
+    EchoingDelegate echoingDelegate;
+    ResponseCountingDelegate responseDelegate;
+    size_t exchangesBefore = ctx.GetExchangeManager().GetNumActiveExchanges();
+    CHIP_ERROR err =
+        ctx.GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Protocols::BDX::Id, kMsgType_TEST1, &echoingDelegate);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    for (size_t i = 0; i < kRequestCount; i++)
+    {
+        ExchangeContext * ec = ctx.NewExchangeToAlice(&responseDelegate);
+        NL_TEST_ASSERT(inSuite, ec != nullptr);
+        VerifyOrReturn(ec != nullptr);
+
+        err = ec->SendMessage(Protocols::BDX::Id, kMsgType_TEST1, System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize),
+                              SendFlags(Messaging::SendMessageFlags::kExpectResponse, Messaging::SendMessageFlags::kNoAutoRequestAck));
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    }
+
+    ctx.DrainAndServiceIO();
+    NL_TEST_ASSERT(inSuite, responseDelegate.mResponseCount == kRequestCount);
+    NL_TEST_ASSERT(inSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == exchangesBefore);
+
+    err = ctx.GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Protocols::BDX::Id, kMsgType_TEST1);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+}
+
+void CheckMaxExchanges(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    MockAppDelegate mockAppDelegate;
+    ctx.GetExchangeManager().SetMaxExchanges(ctx.GetExchangeManager().GetNumActiveExchanges() + 1);
+
+    ExchangeContext * ec1 = ctx.NewExchangeToBob(&mockAppDelegate);
+    NL_TEST_ASSERT(inSuite, ec1 != nullptr);
+
+    ExchangeContext * ec2 = ctx.NewExchangeToBob(&mockAppDelegate);
+    NL_TEST_ASSERT(inSuite, ec2 == nullptr);
+
+    ctx.GetExchangeManager().SetMaxExchanges(SIZE_MAX);
+
+    ec2 = ctx.NewExchangeToBob(&mockAppDelegate);
+    NL_TEST_ASSERT(inSuite, ec2 != nullptr);
+
+    if (ec1 != nullptr)
+    {
+        ec1->Close();
+    }
+    if (ec2 != nullptr)
+    {
+        ec2->Close();
+    }
+}
+
 // Test Suite
 
 /**
@@ -270,6 +370,8 @@ const nlTest sTests[] =
     NL_TEST_DEF("Test ExchangeMgr::NewContext",               CheckNewContextTest),
     NL_TEST_DEF("Test ExchangeMgr::CheckUmhRegistrationTest", CheckUmhRegistrationTest),
     NL_TEST_DEF("Test ExchangeMgr::CheckExchangeMessages",    CheckExchangeMessages),
+    NL_TEST_DEF("Test matching with many exchanges",          CheckMatchingWithManyExchanges),
+    NL_TEST_DEF("Test ExchangeMgr::SetMaxExchanges",          CheckMaxExchanges),
     NL_TEST_DEF("Test OnConnectionExpired basics",            CheckSessionExpirationBasics),
     NL_TEST_DEF("Test OnConnectionExpired timeout handling",  CheckSessionExpirationTimeout),
     NL_TEST_DEF("Test session eviction in timeout handling",  CheckSessionExpirationDuringTimeout),
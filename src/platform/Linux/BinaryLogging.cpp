@@ -0,0 +1,640 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *          Binary logging backend for the Linux platform.
+ *
+ *          The file starts with the "CHIPBLOG" magic, a version byte and the
+ *          process id (u32), followed by records. All integers are little
+ *          endian.
+ *
+ *            'S' u64 address, u16 length, bytes    a format string or module name
+ *            'M' u32 thread id, u16 length, bytes  a log message
+ *
+ *          A log message is a u64 timestamp (microseconds since the epoch),
+ *          the u8 category, the u64 addresses of the module name and format
+ *          string, then one tagged value per argument consumed by the format
+ *          string, '*' widths and precisions included: 'i' i64, 'u' u64,
+ *          'f' IEEE 754 double as u64, 's' u16 length and bytes.
+ */
+
+#include <platform/Linux/BinaryLogging.h>
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/BufferWriter.h>
+#include <lib/support/CodeUtils.h>
+#include <platform/CHIPDeviceConfig.h>
+
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <unordered_set>
+
+#include <ctype.h>
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/syscall.h>
+#include <sys/types.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace chip {
+namespace DeviceLayer {
+namespace BinaryLogging {
+namespace {
+
+using Encoding::LittleEndian::BufferWriter;
+
+constexpr size_t kBufferSize = CHIP_DEVICE_CONFIG_BINARY_LOGGING_BUFFER_SIZE;
+static_assert(kBufferSize >= 1024 && (kBufferSize & (kBufferSize - 1)) == 0,
+              "CHIP_DEVICE_CONFIG_BINARY_LOGGING_BUFFER_SIZE must be a power of two of at least 1024");
+
+constexpr char kFileMagic[]           = "CHIPBLOG";
+constexpr uint8_t kFileVersion        = 1;
+constexpr size_t kLengthSize          = sizeof(uint16_t);
+constexpr size_t kModuleOffset        = sizeof(uint64_t) + sizeof(uint8_t);
+constexpr size_t kFormatOffset        = kModuleOffset + sizeof(uint64_t);
+constexpr size_t kMessageHeaderSize   = kFormatOffset + sizeof(uint64_t);
+constexpr size_t kMaxMessageSize      = kMessageHeaderSize + CHIP_CONFIG_LOG_MESSAGE_MAX_SIZE;
+constexpr size_t kMaxFormatLength     = UINT16_MAX;
+constexpr useconds_t kDrainIntervalUs = 10000;
+
+static_assert(kLengthSize + kMaxMessageSize <= kBufferSize, "A message must fit in an empty buffer");
+static_assert(kMaxMessageSize <= UINT16_MAX, "Message lengths are encoded on 16 bits");
+
+enum class LengthModifier : uint8_t
+{
+    kNone,
+    kChar,
+    kShort,
+    kLong,
+    kLongLong,
+    kIntMax,
+    kSize,
+    kPtrDiff,
+    kLongDouble,
+};
+
+// Single producer (the thread owning the buffer), single consumer (the drain thread) queue of length-prefixed messages.
+struct ThreadBuffer
+{
+    bool Push(const uint8_t * data, size_t length)
+    {
+        size_t head = mHead.load(std::memory_order_relaxed);
+        size_t tail = mTail.load(std::memory_order_acquire);
+        VerifyOrReturnValue(kBufferSize - (head - tail) >= length, false);
+
+        for (size_t i = 0; i < length; i++)
+        {
+            mData[(head + i) & (kBufferSize - 1)] = data[i];
+        }
+        mHead.store(head + length, std::memory_order_release);
+        return true;
+    }
+
+    void CopyOut(size_t position, uint8_t * data, size_t length) const
+    {
+        for (size_t i = 0; i < length; i++)
+        {
+            data[i] = mData[(position + i) & (kBufferSize - 1)];
+        }
+    }
+
+    alignas(64) std::atomic<size_t> mHead{ 0 };
+    alignas(64) std::atomic<size_t> mTail{ 0 };
+    std::atomic<bool> mOrphaned{ false };
+    uint32_t mThreadId   = 0;
+    ThreadBuffer * mNext = nullptr;
+    // Only used by the drain thread: the buffer was orphaned and emptied, and can be freed.
+    bool mReleasable = false;
+    uint8_t mData[kBufferSize];
+};
+
+// Marks the buffer of a thread as orphaned when the thread exits, so that the drain thread frees it once empty.
+struct ThreadBufferOwner
+{
+    ~ThreadBufferOwner()
+    {
+        // The drain thread may free the buffer as soon as it is orphaned: forget it first, so that messages logged later
+        // in the exit of the thread (e.g. from other thread_local destructors) go through the text backend instead.
+        ThreadBuffer * buffer = mBuffer;
+        mBuffer               = nullptr;
+        mThreadExited         = true;
+        if (buffer != nullptr)
+        {
+            buffer->mOrphaned.store(true, std::memory_order_release);
+        }
+    }
+
+    ThreadBuffer * mBuffer = nullptr;
+    bool mThreadExited     = false;
+};
+
+thread_local ThreadBufferOwner tBufferOwner;
+
+std::atomic<bool> gStarted{ false };
+std::atomic<bool> gStopRequested{ false };
+std::atomic<uint64_t> gDroppedCount{ 0 };
+
+// Serializes Start() and Stop().
+std::mutex gControlMutex;
+pthread_t gDrainThread;
+bool gAtExitRegistered = false;
+
+// Protects the list of buffers. Logging threads only take it the first time they log.
+std::mutex gBuffersMutex;
+ThreadBuffer * gBuffers = nullptr;
+
+// Only used by the drain thread while started.
+FILE * gOutput = nullptr;
+std::unordered_set<uint64_t> gWrittenStrings;
+
+ThreadBuffer * GetThreadBuffer()
+{
+    VerifyOrReturnValue(!tBufferOwner.mThreadExited, nullptr);
+    if (tBufferOwner.mBuffer == nullptr)
+    {
+        ThreadBuffer * buffer = new (std::nothrow) ThreadBuffer;
+        VerifyOrReturnValue(buffer != nullptr, nullptr);
+        buffer->mThreadId = static_cast<uint32_t>(syscall(SYS_gettid));
+
+        std::lock_guard<std::mutex> lock(gBuffersMutex);
+        buffer->mNext        = gBuffers;
+        gBuffers             = buffer;
+        tBufferOwner.mBuffer = buffer;
+    }
+    return tBufferOwner.mBuffer;
+}
+
+uint64_t NowMicroseconds()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000 + static_cast<uint64_t>(ts.tv_nsec) / 1000;
+}
+
+LengthModifier ParseLengthModifier(const char *& p)
+{
+    switch (*p)
+    {
+    case 'h':
+        p++;
+        if (*p == 'h')
+        {
+            p++;
+            return LengthModifier::kChar;
+        }
+        return LengthModifier::kShort;
+    case 'l':
+        p++;
+        if (*p == 'l')
+        {
+            p++;
+            return LengthModifier::kLongLong;
+        }
+        return LengthModifier::kLong;
+    case 'j':
+        p++;
+        return LengthModifier::kIntMax;
+    case 'z':
+        p++;
+        return LengthModifier::kSize;
+    case 't':
+        p++;
+        return LengthModifier::kPtrDiff;
+    case 'L':
+        p++;
+        return LengthModifier::kLongDouble;
+    default:
+        return LengthModifier::kNone;
+    }
+}
+
+void PutSigned(BufferWriter & writer, int64_t value)
+{
+    writer.Put8('i').Put64(static_cast<uint64_t>(value));
+}
+
+void PutUnsigned(BufferWriter & writer, uint64_t value)
+{
+    writer.Put8('u').Put64(value);
+}
+
+void PutDouble(BufferWriter & writer, double value)
+{
+    uint64_t bits;
+    static_assert(sizeof(bits) == sizeof(value), "Unexpected size of double");
+    memcpy(&bits, &value, sizeof(bits));
+    writer.Put8('f').Put64(bits);
+}
+
+void PutString(BufferWriter & writer, const char * value, int precision)
+{
+    if (value == nullptr)
+    {
+        value = "(null)";
+    }
+    // A message longer than what fits in a record goes through the text backend, no need to look further.
+    size_t maxLength = CHIP_CONFIG_LOG_MESSAGE_MAX_SIZE + 1;
+    if (precision >= 0 && static_cast<size_t>(precision) < maxLength)
+    {
+        maxLength = static_cast<size_t>(precision);
+    }
+    size_t length = strnlen(value, maxLength);
+    writer.Put8('s').Put16(static_cast<uint16_t>(length)).Put(value, length);
+}
+
+int64_t ReadSigned(va_list * args, LengthModifier length)
+{
+    switch (length)
+    {
+    case LengthModifier::kChar:
+        return static_cast<signed char>(va_arg(*args, int));
+    case LengthModifier::kShort:
+        return static_cast<short>(va_arg(*args, int));
+    case LengthModifier::kLong:
+        return va_arg(*args, long);
+    case LengthModifier::kLongLong:
+        return va_arg(*args, long long);
+    case LengthModifier::kIntMax:
+        return va_arg(*args, intmax_t);
+    case LengthModifier::kSize:
+        return va_arg(*args, ssize_t);
+    case LengthModifier::kPtrDiff:
+        return va_arg(*args, ptrdiff_t);
+    default:
+        return va_arg(*args, int);
+    }
+}
+
+uint64_t ReadUnsigned(va_list * args, LengthModifier length)
+{
+    switch (length)
+    {
+    case LengthModifier::kChar:
+        return static_cast<unsigned char>(va_arg(*args, unsigned int));
+    case LengthModifier::kShort:
+        return static_cast<unsigned short>(va_arg(*args, unsigned int));
+    case LengthModifier::kLong:
+        return va_arg(*args, unsigned long);
+    case LengthModifier::kLongLong:
+        return va_arg(*args, unsigned long long);
+    case LengthModifier::kIntMax:
+        return va_arg(*args, uintmax_t);
+    case LengthModifier::kSize:
+        return va_arg(*args, size_t);
+    case LengthModifier::kPtrDiff:
+        return static_cast<uint64_t>(va_arg(*args, ptrdiff_t));
+    default:
+        return va_arg(*args, unsigned int);
+    }
+}
+
+// Append the arguments consumed by the format string, as printf would read them. Returns false for conversions the decoder
+// does not support.
+bool EncodeArguments(const char * msg, va_list * args, BufferWriter & writer)
+{
+    for (const char * p = strchr(msg, '%'); p != nullptr; p = strchr(p, '%'))
+    {
+        p++;
+        if (*p == '%')
+        {
+            p++;
+            continue;
+        }
+
+        while (*p != '\0' && strchr("-+ #0", *p) != nullptr)
+        {
+            p++;
+        }
+
+        if (*p == '*')
+        {
+            PutSigned(writer, va_arg(*args, int));
+            p++;
+        }
+        while (isdigit(static_cast<unsigned char>(*p)))
+        {
+            p++;
+        }
+
+        int precision = -1;
+        if (*p == '.')
+        {
+            p++;
+            precision = 0;
+            if (*p == '*')
+            {
+                precision = va_arg(*args, int);
+                PutSigned(writer, precision);
+                p++;
+            }
+            while (isdigit(static_cast<unsigned char>(*p)))
+            {
+                precision = precision * 10 + (*p - '0');
+                p++;
+            }
+        }
+
+        LengthModifier length = ParseLengthModifier(p);
+        switch (*p)
+        {
+        case 'd':
+        case 'i':
+            PutSigned(writer, ReadSigned(args, length));
+            break;
+        case 'o':
+        case 'u':
+        case 'x':
+        case 'X':
+            PutUnsigned(writer, ReadUnsigned(args, length));
+            break;
+        case 'c':
+            VerifyOrReturnValue(length == LengthModifier::kNone, false);
+            PutSigned(writer, va_arg(*args, int));
+            break;
+        case 's':
+            VerifyOrReturnValue(length == LengthModifier::kNone, false);
+            PutString(writer, va_arg(*args, const char *), precision);
+            break;
+        case 'p':
+            PutUnsigned(writer, reinterpret_cast<uintptr_t>(va_arg(*args, void *)));
+            break;
+        case 'e':
+        case 'E':
+        case 'f':
+        case 'F':
+        case 'g':
+        case 'G':
+            PutDouble(writer,
+                      (length == LengthModifier::kLongDouble) ? static_cast<double>(va_arg(*args, long double))
+                                                              : va_arg(*args, double));
+            break;
+        default:
+            // %n, %a, wide characters or a malformed format string.
+            return false;
+        }
+        p++;
+    }
+    return true;
+}
+
+void WriteString(uint64_t address)
+{
+    if (address == 0 || !gWrittenStrings.insert(address).second)
+    {
+        return;
+    }
+
+    const char * string = reinterpret_cast<const char *>(static_cast<uintptr_t>(address));
+    size_t length       = strnlen(string, kMaxFormatLength);
+    uint8_t header[1 + sizeof(uint64_t) + sizeof(uint16_t)];
+    BufferWriter writer(header, sizeof(header));
+    writer.Put8('S').Put64(address).Put16(static_cast<uint16_t>(length));
+    fwrite(header, 1, sizeof(header), gOutput);
+    fwrite(string, 1, length, gOutput);
+}
+
+void WriteMessage(uint32_t threadId, const uint8_t * message, uint16_t length)
+{
+    if (length >= kMessageHeaderSize)
+    {
+        WriteString(Encoding::LittleEndian::Get64(message + kModuleOffset));
+        WriteString(Encoding::LittleEndian::Get64(message + kFormatOffset));
+    }
+
+    uint8_t header[1 + sizeof(uint32_t) + sizeof(uint16_t)];
+    BufferWriter writer(header, sizeof(header));
+    writer.Put8('M').Put32(threadId).Put16(length);
+    fwrite(header, 1, sizeof(header), gOutput);
+    fwrite(message, 1, length, gOutput);
+}
+
+// Returns whether any message was written.
+bool Drain(ThreadBuffer & buffer)
+{
+    size_t tail  = buffer.mTail.load(std::memory_order_relaxed);
+    size_t head  = buffer.mHead.load(std::memory_order_acquire);
+    bool drained = (tail != head);
+    uint8_t lengthBytes[kLengthSize];
+    uint8_t message[kMaxMessageSize];
+
+    while (tail != head)
+    {
+        buffer.CopyOut(tail, lengthBytes, sizeof(lengthBytes));
+        uint16_t length = Encoding::LittleEndian::Get16(lengthBytes);
+        buffer.CopyOut(tail + kLengthSize, message, length);
+        WriteMessage(buffer.mThreadId, message, length);
+
+        tail += kLengthSize + length;
+        buffer.mTail.store(tail, std::memory_order_release);
+    }
+    return drained;
+}
+
+bool DrainAll()
+{
+    ThreadBuffer * buffers;
+    {
+        std::lock_guard<std::mutex> lock(gBuffersMutex);
+        buffers = gBuffers;
+    }
+
+    // Buffers are only added at the head of the list, and only removed by this thread, so the list can be walked
+    // without the lock: threads logging for the first time do not wait for the file to be written.
+    bool drained    = false;
+    bool releasable = false;
+    for (ThreadBuffer * buffer = buffers; buffer != nullptr; buffer = buffer->mNext)
+    {
+        // Read before draining: once orphaned, the owning thread does not push anymore.
+        bool orphaned = buffer->mOrphaned.load(std::memory_order_acquire);
+        drained |= Drain(*buffer);
+        buffer->mReleasable = orphaned;
+        releasable |= orphaned;
+    }
+
+    if (drained)
+    {
+        fflush(gOutput);
+    }
+
+    if (releasable)
+    {
+        ThreadBuffer * released = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(gBuffersMutex);
+            ThreadBuffer ** link = &gBuffers;
+            while (*link != nullptr)
+            {
+                ThreadBuffer * buffer = *link;
+                if (buffer->mReleasable)
+                {
+                    *link         = buffer->mNext;
+                    buffer->mNext = released;
+                    released      = buffer;
+                }
+                else
+                {
+                    link = &buffer->mNext;
+                }
+            }
+        }
+
+        while (released != nullptr)
+        {
+            ThreadBuffer * buffer = released;
+            released              = buffer->mNext;
+            delete buffer;
+        }
+    }
+    return drained;
+}
+
+void * DrainThreadMain(void *)
+{
+    while (!gStopRequested.load(std::memory_order_acquire))
+    {
+        if (!DrainAll())
+        {
+            usleep(kDrainIntervalUs);
+        }
+    }
+    DrainAll();
+    return nullptr;
+}
+
+// Drop what was queued after the last drain of a previous session.
+void DiscardQueuedMessages()
+{
+    std::lock_guard<std::mutex> lock(gBuffersMutex);
+    for (ThreadBuffer * buffer = gBuffers; buffer != nullptr; buffer = buffer->mNext)
+    {
+        buffer->mTail.store(buffer->mHead.load(std::memory_order_acquire), std::memory_order_release);
+    }
+}
+
+void StopAtExit()
+{
+    Stop();
+}
+
+} // namespace
+
+CHIP_ERROR Start(const char * path)
+{
+    // Messages that cannot be recorded still go to stdout through the text backend, so records need a file of their own.
+    VerifyOrReturnError(path != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::lock_guard<std::mutex> lock(gControlMutex);
+    VerifyOrReturnError(!gStarted.load(std::memory_order_relaxed), CHIP_ERROR_INCORRECT_STATE);
+
+    FILE * output = fopen(path, "wb");
+    VerifyOrReturnError(output != nullptr, CHIP_ERROR_OPEN_FAILED);
+
+    uint8_t header[sizeof(kFileMagic) - 1 + sizeof(kFileVersion) + sizeof(uint32_t)];
+    BufferWriter writer(header, sizeof(header));
+    writer.Put(kFileMagic).Put8(kFileVersion).Put32(static_cast<uint32_t>(getpid()));
+    if (fwrite(header, 1, sizeof(header), output) != sizeof(header))
+    {
+        fclose(output);
+        return CHIP_ERROR_WRITE_FAILED;
+    }
+
+    DiscardQueuedMessages();
+    gOutput = output;
+    gWrittenStrings.clear();
+    gStopRequested.store(false, std::memory_order_relaxed);
+    if (pthread_create(&gDrainThread, nullptr, DrainThreadMain, nullptr) != 0)
+    {
+        fclose(output);
+        gOutput = nullptr;
+        return CHIP_ERROR_NO_MEMORY;
+    }
+
+    if (!gAtExitRegistered)
+    {
+        // The drain thread has to be joined before the globals it uses are destroyed.
+        atexit(StopAtExit);
+        gAtExitRegistered = true;
+    }
+
+    gDroppedCount.store(0, std::memory_order_relaxed);
+    gStarted.store(true, std::memory_order_release);
+    return CHIP_NO_ERROR;
+}
+
+void Stop()
+{
+    std::lock_guard<std::mutex> lock(gControlMutex);
+    VerifyOrReturn(gStarted.load(std::memory_order_relaxed));
+
+    gStarted.store(false, std::memory_order_release);
+    gStopRequested.store(true, std::memory_order_release);
+    pthread_join(gDrainThread, nullptr);
+
+    fclose(gOutput);
+    gOutput = nullptr;
+}
+
+bool IsStarted()
+{
+    return gStarted.load(std::memory_order_acquire);
+}
+
+bool LogV(const char * module, uint8_t category, const char * msg, va_list v)
+{
+    VerifyOrReturnValue(gStarted.load(std::memory_order_acquire), false);
+    ThreadBuffer * buffer = GetThreadBuffer();
+    VerifyOrReturnValue(buffer != nullptr, false);
+
+    uint8_t record[kLengthSize + kMaxMessageSize];
+    BufferWriter writer(record, sizeof(record));
+    writer.Skip(kLengthSize)
+        .Put64(NowMicroseconds())
+        .Put8(category)
+        .Put64(reinterpret_cast<uintptr_t>(module))
+        .Put64(reinterpret_cast<uintptr_t>(msg));
+
+    va_list args;
+    va_copy(args, v);
+    bool encoded = EncodeArguments(msg, &args, writer);
+    va_end(args);
+    VerifyOrReturnValue(encoded && writer.Fit(), false);
+
+    size_t length = writer.Needed();
+    Encoding::LittleEndian::Put16(record, static_cast<uint16_t>(length - kLengthSize));
+    if (!buffer->Push(record, length))
+    {
+        gDroppedCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    return true;
+}
+
+uint64_t GetDroppedCount()
+{
+    return gDroppedCount.load(std::memory_order_relaxed);
+}
+
+} // namespace BinaryLogging
+} // namespace DeviceLayer
+} // namespace chip
@@ -0,0 +1,79 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *          Binary logging backend for the Linux platform.
+ *
+ *          While binary logging is started, the platform LogV() does not
+ *          format log messages. The calling thread appends the pointers to
+ *          the module name and format string, and the raw arguments, to a
+ *          buffer of its own without taking any lock, and a background
+ *          thread writes the records to a file. Use
+ *          scripts/tools/decode_binary_log.py to turn the file into text.
+ *
+ *          Format strings and module names are recorded by address and only
+ *          read by the background thread, so they must have static storage
+ *          duration, as the literals passed to the ChipLog* macros do.
+ *          Messages that cannot be recorded in binary form (an unsupported
+ *          conversion, or more than CHIP_CONFIG_LOG_MESSAGE_MAX_SIZE bytes of
+ *          arguments) go through the text backend instead. Records are
+ *          dropped, and counted, when the buffer of a thread is full.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+
+#include <stdarg.h>
+#include <stdint.h>
+
+namespace chip {
+namespace DeviceLayer {
+namespace BinaryLogging {
+
+/**
+ * Start recording log messages in binary form to the file at path, which is
+ * truncated. Messages going through the text backend are still written to
+ * stdout.
+ */
+CHIP_ERROR Start(const char * path);
+
+/**
+ * Write the records queued so far, then stop binary logging. Messages logged
+ * concurrently with Stop() may be lost.
+ */
+void Stop();
+
+bool IsStarted();
+
+/**
+ * Record a log message if binary logging is started.
+ *
+ * @retval true  if the message was recorded or dropped.
+ * @retval false if the message has to go through the text backend.
+ */
+bool LogV(const char * module, uint8_t category, const char * msg, va_list v);
+
+/**
+ * Number of messages dropped because the buffer of their thread was full.
+ */
+uint64_t GetDroppedCount();
+
+} // namespace BinaryLogging
+} // namespace DeviceLayer
+} // namespace chip
@@ -68,6 +68,12 @@
 #define CHIP_DEVICE_CONFIG_EVENT_LOGGING_UTC_TIMESTAMPS 1
 #endif // CHIP_DEVICE_CONFIG_EVENT_LOGGING_UTC_TIMESTAMPS
 
+// Size of the buffer each thread queues its log records in when binary logging is
+// started (see BinaryLogging.h). Must be a power of two.
+#ifndef CHIP_DEVICE_CONFIG_BINARY_LOGGING_BUFFER_SIZE
+#define CHIP_DEVICE_CONFIG_BINARY_LOGGING_BUFFER_SIZE 65536
+#endif // CHIP_DEVICE_CONFIG_BINARY_LOGGING_BUFFER_SIZE
+
 #define CHIP_DEVICE_CONFIG_ENABLE_WIFI_TELEMETRY 0
 #define CHIP_DEVICE_CONFIG_ENABLE_THREAD_TELEMETRY 0
 #define CHIP_DEVICE_CONFIG_ENABLE_THREAD_TELEMETRY_FULL 0
@@ -64,6 +64,11 @@ using CHIP_CONFIG_PERSISTED_STORAGE_KEY_TYPE = const char *;
 #define CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS 1
 #endif // CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS
 
+// The KVS rewrites its whole file on every write, so attribute values written in a burst are committed together.
+#ifndef CHIP_CONFIG_WRITE_BEHIND_ATTRIBUTE_STORAGE
+#define CHIP_CONFIG_WRITE_BEHIND_ATTRIBUTE_STORAGE 1
+#endif // CHIP_CONFIG_WRITE_BEHIND_ATTRIBUTE_STORAGE
+
 // ==================== Security Configuration Overrides ====================
 
 #ifndef CHIP_CONFIG_KVS_PATH
@@ -21,7 +21,10 @@
 
 #include "OTAImageProcessorImpl.h"
 
+#include <errno.h>
+#include <fcntl.h>
 #include <sys/stat.h>
+#include <unistd.h>
 
 namespace chip {
 
@@ -63,7 +66,7 @@ CHIP_ERROR OTAImageProcessorImpl::Abort()
 
 CHIP_ERROR OTAImageProcessorImpl::ProcessBlock(ByteSpan & block)
 {
-    if (!mOfs.is_open() || !mOfs.good())
+    if (mImageFd < 0)
     {
         return CHIP_ERROR_INTERNAL;
     }
@@ -127,10 +130,15 @@ void OTAImageProcessorImpl::HandlePrepareDownload(intptr_t context)
 
     unlink(imageProcessor->mImageFile);
 
+    imageProcessor->CloseImageFile();
     imageProcessor->mHeaderParser.Init();
-    imageProcessor->mOfs.open(imageProcessor->mImageFile, std::ofstream::out | std::ofstream::ate | std::ofstream::app);
-    if (!imageProcessor->mOfs.good())
+    imageProcessor->mParams        = OTAImageProgress();
+    imageProcessor->mImageVerified = false;
+
+    imageProcessor->mImageFd = open(imageProcessor->mImageFile, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    if (imageProcessor->mImageFd < 0 || imageProcessor->mImageDigestVerifier.Begin() != CHIP_NO_ERROR)
     {
+        imageProcessor->CloseImageFile();
         imageProcessor->mDownloader->OnPreparedForDownload(CHIP_ERROR_OPEN_FAILED);
         return;
     }
@@ -146,9 +154,22 @@ void OTAImageProcessorImpl::HandleFinalize(intptr_t context)
         return;
     }
 
-    imageProcessor->mOfs.close();
+    imageProcessor->CloseImageFile();
     imageProcessor->ReleaseBlock();
 
+    CHIP_ERROR error = imageProcessor->mImageDigestVerifier.Finish();
+    if (error != CHIP_NO_ERROR)
+    {
+        ChipLogError(SoftwareUpdate, "OTA image verification failed: %" CHIP_ERROR_FORMAT, error.Format());
+        unlink(imageProcessor->mImageFile);
+        if (imageProcessor->mDownloader != nullptr)
+        {
+            imageProcessor->mDownloader->EndDownload(CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+        }
+        return;
+    }
+
+    imageProcessor->mImageVerified = true;
     ChipLogProgress(SoftwareUpdate, "OTA image downloaded to %s", imageProcessor->mImageFile);
 }
 
@@ -160,6 +181,13 @@ void OTAImageProcessorImpl::HandleApply(intptr_t context)
     OTARequestorInterface * requestor = chip::GetRequestorInstance();
     VerifyOrReturn(requestor != nullptr);
 
+    if (!imageProcessor->mImageVerified)
+    {
+        ChipLogError(SoftwareUpdate, "Refusing to apply an OTA image that has not been verified");
+        requestor->CancelImageUpdate();
+        return;
+    }
+
     // Move the downloaded image to the location where the new image is to be executed from
     unlink(kImageExecPath);
     rename(imageProcessor->mImageFile, kImageExecPath);
@@ -178,9 +206,10 @@ void OTAImageProcessorImpl::HandleAbort(intptr_t context)
         return;
     }
 
-    imageProcessor->mOfs.close();
+    imageProcessor->CloseImageFile();
     unlink(imageProcessor->mImageFile);
     imageProcessor->ReleaseBlock();
+    imageProcessor->mImageVerified = false;
 }
 
 void OTAImageProcessorImpl::HandleProcessBlock(intptr_t context)
@@ -206,13 +235,14 @@ void OTAImageProcessorImpl::HandleProcessBlock(intptr_t context)
         return;
     }
 
-    if (!imageProcessor->mOfs.write(reinterpret_cast<const char *>(block.data()), static_cast<std::streamsize>(block.size())))
+    error = imageProcessor->WriteBlock(block);
+    if (error != CHIP_NO_ERROR)
     {
+        ChipLogError(SoftwareUpdate, "Cannot write block: %" CHIP_ERROR_FORMAT, error.Format());
         imageProcessor->mDownloader->EndDownload(CHIP_ERROR_WRITE_FAILED);
         return;
     }
 
-    imageProcessor->mParams.downloadedBytes += block.size();
     imageProcessor->mDownloader->FetchNextData();
 }
 
@@ -228,12 +258,52 @@ CHIP_ERROR OTAImageProcessorImpl::ProcessHeader(ByteSpan & block)
         ReturnErrorOnFailure(error);
 
         mParams.totalFileBytes = header.mPayloadSize;
+        mImageDigestVerifier.SetHeader(header);
         mHeaderParser.Clear();
     }
 
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR OTAImageProcessorImpl::WriteBlock(const ByteSpan & block)
+{
+    // Write at the current offset with pwrite() so that no user-space stream buffering or extra copy is involved
+    const uint8_t * data = block.data();
+    size_t remaining     = block.size();
+    off_t offset         = static_cast<off_t>(mParams.downloadedBytes);
+
+    while (remaining > 0)
+    {
+        ssize_t written = pwrite(mImageFd, data, remaining, offset);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return CHIP_ERROR_POSIX(errno);
+        }
+
+        data += written;
+        remaining -= static_cast<size_t>(written);
+        offset += written;
+    }
+
+    ReturnErrorOnFailure(mImageDigestVerifier.AddPayload(block));
+    mParams.downloadedBytes += block.size();
+
+    return CHIP_NO_ERROR;
+}
+
+void OTAImageProcessorImpl::CloseImageFile()
+{
+    if (mImageFd >= 0)
+    {
+        close(mImageFd);
+        mImageFd = -1;
+    }
+}
+
 CHIP_ERROR OTAImageProcessorImpl::SetBlock(ByteSpan & block)
 {
     if (!IsSpanUsable(block))
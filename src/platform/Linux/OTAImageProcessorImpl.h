@@ -19,12 +19,11 @@
 #pragma once
 
 #include <app/clusters/ota-requestor/OTADownloader.h>
+#include <app/clusters/ota-requestor/OTAImageDigestVerifier.h>
 #include <lib/core/OTAImageHeader.h>
 #include <platform/CHIPDeviceLayer.h>
 #include <platform/OTAImageProcessor.h>
 
-#include <fstream>
-
 namespace chip {
 
 // Full file path to where the new image will be executed from post-download
@@ -55,6 +54,16 @@ private:
 
     CHIP_ERROR ProcessHeader(ByteSpan & block);
 
+    /**
+     * Called to write a payload block at the current download offset and add it to the image digest
+     */
+    CHIP_ERROR WriteBlock(const ByteSpan & block);
+
+    /**
+     * Called to close the image file if it is open
+     */
+    void CloseImageFile();
+
     /**
      * Called to allocate memory for mBlock if necessary and set it to block
      */
@@ -65,11 +74,14 @@ private:
      */
     CHIP_ERROR ReleaseBlock();
 
-    std::ofstream mOfs;
+    int mImageFd = -1;
     MutableByteSpan mBlock;
     OTADownloader * mDownloader;
     OTAImageHeaderParser mHeaderParser;
     const char * mImageFile = nullptr;
+
+    OTAImageDigestVerifier mImageDigestVerifier;
+    bool mImageVerified = false;
 };
 
 } // namespace chip
@@ -0,0 +1,361 @@
+/*
+ *
+ *    Copyright (c) 2023 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test suite for the Linux binary logging
+ *      backend: argument encoding, per-thread buffers and file format.
+ *
+ */
+
+#include <platform/Linux/BinaryLogging.h>
+
+#include <lib/support/BufferReader.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/EnforceFormat.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <lib/support/logging/Constants.h>
+#include <nlunit-test.h>
+#include <platform/CHIPDeviceConfig.h>
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+using namespace chip;
+using namespace chip::DeviceLayer;
+
+namespace {
+
+constexpr char kModule[] = "TST";
+
+// Enough messages to go around the buffer of a thread several times.
+constexpr uint32_t kMessageCount = 4 * CHIP_DEVICE_CONFIG_BINARY_LOGGING_BUFFER_SIZE / 32;
+
+bool ReadString(Encoding::LittleEndian::Reader & reader, std::string & value)
+{
+    uint16_t length = 0;
+    VerifyOrReturnValue(reader.Read16(&length).StatusCode() == CHIP_NO_ERROR, false);
+    value.resize(length);
+    return reader.ReadBytes(reinterpret_cast<uint8_t *>(&value[0]), length).StatusCode() == CHIP_NO_ERROR;
+}
+
+struct Argument
+{
+    char mTag;
+    uint64_t mValue;
+    std::string mString;
+};
+
+struct Message
+{
+    uint32_t mThreadId;
+    uint64_t mTimestamp;
+    uint8_t mCategory;
+    std::string mModule;
+    std::string mFormat;
+    std::vector<Argument> mArguments;
+};
+
+bool ENFORCE_FORMAT(1, 2) Log(const char * msg, ...)
+{
+    va_list v;
+    va_start(v, msg);
+    bool recorded = BinaryLogging::LogV(kModule, Logging::kLogCategory_Progress, msg, v);
+    va_end(v);
+    return recorded;
+}
+
+bool ReadMessage(Encoding::LittleEndian::Reader & reader, std::map<uint64_t, std::string> & strings, Message & message)
+{
+    uint16_t length = 0;
+    VerifyOrReturnValue(reader.Read32(&message.mThreadId).Read16(&length).StatusCode() == CHIP_NO_ERROR, false);
+    std::vector<uint8_t> data(length);
+    VerifyOrReturnValue(reader.ReadBytes(data.data(), length).StatusCode() == CHIP_NO_ERROR, false);
+
+    Encoding::LittleEndian::Reader messageReader(data.data(), data.size());
+    uint64_t module;
+    uint64_t format;
+    VerifyOrReturnValue(
+        messageReader.Read64(&message.mTimestamp).Read8(&message.mCategory).Read64(&module).Read64(&format).StatusCode() ==
+            CHIP_NO_ERROR,
+        false);
+    VerifyOrReturnValue(strings.count(module) == 1 && strings.count(format) == 1, false);
+    message.mModule = strings[module];
+    message.mFormat = strings[format];
+
+    while (messageReader.Remaining() > 0)
+    {
+        Argument argument;
+        uint8_t tag;
+        VerifyOrReturnValue(messageReader.Read8(&tag).StatusCode() == CHIP_NO_ERROR, false);
+        argument.mTag = static_cast<char>(tag);
+        if (argument.mTag == 's')
+        {
+            VerifyOrReturnValue(ReadString(messageReader, argument.mString), false);
+        }
+        else
+        {
+            VerifyOrReturnValue(argument.mTag == 'i' || argument.mTag == 'u' || argument.mTag == 'f', false);
+            VerifyOrReturnValue(messageReader.Read64(&argument.mValue).StatusCode() == CHIP_NO_ERROR, false);
+        }
+        message.mArguments.push_back(argument);
+    }
+    return true;
+}
+
+// Binary logging to a temporary file, removed on destruction.
+class LogFile
+{
+public:
+    LogFile()
+    {
+        int fd = mkstemp(mPath);
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+    }
+    ~LogFile()
+    {
+        BinaryLogging::Stop();
+        unlink(mPath);
+    }
+
+    CHIP_ERROR Start() { return BinaryLogging::Start(mPath); }
+
+    // Stops binary logging and decodes the file, the way scripts/tools/decode_binary_log.py does.
+    bool StopAndRead(std::vector<Message> & messages)
+    {
+        BinaryLogging::Stop();
+
+        std::vector<uint8_t> data;
+        FILE * file = fopen(mPath, "rb");
+        VerifyOrReturnValue(file != nullptr, false);
+        uint8_t chunk[1024];
+        size_t length;
+        while ((length = fread(chunk, 1, sizeof(chunk), file)) > 0)
+        {
+            data.insert(data.end(), chunk, chunk + length);
+        }
+        fclose(file);
+
+        Encoding::LittleEndian::Reader header(data.data(), data.size());
+        uint8_t magic[8];
+        uint8_t version;
+        uint32_t pid;
+        VerifyOrReturnValue(header.ReadBytes(magic, sizeof(magic)).Read8(&version).Read32(&pid).StatusCode() == CHIP_NO_ERROR,
+                            false);
+        VerifyOrReturnValue(memcmp(magic, "CHIPBLOG", sizeof(magic)) == 0 && version == 1, false);
+        VerifyOrReturnValue(pid == static_cast<uint32_t>(getpid()), false);
+
+        // Records are read one at a time: a Reader cannot go through more than UINT16_MAX octets.
+        std::map<uint64_t, std::string> strings;
+        for (size_t offset = header.OctetsRead(); offset < data.size();)
+        {
+            Encoding::LittleEndian::Reader reader(&data[offset], std::min<size_t>(data.size() - offset, UINT16_MAX));
+            uint8_t type;
+            VerifyOrReturnValue(reader.Read8(&type).StatusCode() == CHIP_NO_ERROR, false);
+            if (type == 'S')
+            {
+                uint64_t address;
+                VerifyOrReturnValue(reader.Read64(&address).StatusCode() == CHIP_NO_ERROR, false);
+                VerifyOrReturnValue(ReadString(reader, strings[address]), false);
+            }
+            else
+            {
+                VerifyOrReturnValue(type == 'M', false);
+                Message message;
+                VerifyOrReturnValue(ReadMessage(reader, strings, message), false);
+                messages.push_back(message);
+            }
+            offset += reader.OctetsRead();
+        }
+        return true;
+    }
+
+private:
+    char mPath[32] = "/tmp/chip-binary-log-XXXXXX";
+};
+
+bool IsInteger(const Argument & argument, char tag, uint64_t value)
+{
+    return argument.mTag == tag && argument.mValue == value;
+}
+
+bool IsString(const Argument & argument, const char * value)
+{
+    return argument.mTag == 's' && argument.mString == value;
+}
+
+void TestStart(nlTestSuite * inSuite, void * inContext)
+{
+    // Text messages still go to stdout, so records cannot.
+    NL_TEST_ASSERT(inSuite, BinaryLogging::Start(nullptr) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite, !BinaryLogging::IsStarted());
+    NL_TEST_ASSERT(inSuite, !Log("Not started"));
+
+    LogFile file;
+    NL_TEST_ASSERT(inSuite, file.Start() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, BinaryLogging::IsStarted());
+    NL_TEST_ASSERT(inSuite, file.Start() == CHIP_ERROR_INCORRECT_STATE);
+
+    std::vector<Message> messages;
+    NL_TEST_ASSERT(inSuite, file.StopAndRead(messages));
+    NL_TEST_ASSERT(inSuite, messages.empty());
+    NL_TEST_ASSERT(inSuite, !BinaryLogging::IsStarted());
+}
+
+void TestEncodeArguments(nlTestSuite * inSuite, void * inContext)
+{
+    LogFile file;
+    NL_TEST_ASSERT(inSuite, file.Start() == CHIP_NO_ERROR);
+
+    const double value = 1.5;
+    uint64_t valueBits;
+    memcpy(&valueBits, &value, sizeof(valueBits));
+
+    NL_TEST_ASSERT(inSuite, Log("No arguments, 100%%"));
+    NL_TEST_ASSERT(inSuite, Log("%d %hhd %ld %" PRId64, -1, static_cast<signed char>(-2), -3L, static_cast<int64_t>(-4)));
+    NL_TEST_ASSERT(inSuite,
+                   Log("%u %02x %hu %" PRIu64 " %zu", 1u, 0xabu, static_cast<unsigned short>(2), UINT64_MAX, sizeof(value)));
+    NL_TEST_ASSERT(inSuite, Log("%s %.3s %-*.*s %c", "full", "truncated", 8, 2, "width", 'c'));
+    NL_TEST_ASSERT(inSuite, Log("%p %.2f", static_cast<void *>(&file), value));
+
+    // Conversions the decoder does not support go through the text backend.
+    NL_TEST_ASSERT(inSuite, !Log("%ls", L"wide"));
+    NL_TEST_ASSERT(inSuite, !Log("%a", value));
+
+    std::vector<Message> messages;
+    NL_TEST_ASSERT(inSuite, file.StopAndRead(messages));
+    NL_TEST_ASSERT(inSuite, messages.size() == 5);
+    VerifyOrReturn(messages.size() == 5);
+
+    for (const Message & message : messages)
+    {
+        NL_TEST_ASSERT(inSuite, message.mModule == kModule);
+        NL_TEST_ASSERT(inSuite, message.mCategory == Logging::kLogCategory_Progress);
+        NL_TEST_ASSERT(inSuite, message.mTimestamp > 0);
+        NL_TEST_ASSERT(inSuite, message.mThreadId == messages[0].mThreadId);
+    }
+
+    NL_TEST_ASSERT(inSuite, messages[0].mFormat == "No arguments, 100%%");
+    NL_TEST_ASSERT(inSuite, messages[0].mArguments.empty());
+
+    const std::vector<Argument> & integers = messages[1].mArguments;
+    NL_TEST_ASSERT(inSuite, integers.size() == 4);
+    NL_TEST_ASSERT(inSuite, integers.size() == 4 && IsInteger(integers[0], 'i', static_cast<uint64_t>(-1)));
+    NL_TEST_ASSERT(inSuite, integers.size() == 4 && IsInteger(integers[1], 'i', static_cast<uint64_t>(-2)));
+    NL_TEST_ASSERT(inSuite, integers.size() == 4 && IsInteger(integers[2], 'i', static_cast<uint64_t>(-3)));
+    NL_TEST_ASSERT(inSuite, integers.size() == 4 && IsInteger(integers[3], 'i', static_cast<uint64_t>(-4)));
+
+    const std::vector<Argument> & unsignedIntegers = messages[2].mArguments;
+    NL_TEST_ASSERT(inSuite, unsignedIntegers.size() == 5);
+    NL_TEST_ASSERT(inSuite, unsignedIntegers.size() == 5 && IsInteger(unsignedIntegers[0], 'u', 1));
+    NL_TEST_ASSERT(inSuite, unsignedIntegers.size() == 5 && IsInteger(unsignedIntegers[1], 'u', 0xab));
+    NL_TEST_ASSERT(inSuite, unsignedIntegers.size() == 5 && IsInteger(unsignedIntegers[2], 'u', 2));
+    NL_TEST_ASSERT(inSuite, unsignedIntegers.size() == 5 && IsInteger(unsignedIntegers[3], 'u', UINT64_MAX));
+    NL_TEST_ASSERT(inSuite, unsignedIntegers.size() == 5 && IsInteger(unsignedIntegers[4], 'u', sizeof(value)));
+
+    // '*' widths and precisions are recorded before the value they apply to; precisions bound the recorded strings.
+    const std::vector<Argument> & strings = messages[3].mArguments;
+    NL_TEST_ASSERT(inSuite, strings.size() == 6);
+    NL_TEST_ASSERT(inSuite, strings.size() == 6 && IsString(strings[0], "full"));
+    NL_TEST_ASSERT(inSuite, strings.size() == 6 && IsString(strings[1], "tru"));
+    NL_TEST_ASSERT(inSuite, strings.size() == 6 && IsInteger(strings[2], 'i', 8));
+    NL_TEST_ASSERT(inSuite, strings.size() == 6 && IsInteger(strings[3], 'i', 2));
+    NL_TEST_ASSERT(inSuite, strings.size() == 6 && IsString(strings[4], "wi"));
+    NL_TEST_ASSERT(inSuite, strings.size() == 6 && IsInteger(strings[5], 'i', 'c'));
+
+    const std::vector<Argument> & others = messages[4].mArguments;
+    NL_TEST_ASSERT(inSuite, others.size() == 2);
+    NL_TEST_ASSERT(inSuite, others.size() == 2 && IsInteger(others[0], 'u', reinterpret_cast<uintptr_t>(&file)));
+    NL_TEST_ASSERT(inSuite, others.size() == 2 && IsInteger(others[1], 'f', valueBits));
+}
+
+void TestThreadBuffers(nlTestSuite * inSuite, void * inContext)
+{
+    LogFile file;
+    NL_TEST_ASSERT(inSuite, file.Start() == CHIP_NO_ERROR);
+
+    // The buffer of a thread that exits is still written.
+    std::thread logger([]() {
+        for (uint32_t i = 0; i < kMessageCount; i++)
+        {
+            Log("Other thread %" PRIu32, i);
+        }
+    });
+    for (uint32_t i = 0; i < kMessageCount; i++)
+    {
+        Log("This thread %" PRIu32, i);
+    }
+    logger.join();
+
+    uint64_t droppedCount = BinaryLogging::GetDroppedCount();
+    std::vector<Message> messages;
+    NL_TEST_ASSERT(inSuite, file.StopAndRead(messages));
+
+    // Messages are either written, in the order of their thread, or dropped and counted.
+    std::map<uint32_t, std::vector<uint64_t>> sequences;
+    for (const Message & message : messages)
+    {
+        NL_TEST_ASSERT(inSuite, message.mArguments.size() == 1);
+        VerifyOrReturn(message.mArguments.size() == 1);
+        sequences[message.mThreadId].push_back(message.mArguments[0].mValue);
+    }
+    NL_TEST_ASSERT(inSuite, sequences.size() == 2);
+    for (const auto & sequence : sequences)
+    {
+        for (size_t i = 1; i < sequence.second.size(); i++)
+        {
+            NL_TEST_ASSERT(inSuite, sequence.second[i - 1] < sequence.second[i]);
+        }
+    }
+    NL_TEST_ASSERT(inSuite, messages.size() + droppedCount == 2 * kMessageCount);
+}
+
+/**
+ *   Test Suite. It lists all the test functions.
+ */
+const nlTest sTests[] = {
+    NL_TEST_DEF("Test BinaryLogging::Start", TestStart),
+    NL_TEST_DEF("Test encoding of log arguments", TestEncodeArguments),
+    NL_TEST_DEF("Test per-thread log buffers", TestThreadBuffers),
+    NL_TEST_SENTINEL(),
+};
+
+} // namespace
+
+int TestBinaryLogging()
+{
+    nlTestSuite theSuite = { "BinaryLogging tests", &sTests[0], nullptr, nullptr };
+
+    // Run test suite against one context.
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestBinaryLogging)
@@ -1,7 +1,12 @@
 /**
  *    @file
  *      Implementation for the TransferSession class.
- *      // TODO: Support Asynchronous mode. Currently, only Synchronous mode is supported.
+ *
+ *      In Asynchronous mode, the Sender streams Blocks without waiting for a BlockQuery for each one. Up to
+ *      CHIP_CONFIG_BDX_ASYNC_MAX_BLOCKS_IN_FLIGHT Blocks may be sent before the Receiver acknowledges them with a cumulative
+ *      BlockAck. Blocks are expected to be delivered in order by the underlying transport; a Block with an unexpected counter
+ *      ends the transfer with a kBadBlockCounter StatusReport. Several messages are in flight on the exchange at once, so
+ *      Asynchronous mode must only be used over transports that do not use MRP, such as TCP.
  */
 
 #include <protocols/bdx/BdxTransferSession.h>
@@ -206,6 +211,7 @@ CHIP_ERROR TransferSession::AcceptTransfer(const TransferAcceptData & acceptData
     VerifyOrReturnError(proposedControlOpts.Has(acceptData.ControlMode), CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(acceptData.MaxBlockSize <= mTransferRequestData.MaxBlockSize, CHIP_ERROR_INVALID_ARGUMENT);
 
+    mControlMode          = acceptData.ControlMode;
     mTransferMaxBlockSize = acceptData.MaxBlockSize;
 
     if (mRole == TransferRole::kSender)
@@ -250,7 +256,7 @@ CHIP_ERROR TransferSession::AcceptTransfer(const TransferAcceptData & acceptData
 
     mState = TransferState::kTransferInProgress;
 
-    if ((mRole == TransferRole::kReceiver && mControlMode == TransferControlFlags::kSenderDrive) ||
+    if ((mRole == TransferRole::kReceiver && mControlMode != TransferControlFlags::kReceiverDrive) ||
         (mRole == TransferRole::kSender && mControlMode == TransferControlFlags::kReceiverDrive))
     {
         mAwaitingResponse = true;
@@ -267,6 +273,7 @@ CHIP_ERROR TransferSession::PrepareBlockQuery()
 
     VerifyOrReturnError(mState == TransferState::kTransferInProgress, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mRole == TransferRole::kReceiver, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mControlMode != TransferControlFlags::kAsync, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mPendingOutput == OutputEventType::kNone, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(!mAwaitingResponse, CHIP_ERROR_INCORRECT_STATE);
 
@@ -294,6 +301,7 @@ CHIP_ERROR TransferSession::PrepareBlockQueryWithSkip(const uint64_t & bytesToSk
 
     VerifyOrReturnError(mState == TransferState::kTransferInProgress, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mRole == TransferRole::kReceiver, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mControlMode != TransferControlFlags::kAsync, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mPendingOutput == OutputEventType::kNone, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(!mAwaitingResponse, CHIP_ERROR_INCORRECT_STATE);
 
@@ -345,19 +353,38 @@ CHIP_ERROR TransferSession::PrepareBlock(const BlockData & inData)
         mState = TransferState::kAwaitingEOFAck;
     }
 
-    mAwaitingResponse = true;
-    mLastBlockNum     = mNextBlockNum++;
+    mLastBlockNum = mNextBlockNum++;
+
+    if (mControlMode == TransferControlFlags::kAsync)
+    {
+        // In Async mode, the next Block may be prepared right away unless the send window is full.
+        mAwaitingResponse = (msgType == MessageType::BlockEOF) ||
+            (mNextBlockNum - mNextAckNum >= static_cast<uint32_t>(CHIP_CONFIG_BDX_ASYNC_MAX_BLOCKS_IN_FLIGHT));
+    }
+    else
+    {
+        mAwaitingResponse = true;
+    }
 
     PrepareOutgoingMessageEvent(msgType, mPendingOutput, mMsgTypeData);
 
     return CHIP_NO_ERROR;
 }
 
+bool TransferSession::CanPrepareBlock() const
+{
+    return (mRole == TransferRole::kSender) && (mState == TransferState::kTransferInProgress) &&
+        (mPendingOutput == OutputEventType::kNone) && !mAwaitingResponse;
+}
+
 CHIP_ERROR TransferSession::PrepareBlockAck()
 {
     VerifyOrReturnError(mRole == TransferRole::kReceiver, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError((mState == TransferState::kTransferInProgress) || (mState == TransferState::kReceivedEOF),
                         CHIP_ERROR_INCORRECT_STATE);
+    // In Async mode, there must be a received Block that was not acknowledged yet.
+    VerifyOrReturnError((mControlMode != TransferControlFlags::kAsync) || (mNextAckNum < mNextQueryNum),
+                        CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mPendingOutput == OutputEventType::kNone, CHIP_ERROR_INCORRECT_STATE);
 
     CounterMessage ackMsg;
@@ -371,6 +398,8 @@ CHIP_ERROR TransferSession::PrepareBlockAck()
     ackMsg.LogMessage(msgType);
 #endif // CHIP_AUTOMATION_LOGGING
 
+    mNextAckNum = ackMsg.BlockCounter + 1;
+
     if (mState == TransferState::kTransferInProgress)
     {
         if (mControlMode == TransferControlFlags::kSenderDrive)
@@ -421,6 +450,7 @@ void TransferSession::Reset()
     mNextBlockNum      = 0;
     mLastQueryNum      = 0;
     mNextQueryNum      = 0;
+    mNextAckNum        = 0;
 
     mTimeout                = System::Clock::kZero;
     mTimeoutStartTime       = System::Clock::kZero;
@@ -598,7 +628,7 @@ void TransferSession::HandleReceiveAccept(System::PacketBufferHandle msgData)
     mPendingMsgHandle = std::move(msgData);
     mPendingOutput    = OutputEventType::kAcceptReceived;
 
-    mAwaitingResponse = (mControlMode == TransferControlFlags::kSenderDrive);
+    mAwaitingResponse = (mControlMode != TransferControlFlags::kReceiverDrive);
     mState            = TransferState::kTransferInProgress;
 
 #if CHIP_AUTOMATION_LOGGING
@@ -716,7 +746,15 @@ void TransferSession::HandleBlock(System::PacketBufferHandle msgData)
     mNumBytesProcessed += blockMsg.DataLength;
     mLastBlockNum = blockMsg.BlockCounter;
 
-    mAwaitingResponse = false;
+    if (mControlMode == TransferControlFlags::kAsync)
+    {
+        // In Async mode, the Sender does not wait for a query, so the following Block is implicitly queried.
+        mLastQueryNum = mNextQueryNum = blockMsg.BlockCounter + 1;
+    }
+    else
+    {
+        mAwaitingResponse = false;
+    }
 
 #if CHIP_AUTOMATION_LOGGING
     blockMsg.LogMessage(MessageType::Block);
@@ -746,6 +784,10 @@ void TransferSession::HandleBlockEOF(System::PacketBufferHandle msgData)
 
     mNumBytesProcessed += blockEOFMsg.DataLength;
     mLastBlockNum = blockEOFMsg.BlockCounter;
+    if (mControlMode == TransferControlFlags::kAsync)
+    {
+        mNextQueryNum = blockEOFMsg.BlockCounter + 1;
+    }
 
     mAwaitingResponse = false;
     mState            = TransferState::kReceivedEOF;
@@ -757,20 +799,39 @@ void TransferSession::HandleBlockEOF(System::PacketBufferHandle msgData)
 
 void TransferSession::HandleBlockAck(System::PacketBufferHandle msgData)
 {
+    const bool isAsync = (mControlMode == TransferControlFlags::kAsync);
+
     VerifyOrReturn(mRole == TransferRole::kSender, PrepareStatusReport(StatusCode::kUnexpectedMessage));
-    VerifyOrReturn(mState == TransferState::kTransferInProgress, PrepareStatusReport(StatusCode::kUnexpectedMessage));
-    VerifyOrReturn(mAwaitingResponse, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+    // In Async mode, Blocks sent before the BlockEOF may still be acknowledged after it.
+    VerifyOrReturn((mState == TransferState::kTransferInProgress) || (isAsync && mState == TransferState::kAwaitingEOFAck),
+                   PrepareStatusReport(StatusCode::kUnexpectedMessage));
+    VerifyOrReturn(mAwaitingResponse || isAsync, PrepareStatusReport(StatusCode::kUnexpectedMessage));
 
     BlockAck ackMsg;
     const CHIP_ERROR err = ackMsg.Parse(std::move(msgData));
     VerifyOrReturn(err == CHIP_NO_ERROR, PrepareStatusReport(StatusCode::kBadMessageContents));
-    VerifyOrReturn(ackMsg.BlockCounter == mLastBlockNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
 
-    mPendingOutput = OutputEventType::kAckReceived;
+    if (isAsync)
+    {
+        // BlockAcks are cumulative in Async mode, and make room in the send window. The BlockEOF is acknowledged with a
+        // BlockAckEOF instead.
+        const uint32_t endBlockNum = (mState == TransferState::kAwaitingEOFAck) ? mLastBlockNum : mNextBlockNum;
+        VerifyOrReturn(ackMsg.BlockCounter >= mNextAckNum && ackMsg.BlockCounter < endBlockNum,
+                       PrepareStatusReport(StatusCode::kBadBlockCounter));
+
+        mNextAckNum       = ackMsg.BlockCounter + 1;
+        mAwaitingResponse = (mState == TransferState::kAwaitingEOFAck);
+    }
+    else
+    {
+        VerifyOrReturn(ackMsg.BlockCounter == mLastBlockNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
 
-    // In Receiver Drive, the Receiver can send a BlockAck to indicate receipt of the message and reset the timeout.
-    // In this case, the Sender should wait to receive a BlockQuery next.
-    mAwaitingResponse = (mControlMode == TransferControlFlags::kReceiverDrive);
+        // In Receiver Drive, the Receiver can send a BlockAck to indicate receipt of the message and reset the timeout.
+        // In this case, the Sender should wait to receive a BlockQuery next.
+        mAwaitingResponse = (mControlMode == TransferControlFlags::kReceiverDrive);
+    }
+
+    mPendingOutput = OutputEventType::kAckReceived;
 
 #if CHIP_AUTOMATION_LOGGING
     ackMsg.LogMessage(MessageType::BlockAck);
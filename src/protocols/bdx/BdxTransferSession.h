@@ -221,7 +221,7 @@ public:
 
     /**
      * @brief
-     *   Prepare a BlockQuery message. The Block counter will be populated automatically.
+     *   Prepare a BlockQuery message. The Block counter will be populated automatically. Not used in Async mode.
      *
      * @return CHIP_ERROR The result of the preparation of a BlockQuery message. May also indicate if the TransferSession object
      *                    is unable to handle this request.
@@ -243,6 +243,9 @@ public:
      * @brief
      *   Prepare a Block message. The Block counter will be populated automatically.
      *
+     *   In Async mode, the next Block may be prepared as soon as the previous message has been polled, as long as fewer than
+     *   CHIP_CONFIG_BDX_ASYNC_MAX_BLOCKS_IN_FLIGHT Blocks are waiting for a BlockAck.
+     *
      * @param inData Contains data for filling out the Block message
      *
      * @return CHIP_ERROR The result of the preparation of a Block message. May also indicate if the TransferSession object
@@ -252,7 +255,8 @@ public:
 
     /**
      * @brief
-     *   Prepare a BlockAck message. The Block counter will be populated automatically.
+     *   Prepare a BlockAck message. The Block counter will be populated automatically. In Async mode, the BlockAck
+     *   acknowledges every Block received so far, and may only be prepared when one of them was not acknowledged yet.
      *
      * @return CHIP_ERROR The result of the preparation of a BlockAck message. May also indicate if the TransferSession object
      *                    is unable to handle this request.
@@ -292,6 +296,13 @@ public:
     CHIP_ERROR HandleMessageReceived(const PayloadHeader & payloadHeader, System::PacketBufferHandle msg,
                                      System::Clock::Timestamp curTime);
 
+    /**
+     * @brief
+     *   Whether a Sender may prepare a Block now. In Async mode, this is the case while the send window is not full, without
+     *   waiting for a BlockQuery.
+     */
+    bool CanPrepareBlock() const;
+
     TransferControlFlags GetControlMode() const { return mControlMode; }
     uint64_t GetStartOffset() const { return mStartOffset; }
     uint64_t GetTransferLength() const { return mTransferLength; }
@@ -380,6 +391,7 @@ private:
     uint32_t mNextBlockNum = 0;
     uint32_t mLastQueryNum = 0;
     uint32_t mNextQueryNum = 0;
+    uint32_t mNextAckNum   = 0; ///< First Block not acknowledged yet, used in Async mode
 
     System::Clock::Timeout mTimeout            = System::Clock::kZero;
     System::Clock::Timestamp mTimeoutStartTime = System::Clock::kZero;
@@ -523,6 +523,115 @@ void TestInitiatingSenderSenderDrive(nlTestSuite * inSuite, void * inContext)
     SendAndVerifyBlockAck(inSuite, inContext, initiatingSender, respondingReceiver, outEvent, true);
 }
 
+// Test a full transfer using Async mode, where the Sender streams Blocks and the Receiver acknowledges several at once.
+void TestInitiatingSenderAsync(nlTestSuite * inSuite, void * inContext)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    TransferSession::OutputEvent outEvent;
+    TransferSession initiatingSender;
+    TransferSession respondingReceiver;
+
+    // Async must be proposed along with a synchronous mode
+    BitFlags<TransferControlFlags> driveModes(TransferControlFlags::kAsync, TransferControlFlags::kSenderDrive);
+
+    // Chosen arbitrarily for this test
+    uint32_t numBlockSends         = 10;
+    uint16_t transferBlockSize     = 32;
+    System::Clock::Timeout timeout = System::Clock::Seconds16(24);
+    uint32_t window                = CHIP_CONFIG_BDX_ASYNC_MAX_BLOCKS_IN_FLIGHT;
+
+    BitFlags<TransferControlFlags> receiverOpts(driveModes);
+
+    TransferSession::TransferInitData initOptions;
+    initOptions.TransferCtlFlags = static_cast<TransferControlFlags>(driveModes.Raw());
+    initOptions.MaxBlockSize     = transferBlockSize;
+    char testFileDes[9]          = { "test.txt" };
+    initOptions.FileDesLength    = static_cast<uint16_t>(strlen(testFileDes));
+    initOptions.FileDesignator   = reinterpret_cast<uint8_t *>(testFileDes);
+
+    SendAndVerifyTransferInit(inSuite, inContext, outEvent, timeout, initiatingSender, TransferRole::kSender, initOptions,
+                              respondingReceiver, receiverOpts, transferBlockSize);
+
+    // Both modes are common to the peers, so Async is only used if the responding application picks it
+    TransferSession::TransferAcceptData acceptData;
+    acceptData.ControlMode  = TransferControlFlags::kAsync;
+    acceptData.MaxBlockSize = transferBlockSize;
+
+    SendAndVerifyAcceptMsg(inSuite, inContext, outEvent, respondingReceiver, TransferRole::kReceiver, acceptData, initiatingSender,
+                           initOptions);
+    NL_TEST_ASSERT(inSuite, initiatingSender.GetControlMode() == TransferControlFlags::kAsync);
+
+    // Queries are not used in Async mode, and there is no Block to acknowledge yet
+    err = respondingReceiver.PrepareBlockQuery();
+    NL_TEST_ASSERT(inSuite, err != CHIP_NO_ERROR);
+    err = respondingReceiver.PrepareBlockAck();
+    NL_TEST_ASSERT(inSuite, err != CHIP_NO_ERROR);
+    VerifyNoMoreOutput(inSuite, inContext, respondingReceiver);
+
+    // Send Blocks back to back (last Block is BlockEOF). Once the send window is full, the Sender waits for a BlockAck.
+    uint8_t fakeData[1] = { 0 };
+    TransferSession::BlockData blockData;
+    blockData.Data   = fakeData;
+    blockData.Length = sizeof(fakeData);
+    for (uint32_t numBlocksSent = 0; numBlocksSent < numBlockSends; numBlocksSent++)
+    {
+        if (numBlocksSent > 0 && numBlocksSent % window == 0)
+        {
+            err = initiatingSender.PrepareBlock(blockData);
+            NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_INCORRECT_STATE);
+            SendAndVerifyBlockAck(inSuite, inContext, initiatingSender, respondingReceiver, outEvent, false);
+        }
+
+        bool isEof = (numBlocksSent == numBlockSends - 1);
+        SendAndVerifyArbitraryBlock(inSuite, inContext, initiatingSender, respondingReceiver, outEvent, isEof, numBlocksSent);
+    }
+
+    NL_TEST_ASSERT(inSuite, outEvent.blockdata.IsEof == true);
+    SendAndVerifyBlockAck(inSuite, inContext, initiatingSender, respondingReceiver, outEvent, true);
+}
+
+// Test that a peer proposing Async mode falls back to a synchronous mode when the responder does not support Async.
+void TestAsyncFallbackToSenderDrive(nlTestSuite * inSuite, void * inContext)
+{
+    TransferSession::OutputEvent outEvent;
+    TransferSession initiatingSender;
+    TransferSession respondingReceiver;
+
+    uint16_t transferBlockSize     = 10;
+    System::Clock::Timeout timeout = System::Clock::Seconds16(24);
+
+    BitFlags<TransferControlFlags> receiverOpts;
+    receiverOpts.Set(TransferControlFlags::kSenderDrive);
+
+    // Async must be proposed along with a synchronous mode
+    BitFlags<TransferControlFlags> proposedOpts(TransferControlFlags::kAsync, TransferControlFlags::kSenderDrive);
+
+    TransferSession::TransferInitData initOptions;
+    initOptions.TransferCtlFlags = static_cast<TransferControlFlags>(proposedOpts.Raw());
+    initOptions.MaxBlockSize     = transferBlockSize;
+    char testFileDes[9]          = { "test.txt" };
+    initOptions.FileDesLength    = static_cast<uint16_t>(strlen(testFileDes));
+    initOptions.FileDesignator   = reinterpret_cast<uint8_t *>(testFileDes);
+
+    SendAndVerifyTransferInit(inSuite, inContext, outEvent, timeout, initiatingSender, TransferRole::kSender, initOptions,
+                              respondingReceiver, receiverOpts, transferBlockSize);
+    NL_TEST_ASSERT(inSuite, respondingReceiver.GetControlMode() == TransferControlFlags::kSenderDrive);
+
+    TransferSession::TransferAcceptData acceptData;
+    acceptData.ControlMode  = respondingReceiver.GetControlMode();
+    acceptData.MaxBlockSize = transferBlockSize;
+
+    SendAndVerifyAcceptMsg(inSuite, inContext, outEvent, respondingReceiver, TransferRole::kReceiver, acceptData, initiatingSender,
+                           initOptions);
+
+    // The Sender must now wait for a BlockAck after each Block
+    SendAndVerifyArbitraryBlock(inSuite, inContext, initiatingSender, respondingReceiver, outEvent, false, 0);
+    NL_TEST_ASSERT(inSuite, initiatingSender.GetControlMode() == TransferControlFlags::kSenderDrive);
+    SendAndVerifyBlockAck(inSuite, inContext, initiatingSender, respondingReceiver, outEvent, false);
+    SendAndVerifyArbitraryBlock(inSuite, inContext, initiatingSender, respondingReceiver, outEvent, true, 1);
+    SendAndVerifyBlockAck(inSuite, inContext, initiatingSender, respondingReceiver, outEvent, true);
+}
+
 // Test that calls to AcceptTransfer() with bad parameters result in an error.
 void TestBadAcceptMessageFields(nlTestSuite * inSuite, void * inContext)
 {
@@ -734,6 +843,8 @@ static const nlTest sTests[] =
 {
     NL_TEST_DEF("TestInitiatingReceiverReceiverDrive", TestInitiatingReceiverReceiverDrive),
     NL_TEST_DEF("TestInitiatingSenderSenderDrive", TestInitiatingSenderSenderDrive),
+    NL_TEST_DEF("TestInitiatingSenderAsync", TestInitiatingSenderAsync),
+    NL_TEST_DEF("TestAsyncFallbackToSenderDrive", TestAsyncFallbackToSenderDrive),
     NL_TEST_DEF("TestBadAcceptMessageFields", TestBadAcceptMessageFields),
     NL_TEST_DEF("TestTimeout", TestTimeout),
     NL_TEST_DEF("TestDuplicateBlockError", TestDuplicateBlockError),
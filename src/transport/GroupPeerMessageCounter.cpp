@@ -20,239 +20,444 @@
  *
  */
 
+#include <lib/support/BufferReader.h>
+#include <lib/support/BufferWriter.h>
+#include <lib/support/CodeUtils.h>
 #include <lib/support/DefaultStorageKeyAllocator.h>
+#include <lib/support/ScopedBuffer.h>
 #include <transport/GroupPeerMessageCounter.h>
 
 namespace chip {
 namespace Transport {
 
+namespace {
+
+// Persisted counters of a fabric: a version, followed by one record per sender.
+constexpr uint8_t kCountersVersion      = 1;
+constexpr size_t kCountersHeaderSize    = 1;
+constexpr size_t kCountersRecordSize    = sizeof(NodeId) + sizeof(uint32_t) + 1 /* flags */;
+constexpr uint8_t kCountersFlagsControl = 0x01;
+constexpr size_t kCountersMaxSize =
+    kCountersHeaderSize + kCountersRecordSize * (CHIP_CONFIG_MAX_GROUP_DATA_PEERS + CHIP_CONFIG_MAX_GROUP_CONTROL_PEERS);
+
+static_assert(kCountersMaxSize <= UINT16_MAX, "The persisted counters of a fabric must fit in a single storage value");
+static_assert(CHIP_CONFIG_MAX_GROUP_DATA_PEERS <= UINT16_MAX && CHIP_CONFIG_MAX_GROUP_CONTROL_PEERS <= UINT16_MAX,
+              "Peer counts are stored in 16 bits");
+static_assert((CHIP_CONFIG_GROUP_PEER_TABLE_BUCKETS & (CHIP_CONFIG_GROUP_PEER_TABLE_BUCKETS - 1)) == 0,
+              "CHIP_CONFIG_GROUP_PEER_TABLE_BUCKETS must be a power of two");
+
+uint16_t & PeerCount(GroupFabric & fabric, bool isControl)
+{
+    return isControl ? fabric.mControlPeerCount : fabric.mDataPeerCount;
+}
+
+uint16_t MaxPeerCount(bool isControl)
+{
+    return isControl ? CHIP_CONFIG_MAX_GROUP_CONTROL_PEERS : CHIP_CONFIG_MAX_GROUP_DATA_PEERS;
+}
+
+} // namespace
+
+CHIP_ERROR GroupPeerTable::Init(PersistentStorageDelegate * storage)
+{
+    VerifyOrReturnError(storage != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    mStorage = storage;
+    return CHIP_NO_ERROR;
+}
+
+void GroupPeerTable::Shutdown()
+{
+    for (auto & groupFabric : mGroupFabrics)
+    {
+        if (groupFabric.mFabricIndex != kUndefinedFabricIndex)
+        {
+            ReleaseFabric(groupFabric);
+        }
+    }
+    mStorage = nullptr;
+}
+
 CHIP_ERROR GroupPeerTable::FindOrAddPeer(FabricIndex fabricIndex, NodeId nodeId, bool isControl,
                                          chip::Transport::PeerMessageCounter *& counter)
+{
+    GroupSender * sender = nullptr;
+    ReturnErrorOnFailure(FindOrAddPeer(fabricIndex, nodeId, isControl, sender));
+    counter = &sender->msgCounter;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR GroupPeerTable::FindOrAddPeer(FabricIndex fabricIndex, NodeId nodeId, bool isControl, GroupSender *& sender)
 {
     if (fabricIndex == kUndefinedFabricIndex || nodeId == kUndefinedNodeId)
     {
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
 
-    for (auto & groupFabric : mGroupFabrics)
+    sender = FindPeer(fabricIndex, nodeId, isControl);
+    if (sender != nullptr)
+    {
+        Unlink(sender);
+        LinkMostRecentlyUsed(sender);
+        return CHIP_NO_ERROR;
+    }
+
+    bool added           = false;
+    GroupFabric * fabric = FindOrAddFabric(fabricIndex, added);
+    if (fabric == nullptr)
     {
-        if (groupFabric.mFabricIndex == kUndefinedFabricIndex)
+        // Exceeded the Max number of Group peers
+        return CHIP_ERROR_TOO_MANY_PEER_NODES;
+    }
+
+    if (added && mStorage != nullptr)
+    {
+        // The table has not seen this fabric since it started: restore the counters persisted before.
+        CHIP_ERROR err = LoadCounters(*fabric);
+        if (err != CHIP_NO_ERROR)
         {
-            // Already iterated through all known fabricIndex
-            // Add the new peer to save some processing time
-            groupFabric.mFabricIndex = fabricIndex;
-            if (isControl)
-            {
-                groupFabric.mControlGroupSenders[0].mNodeId = nodeId;
-                counter                                     = &(groupFabric.mControlGroupSenders[0].msgCounter);
-                groupFabric.mControlPeerCount++;
-            }
-            else
-            {
-                groupFabric.mDataGroupSenders[0].mNodeId = nodeId;
-                counter                                  = &(groupFabric.mDataGroupSenders[0].msgCounter);
-                groupFabric.mDataPeerCount++;
-            }
-            return CHIP_NO_ERROR;
+            ChipLogError(Inet, "Failed to restore group peer counters of fabric %u: %" CHIP_ERROR_FORMAT, fabricIndex,
+                         err.Format());
         }
 
-        if (fabricIndex == groupFabric.mFabricIndex)
+        sender = FindPeer(fabricIndex, nodeId, isControl);
+        if (sender != nullptr)
         {
-            if (isControl)
-            {
-                for (auto & node : groupFabric.mControlGroupSenders)
-                {
-                    if (node.mNodeId == kUndefinedNodeId)
-                    {
-                        // Already iterated through all known NodeIds
-                        // Add the new peer to save some processing time
-                        node.mNodeId = nodeId;
-                        counter      = &(node.msgCounter);
-                        groupFabric.mControlPeerCount++;
-                        return CHIP_NO_ERROR;
-                    }
-
-                    if (node.mNodeId == nodeId)
-                    {
-                        counter = &(node.msgCounter);
-                        return CHIP_NO_ERROR;
-                    }
-                }
-            }
-            else
-            {
-                for (auto & node : groupFabric.mDataGroupSenders)
-                {
-                    if (node.mNodeId == kUndefinedNodeId)
-                    {
-                        // Already iterated through all known NodeIds
-                        // Add the new peer to save some processing time
-                        node.mNodeId = nodeId;
-                        counter      = &(node.msgCounter);
-                        groupFabric.mDataPeerCount++;
-                        return CHIP_NO_ERROR;
-                    }
-
-                    if (node.mNodeId == nodeId)
-                    {
-                        counter = &(node.msgCounter);
-                        return CHIP_NO_ERROR;
-                    }
-                }
-            }
-            // Exceeded the Max number of Group peers
-            return CHIP_ERROR_TOO_MANY_PEER_NODES;
+            return CHIP_NO_ERROR;
         }
     }
 
-    // Exceeded the Max number of Group peers
-    return CHIP_ERROR_TOO_MANY_PEER_NODES;
+    CHIP_ERROR err = AddPeer(*fabric, nodeId, isControl, sender);
+    if (err != CHIP_NO_ERROR && fabric->mDataPeerCount == 0 && fabric->mControlPeerCount == 0)
+    {
+        ReleaseFabric(*fabric);
+    }
+    return err;
+}
+
+void GroupPeerTable::CommitCounter(GroupSender & sender, uint32_t counter)
+{
+    sender.msgCounter.CommitGroup(counter);
+
+    VerifyOrReturn(mStorage != nullptr);
+    if (sender.msgCounter.GetCounter() - sender.mPersistedCounter >= CHIP_CONFIG_GROUP_PEER_COUNTER_PERSIST_INTERVAL)
+    {
+        CHIP_ERROR err = StoreCounters(*sender.mFabric);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(Inet, "Failed to persist group peer counters: %" CHIP_ERROR_FORMAT, err.Format());
+        }
+    }
 }
 
 // Used in case of MCSP failure
 CHIP_ERROR GroupPeerTable::RemovePeer(FabricIndex fabricIndex, NodeId nodeId, bool isControl)
 {
-    CHIP_ERROR err    = CHIP_ERROR_NOT_FOUND;
-    uint32_t fabricIt = CHIP_CONFIG_MAX_FABRICS;
-
     if (fabricIndex == kUndefinedFabricIndex || nodeId == kUndefinedNodeId)
     {
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
 
-    for (uint32_t it = 0; it < CHIP_CONFIG_MAX_FABRICS; it++)
+    GroupSender * sender = FindPeer(fabricIndex, nodeId, isControl);
+    if (sender == nullptr)
     {
-        if (fabricIndex == mGroupFabrics[it].mFabricIndex)
-        {
-            if (isControl)
-            {
-                if (RemoveSpecificPeer(mGroupFabrics[it].mControlGroupSenders, nodeId, CHIP_CONFIG_MAX_GROUP_CONTROL_PEERS))
-                {
-                    fabricIt = it;
-                    mGroupFabrics[it].mControlPeerCount--;
-                    err = CHIP_NO_ERROR;
-                }
-            }
-            else
-            {
-                if (RemoveSpecificPeer(mGroupFabrics[it].mDataGroupSenders, nodeId, CHIP_CONFIG_MAX_GROUP_DATA_PEERS))
-                {
-                    fabricIt = it;
-                    mGroupFabrics[it].mDataPeerCount--;
-                    err = CHIP_NO_ERROR;
-                }
-            }
-            break;
-        }
+        // Cannot find Peer to remove
+        return CHIP_ERROR_NOT_FOUND;
     }
 
+    GroupFabric & fabric = *sender->mFabric;
+    ReleasePeer(sender);
+
     // Remove Fabric entry from PeerTable if empty
-    if (fabricIt < CHIP_CONFIG_MAX_FABRICS)
+    if (fabric.mDataPeerCount == 0 && fabric.mControlPeerCount == 0)
     {
-        if (mGroupFabrics[fabricIt].mDataPeerCount == 0 && mGroupFabrics[fabricIt].mControlPeerCount == 0)
+        if (mStorage != nullptr)
         {
-            RemoveAndCompactFabric(fabricIt);
+            mStorage->SyncDeleteKeyValue(DefaultStorageKeyAllocator::FabricGroupPeerCounters(fabricIndex).KeyName());
         }
+        ReleaseFabric(fabric);
+    }
+    else if (mStorage != nullptr)
+    {
+        // Do not restore the counter of the removed peer after a reboot.
+        LogErrorOnFailure(StoreCounters(fabric));
     }
 
-    // Cannot find Peer to remove
-    return err;
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR GroupPeerTable::FabricRemoved(FabricIndex fabricIndex)
 {
-    CHIP_ERROR err = CHIP_ERROR_NOT_FOUND;
-
     if (fabricIndex == kUndefinedFabricIndex)
     {
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
 
-    for (uint32_t it = 0; it < CHIP_CONFIG_MAX_FABRICS; it++)
+    if (mStorage != nullptr)
+    {
+        mStorage->SyncDeleteKeyValue(DefaultStorageKeyAllocator::FabricGroupPeerCounters(fabricIndex).KeyName());
+    }
+
+    GroupFabric * fabric = FindFabric(fabricIndex);
+    if (fabric == nullptr)
+    {
+        // Cannot find Fabric to remove
+        return CHIP_ERROR_NOT_FOUND;
+    }
+
+    ReleaseFabric(*fabric);
+    return CHIP_NO_ERROR;
+}
+
+GroupPeerTable::Stats GroupPeerTable::GetStats() const
+{
+    Stats stats;
+    for (auto & groupFabric : mGroupFabrics)
     {
-        if (fabricIndex == mGroupFabrics[it].mFabricIndex)
+        if (groupFabric.mFabricIndex != kUndefinedFabricIndex)
         {
-            RemoveAndCompactFabric(it);
-            return CHIP_NO_ERROR;
+            stats.mFabricCount++;
+            stats.mDataPeerCount += groupFabric.mDataPeerCount;
+            stats.mControlPeerCount += groupFabric.mControlPeerCount;
         }
     }
+    stats.mPeakPeerCount = mSenders.HighWaterMark();
+    stats.mEvictionCount = mEvictionCount;
+    return stats;
+}
 
-    // Cannot find Fabric to remove
-    return err;
+GroupSender * GroupPeerTable::FindPeer(FabricIndex fabricIndex, NodeId nodeId, bool isControl) const
+{
+    for (GroupSender * sender = mBuckets[BucketIndex(fabricIndex, nodeId, isControl)]; sender != nullptr;
+         sender               = sender->mNextInBucket)
+    {
+        if (sender->mNodeId == nodeId && sender->mIsControl == isControl && sender->mFabric->mFabricIndex == fabricIndex)
+        {
+            return sender;
+        }
+    }
+    return nullptr;
 }
 
-bool GroupPeerTable::RemoveSpecificPeer(GroupSender * list, NodeId nodeId, uint32_t size)
+GroupFabric * GroupPeerTable::FindFabric(FabricIndex fabricIndex)
 {
-    bool removed = false;
-    for (uint32_t nodeIt = 0; nodeIt < size; nodeIt++)
+    for (auto & groupFabric : mGroupFabrics)
     {
-        if (list[nodeIt].mNodeId == nodeId)
+        if (groupFabric.mFabricIndex == fabricIndex)
         {
-            list[nodeIt].mNodeId = kUndefinedNodeId;
-            list[nodeIt].msgCounter.Reset();
-            removed = true;
-            break;
+            return &groupFabric;
         }
     }
+    return nullptr;
+}
 
-    if (removed)
+size_t GroupPeerTable::BucketIndex(FabricIndex fabricIndex, NodeId nodeId, bool isControl)
+{
+    // Fibonacci hashing of the node id, mixed with the fabric index and message kind, so that consecutive node ids spread out.
+    uint64_t key = (nodeId ^ (static_cast<uint64_t>(fabricIndex) << 1) ^ (isControl ? 1 : 0)) * 0x9E3779B97F4A7C15ull;
+    return static_cast<size_t>(key >> 32) & (kBucketCount - 1);
+}
+
+GroupFabric * GroupPeerTable::FindOrAddFabric(FabricIndex fabricIndex, bool & added)
+{
+    GroupFabric * freeFabric = nullptr;
+    for (auto & groupFabric : mGroupFabrics)
     {
-        CompactPeers(list, size);
+        if (groupFabric.mFabricIndex == fabricIndex)
+        {
+            added = false;
+            return &groupFabric;
+        }
+        if (freeFabric == nullptr && groupFabric.mFabricIndex == kUndefinedFabricIndex)
+        {
+            freeFabric = &groupFabric;
+        }
     }
 
-    return removed;
+    if (freeFabric != nullptr)
+    {
+        freeFabric->mFabricIndex = fabricIndex;
+        added                    = true;
+    }
+    return freeFabric;
 }
 
-void GroupPeerTable::CompactPeers(GroupSender * list, uint32_t size)
+CHIP_ERROR GroupPeerTable::AddPeer(GroupFabric & fabric, NodeId nodeId, bool isControl, GroupSender *& sender)
 {
-    if (list == nullptr || size == 0)
+    uint16_t & peerCount = PeerCount(fabric, isControl);
+    if (peerCount >= MaxPeerCount(isControl))
     {
-        return;
+#if CHIP_CONFIG_GROUP_PEER_TABLE_LRU_EVICTION
+        // Reuse the least recently used sender for the new one, rather than releasing it to the pool and allocating again.
+        sender = fabric.mLeastRecentlyUsed[isControl];
+        VerifyOrReturnError(sender != nullptr, CHIP_ERROR_TOO_MANY_PEER_NODES);
+        ChipLogDetail(Inet, "Evicting group peer " ChipLogFormatX64 " of fabric %u", ChipLogValueX64(sender->mNodeId),
+                      fabric.mFabricIndex);
+        UnlinkFromBucket(sender);
+        Unlink(sender);
+        sender->mNodeId = nodeId;
+        sender->msgCounter.Reset();
+        sender->mPersistedCounter = 0;
+        mEvictionCount++;
+#else
+        // Exceeded the Max number of Group peers
+        return CHIP_ERROR_TOO_MANY_PEER_NODES;
+#endif // CHIP_CONFIG_GROUP_PEER_TABLE_LRU_EVICTION
     }
+    else
+    {
+        sender = mSenders.CreateObject(&fabric, nodeId, isControl);
+        VerifyOrReturnError(sender != nullptr, CHIP_ERROR_NO_MEMORY);
+        peerCount++;
+    }
+
+    GroupSender *& bucket = mBuckets[BucketIndex(fabric.mFabricIndex, nodeId, isControl)];
+    sender->mNextInBucket = bucket;
+    bucket                = sender;
+    LinkMostRecentlyUsed(sender);
+    return CHIP_NO_ERROR;
+}
 
-    for (uint32_t peerIndex = 0; peerIndex < size; peerIndex++)
+void GroupPeerTable::UnlinkFromBucket(GroupSender * sender)
+{
+    for (GroupSender ** link = &mBuckets[BucketIndex(sender->mFabric->mFabricIndex, sender->mNodeId, sender->mIsControl)];
+         *link != nullptr; link = &(*link)->mNextInBucket)
     {
-        if (list[peerIndex].mNodeId != kUndefinedNodeId)
+        if (*link == sender)
         {
-            continue;
+            *link = sender->mNextInBucket;
+            break;
         }
+    }
+    sender->mNextInBucket = nullptr;
+}
+
+void GroupPeerTable::ReleasePeer(GroupSender * sender)
+{
+    UnlinkFromBucket(sender);
+    Unlink(sender);
+    PeerCount(*sender->mFabric, sender->mIsControl)--;
+    mSenders.ReleaseObject(sender);
+}
 
-        for (uint32_t i = (size - 1); i > peerIndex; i--)
+void GroupPeerTable::ReleaseFabric(GroupFabric & fabric)
+{
+    for (bool isControl : { false, true })
+    {
+        while (fabric.mMostRecentlyUsed[isControl] != nullptr)
         {
-            if (list[i].mNodeId != kUndefinedNodeId)
-            {
-                // Logic works since all buffer are static
-                // move it up front
-                new (&list[peerIndex]) GroupSender(list[i]);
-                new (&list[i]) GroupSender();
-                break;
-            }
+            ReleasePeer(fabric.mMostRecentlyUsed[isControl]);
         }
     }
+    fabric = GroupFabric();
 }
 
-void GroupPeerTable::RemoveAndCompactFabric(uint32_t tableIndex)
+void GroupPeerTable::LinkMostRecentlyUsed(GroupSender * sender)
 {
-    if (tableIndex >= CHIP_CONFIG_MAX_FABRICS)
+    GroupFabric & fabric = *sender->mFabric;
+    GroupSender *& head  = fabric.mMostRecentlyUsed[sender->mIsControl];
+
+    sender->mMoreRecentlyUsed = nullptr;
+    sender->mLessRecentlyUsed = head;
+    if (head != nullptr)
     {
-        return;
+        head->mMoreRecentlyUsed = sender;
+    }
+    else
+    {
+        fabric.mLeastRecentlyUsed[sender->mIsControl] = sender;
+    }
+    head = sender;
+}
+
+void GroupPeerTable::Unlink(GroupSender * sender)
+{
+    GroupFabric & fabric = *sender->mFabric;
+
+    if (sender->mMoreRecentlyUsed != nullptr)
+    {
+        sender->mMoreRecentlyUsed->mLessRecentlyUsed = sender->mLessRecentlyUsed;
+    }
+    else
+    {
+        fabric.mMostRecentlyUsed[sender->mIsControl] = sender->mLessRecentlyUsed;
     }
-    mGroupFabrics[tableIndex].mFabricIndex = kUndefinedFabricIndex;
-    new (&mGroupFabrics[tableIndex]) GroupFabric();
 
-    // To maintain logic integrity Fabric array cannot have empty slot in between data
-    // Find the last non empty element
-    for (uint32_t i = CHIP_CONFIG_MAX_FABRICS - 1; i > tableIndex; i--)
+    if (sender->mLessRecentlyUsed != nullptr)
+    {
+        sender->mLessRecentlyUsed->mMoreRecentlyUsed = sender->mMoreRecentlyUsed;
+    }
+    else
     {
-        if (mGroupFabrics[i].mFabricIndex != kUndefinedFabricIndex)
+        fabric.mLeastRecentlyUsed[sender->mIsControl] = sender->mMoreRecentlyUsed;
+    }
+
+    sender->mMoreRecentlyUsed = nullptr;
+    sender->mLessRecentlyUsed = nullptr;
+}
+
+CHIP_ERROR GroupPeerTable::LoadCounters(GroupFabric & fabric)
+{
+    Platform::ScopedMemoryBuffer<uint8_t> buffer;
+    uint16_t size = static_cast<uint16_t>(kCountersMaxSize);
+    VerifyOrReturnError(buffer.Alloc(size), CHIP_ERROR_NO_MEMORY);
+
+    StorageKeyName key = DefaultStorageKeyAllocator::FabricGroupPeerCounters(fabric.mFabricIndex);
+    CHIP_ERROR err     = mStorage->SyncGetKeyValue(key.KeyName(), buffer.Get(), size);
+    VerifyOrReturnError(err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND, CHIP_NO_ERROR);
+    ReturnErrorOnFailure(err);
+
+    Encoding::LittleEndian::Reader reader(buffer.Get(), size);
+    uint8_t version = 0;
+    ReturnErrorOnFailure(reader.Read8(&version).StatusCode());
+    VerifyOrReturnError(version == kCountersVersion, CHIP_ERROR_VERSION_MISMATCH);
+
+    while (reader.Remaining() >= kCountersRecordSize)
+    {
+        NodeId nodeId    = kUndefinedNodeId;
+        uint32_t counter = 0;
+        uint8_t flags    = 0;
+        ReturnErrorOnFailure(reader.Read64(&nodeId).Read32(&counter).Read8(&flags).StatusCode());
+
+        bool isControl = (flags & kCountersFlagsControl) != 0;
+        VerifyOrReturnError(nodeId != kUndefinedNodeId, CHIP_ERROR_INVALID_ARGUMENT);
+        if (PeerCount(fabric, isControl) >= MaxPeerCount(isControl) || FindPeer(fabric.mFabricIndex, nodeId, isControl) != nullptr)
         {
-            // Logic works since all buffer are static
-            // move it up front
-            new (&mGroupFabrics[tableIndex]) GroupFabric(mGroupFabrics[i]);
-            new (&mGroupFabrics[i]) GroupFabric();
-            break;
+            continue;
         }
+
+        GroupSender * sender = nullptr;
+        ReturnErrorOnFailure(AddPeer(fabric, nodeId, isControl, sender));
+        sender->msgCounter.SetCounter(counter);
+        sender->mPersistedCounter = counter;
     }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR GroupPeerTable::StoreCounters(GroupFabric & fabric)
+{
+    size_t size = kCountersHeaderSize + kCountersRecordSize * (fabric.mDataPeerCount + fabric.mControlPeerCount);
+    Platform::ScopedMemoryBuffer<uint8_t> buffer;
+    VerifyOrReturnError(buffer.Alloc(size), CHIP_ERROR_NO_MEMORY);
+
+    Encoding::LittleEndian::BufferWriter writer(buffer.Get(), size);
+    writer.Put8(kCountersVersion);
+    for (bool isControl : { false, true })
+    {
+        for (GroupSender * sender = fabric.mMostRecentlyUsed[isControl]; sender != nullptr; sender = sender->mLessRecentlyUsed)
+        {
+            // A sender without a trusted counter yet has nothing to protect.
+            if (!sender->msgCounter.IsSynchronized())
+            {
+                continue;
+            }
+            sender->mPersistedCounter = sender->msgCounter.GetCounter();
+            writer.Put64(sender->mNodeId).Put32(sender->mPersistedCounter).Put8(isControl ? kCountersFlagsControl : 0);
+        }
+    }
+    VerifyOrReturnError(writer.Fit(), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    return mStorage->SyncSetKeyValue(DefaultStorageKeyAllocator::FabricGroupPeerCounters(fabric.mFabricIndex).KeyName(),
+                                     buffer.Get(), static_cast<uint16_t>(writer.Needed()));
 }
 
 GroupOutgoingCounters::GroupOutgoingCounters(chip::PersistentStorageDelegate * storage_delegate)
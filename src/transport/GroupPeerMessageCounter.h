@@ -21,13 +21,11 @@
  */
 #pragma once
 
-#include <array>
-#include <bitset>
-
 #include <lib/core/CHIPPersistentStorageDelegate.h>
 #include <lib/core/DataModelTypes.h>
 #include <lib/core/NodeId.h>
 #include <lib/core/PeerId.h>
+#include <lib/support/Pool.h>
 #include <lib/support/Span.h>
 #include <transport/PeerMessageCounter.h>
 
@@ -36,41 +34,137 @@
 namespace chip {
 namespace Transport {
 
+class GroupFabric;
+
+/**
+ * A node that sent group messages to this device, along with the message counter state of the messages it sent with the data
+ * or control group message counter.
+ */
 class GroupSender
 {
 public:
+    GroupSender(GroupFabric * fabric, NodeId nodeId, bool isControl) : mNodeId(nodeId), mIsControl(isControl), mFabric(fabric) {}
+
     NodeId mNodeId = kUndefinedNodeId;
+    bool mIsControl;
     PeerMessageCounter msgCounter;
+
+private:
+    friend class GroupPeerTable;
+
+    GroupFabric * mFabric;
+    // The counter value last written to storage, when the table persists counters.
+    uint32_t mPersistedCounter      = 0;
+    GroupSender * mNextInBucket     = nullptr;
+    GroupSender * mMoreRecentlyUsed = nullptr;
+    GroupSender * mLessRecentlyUsed = nullptr;
 };
 
 class GroupFabric
 {
 public:
-    FabricIndex mFabricIndex  = kUndefinedFabricIndex;
-    uint8_t mControlPeerCount = 0;
-    uint8_t mDataPeerCount    = 0;
-    GroupSender mDataGroupSenders[CHIP_CONFIG_MAX_GROUP_DATA_PEERS];
-    GroupSender mControlGroupSenders[CHIP_CONFIG_MAX_GROUP_CONTROL_PEERS];
+    FabricIndex mFabricIndex   = kUndefinedFabricIndex;
+    uint16_t mControlPeerCount = 0;
+    uint16_t mDataPeerCount    = 0;
+
+private:
+    friend class GroupPeerTable;
+
+    // The senders of the fabric from the most to the least recently used, for data and for control messages.
+    GroupSender * mMostRecentlyUsed[2]  = {};
+    GroupSender * mLeastRecentlyUsed[2] = {};
 };
 
+/**
+ * The message counters of the nodes that send group messages to this device.
+ *
+ * Senders are found through a hash table, and allocated from an ObjectPool, so they live on the heap when the pool does.
+ * A fabric tracks up to CHIP_CONFIG_MAX_GROUP_DATA_PEERS data senders and CHIP_CONFIG_MAX_GROUP_CONTROL_PEERS control
+ * senders. When CHIP_CONFIG_GROUP_PEER_TABLE_LRU_EVICTION is enabled, a new sender then replaces the least recently used one
+ * of the same kind. Otherwise it is rejected with CHIP_ERROR_TOO_MANY_PEER_NODES.
+ *
+ * The counter of a sender stays at the same address until the sender is removed or evicted.
+ */
 class GroupPeerTable
 {
 public:
+    struct Stats
+    {
+        size_t mFabricCount      = 0;
+        size_t mDataPeerCount    = 0;
+        size_t mControlPeerCount = 0;
+        // The highest number of senders tracked at once.
+        size_t mPeakPeerCount = 0;
+        // The number of senders replaced by a new sender because their fabric had no room left.
+        uint32_t mEvictionCount = 0;
+    };
+
+    GroupPeerTable() = default;
+    ~GroupPeerTable() { Shutdown(); }
+
+    GroupPeerTable(const GroupPeerTable &) = delete;
+    GroupPeerTable & operator=(const GroupPeerTable &) = delete;
+
+    /**
+     * Persist the counters of the senders to storage, and restore them when a fabric sends its first group message after a
+     * reboot. Without this, the first message of each sender is trusted after a reboot, so messages recorded before it can be
+     * replayed.
+     *
+     * The counters of a fabric are written when a sender's counter moved forward by CHIP_CONFIG_GROUP_PEER_COUNTER_PERSIST_INTERVAL
+     * since it was last written (see CommitCounter), so up to that many older messages of a sender are accepted after a reboot.
+     */
+    CHIP_ERROR Init(PersistentStorageDelegate * storage);
+
+    /**
+     * Forget all the senders, and stop persisting their counters.
+     */
+    void Shutdown();
+
+    CHIP_ERROR FindOrAddPeer(FabricIndex fabricIndex, NodeId nodeId, bool isControl, GroupSender *& sender);
     CHIP_ERROR FindOrAddPeer(FabricIndex fabricIndex, NodeId nodeId, bool isControl,
                              chip::Transport::PeerMessageCounter *& counter);
 
+    /**
+     * Commit a counter of the sender, verified with its msgCounter, and persist the counters of its fabric when due.
+     */
+    void CommitCounter(GroupSender & sender, uint32_t counter);
+
     // Used in case of MCSP failure
     CHIP_ERROR RemovePeer(FabricIndex fabricIndex, NodeId nodeId, bool isControl);
 
     CHIP_ERROR FabricRemoved(FabricIndex fabricIndex);
 
+    Stats GetStats() const;
+
     // Protected for Unit Tests inheritance
 protected:
-    bool RemoveSpecificPeer(GroupSender * list, NodeId nodeId, uint32_t size);
-    void CompactPeers(GroupSender * list, uint32_t size);
-    void RemoveAndCompactFabric(uint32_t tableIndex);
+    GroupSender * FindPeer(FabricIndex fabricIndex, NodeId nodeId, bool isControl) const;
+    GroupFabric * FindFabric(FabricIndex fabricIndex);
+
+private:
+    static constexpr size_t kBucketCount = CHIP_CONFIG_GROUP_PEER_TABLE_BUCKETS;
+    static constexpr size_t kMaxSenders =
+        CHIP_CONFIG_MAX_FABRICS * (CHIP_CONFIG_MAX_GROUP_DATA_PEERS + CHIP_CONFIG_MAX_GROUP_CONTROL_PEERS);
+
+    static size_t BucketIndex(FabricIndex fabricIndex, NodeId nodeId, bool isControl);
+
+    GroupFabric * FindOrAddFabric(FabricIndex fabricIndex, bool & added);
+    CHIP_ERROR AddPeer(GroupFabric & fabric, NodeId nodeId, bool isControl, GroupSender *& sender);
+    void UnlinkFromBucket(GroupSender * sender);
+    void ReleasePeer(GroupSender * sender);
+    void ReleaseFabric(GroupFabric & fabric);
+
+    void LinkMostRecentlyUsed(GroupSender * sender);
+    void Unlink(GroupSender * sender);
+
+    CHIP_ERROR LoadCounters(GroupFabric & fabric);
+    CHIP_ERROR StoreCounters(GroupFabric & fabric);
 
     GroupFabric mGroupFabrics[CHIP_CONFIG_MAX_FABRICS];
+    GroupSender * mBuckets[kBucketCount] = {};
+    ObjectPool<GroupSender, kMaxSenders> mSenders;
+    PersistentStorageDelegate * mStorage = nullptr;
+    uint32_t mEvictionCount              = 0;
 };
 
 // Might want to rename this so that it is explicitly the sending side of counters
@@ -100,6 +100,9 @@ CHIP_ERROR SessionManager::Init(System::Layer * systemLayer, TransportMgrBase *
     mGlobalUnencryptedMessageCounter.Init();
 
     ReturnErrorOnFailure(mGroupClientCounter.Init(storageDelegate));
+#if CHIP_CONFIG_PERSIST_GROUP_PEER_COUNTERS
+    ReturnErrorOnFailure(mGroupPeerMsgCounter.Init(storageDelegate));
+#endif // CHIP_CONFIG_PERSIST_GROUP_PEER_COUNTERS
 
     mTransportMgr->SetSessionManager(this);
 
@@ -122,6 +125,9 @@ void SessionManager::Shutdown()
         return Loop::Continue;
     });
 
+    // Release the group senders while the platform memory they may live in is still initialized.
+    mGroupPeerMsgCounter.Shutdown();
+
     mMessageCounterManager = nullptr;
 
     mSystemLayer  = nullptr;
@@ -918,16 +924,16 @@ void SessionManager::SecureGroupMessageDispatch(const PacketHeader & partialPack
 
     // Handle Group message counter here spec 4.7.3
     // spec 4.5.1.2 for msg counter
-    Transport::PeerMessageCounter * counter = nullptr;
+    Transport::GroupSender * sender = nullptr;
 
     if (CHIP_NO_ERROR ==
         mGroupPeerMsgCounter.FindOrAddPeer(groupContext.fabric_index, packetHeaderCopy.GetSourceNodeId().Value(),
-                                           packetHeaderCopy.IsSecureSessionControlMsg(), counter))
+                                           packetHeaderCopy.IsSecureSessionControlMsg(), sender))
     {
 
         if (Credentials::GroupDataProvider::SecurityPolicy::kTrustFirst == groupContext.security_policy)
         {
-            err = counter->VerifyOrTrustFirstGroup(packetHeaderCopy.GetMessageCounter());
+            err = sender->msgCounter.VerifyOrTrustFirstGroup(packetHeaderCopy.GetMessageCounter());
         }
         else
         {
@@ -937,7 +943,7 @@ void SessionManager::SecureGroupMessageDispatch(const PacketHeader & partialPack
             return;
 
             // cache and sync
-            // err = counter->VerifyGroup(packetHeaderCopy.GetMessageCounter());
+            // err = sender->msgCounter.VerifyGroup(packetHeaderCopy.GetMessageCounter());
         }
 
         if (err != CHIP_NO_ERROR)
@@ -954,7 +960,7 @@ void SessionManager::SecureGroupMessageDispatch(const PacketHeader & partialPack
         return;
     }
 
-    counter->CommitGroup(packetHeaderCopy.GetMessageCounter());
+    mGroupPeerMsgCounter.CommitCounter(*sender, packetHeaderCopy.GetMessageCounter());
 
     if (mCB != nullptr)
     {
@@ -140,11 +140,9 @@ TCPBase::ActiveConnectionState * TCPBase::FindActiveConnection(const PeerAddress
         {
             continue;
         }
-        Inet::IPAddress addr;
-        uint16_t port;
-        mActiveConnections[i].mEndPoint->GetPeerInfo(&addr, &port);
 
-        if ((addr == address.GetIPAddress()) && (port == address.GetPort()))
+        const PeerAddress & peerAddr = mActiveConnections[i].mPeerAddr;
+        if ((peerAddr.GetIPAddress() == address.GetIPAddress()) && (peerAddr.GetPort() == address.GetPort()))
         {
             return &mActiveConnections[i];
         }
@@ -165,6 +163,30 @@ TCPBase::ActiveConnectionState * TCPBase::FindActiveConnection(const Inet::TCPEn
     return nullptr;
 }
 
+bool TCPBase::StoreActiveConnection(Inet::TCPEndPoint * endPoint)
+{
+    for (size_t i = 0; i < mActiveConnectionsSize; i++)
+    {
+        if (!mActiveConnections[i].InUse())
+        {
+            mActiveConnections[i].Init(endPoint, GetPeerAddress(endPoint));
+            return true;
+        }
+    }
+    return false;
+}
+
+PeerAddress TCPBase::GetPeerAddress(Inet::TCPEndPoint * endPoint)
+{
+    Inet::IPAddress ipAddress;
+    uint16_t port;
+    Inet::InterfaceId interfaceId;
+
+    endPoint->GetPeerInfo(&ipAddress, &port);
+    endPoint->GetInterfaceId(&interfaceId);
+    return PeerAddress::TCP(ipAddress, port, interfaceId);
+}
+
 CHIP_ERROR TCPBase::SendMessage(const Transport::PeerAddress & address, System::PacketBufferHandle && msgBuf)
 {
     // Sent buffer data format is:
@@ -327,16 +349,12 @@ CHIP_ERROR TCPBase::ProcessSingleMessage(const PeerAddress & peerAddress, Active
 
 CHIP_ERROR TCPBase::OnTcpReceive(Inet::TCPEndPoint * endPoint, System::PacketBufferHandle && buffer)
 {
-    Inet::IPAddress ipAddress;
-    uint16_t port;
-    Inet::InterfaceId interfaceId;
+    TCPBase * tcp                 = reinterpret_cast<TCPBase *>(endPoint->mAppState);
+    ActiveConnectionState * state = tcp->FindActiveConnection(endPoint);
 
-    endPoint->GetPeerInfo(&ipAddress, &port);
-    endPoint->GetInterfaceId(&interfaceId);
-    PeerAddress peerAddress = PeerAddress::TCP(ipAddress, port, interfaceId);
-
-    TCPBase * tcp  = reinterpret_cast<TCPBase *>(endPoint->mAppState);
-    CHIP_ERROR err = tcp->ProcessReceivedBuffer(endPoint, peerAddress, std::move(buffer));
+    // Use the peer address cached when the connection was stored, rather than querying the socket for every buffer.
+    PeerAddress peerAddress = (state != nullptr) ? state->mPeerAddr : GetPeerAddress(endPoint);
+    CHIP_ERROR err          = tcp->ProcessReceivedBuffer(endPoint, peerAddress, std::move(buffer));
 
     if (err != CHIP_NO_ERROR)
     {
@@ -352,13 +370,7 @@ void TCPBase::OnConnectionComplete(Inet::TCPEndPoint * endPoint, CHIP_ERROR inet
     CHIP_ERROR err          = CHIP_NO_ERROR;
     bool foundPendingPacket = false;
     TCPBase * tcp           = reinterpret_cast<TCPBase *>(endPoint->mAppState);
-    Inet::IPAddress ipAddress;
-    uint16_t port;
-    Inet::InterfaceId interfaceId;
-
-    endPoint->GetPeerInfo(&ipAddress, &port);
-    endPoint->GetInterfaceId(&interfaceId);
-    PeerAddress addr = PeerAddress::TCP(ipAddress, port, interfaceId);
+    PeerAddress addr        = GetPeerAddress(endPoint);
 
     // Send any pending packets
     tcp->mPendingPackets.ForEachActiveObject([&](PendingPacket * pending) {
@@ -398,20 +410,9 @@ void TCPBase::OnConnectionComplete(Inet::TCPEndPoint * endPoint, CHIP_ERROR inet
     }
     else
     {
-        bool connectionStored = false;
-        for (size_t i = 0; i < tcp->mActiveConnectionsSize; i++)
-        {
-            if (!tcp->mActiveConnections[i].InUse())
-            {
-                tcp->mActiveConnections[i].Init(endPoint);
-                connectionStored = true;
-                break;
-            }
-        }
-
         // since we track end points counts, we always expect to store the
         // connection.
-        if (!connectionStored)
+        if (!tcp->StoreActiveConnection(endPoint))
         {
             endPoint->Free();
             ChipLogError(Inet, "Internal logic error: insufficient space to store active connection");
@@ -444,14 +445,7 @@ void TCPBase::OnConnectionReceived(Inet::TCPEndPoint * listenEndPoint, Inet::TCP
     if (tcp->mUsedEndPointCount < tcp->mActiveConnectionsSize)
     {
         // have space to use one more (even if considering pending connections)
-        for (size_t i = 0; i < tcp->mActiveConnectionsSize; i++)
-        {
-            if (!tcp->mActiveConnections[i].InUse())
-            {
-                tcp->mActiveConnections[i].Init(endPoint);
-                break;
-            }
-        }
+        tcp->StoreActiveConnection(endPoint);
 
         endPoint->mAppState            = listenEndPoint->mAppState;
         endPoint->OnDataReceived       = OnTcpReceive;
@@ -478,22 +472,13 @@ void TCPBase::Disconnect(const PeerAddress & address)
     // Closes an existing connection
     for (size_t i = 0; i < mActiveConnectionsSize; i++)
     {
-        if (mActiveConnections[i].InUse())
+        if (mActiveConnections[i].InUse() && (address == mActiveConnections[i].mPeerAddr))
         {
-            Inet::IPAddress ipAddress;
-            uint16_t port;
-            Inet::InterfaceId interfaceId;
-
-            mActiveConnections[i].mEndPoint->GetPeerInfo(&ipAddress, &port);
-            mActiveConnections[i].mEndPoint->GetInterfaceId(&interfaceId);
-            if (address == PeerAddress::TCP(ipAddress, port, interfaceId))
-            {
-                // NOTE: this leaves the socket in TIME_WAIT.
-                // Calling Abort() would clean it since SO_LINGER would be set to 0,
-                // however this seems not to be useful.
-                mActiveConnections[i].Free();
-                mUsedEndPointCount--;
-            }
+            // NOTE: this leaves the socket in TIME_WAIT.
+            // Calling Abort() would clean it since SO_LINGER would be set to 0,
+            // however this seems not to be useful.
+            mActiveConnections[i].Free();
+            mUsedEndPointCount--;
         }
     }
 }
@@ -111,9 +111,10 @@ protected:
      */
     struct ActiveConnectionState
     {
-        void Init(Inet::TCPEndPoint * endPoint)
+        void Init(Inet::TCPEndPoint * endPoint, const PeerAddress & peerAddress)
         {
             mEndPoint = endPoint;
+            mPeerAddr = peerAddress;
             mReceived = nullptr;
         }
 
@@ -121,6 +122,7 @@ protected:
         {
             mEndPoint->Free();
             mEndPoint = nullptr;
+            mPeerAddr = PeerAddress::Uninitialized();
             mReceived = nullptr;
         }
         bool InUse() const { return mEndPoint != nullptr; }
@@ -128,6 +130,10 @@ protected:
         // Associated endpoint.
         Inet::TCPEndPoint * mEndPoint;
 
+        // Peer address of the endpoint, cached when the connection is stored so that lookups
+        // on the send and receive paths do not need to query the socket.
+        PeerAddress mPeerAddr;
+
         // Buffers received but not yet consumed.
         System::PacketBufferHandle mReceived;
     };
@@ -190,6 +196,18 @@ private:
     ActiveConnectionState * FindActiveConnection(const PeerAddress & addr);
     ActiveConnectionState * FindActiveConnection(const Inet::TCPEndPoint * endPoint);
 
+    /**
+     * Store a newly established connection in the first free active connection slot.
+     *
+     * @return true if the connection was stored, false if no slot was available.
+     */
+    bool StoreActiveConnection(Inet::TCPEndPoint * endPoint);
+
+    /**
+     * Builds the transport peer address of a connected endpoint.
+     */
+    static PeerAddress GetPeerAddress(Inet::TCPEndPoint * endPoint);
+
     /**
      * Sends the specified message once a connection has been established.
      *
@@ -273,7 +291,7 @@ public:
     {
         for (size_t i = 0; i < kActiveConnectionsSize; ++i)
         {
-            mConnectionsBuffer[i].Init(nullptr);
+            mConnectionsBuffer[i].Init(nullptr, PeerAddress::Uninitialized());
         }
     }
     ~TCP() override { mPendingPackets.ReleaseAll(); }
@@ -108,6 +108,7 @@ public:
             ReturnErrorOnFailure(mMessageSendError);
         }
         mSentMessageCount++;
+        mSentByteCount += msgBuf->TotalLength();
         bool dropMessage = false;
         if (mNumMessagesToAllowBeforeError > 0)
         {
@@ -147,6 +148,7 @@ public:
         mNumMessagesToDrop                = 0;
         mDroppedMessageCount              = 0;
         mSentMessageCount                 = 0;
+        mSentByteCount                    = 0;
         mNumMessagesToAllowBeforeDropping = 0;
         mNumMessagesToAllowBeforeError    = 0;
         mMessageSendError                 = CHIP_NO_ERROR;
@@ -167,6 +169,7 @@ public:
     uint32_t mNumMessagesToDrop                = 0;
     uint32_t mDroppedMessageCount              = 0;
     uint32_t mSentMessageCount                 = 0;
+    uint64_t mSentByteCount                    = 0;
     uint32_t mNumMessagesToAllowBeforeDropping = 0;
     uint32_t mNumMessagesToAllowBeforeError    = 0;
     CHIP_ERROR mMessageSendError               = CHIP_NO_ERROR;
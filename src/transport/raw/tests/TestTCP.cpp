@@ -161,6 +161,37 @@ public:
         SetCallback(nullptr);
     }
 
+    void PipelinedMessagesTest(TCPImpl & tcp, const IPAddress & addr, int messageCount)
+    {
+        SetCallback([](const uint8_t * message, size_t length, int count, void * data) { return memcmp(message, data, length); },
+                    const_cast<void *>(static_cast<const void *>(PAYLOAD)));
+
+        // Queue all messages without driving IO in between, so that they are sent back to back
+        // on the same connection (the first ones while the connection is still being established).
+        for (int i = 0; i < messageCount; ++i)
+        {
+            chip::System::PacketBufferHandle buffer = chip::System::PacketBufferHandle::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+            NL_TEST_ASSERT(mSuite, !buffer.IsNull());
+
+            PacketHeader header;
+            header.SetSourceNodeId(kSourceNodeId)
+                .SetDestinationNodeId(kDestinationNodeId)
+                .SetMessageCounter(kMessageCounter + static_cast<uint32_t>(i));
+
+            CHIP_ERROR err = header.EncodeBeforeData(buffer);
+            NL_TEST_ASSERT(mSuite, err == CHIP_NO_ERROR);
+
+            err = tcp.SendMessage(Transport::PeerAddress::TCP(addr), std::move(buffer));
+            NL_TEST_ASSERT(mSuite, err == CHIP_NO_ERROR);
+        }
+
+        mContext.DriveIOUntil(chip::System::Clock::Seconds16(5),
+                              [this, messageCount]() { return mReceiveHandlerCallCount == messageCount; });
+        NL_TEST_ASSERT(mSuite, mReceiveHandlerCallCount == messageCount);
+
+        SetCallback(nullptr);
+    }
+
     void FinalizeMessageTest(TCPImpl & tcp, const IPAddress & addr)
     {
         // Disconnect and wait for seeing peer close
@@ -232,6 +263,22 @@ void CheckMessageTest6(nlTestSuite * inSuite, void * inContext)
     CheckMessageTest(inSuite, inContext, addr);
 }
 
+/////////////////////////// Pipelined messaging test
+
+void CheckPipelinedMessageTest(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+    TCPImpl tcp;
+
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+
+    MockTransportMgrDelegate gMockTransportMgrDelegate(inSuite, ctx);
+    gMockTransportMgrDelegate.InitializeMessageTest(tcp, addr);
+    gMockTransportMgrDelegate.PipelinedMessagesTest(tcp, addr, 16);
+    gMockTransportMgrDelegate.FinalizeMessageTest(tcp, addr);
+}
+
 // Generates a packet buffer or a chain of packet buffers for a single message.
 struct TestData
 {
@@ -467,6 +514,7 @@ static const nlTest sTests[] =
 
     NL_TEST_DEF("Simple Init Test IPV6",        CheckSimpleInitTest6),
     NL_TEST_DEF("Message Self Test IPV6",       CheckMessageTest6),
+    NL_TEST_DEF("Pipelined Message Test",       CheckPipelinedMessageTest),
     NL_TEST_DEF("ProcessReceivedBuffer Test",   chip::Transport::TCPTest::CheckProcessReceivedBuffer),
 
     NL_TEST_SENTINEL()
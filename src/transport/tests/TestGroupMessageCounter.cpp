@@ -21,6 +21,7 @@
  *      This file implements unit tests for the SessionManager implementation.
  */
 
+#include <lib/support/CHIPMem.h>
 #include <lib/support/DefaultStorageKeyAllocator.h>
 #include <lib/support/TestPersistentStorageDelegate.h>
 #include <lib/support/UnitTestRegistration.h>
@@ -73,31 +74,10 @@ class TestGroupPeerTable : public chip::Transport::GroupPeerTable
 {
 public:
     TestGroupPeerTable(){};
-    FabricIndex GetFabricIndexAt(uint8_t index)
+    bool HasFabric(FabricIndex fabricIndex) { return FindFabric(fabricIndex) != nullptr; }
+    bool HasPeer(FabricIndex fabricIndex, NodeId nodeId, bool isControl)
     {
-        if (index < CHIP_CONFIG_MAX_FABRICS)
-        {
-            return mGroupFabrics[index].mFabricIndex;
-        }
-
-        return kUndefinedFabricIndex;
-    }
-    NodeId GetNodeIdAt(uint8_t fabricIndex, uint8_t index, bool isControl)
-    {
-        if (fabricIndex < CHIP_CONFIG_MAX_FABRICS)
-        {
-            if (isControl && index < CHIP_CONFIG_MAX_GROUP_CONTROL_PEERS)
-            {
-                return mGroupFabrics[fabricIndex].mControlGroupSenders[index].mNodeId;
-            }
-
-            if (!isControl && index < CHIP_CONFIG_MAX_GROUP_DATA_PEERS)
-            {
-                return mGroupFabrics[fabricIndex].mDataGroupSenders[index].mNodeId;
-            }
-        }
-
-        return kUndefinedNodeId;
+        return FindPeer(fabricIndex, nodeId, isControl) != nullptr;
     }
 };
 
@@ -108,8 +88,23 @@ void AddPeerTest(nlTestSuite * inSuite, void * inContext)
     uint32_t i                                    = 0;
     CHIP_ERROR err                                = CHIP_NO_ERROR;
     chip::Transport::PeerMessageCounter * counter = nullptr;
-    chip::Transport::GroupPeerTable mGroupPeerMsgCounter;
+    TestGroupPeerTable mGroupPeerMsgCounter;
 
+#if CHIP_CONFIG_GROUP_PEER_TABLE_LRU_EVICTION
+    for (i = 0; i < CHIP_CONFIG_MAX_GROUP_DATA_PEERS; i++)
+    {
+        err = mGroupPeerMsgCounter.FindOrAddPeer(fabricIndex, peerNodeId++, false, counter);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    }
+
+    // The fabric is full: the least recently used peer, which is the first one, makes room for the new one.
+    err = mGroupPeerMsgCounter.FindOrAddPeer(fabricIndex, peerNodeId, false, counter);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, !mGroupPeerMsgCounter.HasPeer(fabricIndex, 1234, false));
+    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.HasPeer(fabricIndex, 1235, false));
+    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.HasPeer(fabricIndex, peerNodeId, false));
+    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.GetStats().mEvictionCount == 1);
+#else
     do
     {
         err = mGroupPeerMsgCounter.FindOrAddPeer(fabricIndex, peerNodeId++, false, counter);
@@ -118,7 +113,10 @@ void AddPeerTest(nlTestSuite * inSuite, void * inContext)
     } while (err != CHIP_ERROR_TOO_MANY_PEER_NODES);
 
     NL_TEST_ASSERT(inSuite, i == CHIP_CONFIG_MAX_GROUP_DATA_PEERS + 1);
+#endif // CHIP_CONFIG_GROUP_PEER_TABLE_LRU_EVICTION
+    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.GetStats().mDataPeerCount == CHIP_CONFIG_MAX_GROUP_DATA_PEERS);
 
+    // Fabrics are never evicted
     i = 1;
     do
     {
@@ -185,8 +183,10 @@ void RemovePeerTest(nlTestSuite * inSuite, void * inContext)
     err = mGroupPeerMsgCounter.FabricRemoved(99);
     NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_NOT_FOUND);
 
-    // Verify that the Fabric List was compacted.
-    NL_TEST_ASSERT(inSuite, 106 == mGroupPeerMsgCounter.GetFabricIndexAt(0));
+    NL_TEST_ASSERT(inSuite, !mGroupPeerMsgCounter.HasFabric(99));
+    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.HasFabric(104));
+    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.HasFabric(105));
+    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.HasFabric(106));
 }
 
 void PeerRetrievalTest(nlTestSuite * inSuite, void * inContext)
@@ -322,7 +322,8 @@ void ReorderPeerRemovalTest(nlTestSuite * inSuite, void * inContext)
     err = mGroupPeerMsgCounter.FindOrAddPeer(1, 2, true, counter);
     err = mGroupPeerMsgCounter.RemovePeer(1, 1, true);
 
-    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.GetNodeIdAt(0, 0, true) == 2);
+    NL_TEST_ASSERT(inSuite, !mGroupPeerMsgCounter.HasPeer(1, 1, true));
+    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.HasPeer(1, 2, true));
 
     // with other list
     err = mGroupPeerMsgCounter.FindOrAddPeer(2, 1, false, counter);
@@ -337,15 +338,25 @@ void ReorderPeerRemovalTest(nlTestSuite * inSuite, void * inContext)
 
     err = mGroupPeerMsgCounter.RemovePeer(2, 7, false);
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
-    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.GetNodeIdAt(1, 6, false) == 9);
+    NL_TEST_ASSERT(inSuite, !mGroupPeerMsgCounter.HasPeer(2, 7, false));
+    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.HasPeer(2, 9, false));
 
     err = mGroupPeerMsgCounter.RemovePeer(2, 4, false);
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
-    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.GetNodeIdAt(1, 3, false) == 8);
+    NL_TEST_ASSERT(inSuite, !mGroupPeerMsgCounter.HasPeer(2, 4, false));
+    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.HasPeer(2, 8, false));
 
     err = mGroupPeerMsgCounter.RemovePeer(2, 1, false);
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
-    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.GetNodeIdAt(1, 0, false) == 9);
+    NL_TEST_ASSERT(inSuite, !mGroupPeerMsgCounter.HasPeer(2, 1, false));
+
+    err = mGroupPeerMsgCounter.RemovePeer(2, 1, false);
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_NOT_FOUND);
+
+    // The peers of the other list and fabric are untouched
+    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.HasPeer(1, 2, true));
+    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.GetStats().mDataPeerCount == 6);
+    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.GetStats().mControlPeerCount == 1);
 }
 
 void ReorderFabricRemovalTest(nlTestSuite * inSuite, void * inContext)
@@ -367,7 +378,7 @@ void ReorderFabricRemovalTest(nlTestSuite * inSuite, void * inContext)
 
     err = mGroupPeerMsgCounter.FabricRemoved(CHIP_CONFIG_MAX_FABRICS);
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
-    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.GetFabricIndexAt(CHIP_CONFIG_MAX_FABRICS - 1) == kUndefinedFabricIndex);
+    NL_TEST_ASSERT(inSuite, !mGroupPeerMsgCounter.HasFabric(CHIP_CONFIG_MAX_FABRICS));
 
     err = mGroupPeerMsgCounter.FindOrAddPeer(CHIP_CONFIG_MAX_FABRICS, 1, false, counter);
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
@@ -387,18 +398,185 @@ void ReorderFabricRemovalTest(nlTestSuite * inSuite, void * inContext)
     // Per Spec CHIP_CONFIG_MAX_FABRICS can only be as low as 4
     err = mGroupPeerMsgCounter.RemovePeer(3, 1, false);
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
-    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.GetFabricIndexAt(2) == CHIP_CONFIG_MAX_FABRICS);
+    NL_TEST_ASSERT(inSuite, !mGroupPeerMsgCounter.HasFabric(3));
+    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.HasFabric(CHIP_CONFIG_MAX_FABRICS));
     err = mGroupPeerMsgCounter.RemovePeer(2, 1, false);
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
-    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.GetFabricIndexAt(1) == CHIP_CONFIG_MAX_FABRICS - 1);
+    NL_TEST_ASSERT(inSuite, !mGroupPeerMsgCounter.HasFabric(2));
+    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.HasFabric(CHIP_CONFIG_MAX_FABRICS - 1));
 
-    // Validate that counter value were moved around correctly
+    // Validate that counter value were kept
     err = mGroupPeerMsgCounter.FindOrAddPeer(CHIP_CONFIG_MAX_FABRICS, 1, false, counter);
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
     err = counter->VerifyOrTrustFirstGroup(4756);
     NL_TEST_ASSERT(inSuite, err != CHIP_NO_ERROR);
 }
 
+#if CHIP_CONFIG_GROUP_PEER_TABLE_LRU_EVICTION
+void LruEvictionTest(nlTestSuite * inSuite, void * inContext)
+{
+    CHIP_ERROR err                                = CHIP_NO_ERROR;
+    chip::Transport::PeerMessageCounter * counter = nullptr;
+    chip::Transport::PeerMessageCounter * first   = nullptr;
+    TestGroupPeerTable mGroupPeerMsgCounter;
+
+    for (NodeId nodeId = 1; nodeId <= CHIP_CONFIG_MAX_GROUP_DATA_PEERS; nodeId++)
+    {
+        err = mGroupPeerMsgCounter.FindOrAddPeer(1, nodeId, false, counter);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    }
+
+    // A message from the first peer makes the second one the least recently used.
+    err = mGroupPeerMsgCounter.FindOrAddPeer(1, 1, false, first);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, first->VerifyOrTrustFirstGroup(5656) == CHIP_NO_ERROR);
+    first->CommitGroup(5656);
+
+    // Control peers are evicted separately
+    err = mGroupPeerMsgCounter.FindOrAddPeer(1, 2, true, counter);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = mGroupPeerMsgCounter.FindOrAddPeer(1, 1000, false, counter);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, !mGroupPeerMsgCounter.HasPeer(1, 2, false));
+    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.HasPeer(1, 2, true));
+    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.HasPeer(1, 1, false));
+
+    // The counter of a peer that was not evicted is unchanged
+    err = mGroupPeerMsgCounter.FindOrAddPeer(1, 1, false, counter);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, counter == first);
+    NL_TEST_ASSERT(inSuite, counter->VerifyOrTrustFirstGroup(5656) != CHIP_NO_ERROR);
+
+    // Peers of other fabrics are not evicted
+    err = mGroupPeerMsgCounter.FindOrAddPeer(2, 1, false, counter);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = mGroupPeerMsgCounter.FindOrAddPeer(1, 1001, false, counter);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.HasPeer(2, 1, false));
+    NL_TEST_ASSERT(inSuite, !mGroupPeerMsgCounter.HasPeer(1, 3, false));
+
+    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.GetStats().mEvictionCount == 2);
+}
+#endif // CHIP_CONFIG_GROUP_PEER_TABLE_LRU_EVICTION
+
+void StatsTest(nlTestSuite * inSuite, void * inContext)
+{
+    chip::Transport::PeerMessageCounter * counter = nullptr;
+    chip::Transport::GroupPeerTable mGroupPeerMsgCounter;
+
+    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.FindOrAddPeer(1, 1, false, counter) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.FindOrAddPeer(1, 2, false, counter) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.FindOrAddPeer(1, 1, true, counter) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.FindOrAddPeer(2, 1, false, counter) == CHIP_NO_ERROR);
+
+    chip::Transport::GroupPeerTable::Stats stats = mGroupPeerMsgCounter.GetStats();
+    NL_TEST_ASSERT(inSuite, stats.mFabricCount == 2);
+    NL_TEST_ASSERT(inSuite, stats.mDataPeerCount == 3);
+    NL_TEST_ASSERT(inSuite, stats.mControlPeerCount == 1);
+    NL_TEST_ASSERT(inSuite, stats.mPeakPeerCount == 4);
+    NL_TEST_ASSERT(inSuite, stats.mEvictionCount == 0);
+
+    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.FabricRemoved(1) == CHIP_NO_ERROR);
+
+    stats = mGroupPeerMsgCounter.GetStats();
+    NL_TEST_ASSERT(inSuite, stats.mFabricCount == 1);
+    NL_TEST_ASSERT(inSuite, stats.mDataPeerCount == 1);
+    NL_TEST_ASSERT(inSuite, stats.mControlPeerCount == 0);
+    NL_TEST_ASSERT(inSuite, stats.mPeakPeerCount == 4);
+}
+
+#if CHIP_CONFIG_MAX_GROUP_DATA_PEERS >= 500
+void ManySendersTest(nlTestSuite * inSuite, void * inContext)
+{
+    // The switches and sensors of a large installation, all sending group messages on the same fabric.
+    constexpr NodeId kSenderCount         = 500;
+    chip::Transport::GroupSender * sender = nullptr;
+    chip::Transport::GroupPeerTable mGroupPeerMsgCounter;
+
+    for (uint32_t round = 1; round <= 2; round++)
+    {
+        for (NodeId nodeId = 1; nodeId <= kSenderCount; nodeId++)
+        {
+            const uint32_t messageCounter = static_cast<uint32_t>(round * 1000 + nodeId);
+            NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.FindOrAddPeer(1, nodeId, false, sender) == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(inSuite, sender->msgCounter.VerifyOrTrustFirstGroup(messageCounter) == CHIP_NO_ERROR);
+            mGroupPeerMsgCounter.CommitCounter(*sender, messageCounter);
+        }
+    }
+
+    // Every sender kept its counter, so none of their messages can be replayed.
+    for (NodeId nodeId = 1; nodeId <= kSenderCount; nodeId++)
+    {
+        NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.FindOrAddPeer(1, nodeId, false, sender) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite,
+                       sender->msgCounter.VerifyOrTrustFirstGroup(static_cast<uint32_t>(2000 + nodeId)) ==
+                           CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED);
+        NL_TEST_ASSERT(inSuite,
+                       sender->msgCounter.VerifyOrTrustFirstGroup(static_cast<uint32_t>(1000 + nodeId)) ==
+                           CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED);
+    }
+
+    chip::Transport::GroupPeerTable::Stats stats = mGroupPeerMsgCounter.GetStats();
+    NL_TEST_ASSERT(inSuite, stats.mDataPeerCount == kSenderCount);
+    NL_TEST_ASSERT(inSuite, stats.mEvictionCount == 0);
+}
+#endif // CHIP_CONFIG_MAX_GROUP_DATA_PEERS >= 500
+
+void CounterPersistenceTest(nlTestSuite * inSuite, void * inContext)
+{
+    chip::TestPersistentStorageDelegate delegate;
+    chip::Transport::GroupSender * sender = nullptr;
+    const uint32_t committed              = 5000 + CHIP_CONFIG_GROUP_PEER_COUNTER_PERSIST_INTERVAL;
+
+    {
+        chip::Transport::GroupPeerTable mGroupPeerMsgCounter;
+        NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.Init(&delegate) == CHIP_NO_ERROR);
+
+        NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.FindOrAddPeer(1, 99, false, sender) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, sender->msgCounter.VerifyOrTrustFirstGroup(5000) == CHIP_NO_ERROR);
+        mGroupPeerMsgCounter.CommitCounter(*sender, 5000);
+
+        // The first counter of a peer is persisted right away
+        NL_TEST_ASSERT(inSuite, delegate.HasKey(DefaultStorageKeyAllocator::FabricGroupPeerCounters(1).KeyName()));
+
+        NL_TEST_ASSERT(inSuite, sender->msgCounter.VerifyOrTrustFirstGroup(committed) == CHIP_NO_ERROR);
+        mGroupPeerMsgCounter.CommitCounter(*sender, committed);
+
+        NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.FindOrAddPeer(1, 100, true, sender) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.FindOrAddPeer(2, 99, false, sender) == CHIP_NO_ERROR);
+
+        // Removing a peer persists the counters of the fabric without it
+        NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.FindOrAddPeer(1, 101, false, sender) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, sender->msgCounter.VerifyOrTrustFirstGroup(7000) == CHIP_NO_ERROR);
+        mGroupPeerMsgCounter.CommitCounter(*sender, 7000);
+        NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.RemovePeer(1, 101, false) == CHIP_NO_ERROR);
+    }
+
+    // After a reboot, messages sent before the persisted counter are rejected
+    {
+        chip::Transport::GroupPeerTable mGroupPeerMsgCounter;
+        NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.Init(&delegate) == CHIP_NO_ERROR);
+
+        NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.FindOrAddPeer(1, 99, false, sender) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, sender->msgCounter.IsSynchronized());
+        NL_TEST_ASSERT(inSuite, sender->msgCounter.VerifyOrTrustFirstGroup(committed) != CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, sender->msgCounter.VerifyOrTrustFirstGroup(committed + 1) == CHIP_NO_ERROR);
+
+        // Peers whose counter was never verified, or that were removed, are trusted again on their first message
+        NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.FindOrAddPeer(1, 100, true, sender) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, !sender->msgCounter.IsSynchronized());
+        NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.FindOrAddPeer(1, 101, false, sender) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, !sender->msgCounter.IsSynchronized());
+        NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.FindOrAddPeer(2, 99, false, sender) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, !sender->msgCounter.IsSynchronized());
+
+        // Removing the fabric forgets its counters
+        NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.FabricRemoved(1) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, !delegate.HasKey(DefaultStorageKeyAllocator::FabricGroupPeerCounters(1).KeyName()));
+    }
+}
+
 void GroupMessageCounterTest(nlTestSuite * inSuite, void * inContext)
 {
 
@@ -453,6 +631,17 @@ void GroupMessageCounterTest(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, groupCientCounter5.GetCounter(false) == (UINT32_MAX + GROUP_MSG_COUNTER_MIN_INCREMENT));
 }
 
+int Initialize(void * aContext)
+{
+    return chip::Platform::MemoryInit() == CHIP_NO_ERROR ? SUCCESS : FAILURE;
+}
+
+int Finalize(void * aContext)
+{
+    chip::Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
 } // namespace
 
 /**
@@ -468,6 +657,14 @@ const nlTest sTests[] =
     NL_TEST_DEF("Counter Trust first",    CounterTrustFirstTest),
     NL_TEST_DEF("Reorder Peer removal",   ReorderPeerRemovalTest),
     NL_TEST_DEF("Reorder Fabric Removal", ReorderFabricRemovalTest),
+#if CHIP_CONFIG_GROUP_PEER_TABLE_LRU_EVICTION
+    NL_TEST_DEF("LRU eviction",           LruEvictionTest),
+#endif // CHIP_CONFIG_GROUP_PEER_TABLE_LRU_EVICTION
+    NL_TEST_DEF("Stats",                  StatsTest),
+#if CHIP_CONFIG_MAX_GROUP_DATA_PEERS >= 500
+    NL_TEST_DEF("Many senders",           ManySendersTest),
+#endif // CHIP_CONFIG_MAX_GROUP_DATA_PEERS >= 500
+    NL_TEST_DEF("Counter persistence",    CounterPersistenceTest),
     NL_TEST_DEF("Group Message Counter",  GroupMessageCounterTest),
     NL_TEST_SENTINEL()
 };
@@ -480,7 +677,7 @@ int TestGroupMessageCounter()
 {
     // Run test suit against one context
 
-    nlTestSuite theSuite = { "Transport-TestGroupMessageCounter", &sTests[0], nullptr, nullptr };
+    nlTestSuite theSuite = { "Transport-TestGroupMessageCounter", &sTests[0], Initialize, Finalize };
     nlTestRunner(&theSuite, nullptr);
 
     return (nlTestRunnerStats(&theSuite));